@@ -0,0 +1,178 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Hardware/LinuxProcCpuInfoReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../../Tests/Hardware/CapturedCpuInfo.h"
+
+#include <celero/Celero.h>
+
+#include <string> // for std::string
+#include <string_view> // for std::string_view
+#include <cstring> // for std::memchr()
+#include <stdexcept> // for std::logic_error
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Number of times the captured server's processors are repeated</summary>
+  const std::size_t ServerRepetitionCount = 8;
+
+  /// <summary>Number of processors in the captured server's /proc/cpuinfo</summary>
+  const std::size_t CapturedServerProcessorCount = 32;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Counts the processors reported by the /proc/cpuinfo parser</summary>
+  /// <param name="countAsVoid">Counter that will be incremented</param>
+  /// <param name="processorIndex">Index of the processor</param>
+  /// <param name="physicalCpuId">Id of the physical CPU the processor belongs to</param>
+  /// <param name="coreId">Id of the core the processor belongs to</param>
+  /// <param name="name">Make and model of the CPU</param>
+  /// <param name="frequencyInMhz">Current frequency of the processor</param>
+  /// <param name="bogoMips">Rough benchmark value of the processor</param>
+  void countProcessor(
+    void *countAsVoid,
+    std::size_t processorIndex,
+    std::size_t physicalCpuId,
+    std::size_t coreId,
+    const std::string_view &name,
+    double frequencyInMhz,
+    double bogoMips
+  ) {
+    (void)processorIndex;
+    (void)physicalCpuId;
+    (void)coreId;
+    (void)name;
+    (void)frequencyInMhz;
+    (void)bogoMips;
+
+    ++(*reinterpret_cast<std::size_t *>(countAsVoid));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Builds the /proc/cpuinfo contents of a machine with 256 processors</summary>
+  /// <returns>The contents the /proc/cpuinfo file would have on such a machine</returns>
+  /// <remarks>
+  ///   Repeats the processors of a /proc/cpuinfo file captured on a real server and
+  ///   renumbers them, so the parser sees the same line structure it does in practice.
+  /// </remarks>
+  std::string buildLargeServerCpuInfo() {
+    using Nuclex::Platform::Hardware::exampleServerCpuInfo;
+    using Nuclex::Platform::Hardware::LinuxProcCpuInfoReader;
+
+    const std::string_view processorKey(u8"processor");
+
+    std::string cpuInfo;
+    std::size_t processorIndex = 0;
+    for(std::size_t repetition = 0; repetition < ServerRepetitionCount; ++repetition) {
+      std::string::size_type lineStart = 0;
+      while(lineStart < exampleServerCpuInfo.length()) {
+        std::string::size_type lineEnd = exampleServerCpuInfo.find('\n', lineStart);
+        if(lineEnd == std::string::npos) {
+          lineEnd = exampleServerCpuInfo.length();
+        }
+
+        // Processor lines get a new index, everything else is copied as-is
+        std::string_view line(exampleServerCpuInfo);
+        line = line.substr(lineStart, lineEnd - lineStart);
+        std::string_view::size_type colonIndex = line.find(':');
+        bool isProcessorLine = (
+          (line.substr(0, processorKey.length()) == processorKey) &&
+          (colonIndex != std::string_view::npos)
+        );
+        if(isProcessorLine) {
+          cpuInfo.append(line.substr(0, colonIndex + 1));
+          cpuInfo.push_back(' ');
+          cpuInfo.append(std::to_string(processorIndex));
+          ++processorIndex;
+        } else {
+          cpuInfo.append(line);
+        }
+        cpuInfo.push_back('\n');
+
+        lineStart = lineEnd + 1;
+      }
+    }
+
+    // Make sure the benchmark times a parse that actually finds all processors
+    std::size_t processorCount = 0;
+    LinuxProcCpuInfoReader::ParseCpuInfo(cpuInfo, &processorCount, &countProcessor);
+    if(processorCount != ServerRepetitionCount * CapturedServerProcessorCount) {
+      throw std::logic_error(u8"Parser did not report all processors of the benchmark input");
+    }
+
+    return cpuInfo;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>/proc/cpuinfo contents the benchmarks will be run on</summary>
+  const std::string largeServerCpuInfo = buildLargeServerCpuInfo();
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  // Lower bound: just finding the line breaks without looking at the lines at all
+  BASELINE(ProcCpuInfo256Processors, SplitLinesOnly, 100, 10) {
+    const char *current = largeServerCpuInfo.data();
+    const char *end = current + largeServerCpuInfo.length();
+
+    std::size_t lineCount = 0;
+    while(current < end) {
+      const char *lineEnd = static_cast<const char *>(
+        std::memchr(current, '\n', static_cast<std::size_t>(end - current))
+      );
+      if(lineEnd == nullptr) {
+        break;
+      }
+
+      ++lineCount;
+      current = lineEnd + 1;
+    }
+
+    celero::DoNotOptimizeAway(lineCount);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  BENCHMARK(ProcCpuInfo256Processors, ParseCpuInfo, 100, 10) {
+    std::size_t processorCount = 0;
+    LinuxProcCpuInfoReader::ParseCpuInfo(largeServerCpuInfo, &processorCount, &countProcessor);
+
+    celero::DoNotOptimizeAway(processorCount);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,187 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Hardware/LinuxSysCpuTreeReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../../Source/Platform/LinuxFileApi.h"
+
+#include <celero/Celero.h>
+
+#include <string> // for std::string
+#include <vector> // for std::vector
+#include <optional> // for std::optional
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Path of the directory holding the processor directories</summary>
+  const std::string CpuDirectory(u8"/sys/devices/system/cpu");
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Lists the per-processor files the sysfs CPU tree reader looks at</summary>
+  /// <returns>The paths of the files relative to the /sys/devices/system/cpu directory</returns>
+  std::vector<std::string> listProcessorFiles() {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    static const char *const processorFileNames[] = {
+      u8"topology/physical_package_id",
+      u8"topology/core_cpus_list",
+      u8"topology/thread_siblings_list",
+      u8"cpufreq/base_frequency",
+      u8"cpufreq/cpuinfo_min_freq",
+      u8"cpufreq/cpuinfo_max_freq"
+    };
+    static const char *const cacheFileNames[] = {
+      u8"level",
+      u8"type",
+      u8"size",
+      u8"coherency_line_size",
+      u8"ways_of_associativity",
+      u8"shared_cpu_list"
+    };
+
+    std::vector<std::string> paths;
+
+    std::vector<std::string> entryNames;
+    if(!LinuxFileApi::TryListDirectory(CpuDirectory, entryNames)) {
+      return paths;
+    }
+
+    for(const std::string &entryName : entryNames) {
+      bool isProcessorDirectory = (
+        (entryName.length() > 3) &&
+        (entryName.compare(0, 3, u8"cpu", 3) == 0) &&
+        (entryName[3] >= '0') && (entryName[3] <= '9')
+      );
+      if(!isProcessorDirectory) {
+        continue;
+      }
+
+      std::string processorDirectory = entryName + u8"/";
+      for(const char *fileName : processorFileNames) {
+        paths.push_back(processorDirectory + fileName);
+      }
+
+      std::vector<std::string> cacheNames;
+      LinuxFileApi::TryListDirectory(
+        LinuxFileApi::JoinPaths(CpuDirectory, processorDirectory + u8"cache"), cacheNames
+      );
+      for(const std::string &cacheName : cacheNames) {
+        if(cacheName.compare(0, 5, u8"index", 5) == 0) {
+          for(const char *fileName : cacheFileNames) {
+            paths.push_back(processorDirectory + u8"cache/" + cacheName + u8"/" + fileName);
+          }
+        }
+      }
+    }
+
+    return paths;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Relative paths of all files the benchmarks will read</summary>
+  const std::vector<std::string> processorFiles = listProcessorFiles();
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  // Each file opened, read and closed with its own system calls
+  BASELINE(SysCpuTreeFiles, FileByFile, 30, 10) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    int cpuDirectoryDescriptor;
+    if(!LinuxFileApi::TryOpenDirectory(CpuDirectory, cpuDirectoryDescriptor)) {
+      return;
+    }
+
+    char buffer[1024];
+    std::size_t totalLength = 0;
+    for(const std::string &path : processorFiles) {
+      std::size_t length;
+      bool wasRead = LinuxFileApi::TryReadFileAt(
+        cpuDirectoryDescriptor, path.c_str(), buffer, sizeof(buffer), length
+      );
+      if(wasRead) {
+        totalLength += length;
+      }
+    }
+
+    LinuxFileApi::Close(cpuDirectoryDescriptor, false);
+    celero::DoNotOptimizeAway(totalLength);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  // All files opened, read and closed in batches through io_uring (if available)
+  BENCHMARK(SysCpuTreeFiles, BatchedReads, 30, 10) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    int cpuDirectoryDescriptor;
+    if(!LinuxFileApi::TryOpenDirectory(CpuDirectory, cpuDirectoryDescriptor)) {
+      return;
+    }
+
+    std::vector<std::optional<std::string>> contents = LinuxFileApi::ReadManyFilesAt(
+      cpuDirectoryDescriptor, processorFiles, 1024
+    );
+
+    LinuxFileApi::Close(cpuDirectoryDescriptor, false);
+    celero::DoNotOptimizeAway(contents.size());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  // The whole reader, which reads the same files one by one and parses them
+  BENCHMARK(SysCpuTreeFiles, TryReadProcessors, 30, 10) {
+    std::vector<LinuxSysCpuTreeReader::ProcessorInfo> processors = (
+      LinuxSysCpuTreeReader::TryReadProcessors()
+    );
+
+    celero::DoNotOptimizeAway(processors.size());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  // The whole reader again, but reading the files in batches through io_uring (if available)
+  BENCHMARK(SysCpuTreeFiles, TryReadProcessorsBatched, 30, 10) {
+    std::vector<LinuxSysCpuTreeReader::ProcessorInfo> processors = (
+      LinuxSysCpuTreeReader::TryReadProcessors(u8"/sys/devices", 1, true)
+    );
+
+    celero::DoNotOptimizeAway(processors.size());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -85,6 +85,16 @@ limitations under the License.
 
 // --------------------------------------------------------------------------------------------- //
 
+// Processor architecture detection, only for the architectures where we query the CPU
+// directly. Other architectures are fine, they just won't get any CPU-specific details.
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+  #define NUCLEX_PLATFORM_X86 1
+#elif defined(_M_ARM) || defined(_M_ARM64) || defined(__arm__) || defined(__aarch64__)
+  #define NUCLEX_PLATFORM_ARM 1
+#endif
+
+// --------------------------------------------------------------------------------------------- //
+
 // Decides whether symbols are imported from a dll (client app) or exported to
 // a dll (Nuclex.Platform.Native library). The NUCLEX_PLATFORM_SOURCE symbol is defined by
 // all source files of the library, so you don't have to worry about a thing.
@@ -0,0 +1,81 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_CLOCKINFO_H
+#define NUCLEX_PLATFORM_HARDWARE_CLOCKINFO_H
+
+#include "Nuclex/Platform/Config.h"
+
+#include <string> // for std::string
+#include <vector> // for std::vector
+#include <optional> // for std::optional
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Timing characteristics of the system's clocks and scheduler</summary>
+  /// <remarks>
+  ///   The costs and granularities are measured on the calling thread, so a busy system
+  ///   or a virtual machine with overcommitted processors will report worse figures than
+  ///   the same hardware would when idle.
+  /// </remarks>
+  class NUCLEX_PLATFORM_TYPE ClockInfo {
+
+    /// <summary>Name of the clock source the operating system is currently using</summary>
+    /// <remarks>
+    ///   On Linux this is the kernel's current clocksource, for example &quot;tsc&quot;,
+    ///   &quot;hpet&quot;, &quot;acpi_pm&quot; or &quot;kvm-clock&quot;. Windows always
+    ///   reports &quot;QueryPerformanceCounter&quot; since it picks the hardware by itself.
+    /// </remarks>
+    public: std::string ClockSource;
+
+    /// <summary>Clock sources the operating system could switch to</summary>
+    public: std::vector<std::string> AvailableClockSources;
+
+    /// <summary>Whether the CPU's time stamp counter ticks at a constant rate</summary>
+    /// <remarks>
+    ///   An invariant time stamp counter keeps running at the same rate in all power
+    ///   and frequency states, which allows the operating system to read the time without
+    ///   leaving user mode. Empty if the CPU does not have a time stamp counter.
+    /// </remarks>
+    public: std::optional<bool> HasInvariantTsc;
+
+    /// <summary>Average time in nanoseconds a call to the steady clock takes</summary>
+    /// <remarks>
+    ///   Usually around 20 nanoseconds when the time stamp counter is used. Slow clock
+    ///   sources that have to be read through the kernel can take a microsecond or more.
+    /// </remarks>
+    public: double ClockReadNanoseconds;
+
+    /// <summary>Typical time in microseconds a thread sleeping for 1 µs really sleeps</summary>
+    /// <remarks>
+    ///   This is the shortest delay that can be achieved by putting a thread to sleep.
+    ///   Linux with high resolution timers manages around 50 microseconds whereas Windows
+    ///   usually rounds up to its timer interrupt interval, which is 1 to 16 milliseconds.
+    /// </remarks>
+    public: double SleepGranularityMicroseconds;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_CLOCKINFO_H
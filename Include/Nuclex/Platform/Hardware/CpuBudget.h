@@ -0,0 +1,70 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_CPUBUDGET_H
+#define NUCLEX_PLATFORM_HARDWARE_CPUBUDGET_H
+
+#include "Nuclex/Platform/Config.h"
+
+#include <cstddef> // for std::size_t
+#include <optional> // for std::optional
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Share of the system's CPUs the running process is allowed to use</summary>
+  /// <remarks>
+  ///   The CPU topology describes the hardware, but a process can be restricted to a part
+  ///   of it by its CPU affinity, by a cpuset or by a CPU time quota (all three are common
+  ///   in containers). Thread pools and task coordinators should be sized according to
+  ///   the <see cref="UsableThreadCount" /> rather than the number of processors installed.
+  /// </remarks>
+  class NUCLEX_PLATFORM_TYPE CpuBudget {
+
+    /// <summary>Logical processors the process may be scheduled to</summary>
+    /// <remarks>
+    ///   Combines the process' CPU affinity with the effective cpuset of its cgroup.
+    ///   The indices match those in the CPU topology and are in ascending order.
+    /// </remarks>
+    public: std::vector<std::size_t> AvailableProcessors;
+
+    /// <summary>Number of processors' worth of CPU time the process may use</summary>
+    /// <remarks>
+    ///   A quota of 2.5 means the process can keep two and a half processors busy on
+    ///   average. If it uses more, all its threads will be throttled until the next
+    ///   period begins. Empty if there is no CPU time quota.
+    /// </remarks>
+    public: std::optional<double> CpuQuota;
+
+    /// <summary>Number of threads that can run in parallel without being throttled</summary>
+    /// <remarks>
+    ///   The number of available processors or the CPU quota rounded down, whichever is
+    ///   lower. Always at least 1, even if the quota is below one processor.
+    /// </remarks>
+    public: std::size_t UsableThreadCount;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_CPUBUDGET_H
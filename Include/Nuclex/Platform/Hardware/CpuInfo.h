@@ -21,6 +21,7 @@ limitations under the License.
 #define NUCLEX_PLATFORM_HARDWARE_CPUINFO_H
 
 #include "Nuclex/Platform/Config.h"
+#include "Nuclex/Platform/Hardware/InstructionSetSupport.h" // for InstructionSetSupport
 
 #include <cstddef> // for std::size_t
 #include <string> // for std::string
@@ -32,6 +33,8 @@ namespace Nuclex { namespace Platform { namespace Hardware {
   // ------------------------------------------------------------------------------------------- //
 
   class CoreInfo; // declared further down in this file
+  class CacheInfo; // declared further down in this file
+  enum class CacheType; // declared further down in this file
 
   // ------------------------------------------------------------------------------------------- //
 
@@ -76,6 +79,15 @@ namespace Nuclex { namespace Platform { namespace Hardware {
     /// </remarks>
     public: std::size_t ThreadCount;
 
+    /// <summary>Instruction set extensions the CPU supports</summary>
+    /// <remarks>
+    ///   Systems with more than one CPU are assumed to have identical CPUs, so this is
+    ///   the same for all CPUs. To pick an optimized code path without a full analysis,
+    ///   use <see cref="PlatformAppraiser.QueryInstructionSets" /> or
+    ///   <see cref="DispatchedKernel" />.
+    /// </remarks>
+    public: InstructionSetSupport InstructionSets;
+
     /// <summary>Detailed information about the CPU's cores</summary>
     public: std::vector<CoreInfo> Cores;
 
@@ -123,6 +135,85 @@ namespace Nuclex { namespace Platform { namespace Hardware {
     /// </remarks>
     public: std::size_t ThreadCount;
 
+    /// <summary>Indices of the logical processors (hardware threads) of this core</summary>
+    /// <remarks>
+    ///   These are the same indices the operating system uses for CPU affinity and that
+    ///   are reported in the <see cref="CpuBudget" />, in ascending order. Empty if
+    ///   the processors could not be attributed to their cores (currently on Windows).
+    /// </remarks>
+    public: std::vector<std::size_t> ProcessorIndices;
+
+    /// <summary>Lowest frequency the core can be throttled down to in Megahertz</summary>
+    public: std::optional<double> MinimumFrequencyInMHz;
+
+    /// <summary>Highest frequency the core can reach in Megahertz</summary>
+    /// <remarks>
+    ///   This includes opportunistic overclocking (&quot;turbo boost&quot;), so it is
+    ///   the frequency the core runs at when it is the only one busy and cool enough.
+    /// </remarks>
+    public: std::optional<double> MaximumFrequencyInMHz;
+
+    /// <summary>Caches the core can access, ordered by level</summary>
+    /// <remarks>
+    ///   Caches shared with other cores (usually the L3 cache, sometimes the L2 cache)
+    ///   are listed for each of the cores sharing them. Empty if the cache layout
+    ///   could not be determined.
+    /// </remarks>
+    public: std::vector<CacheInfo> Caches;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Informations about a CPU cache</summary>
+  class NUCLEX_PLATFORM_TYPE CacheInfo {
+
+    /// <summary>Level of the cache, 1 being the smallest and closest to the core</summary>
+    public: std::size_t Level;
+
+    /// <summary>Whether the cache holds data, instructions or both</summary>
+    public: CacheType Type;
+
+    /// <summary>Capacity of the cache in bytes</summary>
+    public: std::size_t SizeInBytes;
+
+    /// <summary>Size of a cache line in bytes, zero if unknown</summary>
+    /// <remarks>
+    ///   This is the granularity in which the cache fetches memory and in which cores
+    ///   contend for ownership of data. Variables written by different threads should
+    ///   be at least this far apart to avoid false sharing.
+    /// </remarks>
+    public: std::size_t LineSizeInBytes;
+
+    /// <summary>Number of ways of the cache, zero if fully associative or unknown</summary>
+    /// <remarks>
+    ///   Memory addresses that are a multiple of (size / ways) apart compete for the same
+    ///   set of cache lines, so at most this many of them can be cached at the same time.
+    /// </remarks>
+    public: std::size_t Associativity;
+
+    /// <summary>Logical processors sharing this cache, in ascending order</summary>
+    /// <remarks>
+    ///   Includes the processors of the core the cache is listed for. Empty if it is
+    ///   unknown which processors share the cache (when the cache layout had to be
+    ///   obtained from the CPU itself rather than the operating system).
+    /// </remarks>
+    public: std::vector<std::size_t> SharedProcessorIndices;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Kind of contents a CPU cache stores</summary>
+  enum class NUCLEX_PLATFORM_TYPE CacheType {
+
+    /// <summary>Cache stores both data and instructions</summary>
+    Unified,
+    /// <summary>Cache only stores data</summary>
+    Data,
+    /// <summary>Cache only stores instructions</summary>
+    Instruction
+
   };
 
   // ------------------------------------------------------------------------------------------- //
@@ -0,0 +1,64 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_CPULOAD_H
+#define NUCLEX_PLATFORM_HARDWARE_CPULOAD_H
+
+#include "Nuclex/Platform/Config.h"
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>How a processor spent its time between two samples</summary>
+  /// <remarks>
+  ///   The load covers all processes on the system, not just the running one. This is
+  ///   what tells whether other processes or virtual machines on the same host compete
+  ///   for the processors the process is allowed to use.
+  /// </remarks>
+  class NUCLEX_PLATFORM_TYPE CpuLoad {
+
+    /// <summary>Percentage of time the processor spent executing code</summary>
+    /// <remarks>
+    ///   Includes user mode, kernel mode and interrupt handling. Time spent waiting
+    ///   for I/O or taken away by the hypervisor is not counted as busy.
+    /// </remarks>
+    public: float BusyPercent;
+
+    /// <summary>Percentage of time the processor was idle while I/O was outstanding</summary>
+    /// <remarks>
+    ///   Only a hint, the processor could have run other threads during this time.
+    ///   Always 0 on Windows.
+    /// </remarks>
+    public: float IoWaitPercent;
+
+    /// <summary>Percentage of time the hypervisor ran other virtual machines</summary>
+    /// <remarks>
+    ///   A high steal percentage means the virtual machine is competing with noisy
+    ///   neighbors for the physical processor. Always 0 on Windows and bare metal.
+    /// </remarks>
+    public: float StealPercent;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_CPULOAD_H
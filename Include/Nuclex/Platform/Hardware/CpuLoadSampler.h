@@ -0,0 +1,117 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_CPULOADSAMPLER_H
+#define NUCLEX_PLATFORM_HARDWARE_CPULOADSAMPLER_H
+
+#include "Nuclex/Platform/Config.h"
+#include "Nuclex/Platform/Hardware/CpuLoad.h" // for CpuLoad
+
+#include <atomic> // for std::atomic
+#include <cstddef> // for std::size_t
+#include <memory> // for std::unique_ptr
+#include <mutex> // for std::mutex
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Measures how busy the system's processors are</summary>
+  /// <remarks>
+  ///   <para>
+  ///     Each call to <see cref="Sample" /> reads the processor time counters of the
+  ///     operating system and computes how the processors spent their time since
+  ///     the previous call. Call it at a steady rate (a few times per second) from
+  ///     whichever thread drives your monitoring; sampling does not allocate memory.
+  ///   </para>
+  ///   <para>
+  ///     The results of the most recent sample can be queried from any thread without
+  ///     taking a lock. On Linux, the load is reported for each processor and for the
+  ///     system as a whole. On Windows, only the system-wide load is available and
+  ///     the per-processor load mirrors it.
+  ///   </para>
+  /// </remarks>
+  class NUCLEX_PLATFORM_TYPE CpuLoadSampler {
+
+    /// <summary>Initializes a new CPU load sampler and takes the baseline reading</summary>
+    /// <remarks>
+    ///   Until <see cref="Sample" /> is called for the first time, all loads are zero.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API CpuLoadSampler();
+
+    /// <summary>Frees all resources owned by the sampler</summary>
+    public: NUCLEX_PLATFORM_API ~CpuLoadSampler();
+
+    /// <summary>Counts the processors the sampler reports the load for</summary>
+    /// <returns>The number of processors whose load can be queried</returns>
+    public: NUCLEX_PLATFORM_API std::size_t CountProcessors() const noexcept {
+      return this->processorCount;
+    }
+
+    /// <summary>Measures the load since the previous sample and publishes it</summary>
+    /// <returns>True if the load was measured, false if the counters couldn't be read</returns>
+    public: NUCLEX_PLATFORM_API bool Sample();
+
+    /// <summary>Provides the system-wide load measured by the most recent sample</summary>
+    /// <returns>The load averaged over all processors</returns>
+    public: NUCLEX_PLATFORM_API CpuLoad GetTotalLoad() const noexcept;
+
+    /// <summary>Provides the load of one processor measured by the most recent sample</summary>
+    /// <param name="processorIndex">Index of the processor whose load will be returned</param>
+    /// <returns>The load of the specified processor</returns>
+    public: NUCLEX_PLATFORM_API CpuLoad GetProcessorLoad(
+      std::size_t processorIndex
+    ) const noexcept;
+
+    private: CpuLoadSampler(const CpuLoadSampler &other) = delete;
+    private: CpuLoadSampler &operator =(const CpuLoadSampler &other) = delete;
+
+    /// <summary>Platform-specific counters and the previous readings</summary>
+    private: struct Sampler;
+    /// <summary>Load of one processor in a form that can be read without locking</summary>
+    private: struct PublishedLoad;
+
+    /// <summary>Reads the load of one processor as a consistent snapshot</summary>
+    /// <param name="published">Published load that will be read</param>
+    /// <returns>The load of the processor</returns>
+    private: CpuLoad read(const PublishedLoad &published) const noexcept;
+
+    /// <summary>Must be held while taking a sample</summary>
+    private: std::mutex samplerMutex;
+    /// <summary>Reads the platform-specific counters</summary>
+    private: std::unique_ptr<Sampler> sampler;
+    /// <summary>Number of processors the load is reported for</summary>
+    private: std::size_t processorCount;
+
+    /// <summary>Incremented before and after each sample is published</summary>
+    /// <remarks>
+    ///   While odd, a sample is being published and readers have to retry. Readers
+    ///   also retry if the sequence number changed while they copied the fields.
+    /// </remarks>
+    private: std::atomic<std::size_t> sequenceNumber;
+    /// <summary>Published load, the system-wide load first, then each processor's</summary>
+    private: std::unique_ptr<PublishedLoad[]> publishedLoads;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_CPULOADSAMPLER_H
@@ -0,0 +1,130 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_DISPATCHEDKERNEL_H
+#define NUCLEX_PLATFORM_HARDWARE_DISPATCHEDKERNEL_H
+
+#include "Nuclex/Platform/Config.h"
+#include "Nuclex/Platform/Hardware/InstructionSetSupport.h" // for InstructionSetSupport
+#include "Nuclex/Platform/Hardware/PlatformAppraiser.h" // for PlatformAppraiser
+
+#include <initializer_list> // for std::initializer_list
+#include <utility> // for std::forward()
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  template<typename TSignature> class DispatchedKernel;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Picks the best variant of a compute kernel for the CPU once</summary>
+  /// <typeparam name="TResult">Type of value the kernel returns</typeparam>
+  /// <typeparam name="TArguments">Types of the arguments the kernel takes</typeparam>
+  /// <remarks>
+  ///   <para>
+  ///     Keep an instance in a static variable so the variant is selected only once,
+  ///     after which each call is a plain indirect call through the stored function pointer:
+  ///   </para>
+  ///   <code>
+  ///     float sum(const float *values, std::size_t count) {
+  ///       static const DispatchedKernel&lt;float(const float *, std::size_t)&gt; kernel(
+  ///         {
+  ///           { { InstructionSet::Avx2, InstructionSet::Fma }, &amp;sumAvx2 },
+  ///           { { InstructionSet::Sse41 }, &amp;sumSse41 }
+  ///         },
+  ///         &amp;sumScalar
+  ///       );
+  ///       return kernel(values, count);
+  ///     }
+  ///   </code>
+  ///   <para>
+  ///     The variants are checked in the order they're listed, so the fastest one should
+  ///     come first. The fallback is used if the CPU lacks the extensions of all variants.
+  ///   </para>
+  /// </remarks>
+  template<typename TResult, typename... TArguments>
+  class DispatchedKernel<TResult(TArguments...)> {
+
+    /// <summary>Type of the functions implementing the kernel's variants</summary>
+    public: typedef TResult FunctionType(TArguments...);
+
+    #pragma region struct Variant
+
+    /// <summary>Variant of the kernel that needs certain instruction set extensions</summary>
+    public: struct Variant {
+
+      /// <summary>Extensions the CPU must support for the variant to be used</summary>
+      public: InstructionSetSupport RequiredInstructionSets;
+      /// <summary>Function implementing the variant</summary>
+      public: FunctionType *Function;
+
+    };
+
+    #pragma endregion // struct Variant
+
+    /// <summary>Initializes a new kernel, selecting the best variant for the CPU</summary>
+    /// <param name="variants">Variants of the kernel, ordered from fastest to slowest</param>
+    /// <param name="fallback">Variant that will be used if no other variant is usable</param>
+    public: DispatchedKernel(std::initializer_list<Variant> variants, FunctionType *fallback) :
+      function(Select(PlatformAppraiser::QueryInstructionSets(), variants, fallback)) {}
+
+    /// <summary>Selects the first variant the specified extensions suffice for</summary>
+    /// <param name="supportedInstructionSets">Extensions the CPU supports</param>
+    /// <param name="variants">Variants of the kernel, ordered from fastest to slowest</param>
+    /// <param name="fallback">Variant that will be used if no other variant is usable</param>
+    /// <returns>The selected variant's function</returns>
+    public: static FunctionType *Select(
+      const InstructionSetSupport &supportedInstructionSets,
+      std::initializer_list<Variant> variants,
+      FunctionType *fallback
+    ) {
+      for(const Variant &variant : variants) {
+        if(supportedInstructionSets.HasAll(variant.RequiredInstructionSets)) {
+          return variant.Function;
+        }
+      }
+
+      return fallback;
+    }
+
+    /// <summary>Calls the selected variant of the kernel</summary>
+    /// <param name="arguments">Arguments that will be passed to the kernel</param>
+    /// <returns>The value returned by the kernel</returns>
+    public: TResult operator()(TArguments... arguments) const {
+      return this->function(std::forward<TArguments>(arguments)...);
+    }
+
+    /// <summary>Retrieves the function implementing the selected variant</summary>
+    /// <returns>The selected variant's function</returns>
+    public: FunctionType *GetFunction() const {
+      return this->function;
+    }
+
+    /// <summary>Function implementing the selected variant of the kernel</summary>
+    private: FunctionType *function;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_DISPATCHEDKERNEL_H
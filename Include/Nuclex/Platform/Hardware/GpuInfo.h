@@ -23,6 +23,7 @@ limitations under the License.
 #include "Nuclex/Platform/Config.h"
 
 #include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint16_t
 #include <string> // for std::string
 #include <vector> // for std;:vector
 
@@ -45,6 +46,13 @@ namespace Nuclex { namespace Platform { namespace Hardware {
     // part of this BIOS settings block, as is the company name (i.e. "Asus" or "MSI")
     //
 
+    /// <summary>PCI vendor ID of the GPU, i.e. 0x10de for NVidia</summary>
+    /// <remarks>Zero if the GPU is not a PCI device or the ID could not be determined</remarks>
+    public: std::uint16_t VendorId;
+
+    /// <summary>PCI device ID identifying the GPU model within the vendor's lineup</summary>
+    public: std::uint16_t DeviceId;
+
     /// <summary>Human-readable model name of this GPU</summary>
     public: std::string ModelName;
 
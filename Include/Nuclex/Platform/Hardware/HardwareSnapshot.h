@@ -0,0 +1,221 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_HARDWARESNAPSHOT_H
+#define NUCLEX_PLATFORM_HARDWARE_HARDWARESNAPSHOT_H
+
+#include "Nuclex/Platform/Config.h"
+
+#include "Nuclex/Platform/Hardware/CpuInfo.h" // for CpuInfo
+#include "Nuclex/Platform/Hardware/MemoryInfo.h" // for MemoryInfo
+#include "Nuclex/Platform/Hardware/StoreInfo.h" // for StoreInfo
+#include "Nuclex/Platform/Hardware/StoreLocator.h" // for StoreLocator
+
+#include <chrono> // for std::chrono::steady_clock
+#include <cstdint> // for std::uint64_t
+#include <functional> // for std::function
+#include <future> // for std::shared_future
+#include <memory> // for std::shared_ptr
+#include <mutex> // for std::mutex
+#include <utility> // for std::pair
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Part of the hardware description that has changed</summary>
+  enum class HardwareChange {
+
+    /// <summary>Processors went online or offline</summary>
+    CpuTopology,
+
+    /// <summary>The amount of installed memory has changed</summary>
+    Memory,
+
+    /// <summary>Storage volumes were mounted or unmounted</summary>
+    StorageVolumes
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Keeps the results of the platform appraiser and refreshes them when needed</summary>
+  /// <remarks>
+  ///   <para>
+  ///     Each call to the <see cref="PlatformAppraiser" /> analyzes the system from scratch.
+  ///     If several components of an application need to know about the hardware, share
+  ///     one hardware snapshot between them instead. Only the first query of each part
+  ///     blocks, further queries return the stored result immediately.
+  ///   </para>
+  ///   <para>
+  ///     When a stored result is older than the refresh interval, a query will also kick
+  ///     off a check in the background. This check looks at small sources describing the
+  ///     structure of the hardware (like the list of online processors on Linux) and only
+  ///     analyzes a part again if the modification time, size or contents of its sources
+  ///     have changed. Subscribers are notified from the background thread afterwards.
+  ///   </para>
+  ///   <para>
+  ///     On platforms without such sources, the check always analyzes the part again.
+  ///     This class is thread-safe.
+  ///   </para>
+  ///   <para>
+  ///     There is no timer watching the hardware. Checks only happen when a part is
+  ///     queried after the refresh interval has elapsed or when <see cref="Refresh" />
+  ///     is called, so subscribers that want to be notified without querying the snapshot
+  ///     themselves need to call <see cref="Refresh" /> periodically.
+  ///   </para>
+  /// </remarks>
+  class NUCLEX_PLATFORM_TYPE HardwareSnapshot {
+
+    /// <summary>Function that can be subscribed to changes of the hardware</summary>
+    public: typedef std::function<void(HardwareChange change)> ChangeCallback;
+
+    /// <summary>Function that calculates the fingerprint of a part's sources</summary>
+    /// <remarks>
+    ///   A part is analyzed again when its fingerprint differs from the fingerprint
+    ///   taken at the time of its last analysis.
+    /// </remarks>
+    public: typedef std::function<std::uint64_t(HardwareChange part)> FingerprintFunction;
+
+    /// <summary>Initializes a new hardware snapshot</summary>
+    /// <param name="refreshInterval">
+    ///   Minimum time that has to pass before a query checks for changes again
+    /// </param>
+    /// <param name="fingerprint">
+    ///   Function used to detect changes, empty to look at the system's own sources.
+    ///   Can be changed to watch different sources or for unit tests.
+    /// </param>
+    public: NUCLEX_PLATFORM_API HardwareSnapshot(
+      std::chrono::steady_clock::duration refreshInterval = std::chrono::seconds(1),
+      const FingerprintFunction &fingerprint = FingerprintFunction()
+    );
+
+    /// <summary>Waits for any check that is still running in the background</summary>
+    public: NUCLEX_PLATFORM_API ~HardwareSnapshot();
+
+    /// <summary>Provides the CPU topology of the system</summary>
+    /// <returns>A description of the system's CPU topology</returns>
+    public: NUCLEX_PLATFORM_API std::shared_ptr<const std::vector<CpuInfo>> GetCpuTopology();
+
+    /// <summary>Provides the installed and available memory of the system</summary>
+    /// <returns>A description of the system's memory</returns>
+    public: NUCLEX_PLATFORM_API std::shared_ptr<const MemoryInfo> GetMemory();
+
+    /// <summary>Provides the mounted storage volumes of the system</summary>
+    /// <returns>A description of the system's storage volumes</returns>
+    public: NUCLEX_PLATFORM_API std::shared_ptr<const std::vector<StoreInfo>> GetStorageVolumes();
+
+    /// <summary>Provides a store locator for the mounted storage volumes</summary>
+    /// <returns>A store locator for the current storage volumes</returns>
+    /// <remarks>
+    ///   The store locator is built once and reused until the storage volumes change.
+    ///   Its store indices refer to the list returned by the locator itself, which is
+    ///   the same list <see cref="GetStorageVolumes" /> provided at the time.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API std::shared_ptr<const StoreLocator> GetStoreLocator();
+
+    /// <summary>Checks for changes right away, ignoring the refresh interval</summary>
+    /// <returns>A future that completes once the check and any notifications are done</returns>
+    /// <remarks>
+    ///   Only parts that have been queried before are checked. If a check is already
+    ///   running, no new check is started and the future of the running one is returned.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API std::shared_future<void> Refresh();
+
+    /// <summary>Registers a function that will be called when the hardware changes</summary>
+    /// <param name="callback">Function that will be called for each changed part</param>
+    /// <returns>An identifier through which the subscription can be cancelled</returns>
+    /// <remarks>
+    ///   The callback is invoked from a background thread after the stored result of
+    ///   the changed part has been replaced, so querying it from the callback will
+    ///   provide the new description.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API std::size_t Subscribe(const ChangeCallback &callback);
+
+    /// <summary>Cancels a subscription made earlier</summary>
+    /// <param name="subscriptionId">Identifier that was returned by Subscribe()</param>
+    public: NUCLEX_PLATFORM_API void Unsubscribe(std::size_t subscriptionId);
+
+    /// <summary>Starts a background check if the refresh interval has elapsed</summary>
+    /// <remarks>The state mutex must be held by the caller</remarks>
+    private: void startRefreshIfDue();
+
+    /// <summary>Starts a background check unless one is already running</summary>
+    /// <remarks>The state mutex must be held by the caller</remarks>
+    private: void startRefresh();
+
+    /// <summary>Analyzes all previously queried parts again whose sources have changed</summary>
+    private: void refreshChangedParts();
+
+    /// <summary>Calls all subscribers to notify them of a change</summary>
+    /// <param name="change">Part of the hardware description that has changed</param>
+    private: void notifySubscribers(HardwareChange change);
+
+    private: HardwareSnapshot(const HardwareSnapshot &other) = delete;
+    private: HardwareSnapshot &operator =(const HardwareSnapshot &other) = delete;
+
+    /// <summary>Minimum time between two checks for changes</summary>
+    private: std::chrono::steady_clock::duration refreshInterval;
+    /// <summary>Calculates the fingerprints of the parts' sources</summary>
+    private: FingerprintFunction fingerprintFunction;
+
+    /// <summary>Held while a part of the hardware description is being analyzed</summary>
+    /// <remarks>
+    ///   Makes concurrent first queries wait for one analysis and keeps the background
+    ///   check from analyzing a part at the same time as a first query.
+    /// </remarks>
+    private: std::mutex analysisMutex;
+    /// <summary>Must be held while accessing the stored results or the refresh state</summary>
+    private: std::mutex stateMutex;
+    /// <summary>Must be held while accessing the list of subscribers</summary>
+    private: std::mutex subscriberMutex;
+
+    /// <summary>Last CPU topology that was analyzed, null if none was requested yet</summary>
+    private: std::shared_ptr<const std::vector<CpuInfo>> cpuTopology;
+    /// <summary>Fingerprint of the CPU topology's sources at the time of analysis</summary>
+    private: std::uint64_t cpuTopologyFingerprint;
+    /// <summary>Last memory description that was analyzed, null if none was requested yet</summary>
+    private: std::shared_ptr<const MemoryInfo> memory;
+    /// <summary>Fingerprint of the memory description's sources at the time of analysis</summary>
+    private: std::uint64_t memoryFingerprint;
+    /// <summary>Last storage volumes that were analyzed, null if none were requested yet</summary>
+    private: std::shared_ptr<const std::vector<StoreInfo>> storageVolumes;
+    /// <summary>Fingerprint of the storage volumes' sources at the time of analysis</summary>
+    private: std::uint64_t storageVolumesFingerprint;
+    /// <summary>Store locator for the storage volumes, built on first request</summary>
+    private: std::shared_ptr<const StoreLocator> storeLocator;
+
+    /// <summary>Time at which the last check for changes was started</summary>
+    private: std::chrono::steady_clock::time_point lastRefreshTime;
+    /// <summary>Completes when the most recent check for changes has finished</summary>
+    private: std::shared_future<void> refreshFuture;
+
+    /// <summary>Identifier that will be assigned to the next subscription</summary>
+    private: std::size_t nextSubscriptionId;
+    /// <summary>Functions that will be called when the hardware changes</summary>
+    private: std::vector<std::pair<std::size_t, ChangeCallback>> subscribers;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_HARDWARESNAPSHOT_H
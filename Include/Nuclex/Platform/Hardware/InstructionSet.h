@@ -0,0 +1,107 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_INSTRUCTIONSET_H
+#define NUCLEX_PLATFORM_HARDWARE_INSTRUCTIONSET_H
+
+#include "Nuclex/Platform/Config.h"
+
+#include <cstddef> // for std::size_t
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Instruction set extensions a CPU can support</summary>
+  /// <remarks>
+  ///   Only extensions that are commonly used to accelerate hot loops are listed. An x86
+  ///   extension using the AVX registers is only reported if the operating system also
+  ///   saves those registers on context switches, otherwise using it would crash.
+  /// </remarks>
+  enum class NUCLEX_PLATFORM_TYPE InstructionSet : std::size_t {
+
+    /// <summary>SSE2, always present on AMD64</summary>
+    Sse2,
+    /// <summary>SSE3 with horizontal adds and unaligned 128 bit loads</summary>
+    Sse3,
+    /// <summary>Supplemental SSE3 with byte shuffles</summary>
+    Ssse3,
+    /// <summary>SSE 4.1 with blends, dot products and rounding</summary>
+    Sse41,
+    /// <summary>SSE 4.2 with string comparisons and CRC32</summary>
+    Sse42,
+    /// <summary>Population count instruction</summary>
+    Popcnt,
+    /// <summary>AES-NI instructions for AES encryption</summary>
+    Aes,
+    /// <summary>Carry-less multiplication, used by CRC and GCM</summary>
+    Pclmul,
+    /// <summary>256 bit floating point vectors</summary>
+    Avx,
+    /// <summary>Conversion between half precision and single precision floats</summary>
+    F16c,
+    /// <summary>Fused multiply-add with three operands</summary>
+    Fma,
+    /// <summary>256 bit integer vectors, gathers and permutes</summary>
+    Avx2,
+    /// <summary>First bit manipulation instruction set (i.e. tzcnt, andn)</summary>
+    Bmi1,
+    /// <summary>Second bit manipulation instruction set (i.e. pdep, pext)</summary>
+    Bmi2,
+    /// <summary>SHA-1 and SHA-256 hashing instructions</summary>
+    Sha,
+    /// <summary>AVX-512 foundation with 512 bit vectors and mask registers</summary>
+    Avx512F,
+    /// <summary>AVX-512 conflict detection</summary>
+    Avx512Cd,
+    /// <summary>AVX-512 doubleword and quadword instructions</summary>
+    Avx512Dq,
+    /// <summary>AVX-512 byte and word instructions</summary>
+    Avx512Bw,
+    /// <summary>AVX-512 instructions on 128 and 256 bit vectors</summary>
+    Avx512Vl,
+    /// <summary>AVX-512 vector neural network instructions (int8 dot products)</summary>
+    Avx512Vnni,
+    /// <summary>ARM advanced SIMD, always present on AArch64</summary>
+    Neon,
+    /// <summary>ARM cryptography extension's AES instructions</summary>
+    ArmAes,
+    /// <summary>ARM cryptography extension's SHA-256 instructions</summary>
+    ArmSha2,
+    /// <summary>ARM CRC32 instructions</summary>
+    ArmCrc32,
+    /// <summary>ARM scalable vector extension</summary>
+    Sve,
+    /// <summary>Second version of the ARM scalable vector extension</summary>
+    Sve2
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Highest value present in the InstructionSet enumeration</summary>
+  constexpr const std::size_t MaximumInstructionSet = static_cast<std::size_t>(
+    InstructionSet::Sve2
+  );
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_INSTRUCTIONSET_H
@@ -0,0 +1,99 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_INSTRUCTIONSETSUPPORT_H
+#define NUCLEX_PLATFORM_HARDWARE_INSTRUCTIONSETSUPPORT_H
+
+#include "Nuclex/Platform/Config.h"
+#include "Nuclex/Platform/Hardware/InstructionSet.h" // for InstructionSet
+
+#include <cstdint> // for std::uint64_t
+#include <initializer_list> // for std::initializer_list
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Set of instruction set extensions</summary>
+  /// <remarks>
+  ///   Used both to describe the extensions a CPU supports and the extensions a piece
+  ///   of code requires (see <see cref="DispatchedKernel" />).
+  /// </remarks>
+  class NUCLEX_PLATFORM_TYPE InstructionSetSupport {
+
+    static_assert(
+      MaximumInstructionSet < 64, u8"Each instruction set must fit in one bit of the flags"
+    );
+
+    /// <summary>Initializes a new, empty set of instruction set extensions</summary>
+    public: InstructionSetSupport() :
+      flags(0) {}
+
+    /// <summary>Initializes a new set holding the specified instruction set extensions</summary>
+    /// <param name="instructionSets">Extensions that will be in the set</param>
+    public: InstructionSetSupport(std::initializer_list<InstructionSet> instructionSets) :
+      flags(0) {
+      for(InstructionSet instructionSet : instructionSets) {
+        Add(instructionSet);
+      }
+    }
+
+    /// <summary>Adds an instruction set extension to the set</summary>
+    /// <param name="instructionSet">Extension that will be added</param>
+    public: void Add(InstructionSet instructionSet) {
+      this->flags |= getFlag(instructionSet);
+    }
+
+    /// <summary>Checks whether the set contains an instruction set extension</summary>
+    /// <param name="instructionSet">Extension that will be checked for</param>
+    /// <returns>True if the set contains the extension</returns>
+    public: bool Has(InstructionSet instructionSet) const {
+      return ((this->flags & getFlag(instructionSet)) != 0);
+    }
+
+    /// <summary>Checks whether the set contains all extensions of another set</summary>
+    /// <param name="other">Set of extensions that will be checked for</param>
+    /// <returns>True if the set contains all extensions in the other set</returns>
+    public: bool HasAll(const InstructionSetSupport &other) const {
+      return ((this->flags & other.flags) == other.flags);
+    }
+
+    /// <summary>Checks whether the set contains no extensions at all</summary>
+    /// <returns>True if the set is empty</returns>
+    public: bool IsEmpty() const {
+      return (this->flags == 0);
+    }
+
+    /// <summary>Looks up the flag that represents an instruction set extension</summary>
+    /// <param name="instructionSet">Extension whose flag will be returned</param>
+    /// <returns>The bit representing the extension in the flags</returns>
+    private: static std::uint64_t getFlag(InstructionSet instructionSet) {
+      return (std::uint64_t(1) << static_cast<std::size_t>(instructionSet));
+    }
+
+    /// <summary>One bit for each instruction set extension that is in the set</summary>
+    private: std::uint64_t flags;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_INSTRUCTIONSETSUPPORT_H
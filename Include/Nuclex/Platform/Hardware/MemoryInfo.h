@@ -21,6 +21,7 @@ limitations under the License.
 #define NUCLEX_PLATFORM_HARDWARE_MEMORYINFO_H
 
 #include "Nuclex/Platform/Config.h"
+#include "Nuclex/Platform/Hardware/TransparentHugePageMode.h"
 
 #include <cstddef> // for std::size_t
 #include <string> // for std::string
@@ -39,6 +40,35 @@ namespace Nuclex { namespace Platform { namespace Hardware {
     /// <summary>The amount of memory a running program is allowed to use at most</summary>
     public: std::size_t MaximumProgramMegabytes;
 
+    /// <summary>Size of the default huge pages in kilobytes, zero if not supported</summary>
+    /// <remarks>
+    ///   On Linux, this is usually 2048 KiB on x86 systems. On Windows, it is the large
+    ///   page minimum, which only processes holding the 'lock pages in memory' privilege
+    ///   can make use of.
+    /// </remarks>
+    public: std::size_t HugePageKilobytes;
+
+    /// <summary>Number of huge pages the system has set aside in total</summary>
+    /// <remarks>
+    ///   Linux only hands out explicit huge pages (MAP_HUGETLB) from a pool reserved
+    ///   by the administrator through 'vm.nr_hugepages'. This is zero if no pool has
+    ///   been reserved or on Windows, which allocates large pages on demand.
+    /// </remarks>
+    public: std::size_t HugePageTotalCount;
+
+    /// <summary>Number of huge pages in the pool that have not been used yet</summary>
+    public: std::size_t HugePageFreeCount;
+
+    /// <summary>When the kernel uses huge pages for ordinary allocations by itself</summary>
+    public: TransparentHugePageMode TransparentHugePages;
+
+    /// <summary>Free memory on each NUMA node in megabytes, indexed by node number</summary>
+    /// <remarks>
+    ///   Empty if the system does not report NUMA nodes. Node numbers can have gaps,
+    ///   any node numbers not present in the system are listed with zero free memory.
+    /// </remarks>
+    public: std::vector<std::size_t> NodeFreeMegabytes;
+
   };
 
   // ------------------------------------------------------------------------------------------- //
@@ -0,0 +1,81 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_MEMORYPRESSURE_H
+#define NUCLEX_PLATFORM_HARDWARE_MEMORYPRESSURE_H
+
+#include "Nuclex/Platform/Config.h"
+
+#include <cstddef> // for std::size_t
+#include <optional> // for std::optional
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Momentary state of the memory available to the running process</summary>
+  class NUCLEX_PLATFORM_TYPE MemoryPressure {
+
+    /// <summary>Amount of memory the operating system can use in total</summary>
+    public: std::size_t TotalMegabytes;
+
+    /// <summary>Amount of memory that can be allocated without swapping</summary>
+    /// <remarks>
+    ///   This is an estimate by the operating system that includes caches and buffers
+    ///   which can be dropped to make room for new allocations.
+    /// </remarks>
+    public: std::size_t AvailableMegabytes;
+
+    /// <summary>Memory limit imposed on the process' control group or job, if any</summary>
+    /// <remarks>
+    ///   On Linux, this is the lowest cgroup v2 'memory.max' value of the process' cgroup
+    ///   and all of its ancestors. Inside a container, this is what the process will be
+    ///   OOM-killed for exceeding, no matter how much memory the host has.
+    /// </remarks>
+    public: std::optional<std::size_t> GroupLimitMegabytes;
+
+    /// <summary>Memory currently used by the process' control group or job, if known</summary>
+    public: std::optional<std::size_t> GroupUsageMegabytes;
+
+    /// <summary>Amount of memory the process can still allocate</summary>
+    /// <remarks>
+    ///   The available memory or the memory remaining below the group limit,
+    ///   whichever is lower. This is the value to base allocation decisions on.
+    /// </remarks>
+    public: std::size_t UsableMegabytes;
+
+    /// <summary>
+    ///   Percentage of time during the last 10 seconds in which at least one task was
+    ///   stalled waiting for memory, if the system reports it
+    /// </summary>
+    public: std::optional<float> SomeStallPercent;
+
+    /// <summary>
+    ///   Percentage of time during the last 10 seconds in which all tasks were stalled
+    ///   waiting for memory, if the system reports it
+    /// </summary>
+    public: std::optional<float> FullStallPercent;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_MEMORYPRESSURE_H
@@ -0,0 +1,126 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_MEMORYPRESSUREMONITOR_H
+#define NUCLEX_PLATFORM_HARDWARE_MEMORYPRESSUREMONITOR_H
+
+#include "Nuclex/Platform/Config.h"
+#include "Nuclex/Platform/Hardware/MemoryPressure.h" // for MemoryPressure
+
+#include <atomic> // for std::atomic
+#include <chrono> // for std::chrono::milliseconds
+#include <condition_variable> // for std::condition_variable
+#include <memory> // for std::unique_ptr
+#include <mutex> // for std::mutex
+#include <thread> // for std::thread
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Keeps track of how much memory the running process can still use</summary>
+  /// <remarks>
+  ///   <para>
+  ///     The <see cref="PlatformAppraiser" /> reports how much memory is installed, which
+  ///     says little about how much the process may allocate right now. Inside a container,
+  ///     the host may have hundreds of gigabytes free while the container's cgroup limit
+  ///     is about to be hit. This monitor samples available memory, memory stalls and the
+  ///     cgroup limit and usage in a background thread at a configurable rate.
+  ///   </para>
+  ///   <para>
+  ///     Querying the most recent sample does not take a lock and makes no system calls,
+  ///     so it is cheap enough to do before each large allocation.
+  ///   </para>
+  /// </remarks>
+  class NUCLEX_PLATFORM_TYPE MemoryPressureMonitor {
+
+    /// <summary>Initializes a new memory pressure monitor and takes the first sample</summary>
+    /// <param name="sampleInterval">Time between two samples of the memory state</param>
+    public: NUCLEX_PLATFORM_API MemoryPressureMonitor(
+      std::chrono::milliseconds sampleInterval = std::chrono::milliseconds(250)
+    );
+
+    /// <summary>Stops the sampling thread</summary>
+    public: NUCLEX_PLATFORM_API ~MemoryPressureMonitor();
+
+    /// <summary>Provides the most recent sample of the memory state</summary>
+    /// <returns>The memory state at the time of the most recent sample</returns>
+    public: NUCLEX_PLATFORM_API MemoryPressure GetCurrentPressure() const noexcept;
+
+    /// <summary>Takes a sample right away instead of waiting for the next interval</summary>
+    /// <returns>The memory state that was just sampled</returns>
+    public: NUCLEX_PLATFORM_API MemoryPressure SampleNow();
+
+    /// <summary>Takes samples until the monitor is destroyed</summary>
+    private: void sampleContinuously();
+
+    /// <summary>Makes a sample visible to readers of the current pressure</summary>
+    /// <param name="pressure">Sample that will be published</param>
+    private: void publish(const MemoryPressure &pressure) noexcept;
+
+    private: MemoryPressureMonitor(const MemoryPressureMonitor &other) = delete;
+    private: MemoryPressureMonitor &operator =(const MemoryPressureMonitor &other) = delete;
+
+    /// <summary>Platform-specific sources the samples are taken from</summary>
+    private: struct Sampler;
+
+    /// <summary>Time between two samples of the memory state</summary>
+    private: std::chrono::milliseconds sampleInterval;
+    /// <summary>Must be held while taking a sample</summary>
+    private: std::mutex samplerMutex;
+    /// <summary>Reads the platform-specific sources</summary>
+    private: std::unique_ptr<Sampler> sampler;
+
+    /// <summary>Incremented before and after each sample is published</summary>
+    /// <remarks>
+    ///   While odd, a sample is being published and readers have to retry. Readers
+    ///   also retry if the sequence number changed while they copied the fields.
+    /// </remarks>
+    private: std::atomic<std::size_t> sequenceNumber;
+    /// <summary>Published total memory</summary>
+    private: std::atomic<std::size_t> totalMegabytes;
+    /// <summary>Published available memory</summary>
+    private: std::atomic<std::size_t> availableMegabytes;
+    /// <summary>Published group limit, std::size_t(-1) if there is none</summary>
+    private: std::atomic<std::size_t> groupLimitMegabytes;
+    /// <summary>Published group usage, std::size_t(-1) if unknown</summary>
+    private: std::atomic<std::size_t> groupUsageMegabytes;
+    /// <summary>Published usable memory</summary>
+    private: std::atomic<std::size_t> usableMegabytes;
+    /// <summary>Published 'some' stall percentage, negative if unknown</summary>
+    private: std::atomic<float> someStallPercent;
+    /// <summary>Published 'full' stall percentage, negative if unknown</summary>
+    private: std::atomic<float> fullStallPercent;
+
+    /// <summary>Must be held while changing the stop flag</summary>
+    private: std::mutex stopMutex;
+    /// <summary>Wakes the sampling thread early when the monitor is destroyed</summary>
+    private: std::condition_variable stopSignal;
+    /// <summary>Set when the sampling thread should end</summary>
+    private: bool stopRequested;
+    /// <summary>Thread that takes samples at the configured interval</summary>
+    private: std::thread samplingThread;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_MEMORYPRESSUREMONITOR_H
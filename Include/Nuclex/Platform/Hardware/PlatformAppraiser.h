@@ -28,9 +28,14 @@ limitations under the License.
 #include <future> // for std::future
 
 #include "Nuclex/Platform/Hardware/CpuInfo.h"
+#include "Nuclex/Platform/Hardware/CpuBudget.h"
+#include "Nuclex/Platform/Hardware/ClockInfo.h"
+#include "Nuclex/Platform/Hardware/InstructionSetSupport.h"
 #include "Nuclex/Platform/Hardware/MemoryInfo.h"
 #include "Nuclex/Platform/Hardware/GpuInfo.h"
 #include "Nuclex/Platform/Hardware/StoreInfo.h"
+#include "Nuclex/Platform/Hardware/StoreThroughput.h"
+#include "Nuclex/Platform/Hardware/PlatformInfo.h"
 
 // PlatformAnalyzer
 //   -> I wouldn't think of a hardware inventory querying system reading this name
@@ -49,11 +54,22 @@ namespace Nuclex { namespace Support { namespace Threading {
   // ------------------------------------------------------------------------------------------- //
 
   class StopToken;
+  class ThreadPool;
 
   // ------------------------------------------------------------------------------------------- //
 
 }}} // namespace Nuclex::Support::Threading
 
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  class TaskCoordinator;
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
+
 namespace Nuclex { namespace Platform { namespace Hardware {
 
   //void removeTrailingSlash(std::wstring &volumeName);
@@ -71,6 +87,9 @@ namespace Nuclex { namespace Platform { namespace Hardware {
   /// </remarks>
   class NUCLEX_PLATFORM_TYPE PlatformAppraiser {
 
+    /// <summary>Keeps the results of the analysis methods around</summary>
+    friend class HardwareSnapshot;
+
     /// <summary>Analyzes the CPUs installed in the system</summary>
     /// <param name="canceller">
     ///   Allows cancellation of the data collection process before it is finished
@@ -85,6 +104,31 @@ namespace Nuclex { namespace Platform { namespace Hardware {
       )
     );
 
+    /// <summary>Determines the share of the system's CPUs the process may use</summary>
+    /// <returns>The processors and CPU time available to the running process</returns>
+    /// <remarks>
+    ///   <para>
+    ///     Unlike the analysis methods, this runs synchronously because it only needs to
+    ///     read a handful of small files. It's meant to be called whenever a thread pool
+    ///     is sized, so that a process in an 8-core container doesn't start 128 threads
+    ///     because the host has that many processors.
+    ///   </para>
+    ///   <para>
+    ///     On Linux, this looks at the process' CPU affinity and at the cgroup v2
+    ///     'cpuset.cpus.effective' and 'cpu.max' files. On Windows, only the process'
+    ///     affinity mask is taken into account.
+    ///   </para>
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static CpuBudget QueryCpuBudget();
+
+    /// <summary>Determines the instruction set extensions the CPU supports</summary>
+    /// <returns>The instruction set extensions that can be used</returns>
+    /// <remarks>
+    ///   The extensions are detected on the first call and remembered, so this is cheap
+    ///   enough to call from anywhere that picks between optimized code paths.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static InstructionSetSupport QueryInstructionSets();
+
     /// <summary>Analyzes the installed and available memory in the system</summary>
     /// <returns>
     ///   An <see cref="std::future" /> that will provide a description of
@@ -109,6 +153,307 @@ namespace Nuclex { namespace Platform { namespace Hardware {
       )
     );
 
+    /// <summary>Analyzes the GPUs installed in the system</summary>
+    /// <param name="canceller">
+    ///   Allows cancellation of the data collection process before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide a description of
+    ///   the GPUs installed in the system
+    /// </returns>
+    /// <remarks>
+    ///   GPUs are currently only detected on Linux, where they're read from the DRM
+    ///   devices in /sys/class/drm. The amount of video memory is only known for GPUs
+    ///   whose driver reports it (amdgpu does, NVidia's proprietary driver does not).
+    ///   On Windows, no GPUs are reported and the returned list is always empty.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static std::future<std::vector<GpuInfo>> AnalyzeGpus(
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Analyzes the CPUs installed in the system using a thread pool</summary>
+    /// <param name="threadPool">Thread pool in which the analysis will run</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the data collection process before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide a description of
+    ///   the CPU topology when the detection has completed
+    /// </returns>
+    /// <remarks>
+    ///   The other overload creates a new thread for each call, which can take longer
+    ///   than the analysis itself. If the application already has a thread pool, this
+    ///   overload lets the analysis run in one of its threads instead. It also scans
+    ///   the sysfs tree in that thread alone rather than starting helper threads.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static std::future<std::vector<CpuInfo>> AnalyzeCpuTopology(
+      Support::Threading::ThreadPool &threadPool,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Analyzes the CPUs installed in the system as a coordinated task</summary>
+    /// <param name="taskCoordinator">Task coordinator that will run the analysis</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the data collection process before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide a description of
+    ///   the CPU topology when the detection has completed
+    /// </returns>
+    /// <remarks>
+    ///   The analysis is scheduled as a task occupying one CPU core and doesn't start
+    ///   any helper threads. If the task coordinator is shut down before the task runs,
+    ///   the future will report a broken promise.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static std::future<std::vector<CpuInfo>> AnalyzeCpuTopology(
+      Tasks::TaskCoordinator &taskCoordinator,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Analyzes the installed and available memory using a thread pool</summary>
+    /// <param name="threadPool">Thread pool in which the analysis will run</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the data collection process before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide a description of
+    ///   the installed and available memory in the system
+    /// </returns>
+    public: NUCLEX_PLATFORM_API static std::future<MemoryInfo> AnalyzeMemory(
+      Support::Threading::ThreadPool &threadPool,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Analyzes the installed and available memory as a coordinated task</summary>
+    /// <param name="taskCoordinator">Task coordinator that will run the analysis</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the data collection process before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide a description of
+    ///   the installed and available memory in the system
+    /// </returns>
+    public: NUCLEX_PLATFORM_API static std::future<MemoryInfo> AnalyzeMemory(
+      Tasks::TaskCoordinator &taskCoordinator,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Analyzes the mounted storage volumes using a thread pool</summary>
+    /// <param name="threadPool">Thread pool in which the analysis will run</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the data collection process before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide a description of
+    ///   the installed and mounted storage volumes in the system
+    /// </returns>
+    public: NUCLEX_PLATFORM_API static std::future<
+      std::vector<StoreInfo>
+    > AnalyzeStorageVolumes(
+      Support::Threading::ThreadPool &threadPool,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Analyzes the mounted storage volumes as a coordinated task</summary>
+    /// <param name="taskCoordinator">Task coordinator that will run the analysis</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the data collection process before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide a description of
+    ///   the installed and mounted storage volumes in the system
+    /// </returns>
+    public: NUCLEX_PLATFORM_API static std::future<
+      std::vector<StoreInfo>
+    > AnalyzeStorageVolumes(
+      Tasks::TaskCoordinator &taskCoordinator,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Analyzes the installed GPUs using a thread pool</summary>
+    /// <param name="threadPool">Thread pool in which the analysis will run</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the data collection process before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide a description of
+    ///   the GPUs installed in the system
+    /// </returns>
+    public: NUCLEX_PLATFORM_API static std::future<std::vector<GpuInfo>> AnalyzeGpus(
+      Support::Threading::ThreadPool &threadPool,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Analyzes the installed GPUs as a coordinated task</summary>
+    /// <param name="taskCoordinator">Task coordinator that will run the analysis</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the data collection process before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide a description of
+    ///   the GPUs installed in the system
+    /// </returns>
+    public: NUCLEX_PLATFORM_API static std::future<std::vector<GpuInfo>> AnalyzeGpus(
+      Tasks::TaskCoordinator &taskCoordinator,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Runs all analyses concurrently</summary>
+    /// <param name="canceller">
+    ///   Allows cancellation of the data collection process before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide the combined results of
+    ///   all analyses once they have completed
+    /// </returns>
+    /// <remarks>
+    ///   The analyses are started right away, but the returned future is deferred,
+    ///   so waiting on it with a timeout will report <code>future_status::deferred</code>.
+    ///   If any analysis fails, the exception is rethrown from the future's get() method.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static std::future<PlatformInfo> AnalyzeAll(
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Runs all analyses concurrently using a thread pool</summary>
+    /// <param name="threadPool">Thread pool in which the analyses will run</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the data collection process before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide the combined results of
+    ///   all analyses once they have completed
+    /// </returns>
+    public: NUCLEX_PLATFORM_API static std::future<PlatformInfo> AnalyzeAll(
+      Support::Threading::ThreadPool &threadPool,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Runs all analyses concurrently as coordinated tasks</summary>
+    /// <param name="taskCoordinator">Task coordinator that will run the analyses</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the data collection process before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide the combined results of
+    ///   all analyses once they have completed
+    /// </returns>
+    public: NUCLEX_PLATFORM_API static std::future<PlatformInfo> AnalyzeAll(
+      Tasks::TaskCoordinator &taskCoordinator,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Measures the read performance of the store holding a directory</summary>
+    /// <param name="directory">
+    ///   Directory in which a temporary test file will be created
+    /// </param>
+    /// <param name="testFileMegabytes">Size of the test file in megabytes</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the measurement before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide the measured throughput
+    /// </returns>
+    /// <remarks>
+    ///   <para>
+    ///     This is not part of the regular analysis because it writes a test file and
+    ///     keeps the store busy for a second or two. Run it once, i.e. when the application
+    ///     is first started, and remember the results to pick read sizes and the number
+    ///     of parallel reads for each store.
+    ///   </para>
+    ///   <para>
+    ///     The test file is deleted again when the measurement completes or fails.
+    ///     The random access test stops after about one second, so slow hard drives
+    ///     will not hold up the measurement for long.
+    ///   </para>
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static std::future<StoreThroughput> MeasureStoreThroughput(
+      const std::string &directory,
+      std::size_t testFileMegabytes = 64,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Measures the cost and resolution of the system's clocks</summary>
+    /// <param name="canceller">
+    ///   Allows cancellation of the measurement before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide the clock informations
+    /// </returns>
+    /// <remarks>
+    ///   <para>
+    ///     This is not part of the regular analysis because it keeps a processor busy
+    ///     reading the clock in a loop and puts a thread to sleep several times, which can
+    ///     take up to a few hundred milliseconds on systems with a coarse timer.
+    ///   </para>
+    ///   <para>
+    ///     Use the results to decide whether waiting for short intervals is better done
+    ///     by sleeping, yielding or spinning. The task coordinator can pick its wake path
+    ///     from them via <see cref="Tasks::NaiveTaskCoordinator::AdaptWakeStrategy" />.
+    ///   </para>
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static std::future<ClockInfo> MeasureClocks(
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Measures the cost and resolution of the clocks using a thread pool</summary>
+    /// <param name="threadPool">Thread pool in which the measurement will run</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the measurement before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide the clock informations
+    /// </returns>
+    public: NUCLEX_PLATFORM_API static std::future<ClockInfo> MeasureClocks(
+      Support::Threading::ThreadPool &threadPool,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Measures the cost and resolution of the clocks as a coordinated task</summary>
+    /// <param name="taskCoordinator">Task coordinator that will run the measurement</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the measurement before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide the clock informations
+    /// </returns>
+    public: NUCLEX_PLATFORM_API static std::future<ClockInfo> MeasureClocks(
+      Tasks::TaskCoordinator &taskCoordinator,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
     /// <summary>Runs in a thread to analyze the system's CPU topology</summary>
     /// <param name="canceller">Allows the information collection to be cancelled</param>
     /// <returns>A description of the system's CPU topology</returns>
@@ -116,6 +461,17 @@ namespace Nuclex { namespace Platform { namespace Hardware {
       std::shared_ptr<const Support::Threading::StopToken> canceller
     );
 
+    /// <summary>Runs in a thread pool or task to analyze the system's CPU topology</summary>
+    /// <param name="canceller">Allows the information collection to be cancelled</param>
+    /// <returns>A description of the system's CPU topology</returns>
+    /// <remarks>
+    ///   Unlike <see cref="analyzeCpuTopologyAsync" />, this never starts additional
+    ///   threads, so the analysis stays within the pool or coordinator it was given to.
+    /// </remarks>
+    private: static std::vector<CpuInfo> analyzeCpuTopologyInPool(
+      std::shared_ptr<const Support::Threading::StopToken> canceller
+    );
+
     /// <summary>Runs in a thread to analyze the system's memory</summary>
     /// <param name="canceller">Allows the information collection to be cancelled</param>
     /// <returns>A description of the system's memory</returns>
@@ -130,6 +486,31 @@ namespace Nuclex { namespace Platform { namespace Hardware {
       std::shared_ptr<const Support::Threading::StopToken> canceller
     );
 
+    /// <summary>Runs in a thread to analyze the system's GPUs</summary>
+    /// <param name="canceller">Allows the information collection to be cancelled</param>
+    /// <returns>A description of the system's GPUs</returns>
+    private: static std::vector<GpuInfo> analyzeGpusAsync(
+      std::shared_ptr<const Support::Threading::StopToken> canceller
+    );
+
+    /// <summary>Runs in a thread to measure the read performance of a store</summary>
+    /// <param name="directory">Directory in which the test file will be created</param>
+    /// <param name="testFileMegabytes">Size of the test file in megabytes</param>
+    /// <param name="canceller">Allows the measurement to be cancelled</param>
+    /// <returns>The measured read performance</returns>
+    private: static StoreThroughput measureStoreThroughputAsync(
+      std::string directory,
+      std::size_t testFileMegabytes,
+      std::shared_ptr<const Support::Threading::StopToken> canceller
+    );
+
+    /// <summary>Runs in a thread to measure the system's clocks</summary>
+    /// <param name="canceller">Allows the measurement to be cancelled</param>
+    /// <returns>The clock source and the measured clock characteristics</returns>
+    private: static ClockInfo measureClocksAsync(
+      std::shared_ptr<const Support::Threading::StopToken> canceller
+    );
+
     // --------------------------------
     // old from Videl
     // --------------------------------
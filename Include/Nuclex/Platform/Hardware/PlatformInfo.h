@@ -0,0 +1,57 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_PLATFORMINFO_H
+#define NUCLEX_PLATFORM_HARDWARE_PLATFORMINFO_H
+
+#include "Nuclex/Platform/Config.h"
+
+#include "Nuclex/Platform/Hardware/CpuInfo.h" // for CpuInfo
+#include "Nuclex/Platform/Hardware/MemoryInfo.h" // for MemoryInfo
+#include "Nuclex/Platform/Hardware/StoreInfo.h" // for StoreInfo
+#include "Nuclex/Platform/Hardware/GpuInfo.h" // for GpuInfo
+
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Combined results of all analyses the platform appraiser can perform</summary>
+  class NUCLEX_PLATFORM_TYPE PlatformInfo {
+
+    /// <summary>Description of the CPUs installed in the system</summary>
+    public: std::vector<CpuInfo> CpuTopology;
+
+    /// <summary>Description of the installed and available memory</summary>
+    public: MemoryInfo Memory;
+
+    /// <summary>Description of the mounted storage volumes</summary>
+    public: std::vector<StoreInfo> StorageVolumes;
+
+    /// <summary>Description of the GPUs installed in the system</summary>
+    public: std::vector<GpuInfo> Gpus;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_PLATFORMINFO_H
@@ -32,6 +32,7 @@ namespace Nuclex { namespace Platform { namespace Hardware {
   // ------------------------------------------------------------------------------------------- //
 
   enum class StoreType; // declared further down in this file
+  enum class StoreInterface; // declared further down in this file
 
   // ------------------------------------------------------------------------------------------- //
 
@@ -63,20 +64,21 @@ namespace Nuclex { namespace Platform { namespace Hardware {
   /// </remarks>
   class NUCLEX_PLATFORM_TYPE StoreInfo {
 
-/*
     /// <summary>Operating-system specific identifier of the drive</summary>
+    /// <remarks>
+    ///   On Linux, this is the name of the block device (i.e. 'sda' or 'nvme0n1') or,
+    ///   for network stores, the host name or address of the server.
+    /// </remarks>
     public: std::string Identifier;
 
-    /// <summary>Human-readable name of the drive's manufacturer</summary>
+    /// <summary>Human-readable name of the drive's manufacturer, if known</summary>
     public: std::string ManufacturerName;
 
-    /// <summary>Model name of the drive</summary>
+    /// <summary>Model name of the drive, if known</summary>
     public: std::string ModelName;
 
     /// <summary>Total capacity of this drive in megabytes (1024-based)</summary>
-    public: std::size_t CapacityInMegabytes;
-
-    */
+    public: std::optional<std::size_t> CapacityInMegabytes;
 
     /// <summary>How the store is connected or reachable by the local machine</summary>
     public: StoreType Type;
@@ -84,10 +86,47 @@ namespace Nuclex { namespace Platform { namespace Hardware {
     /// <summary>Whether this is a solid state drive</summary>
     public: std::optional<bool> IsSolidState;
 
+    /// <summary>Bus or protocol through which the store is accessed</summary>
+    public: StoreInterface Interface;
+
+    /// <summary>Number of requests the operating system will queue for the store</summary>
+    /// <remarks>
+    ///   NVMe drives accept hundreds of concurrent requests while hard drives and SATA SSDs
+    ///   top out at 32. This is a good upper bound for the number of parallel reads issued
+    ///   to a store, though hard drives will usually be faster with just one.
+    /// </remarks>
+    public: std::optional<std::size_t> QueueDepth;
+
+    /// <summary>Smallest unit in bytes the store can address</summary>
+    public: std::optional<std::size_t> LogicalBlockSize;
+
+    /// <summary>Smallest unit in bytes the store can write without read-modify-write</summary>
+    public: std::optional<std::size_t> PhysicalBlockSize;
+
+    /// <summary>Transfer size in bytes the store reports as ideal, if any</summary>
+    /// <remarks>
+    ///   Mostly reported by RAID arrays (as their stripe width) and some SSDs. Reads and
+    ///   writes in multiples of this size avoid splitting requests across stripes.
+    /// </remarks>
+    public: std::optional<std::size_t> OptimalTransferSize;
+
+    /// <summary>Largest transfer in bytes the operating system issues as one request</summary>
+    /// <remarks>
+    ///   Reads larger than this will be split up. There's little gain in reading more
+    ///   than this in one call, except for saving on system call overhead.
+    /// </remarks>
+    public: std::optional<std::size_t> MaximumTransferSize;
+
+    /// <summary>Name of the I/O scheduler the operating system uses for the store</summary>
+    /// <remarks>
+    ///   On Linux, this is 'none', 'mq-deadline', 'bfq' or 'kyber'. Empty if there's no
+    ///   such thing on the current platform or it could not be determined.
+    /// </remarks>
+    public: std::string IoScheduler;
+
     /// <summary>Detailed information about the mounted partitions from the drive</summary>
     public: std::vector<PartitionInfo> Partitions;
 
-
   };
 
   // ------------------------------------------------------------------------------------------- //
@@ -120,6 +159,30 @@ namespace Nuclex { namespace Platform { namespace Hardware {
 
   // ------------------------------------------------------------------------------------------- //
 
+  /// <summary>Bus or protocol through which a data store is accessed</summary>
+  enum class NUCLEX_PLATFORM_TYPE StoreInterface {
+
+    /// <summary>Unknown interface</summary>
+    Unknown,
+    /// <summary>Serial ATA or its ancestor, parallel ATA</summary>
+    Sata,
+    /// <summary>SCSI or Serial Attached SCSI, usually found in servers</summary>
+    Scsi,
+    /// <summary>NVM Express, PCI Express-attached solid state drives</summary>
+    Nvme,
+    /// <summary>Universal Serial Bus, usually for external drives and sticks</summary>
+    Usb,
+    /// <summary>SD or MMC memory card, also used for soldered eMMC storage</summary>
+    MemoryCard,
+    /// <summary>Paravirtualized disk provided by a hypervisor or device mapper</summary>
+    Virtual,
+    /// <summary>Network file system protocol such as NFS or SMB</summary>
+    Network
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
   /// <summary>Informations about a partition mounted for access by the system</summary>
   class NUCLEX_PLATFORM_TYPE PartitionInfo {
 
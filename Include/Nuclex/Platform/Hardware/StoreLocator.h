@@ -0,0 +1,143 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_STORELOCATOR_H
+#define NUCLEX_PLATFORM_HARDWARE_STORELOCATOR_H
+
+#include "Nuclex/Platform/Config.h"
+
+#include "Nuclex/Platform/Hardware/StoreInfo.h" // for StoreInfo
+
+#include <cstddef> // for std::size_t
+#include <memory> // for std::shared_ptr
+#include <optional> // for std::optional
+#include <string> // for std::string
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Store and partition a path lives on</summary>
+  class NUCLEX_PLATFORM_TYPE StoreLocation {
+
+    /// <summary>Index of the store in the list the store locator was created from</summary>
+    public: std::size_t StoreIndex;
+
+    /// <summary>Index of the partition in the store's list of partitions</summary>
+    public: std::size_t PartitionIndex;
+
+    /// <summary>Mount path through which the path is reached</summary>
+    public: std::string MountPath;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Looks up the store and partition holding a file or directory</summary>
+  /// <remarks>
+  ///   <para>
+  ///     Building the locator sorts all mount paths of all partitions by length so that
+  ///     looking up a path only needs to find the first (and thus longest) mount path
+  ///     the path starts with. Nested mounts, like a separate partition mounted in
+  ///     '/home', are thereby resolved to the innermost mount.
+  ///   </para>
+  ///   <para>
+  ///     Paths are compared as written, only '.' and '..' segments and doubled slashes
+  ///     are resolved. Symbolic links are not followed because that would require
+  ///     accessing the file system. If a path may contain links into other stores, pass
+  ///     it through std::filesystem::canonical() first. Relative paths are never found.
+  ///   </para>
+  ///   <para>
+  ///     A store locator never changes after it has been created, so it can be used from
+  ///     any number of threads at once. When the mounted volumes change, create a new one
+  ///     or obtain it from a <see cref="HardwareSnapshot" /> which does so automatically.
+  ///   </para>
+  /// </remarks>
+  class NUCLEX_PLATFORM_TYPE StoreLocator {
+
+    /// <summary>Builds a store locator for the specified stores</summary>
+    /// <param name="stores">
+    ///   Stores as provided by <see cref="PlatformAppraiser.AnalyzeStorageVolumes" />
+    /// </param>
+    public: NUCLEX_PLATFORM_API StoreLocator(
+      const std::shared_ptr<const std::vector<StoreInfo>> &stores
+    );
+
+    /// <summary>Frees all resources owned by the store locator</summary>
+    public: NUCLEX_PLATFORM_API ~StoreLocator();
+
+    /// <summary>Provides the stores the locator was created from</summary>
+    /// <returns>The list of stores the store indices refer to</returns>
+    public: NUCLEX_PLATFORM_API const std::vector<StoreInfo> &GetStores() const {
+      return *this->stores.get();
+    }
+
+    /// <summary>Determines the store and partition holding the specified path</summary>
+    /// <param name="path">Path of a file or directory that will be looked up</param>
+    /// <returns>
+    ///   The location of the path or nothing if the path is not below any known mount
+    /// </returns>
+    public: NUCLEX_PLATFORM_API std::optional<StoreLocation> Locate(
+      const std::string &path
+    ) const;
+
+    /// <summary>Forms a bit mask identifying the store holding the specified path</summary>
+    /// <param name="path">Path of a file or directory that will be looked up</param>
+    /// <returns>
+    ///   A value with the bit of the store's index set or 0 if the path is not below
+    ///   any known mount or its store index does not fit into the mask
+    /// </returns>
+    /// <remarks>
+    ///   Intended for the <see cref="Tasks.ResourceManifest.AccessedHardDriveMask" />
+    ///   so that tasks accessing the same store are not run at the same time. Combine
+    ///   the masks of all paths a task accesses with the binary or operator.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API std::size_t GetDriveMask(const std::string &path) const;
+
+    #pragma region struct MountEntry
+
+    /// <summary>Mount path with the partition it belongs to</summary>
+    private: struct MountEntry {
+
+      /// <summary>Mount path normalized for comparison</summary>
+      public: std::string NormalizedPath;
+      /// <summary>Index of the store the mounted partition belongs to</summary>
+      public: std::size_t StoreIndex;
+      /// <summary>Index of the mounted partition in its store</summary>
+      public: std::size_t PartitionIndex;
+      /// <summary>Index of the mount path in the partition's list of mount paths</summary>
+      public: std::size_t MountPathIndex;
+
+    };
+
+    #pragma endregion // struct MountEntry
+
+    /// <summary>Stores the locator will find paths on</summary>
+    private: std::shared_ptr<const std::vector<StoreInfo>> stores;
+    /// <summary>Mount paths of all partitions ordered from longest to shortest</summary>
+    private: std::vector<MountEntry> mounts;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_STORELOCATOR_H
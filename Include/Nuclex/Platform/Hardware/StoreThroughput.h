@@ -0,0 +1,66 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_STORETHROUGHPUT_H
+#define NUCLEX_PLATFORM_HARDWARE_STORETHROUGHPUT_H
+
+#include "Nuclex/Platform/Config.h"
+
+#include <cstddef> // for std::size_t
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Read performance measured on a storage volume</summary>
+  /// <remarks>
+  ///   The figures are measured by reading back a freshly written test file after asking
+  ///   the operating system to drop it from its caches. File systems with their own
+  ///   caching (such as ZFS) or volumes living in memory (such as tmpfs) may still
+  ///   report much higher numbers than the underlying drive can deliver.
+  /// </remarks>
+  class NUCLEX_PLATFORM_TYPE StoreThroughput {
+
+    /// <summary>Size of the test file in bytes that was read</summary>
+    public: std::size_t TestFileSize;
+
+    /// <summary>Megabytes per second when reading the test file from start to end</summary>
+    public: double SequentialReadMegabytesPerSecond;
+
+    /// <summary>Size in bytes of each read in the random access test</summary>
+    public: std::size_t RandomReadSize;
+
+    /// <summary>Reads per second when reading small blocks at random offsets</summary>
+    /// <remarks>
+    ///   Hard drives manage around a hundred of these, SSDs many thousands. Since only
+    ///   one read is in flight at a time, this reflects the latency of the store more
+    ///   than what it could achieve with a deep queue.
+    /// </remarks>
+    public: double RandomReadsPerSecond;
+
+    /// <summary>Megabytes per second when reading small blocks at random offsets</summary>
+    public: double RandomReadMegabytesPerSecond;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_STORETHROUGHPUT_H
@@ -0,0 +1,47 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_TRANSPARENTHUGEPAGEMODE_H
+#define NUCLEX_PLATFORM_HARDWARE_TRANSPARENTHUGEPAGEMODE_H
+
+#include "Nuclex/Platform/Config.h"
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>When the kernel backs ordinary memory with huge pages by itself</summary>
+  enum class NUCLEX_PLATFORM_TYPE TransparentHugePageMode {
+
+    /// <summary>The system does not have transparent huge pages</summary>
+    Unsupported,
+    /// <summary>Transparent huge pages are turned off</summary>
+    Never,
+    /// <summary>Only memory flagged via madvise(MADV_HUGEPAGE) gets huge pages</summary>
+    OnRequest,
+    /// <summary>Any sufficiently large anonymous mapping may get huge pages</summary>
+    Always
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_TRANSPARENTHUGEPAGEMODE_H
@@ -0,0 +1,89 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_TASKS_BLOCKINGREGION_H
+#define NUCLEX_PLATFORM_TASKS_BLOCKINGREGION_H
+
+#include "Nuclex/Platform/Config.h"
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  class NaiveTaskCoordinator;
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Tells the task coordinator that the current task is about to block</summary>
+  /// <remarks>
+  ///   <para>
+  ///     The task coordinator only keeps as many tasks running as it has threads for
+  ///     the CPU cores and GPUs it was given. If a task waits for disk or network I/O,
+  ///     its thread sits idle and other tasks may be held back even though CPU cores
+  ///     are free. Placing a blocking region around the waiting part lets the task
+  ///     coordinator launch additional tasks on extra threads until the region ends.
+  ///   </para>
+  ///   <para>
+  ///     <code>
+  ///       {
+  ///         BlockingRegion waitingForNetwork;
+  ///         response = httpClient.Get(url); // blocks for a while
+  ///       }
+  ///     </code>
+  ///   </para>
+  ///   <para>
+  ///     Blocking regions can be nested and are simply ignored when they're used outside
+  ///     of a task executed by a task coordinator, so library code can use them freely.
+  ///   </para>
+  ///   <para>
+  ///     While the outermost blocking region is active, the CPU cores listed in the task's
+  ///     resource manifest are handed back so other tasks can be admitted. All other
+  ///     resources (and those of the task's environment) remain allocated. When the region
+  ///     ends, the task takes its CPU cores back. If another task holds them by then,
+  ///     the task continues anyway and the CPU cores are overcommitted until either task
+  ///     has finished.
+  ///   </para>
+  /// </remarks>
+  class NUCLEX_PLATFORM_TYPE BlockingRegion {
+
+    /// <summary>Marks the calling thread as blocked until the region is destroyed</summary>
+    public: NUCLEX_PLATFORM_API BlockingRegion();
+
+    /// <summary>Marks the calling thread as running again</summary>
+    public: NUCLEX_PLATFORM_API ~BlockingRegion();
+
+    private: BlockingRegion(const BlockingRegion &other) = delete;
+    private: BlockingRegion &operator =(const BlockingRegion &other) = delete;
+
+    /// <summary>Task coordinator that was notified, null if there was none</summary>
+    private: NaiveTaskCoordinator *coordinator;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
+
+#endif // NUCLEX_PLATFORM_TASKS_BLOCKINGREGION_H
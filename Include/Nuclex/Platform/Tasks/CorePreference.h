@@ -0,0 +1,61 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_TASKS_COREPREFERENCE_H
+#define NUCLEX_PLATFORM_TASKS_COREPREFERENCE_H
+
+#include "Nuclex/Platform/Config.h"
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Which class of CPU cores a task should run on</summary>
+  /// <remarks>
+  ///   <para>
+  ///     Hybrid CPUs combine fast performance cores (&quot;p-cores&quot;) with slower but
+  ///     energy-efficient eco cores (&quot;e-cores&quot;). Latency-critical work should run
+  ///     on p-cores while throughput-oriented background work can go to the e-cores
+  ///     and leave the p-cores free.
+  ///   </para>
+  ///   <para>
+  ///     On systems where the task coordinator has not been given CPU core units of both
+  ///     classes, all preferences and requirements are treated as <see cref="Any" />.
+  ///   </para>
+  /// </remarks>
+  enum class NUCLEX_PLATFORM_TYPE CorePreference {
+
+    /// <summary>The task can run on any core</summary>
+    Any,
+    /// <summary>Performance cores are preferred, eco cores used if none are free</summary>
+    PreferPerformance,
+    /// <summary>The task must run on performance cores and will wait for them</summary>
+    RequirePerformance,
+    /// <summary>Eco cores are preferred, performance cores used if none are free</summary>
+    PreferEfficiency,
+    /// <summary>The task must run on eco cores and will wait for them</summary>
+    RequireEfficiency
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
+
+#endif // NUCLEX_PLATFORM_TASKS_COREPREFERENCE_H
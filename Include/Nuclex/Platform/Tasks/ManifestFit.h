@@ -0,0 +1,47 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_TASKS_MANIFESTFIT_H
+#define NUCLEX_PLATFORM_TASKS_MANIFESTFIT_H
+
+#include "Nuclex/Platform/Config.h"
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>How well the amount declared in a resource manifest matches actual use</summary>
+  enum class NUCLEX_PLATFORM_TYPE ManifestFit {
+
+    /// <summary>The resource's usage could not be measured well enough to judge it</summary>
+    Unknown,
+    /// <summary>The declared amount is close to what the task actually used</summary>
+    Accurate,
+    /// <summary>The task used a lot less than it declared, blocking other tasks</summary>
+    OverDeclared,
+    /// <summary>The task used more than it declared, overcommitting the system</summary>
+    UnderDeclared
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
+
+#endif // NUCLEX_PLATFORM_TASKS_MANIFESTFIT_H
@@ -23,21 +23,50 @@ limitations under the License.
 #include "Nuclex/Platform/Config.h"
 
 #include "Nuclex/Platform/Tasks/TaskCoordinator.h"
+#include "Nuclex/Platform/Tasks/TaskUsageSummary.h" // for TaskUsageSummary
+#include "Nuclex/Platform/Tasks/WakeStrategy.h" // for WakeStrategy
 #include <Nuclex/Support/Threading/ThreadPool.h> // for ThreadPool
 #include <Nuclex/Support/Threading/Semaphore.h> // for Semaphore
 
 #include <optional> // for std::optional
 #include <memory> // for std::unique_ptr
 #include <mutex> // for std::mutex
+#include <condition_variable> // for std::condition_variable
 #include <deque> // for std::deque
+#include <vector> // for std::vector
+#include <string> // for std::string
 #include <array> // for std::array
 #include <atomic> // for std::atomic
+#include <chrono> // for std::chrono::microseconds
+
+namespace Nuclex { namespace Support { namespace Threading {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  class StopSource;
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Support::Threading
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  class ClockInfo;
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
 
 namespace Nuclex { namespace Platform { namespace Tasks {
 
   // ------------------------------------------------------------------------------------------- //
 
   class ResourceBudget;
+  class BlockingRegion;
+  class TaskUsageLedger;
+  class ManifestLearner;
 
   // ------------------------------------------------------------------------------------------- //
 
@@ -48,8 +77,18 @@ namespace Nuclex { namespace Platform { namespace Tasks {
   // ------------------------------------------------------------------------------------------- //
 
   /// <summary>Coordinates background tasks based on their usage of system resouces</summary>
+  /// <remarks>
+  ///   A <see cref="TaskEnvironment" /> is activated on the thread of the first task that
+  ///   needs it and shut down by the last task using it when that task ends. Tasks are not
+  ///   reordered to form series sharing an environment, so an environment whose tasks do
+  ///   not overlap is activated and shut down again for each of them. The environment's
+  ///   resources are counted once for each task using it. If activating an environment
+  ///   throws, the task is not run and its resources are returned.
+  /// </remarks>
   class NUCLEX_PLATFORM_TYPE NaiveTaskCoordinator : public TaskCoordinator {
 
+    friend class BlockingRegion;
+
     /// <summary>Initializes a new task coordinator</summary>
     public: NUCLEX_PLATFORM_API NaiveTaskCoordinator();
 
@@ -70,6 +109,230 @@ namespace Nuclex { namespace Platform { namespace Tasks {
       Tasks::ResourceType resourceType, std::size_t amountAvailable
     );
 
+    /// <summary>Adds a unit of CPU cores bound to a specific set of logical processors</summary>
+    /// <param name="coreCount">Number of CPU cores the unit provides to tasks</param>
+    /// <param name="processorIndices">
+    ///   Indices of the logical processors (as numbered by the operating system) that
+    ///   make up this unit, including any SMT siblings of its cores
+    /// </param>
+    /// <param name="areEcoCores">
+    ///   Whether the unit consists of eco cores (&quot;e-cores&quot;) of a hybrid CPU
+    /// </param>
+    /// <remarks>
+    ///   <para>
+    ///     This works like calling <see cref="AddResource" /> with
+    ///     <see cref="ResourceType.CpuCores" />, but also remembers which logical processors
+    ///     belong to the unit. If core pinning is enabled, tasks assigned to this unit will
+    ///     only be allowed to run on these processors. Normally, you'd add one unit per
+    ///     physical CPU, per NUMA node or per core complex sharing a last-level cache.
+    ///   </para>
+    ///   <para>
+    ///     On hybrid CPUs, add the performance cores and the eco cores as separate units.
+    ///     Tasks can then use <see cref="Task.PreferredCores" /> to state which class of
+    ///     cores they want to run on. Units added via <see cref="AddResource" /> count
+    ///     as performance cores.
+    ///   </para>
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API void AddCpuCores(
+      std::size_t coreCount,
+      const std::vector<std::size_t> &processorIndices,
+      bool areEcoCores = false
+    );
+
+    /// <summary>Adds one CPU core unit and one system memory unit per NUMA node</summary>
+    /// <returns>
+    ///   The number of NUMA nodes that were added. If the system does not report any
+    ///   NUMA nodes, nothing is added and zero is returned. In that case, add the system's
+    ///   resources manually via <see cref="AddResource" />.
+    /// </returns>
+    /// <remarks>
+    ///   <para>
+    ///     On machines with multiple CPU sockets, each socket has its own memory controller
+    ///     and accessing another socket's memory costs time and interconnect bandwidth.
+    ///     Registering each node as its own resource unit keeps tasks from spreading
+    ///     over several nodes. System memory unit n always refers to node n and the
+    ///     coordinator will only hand out CPU cores together with their node's memory.
+    ///   </para>
+    ///   <para>
+    ///     On hybrid CPUs, each node is given one CPU core unit for its performance cores
+    ///     and one for its eco cores, so <see cref="Task.PreferredCores" /> picks among
+    ///     the units of a node while the task's memory still comes from the same node.
+    ///   </para>
+    ///   <para>
+    ///     Memory is placed on the node of the thread touching it first, so to also keep
+    ///     a task's memory on its node, combine this with <see cref="EnableCorePinning" />.
+    ///     Nodes without any CPUs (i.e. memory expanders) are skipped.
+    ///   </para>
+    ///   <para>
+    ///     The nodes' memory is reduced by the same reserve for the operating system that
+    ///     <see cref="NaiveTaskCoordinatorFactory.GetUsableMemory" /> subtracts and is
+    ///     capped by the memory limit of the process' cgroup. What remains is split among
+    ///     the nodes in proportion to the amount of memory each of them has.
+    ///   </para>
+    ///   <para>
+    ///     This must be called before any other CPU core or system memory units are added.
+    ///     NUMA nodes are currently only detected on Linux.
+    ///   </para>
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API std::size_t AddNumaNodeResources();
+
+    /// <summary>Enables or disables pinning of tasks to their assigned CPU cores</summary>
+    /// <param name="enable">Whether tasks should be pinned to their CPU core unit</param>
+    /// <remarks>
+    ///   <para>
+    ///     When enabled, the thread executing a task is restricted to the logical processors
+    ///     of the CPU core unit assigned to the task for as long as the task runs. This keeps
+    ///     the task's working set in the caches of one CPU and stops the scheduler from
+    ///     migrating it across sockets. It has no effect for tasks that do not list
+    ///     <see cref="ResourceType.CpuCores" /> in their resource manifest.
+    ///   </para>
+    ///   <para>
+    ///     CPU core units added via <see cref="AddResource" /> do not state which logical
+    ///     processors they cover. Those will be given consecutive slices of the processors
+    ///     the process is allowed to run on when <see cref="Start" /> is called, sized
+    ///     according to the number of cores in each unit.
+    ///   </para>
+    ///   <para>
+    ///     Core pinning is currently only implemented on Linux and must be configured
+    ///     before <see cref="Start" /> is called.
+    ///   </para>
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API void EnableCorePinning(bool enable = true);
+
+    /// <summary>Enables or disables measuring the resources tasks actually use</summary>
+    /// <param name="enable">Whether the resource usage of tasks should be measured</param>
+    /// <remarks>
+    ///   <para>
+    ///     When enabled, the processor time, page faults and storage I/O of the thread
+    ///     running each task are captured before and after <see cref="Task.Run" /> and
+    ///     accumulated per type of task. <see cref="SummarizeTaskUsage" /> then reports
+    ///     the averages and compares them against the tasks' resource manifests, so
+    ///     manifests that are far off can be corrected.
+    ///   </para>
+    ///   <para>
+    ///     Measuring costs a handful of system calls per task, so this is meant to be
+    ///     enabled while profiling. It can be switched on and off at any time.
+    ///   </para>
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API void EnableUsageAccounting(bool enable = true);
+
+    /// <summary>Reports the resources used by each type of task so far</summary>
+    /// <returns>
+    ///   One summary for each type of task that ran while usage accounting was enabled,
+    ///   sorted by the name of the task type
+    /// </returns>
+    public: NUCLEX_PLATFORM_API std::vector<TaskUsageSummary> SummarizeTaskUsage() const;
+
+    /// <summary>Enables or disables tuning resource manifests from observed usage</summary>
+    /// <param name="enable">Whether resource manifests should be tuned</param>
+    /// <remarks>
+    ///   <para>
+    ///     When enabled, the CPU cores and memory used by each type of task are tracked
+    ///     as moving averages (this uses the same measurements as usage accounting).
+    ///     After a task type has run a few times, its tasks are admitted with the learned
+    ///     amounts plus a safety margin instead of the amounts in their manifests.
+    ///     The learned amounts never exceed twice the declared amounts and CPU cores
+    ///     are never raised above the declared amount.
+    ///   </para>
+    ///   <para>
+    ///     Only the CPU cores and system memory a task declared are ever adjusted and
+    ///     memory use can currently only be measured on Linux. The manifests of tasks
+    ///     themselves are never modified.
+    ///   </para>
+    ///   <para>
+    ///     Since only the thread running a task is measured and memory reused from
+    ///     the allocator causes no page faults, the per-task measurements only raise
+    ///     system memory. CPU cores are only lowered for tasks declaring one core or
+    ///     whose manifest sets <see cref="ResourceManifest.CpuCoresMayBeLowered" />.
+    ///   </para>
+    ///   <para>
+    ///     System memory is lowered only when the peak resident memory of the whole
+    ///     process stays below the declared amount. That reclaims memory from tasks
+    ///     declaring far more than the process ever uses, but a task that declares too
+    ///     much in a process holding lots of other memory keeps its declared amount.
+    ///   </para>
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API void EnableManifestLearning(bool enable = true);
+
+    /// <summary>Saves the learned resource usage so it can be reused later</summary>
+    /// <param name="path">Path of the file the learned usage will be written to</param>
+    /// <remarks>
+    ///   The state directory (see <see cref="StandardDirectoryResolver.GetStateDirectory" />)
+    ///   is the intended place for this file. It is a small text file with one line
+    ///   per task type, identified by the name of the task's class.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API void SaveLearnedManifests(const std::string &path) const;
+
+    /// <summary>Loads resource usage learned and saved by an earlier run</summary>
+    /// <param name="path">Path of the file the learned usage will be read from</param>
+    /// <returns>True if the file existed and was read, false otherwise</returns>
+    /// <remarks>
+    ///   With loaded values, tasks are admitted with the learned amounts right from
+    ///   their first run. Lines in the file that can't be understood are ignored.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API bool LoadLearnedManifests(const std::string &path);
+
+    /// <summary>Selects how the coordinator waits for newly scheduled tasks</summary>
+    /// <param name="strategy">Whether to block, yield or spin while waiting</param>
+    /// <param name="pollDuration">
+    ///   How long the coordinator polls for new tasks by yielding or spinning before
+    ///   it blocks. Ignored for <see cref="WakeStrategy.Block" />.
+    /// </param>
+    /// <remarks>
+    ///   <para>
+    ///     By default, the coordinator blocks until a task is scheduled or a running task
+    ///     completes, which costs the least processor time but adds the operating system's
+    ///     wake-up latency to the dispatch of each task. Polling for a short while avoids
+    ///     that latency when tasks are scheduled in quick succession.
+    ///   </para>
+    ///   <para>
+    ///     The wake strategy must be configured before <see cref="Start" /> is called.
+    ///   </para>
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API void SetWakeStrategy(
+      WakeStrategy strategy,
+      std::chrono::microseconds pollDuration = std::chrono::microseconds(50)
+    );
+
+    /// <summary>Reports how the coordinator waits for newly scheduled tasks</summary>
+    /// <returns>The wake strategy the coordinator is using</returns>
+    public: NUCLEX_PLATFORM_API WakeStrategy GetWakeStrategy() const {
+      return this->wakeStrategy;
+    }
+
+    /// <summary>Selects the wake strategy best suited to the system's clocks</summary>
+    /// <param name="clockInfo">
+    ///   Clock characteristics as measured by <see cref="PlatformAppraiser.MeasureClocks" />
+    /// </param>
+    /// <remarks>
+    ///   Uses <see cref="ChooseWakeStrategy" /> with the number of CPU cores added to
+    ///   the coordinator so far, so call this after adding the system's resources and
+    ///   before <see cref="Start" />. The polling window follows the sleep granularity
+    ///   since that is roughly what a blocked coordinator would lose on each wake-up.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API void AdaptWakeStrategy(const Hardware::ClockInfo &clockInfo);
+
+    /// <summary>Decides which wake strategy suits a system's clocks best</summary>
+    /// <param name="clockInfo">Measured clock characteristics of the system</param>
+    /// <param name="cpuCoreCount">Number of CPU cores available to tasks</param>
+    /// <returns>The wake strategy that should be used</returns>
+    /// <remarks>
+    ///   <para>
+    ///     Polling needs a processor to spare and a clock that is cheap to read, since
+    ///     the poll loop keeps checking whether its window has expired. With a single core
+    ///     or a clock that has to be read through the kernel (such as the HPET or ACPI PM
+    ///     timer), blocking right away is chosen.
+    ///   </para>
+    ///   <para>
+    ///     Spinning is only chosen on systems with a few cores and a clock that is read
+    ///     without involving the kernel. Otherwise, the coordinator yields while it polls
+    ///     so the processor remains available to other threads.
+    ///   </para>
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static WakeStrategy ChooseWakeStrategy(
+      const Hardware::ClockInfo &clockInfo, std::size_t cpuCoreCount
+    );
+
     /// <summary>Begins execution of scheduled tasks</summary>
     /// <remarks>
     ///   After this method is called, the <see cref="AddResources" /> method must not be
@@ -166,6 +429,30 @@ namespace Nuclex { namespace Platform { namespace Tasks {
     /// <summary>Thread that launches incoming tasks acoording to available resources</summary>
     private: void coordinationThread();
 
+    /// <summary>Wakes the coordination thread so it checks for runnable tasks</summary>
+    private: void wakeCoordinationThread();
+
+    /// <summary>Yields or spins until a wake-up is pending or the poll window expires</summary>
+    /// <returns>True if a wake-up is pending, false if the poll window expired</returns>
+    private: bool pollForWakeUp();
+
+    /// <summary>Adds CPU core and system memory units for NUMA nodes in sysfs</summary>
+    /// <param name="devicesPath">Path to the devices directory in sysfs</param>
+    /// <param name="procPath">Path at which procfs is mounted</param>
+    /// <param name="cgroupRootPath">Path at which the cgroup v2 filesystem is mounted</param>
+    /// <returns>The number of NUMA nodes that were added</returns>
+    /// <remarks>
+    ///   Only exists so that unit tests can point the coordinator at fake file trees
+    /// </remarks>
+    protected: NUCLEX_PLATFORM_API std::size_t AddNumaNodeResources(
+      const std::string &devicesPath,
+      const std::string &procPath,
+      const std::string &cgroupRootPath
+    );
+
+    /// <summary>Assigns logical processors to CPU core units that didn't specify any</summary>
+    private: void distributeProcessorsToCpuCoreUnits();
+
     /// <summary>
     ///   Helper that calls the <see cref="coordinateAndKickOffIncomingTasks" /> method
     /// </summary>
@@ -186,12 +473,20 @@ namespace Nuclex { namespace Platform { namespace Tasks {
       ) :
         PrimaryEnvironment(environment),
         PrimaryTask(task),
+        EffectiveResources(),
         AssignedResourceIndices() {}
 
       /// <summary>Environment that needs to be active for the task, can be empty</summary>
       public: std::shared_ptr<TaskEnvironment> PrimaryEnvironment;
       /// <summary>Task to be executed</summary>
       public: std::shared_ptr<Task> PrimaryTask;
+      /// <summary>Resources the task is admitted with</summary>
+      /// <remarks>
+      ///   Either the task's own resource manifest or, with manifest learning, one
+      ///   tuned to the resources that type of task was observed to use. Set when
+      ///   the resources are allocated and used to release them again.
+      /// </remarks>
+      public: std::shared_ptr<ResourceManifest> EffectiveResources;
       /// <summary>The indices of the resource units assigned to this task</summary>
       /// <remarks>
       ///   When there are multiple units providing a resource (for example, multiple GPUs),
@@ -214,25 +509,134 @@ namespace Nuclex { namespace Platform { namespace Tasks {
 
       /// <summary>Task environment that is currently active</summary>
       public: std::shared_ptr<TaskEnvironment> Environment;
-      /// <summary>Units that have been selected to provide the resources</summary>
-      public: std::array<std::size_t, MaximumResourceType + 1> SelectedUnits;
       /// <summary>Number of tasks that are using this environment right now</summary>
       public: std::size_t ActiveTaskCount;
+      /// <summary>False while the environment is being activated or shut down</summary>
+      public: bool IsActive;
 
     };
 
     #pragma endregion // struct ActiveEnvironment
 
+    #pragma region struct CpuCoreUnit
+
+    /// <summary>CPU cores that have been added as one resource unit</summary>
+    private: struct CpuCoreUnit {
+
+      /// <summary>Number of CPU cores the unit provides</summary>
+      public: std::size_t CoreCount;
+      /// <summary>Logical processors that make up the unit</summary>
+      /// <remarks>
+      ///   Units for which no processors were specified have an empty list until
+      ///   <see cref="Start" /> is called and processors are distributed among them.
+      /// </remarks>
+      public: std::vector<std::size_t> ProcessorIndices;
+      /// <summary>Whether the unit consists of eco cores rather than performance cores</summary>
+      public: bool IsEcoCore;
+      /// <summary>System memory unit of the NUMA node the cores belong to</summary>
+      /// <remarks>
+      ///   Is std::size_t(-1) if the unit doesn't belong to a NUMA node. Otherwise,
+      ///   the unit is only ever allocated together with this system memory unit.
+      /// </remarks>
+      public: std::size_t SystemMemoryUnitIndex;
+
+    };
+
+    #pragma endregion // struct CpuCoreUnit
+
+    /// <summary>Tries to allocate the resources a scheduled task needs to run</summary>
+    /// <param name="scheduledTask">Task whose resources will be allocated</param>
+    /// <returns>True if the resources were allocated, false if they were insufficient</returns>
+    private: bool tryAllocateResources(ScheduledTask &scheduledTask);
+
+    /// <summary>Records that the task on the calling thread has entered a blocking region</summary>
+    /// <returns>
+    ///   The task coordinator executing the calling thread's task or a null pointer if
+    ///   the calling thread isn't running a task
+    /// </returns>
+    private: static NaiveTaskCoordinator *enterBlockingRegion();
+
+    /// <summary>Records that the task on the calling thread has left a blocking region</summary>
+    /// <param name="self">Task coordinator that was returned when entering the region</param>
+    private: static void leaveBlockingRegion(NaiveTaskCoordinator *self);
+
+    /// <summary>Activates a task environment unless it is already active</summary>
+    /// <param name="environment">Environment a task that is about to run needs</param>
+    /// <remarks>
+    ///   Waits if the environment is being activated or shut down by another thread.
+    ///   Each call must be matched by a call to <see cref="shutDownEnvironment" />.
+    /// </remarks>
+    private: void activateEnvironment(const std::shared_ptr<TaskEnvironment> &environment);
+
+    /// <summary>Shuts a task environment down if no other task is using it</summary>
+    /// <param name="environment">Environment a task that has ended was using</param>
+    private: void shutDownEnvironment(const std::shared_ptr<TaskEnvironment> &environment);
+
+    /// <summary>Executes a task that has been assigned its resources</summary>
+    /// <param name="scheduledTask">Task that will be executed in the calling thread</param>
+    private: void runScheduledTask(const ScheduledTask &scheduledTask);
+
+    /// <summary>
+    ///   Helper that calls the <see cref="runScheduledTask" /> method
+    /// </summary>
+    /// <param name="self">The 'this' pointer of the task coordinator instance</param>
+    /// <param name="scheduledTask">Task that will be executed in the calling thread</param>
+    private: static void invokeScheduledTask(
+      NaiveTaskCoordinator *self, const ScheduledTask &scheduledTask
+    );
+
     /// <summary>Tracks the resources available on the system</summary>
     private: std::unique_ptr<ResourceBudget> availableResources;
     /// <summary>Number of CPU cores that have been added as resources in total</summary>
     private: std::size_t totalCpuCoreCount;
+    /// <summary>Cores and logical processors of each CPU core unit, indexed by unit</summary>
+    private: std::vector<CpuCoreUnit> cpuCoreUnits;
+    /// <summary>Logical processors the process could run on when Start() was called</summary>
+    private: std::vector<std::size_t> unpinnedProcessors;
+    /// <summary>Number of NUMA nodes whose CPU core and memory units are paired</summary>
+    /// <remarks>
+    ///   If this is non-zero, system memory unit n belongs to NUMA node n and each CPU
+    ///   core unit is always allocated together with the memory unit of its node.
+    /// </remarks>
+    private: std::size_t numaNodeCount;
+    /// <summary>Whether CPU core units of both performance and eco cores exist</summary>
+    /// <remarks>
+    ///   Determined when <see cref="Start" /> is called. Unless this is set, the core
+    ///   preferences of tasks are ignored.
+    /// </remarks>
+    private: bool hasHybridCpuCoreUnits;
+    /// <summary>Whether task threads will be pinned to their CPU core unit</summary>
+    private: bool corePinningEnabled;
+    /// <summary>Whether the resources used by tasks are being measured</summary>
+    private: std::atomic<bool> usageAccountingEnabled;
+    /// <summary>Accumulates the measured resource usage of tasks</summary>
+    private: std::unique_ptr<TaskUsageLedger> usageLedger;
+    /// <summary>Whether tasks are admitted with learned resource manifests</summary>
+    private: std::atomic<bool> manifestLearningEnabled;
+    /// <summary>Tracks the resources each type of task uses to tune its manifest</summary>
+    private: std::unique_ptr<ManifestLearner> manifestLearner;
+    /// <summary>Used to signal cancellation to running tasks when shutting down</summary>
+    private: std::shared_ptr<Nuclex::Support::Threading::StopSource> cancellationTrigger;
     
+    /// <summary>Number of tasks that may run at once while none of them block</summary>
+    /// <remarks>
+    ///   One thread per CPU core plus four threads per GPU. Set when <see cref="Start" />
+    ///   is called.
+    /// </remarks>
+    private: std::size_t regularTaskThreadCount;
+    /// <summary>Number of tasks that may run at once including those that block</summary>
+    private: std::size_t maximumTaskThreadCount;
+    /// <summary>Number of tasks that have been handed to the thread pool</summary>
+    private: std::atomic<std::size_t> runningTaskCount;
+    /// <summary>Number of running tasks that are inside a blocking region</summary>
+    private: std::atomic<std::size_t> blockedTaskCount;
+
     /// <summary>Thread pool used to start off the scheduled tasks</summary>
     /// <remarks>
     ///   Only optional so it can be constructed at a later time. Is set when
     ///   the <see cref="Start" /> method is called. Contains as many ready threads
-    ///   as there are cpu cores added to the task coordinator.
+    ///   as there are cpu cores added to the task coordinator and is allowed to grow
+    ///   beyond that while tasks are blocked.
     /// </remarks>
     private: std::optional<Nuclex::Support::Threading::ThreadPool> threadPool;
 
@@ -252,6 +656,23 @@ namespace Nuclex { namespace Platform { namespace Tasks {
     ///   Also gets posted for a silly number of tasks when a shutdown is requested.
     /// </remarks>
     private: Nuclex::Support::Threading::Semaphore tasksAvailableSemaphore;
+    /// <summary>Number of times the semaphore was posted but not yet waited on</summary>
+    /// <remarks>
+    ///   Incremented before the semaphore is posted, so the coordination thread can poll
+    ///   this instead of the semaphore without entering the operating system.
+    /// </remarks>
+    private: std::atomic<std::size_t> pendingWakeUpCount;
+    /// <summary>How the coordination thread waits for newly scheduled tasks</summary>
+    private: WakeStrategy wakeStrategy;
+    /// <summary>How long the coordination thread polls before blocking</summary>
+    private: std::chrono::microseconds wakePollDuration;
+
+    /// <summary>Mutex that must be held when accessing the active environments</summary>
+    private: std::mutex environmentAccessMutex;
+    /// <summary>Signalled when an environment finished activating or shutting down</summary>
+    private: std::condition_variable environmentStateChanged;
+    /// <summary>Environments that are active or being activated or shut down</summary>
+    private: std::vector<ActiveEnvironment> activeEnvironments;
 
   };
 
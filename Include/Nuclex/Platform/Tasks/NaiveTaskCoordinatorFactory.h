@@ -0,0 +1,221 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_TASKS_NAIVETASKCOORDINATORFACTORY_H
+#define NUCLEX_PLATFORM_TASKS_NAIVETASKCOORDINATORFACTORY_H
+
+#include "Nuclex/Platform/Config.h"
+
+#include "Nuclex/Platform/Tasks/NaiveTaskCoordinator.h"
+#include "Nuclex/Platform/Hardware/CpuInfo.h"
+#include "Nuclex/Platform/Hardware/CpuBudget.h"
+#include "Nuclex/Platform/Hardware/MemoryInfo.h"
+#include "Nuclex/Platform/Hardware/GpuInfo.h"
+#include "Nuclex/Platform/Hardware/ClockInfo.h"
+#include "Nuclex/Platform/Hardware/PlatformInfo.h"
+
+#include <memory> // for std::unique_ptr, std::shared_ptr
+#include <vector> // for std::vector
+#include <future> // for std::future
+
+namespace Nuclex { namespace Support { namespace Threading {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  class StopToken;
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Support::Threading
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Sets up task coordinators matching the system's hardware</summary>
+  /// <remarks>
+  ///   <para>
+  ///     Instead of hand-picking resource units, you can let this factory build a task
+  ///     coordinator from the findings of the <see cref="Hardware.PlatformAppraiser" />.
+  ///     Each physical CPU becomes its own CPU core unit (or each NUMA node, where
+  ///     the system reports more than one), installed memory becomes a system memory unit
+  ///     minus a reserve for the operating system and each GPU with dedicated memory
+  ///     becomes a video memory unit. Hybrid CPUs are split into a unit of performance
+  ///     cores and a unit of eco cores where the processors of each class are known.
+  ///   </para>
+  ///   <para>
+  ///     For NUMA nodes and split hybrid CPUs, the factory also enables core pinning
+  ///     (see <see cref="NaiveTaskCoordinator.EnableCorePinning" />), so that tasks
+  ///     really run on the unit they were assigned and, on NUMA systems, allocate their
+  ///     memory from the node whose memory was reserved for them.
+  ///   </para>
+  ///   <para>
+  ///     The coordinator's thread pool is sized from these units when you call
+  ///     <see cref="NaiveTaskCoordinator.Start" />, so the coordinators returned by
+  ///     the factory only need to be started (after adding any custom resources).
+  ///   </para>
+  /// </remarks>
+  class NUCLEX_PLATFORM_TYPE NaiveTaskCoordinatorFactory {
+
+    /// <summary>Analyzes the system and builds a matching task coordinator</summary>
+    /// <param name="canceller">
+    ///   Allows cancellation of the hardware analysis before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide the configured, but not yet
+    ///   started task coordinator once the analysis has completed
+    /// </returns>
+    /// <remarks>
+    ///   The CPU and memory analyses run in parallel to each other and to the caller,
+    ///   so the intended use is to call this early during application startup and only
+    ///   collect the coordinator when the first task needs to be scheduled. The system's
+    ///   clocks are measured as well to pick the coordinator's wake strategy. If the
+    ///   process' affinity, cpuset or CPU quota leave it fewer processors than installed,
+    ///   the CPUs are passed through <see cref="RestrictToBudget" /> first.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static std::future<
+      std::unique_ptr<NaiveTaskCoordinator>
+    > CreateForThisSystem(
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Analyzes the system in a thread pool and builds a task coordinator</summary>
+    /// <param name="threadPool">Thread pool in which the analyses will run</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the hardware analysis before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide the configured, but not yet
+    ///   started task coordinator once the analysis has completed
+    /// </returns>
+    /// <remarks>
+    ///   Works like the other overload, but the analyses run in the thread pool (via
+    ///   <see cref="Hardware.PlatformAppraiser.AnalyzeAll" />) and no other threads are
+    ///   started. The returned future is deferred, so the coordinator is assembled in
+    ///   the thread that calls its get() method and no pool thread has to wait for
+    ///   the analyses.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static std::future<
+      std::unique_ptr<NaiveTaskCoordinator>
+    > CreateForThisSystem(
+      Support::Threading::ThreadPool &threadPool,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Analyzes the system as coordinated tasks and builds a task coordinator</summary>
+    /// <param name="taskCoordinator">Task coordinator that will run the analyses</param>
+    /// <param name="canceller">
+    ///   Allows cancellation of the hardware analysis before it is finished
+    /// </param>
+    /// <returns>
+    ///   An <see cref="std::future" /> that will provide the configured, but not yet
+    ///   started task coordinator once the analysis has completed
+    /// </returns>
+    /// <remarks>
+    ///   Works like the thread pool overload, with each analysis scheduled as a task
+    ///   occupying one CPU core. If the task coordinator is shut down before the
+    ///   analyses have run, the future will report a broken promise.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static std::future<
+      std::unique_ptr<NaiveTaskCoordinator>
+    > CreateForThisSystem(
+      TaskCoordinator &taskCoordinator,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller = (
+        std::shared_ptr<const Support::Threading::StopToken>()
+      )
+    );
+
+    /// <summary>Builds a task coordinator for the specified hardware</summary>
+    /// <param name="cpus">Physical CPUs, as reported by the platform appraiser</param>
+    /// <param name="memory">Memory of the system, as reported by the platform appraiser</param>
+    /// <param name="gpus">GPUs that can be used for tasks, may be empty</param>
+    /// <returns>A configured task coordinator that has not been started yet</returns>
+    public: NUCLEX_PLATFORM_API static std::unique_ptr<NaiveTaskCoordinator> CreateFor(
+      const std::vector<Hardware::CpuInfo> &cpus,
+      const Hardware::MemoryInfo &memory,
+      const std::vector<Hardware::GpuInfo> &gpus = std::vector<Hardware::GpuInfo>()
+    );
+
+    /// <summary>Calculates how much system memory tasks should be allowed to use</summary>
+    /// <param name="memory">Memory of the system, as reported by the platform appraiser</param>
+    /// <returns>The amount of memory in bytes that will be made available to tasks</returns>
+    /// <remarks>
+    ///   This subtracts a reserve for the operating system and other applications, which
+    ///   would otherwise be forced into swapping when the tasks make full use of memory.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static std::size_t GetUsableMemory(
+      const Hardware::MemoryInfo &memory
+    );
+
+    /// <summary>Removes the cores and processors the process may not use</summary>
+    /// <param name="cpus">Physical CPUs, as reported by the platform appraiser</param>
+    /// <param name="budget">Share of the CPUs the process is allowed to use</param>
+    /// <returns>The CPUs, reduced to the cores and processors within the budget</returns>
+    /// <remarks>
+    ///   Cores keep their type and CPUs stay separate, so hybrid CPUs and multi-socket
+    ///   systems are still recognized as such. Cores whose processors are not known are
+    ///   kept, and if a CPU time quota allows fewer threads than there are available
+    ///   processors, the last cores are dropped until the thread count fits the quota.
+    /// </remarks>
+    public: NUCLEX_PLATFORM_API static std::vector<Hardware::CpuInfo> RestrictToBudget(
+      const std::vector<Hardware::CpuInfo> &cpus, const Hardware::CpuBudget &budget
+    );
+
+    /// <summary>Runs in a thread to analyze the system and build a coordinator</summary>
+    /// <param name="canceller">Allows the analysis to be cancelled</param>
+    /// <returns>A configured task coordinator that has not been started yet</returns>
+    private: static std::unique_ptr<NaiveTaskCoordinator> createForThisSystemAsync(
+      std::shared_ptr<const Support::Threading::StopToken> canceller
+    );
+
+    /// <summary>Builds a coordinator once the platform analyses have completed</summary>
+    /// <param name="platform">Future that will provide the results of the analyses</param>
+    /// <param name="clocks">Future that will provide the clock measurements</param>
+    /// <param name="canceller">Allows the analysis to be cancelled</param>
+    /// <returns>A deferred future that builds the coordinator from the results</returns>
+    private: static std::future<std::unique_ptr<NaiveTaskCoordinator>> createWhenAnalyzed(
+      std::future<Hardware::PlatformInfo> &&platform,
+      std::future<Hardware::ClockInfo> &&clocks,
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller
+    );
+
+    /// <summary>Builds a coordinator from the results of the platform analyses</summary>
+    /// <param name="cpus">Physical CPUs, as reported by the platform appraiser</param>
+    /// <param name="memory">Memory of the system, as reported by the platform appraiser</param>
+    /// <param name="gpus">GPUs that can be used for tasks, may be empty</param>
+    /// <param name="clocks">Clocks of the system, as measured by the platform appraiser</param>
+    /// <returns>A configured task coordinator that has not been started yet</returns>
+    private: static std::unique_ptr<NaiveTaskCoordinator> createFromAnalyses(
+      const std::vector<Hardware::CpuInfo> &cpus,
+      const Hardware::MemoryInfo &memory,
+      const std::vector<Hardware::GpuInfo> &gpus,
+      const Hardware::ClockInfo &clocks
+    );
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
+
+#endif // NUCLEX_PLATFORM_TASKS_NAIVETASKCOORDINATORFACTORY_H
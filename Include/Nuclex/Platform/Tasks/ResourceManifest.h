@@ -100,8 +100,18 @@ namespace Nuclex { namespace Platform { namespace Tasks {
     ///   This field is initialized to 0 (no hard drives accessed). It should be directly
     ///   assigned in case a workload accesses any hard drives. Methods such as
     ///   <see cref="Combine" /> will use bitwise operations as appropriate for flags.
+    ///   The <see cref="Hardware.StoreLocator" /> can provide the bit for any path.
     /// </remarks>
     public: std::size_t AccessedHardDriveMask;
+    /// <summary>Whether manifest learning may admit the task with fewer CPU cores</summary>
+    /// <remarks>
+    ///   Manifest learning only measures the processor time of the thread that runs
+    ///   the task, so by default, tasks declaring more than one CPU core are never
+    ///   admitted with fewer cores than declared. Set this if the task does all of its
+    ///   work in the calling thread and may have declared more cores than it needs.
+    ///   Initialized to false, <see cref="Combine" /> only keeps it if both manifests set it.
+    /// </remarks>
+    public: bool CpuCoresMayBeLowered;
 
     // Could track NetworkAdapters to focus bandwidth on single action, but pointless?
     // Could track Camera accesses, but makes little sense?
@@ -22,6 +22,7 @@ limitations under the License.
 
 #include "Nuclex/Platform/Config.h"
 #include "Nuclex/Platform/Tasks/ResourceType.h" // for ResourceType enum
+#include "Nuclex/Platform/Tasks/CorePreference.h" // for CorePreference enum
 
 #include <array> // for std:;array
 #include <memory> // for std::shared_ptr
@@ -60,6 +61,11 @@ namespace Nuclex { namespace Platform { namespace Tasks {
   /// </remarks>
   class NUCLEX_PLATFORM_TYPE Task {
 
+    /// <summary>Initializes a new task</summary>
+    public: NUCLEX_PLATFORM_API Task() :
+      Resources(),
+      PreferredCores(CorePreference::Any) {}
+
     /// <summary>Frees all resources owned by the task</summary>
     /// <remarks>
     ///   The task must be either finished or cancelled before it may be destroyed.
@@ -69,6 +75,15 @@ namespace Nuclex { namespace Platform { namespace Tasks {
     /// <summary>Resources that this task will consume while it runs</summary>
     public: std::shared_ptr<ResourceManifest> Resources;
 
+    /// <summary>Class of CPU cores the task should be executed on</summary>
+    /// <remarks>
+    ///   Only has an effect if the task coordinator knows about performance and eco cores
+    ///   in the system and the task lists <see cref="ResourceType.CpuCores" /> in its
+    ///   resource manifest. Mark latency-critical tasks with a preference for performance
+    ///   cores and background work with a preference for eco cores.
+    /// </remarks>
+    public: CorePreference PreferredCores;
+
     /// <summary>Executes the task, using the specified resource units</summary>
     /// <param name="resourceUnitIndices">
     ///   when you set up the task coordinator, you specify one or more &quot;units&quot;
@@ -0,0 +1,102 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_TASKS_TASKUSAGESUMMARY_H
+#define NUCLEX_PLATFORM_TASKS_TASKUSAGESUMMARY_H
+
+#include "Nuclex/Platform/Config.h"
+#include "Nuclex/Platform/Tasks/ManifestFit.h" // for ManifestFit
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t
+#include <string> // for std::string
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Resources that all runs of one type of task have actually used</summary>
+  /// <remarks>
+  ///   <para>
+  ///     Produced by the <see cref="NaiveTaskCoordinator" /> when usage accounting is
+  ///     enabled. Only the thread executing <see cref="Task.Run" /> is measured, so tasks
+  ///     that hand their work to threads of their own will appear to use less CPU time
+  ///     than they do.
+  ///   </para>
+  ///   <para>
+  ///     Memory use is estimated from the page faults of the task's thread, which counts
+  ///     memory the task touched for the first time. Memory recycled from an allocator's
+  ///     pool causes no page faults and a transparent huge page is faulted in at once,
+  ///     so this is a lower bound. The peak resident memory of the whole process is
+  ///     recorded as an upper bound.
+  ///   </para>
+  /// </remarks>
+  class NUCLEX_PLATFORM_TYPE TaskUsageSummary {
+
+    /// <summary>Name of the class implementing the task</summary>
+    public: std::string TaskTypeName;
+    /// <summary>Number of times a task of this type has been run</summary>
+    public: std::size_t RunCount;
+
+    /// <summary>Average time a run took from start to finish</summary>
+    public: double AverageWallSeconds;
+    /// <summary>Average processor time a run consumed</summary>
+    public: double AverageCpuSeconds;
+    /// <summary>Average number of CPU cores the task kept busy while running</summary>
+    public: double AverageCoresUsed;
+    /// <summary>Number of CPU cores the task's resource manifest declared</summary>
+    public: std::size_t DeclaredCpuCores;
+    /// <summary>How well the declared CPU cores match the cores used</summary>
+    /// <remarks>
+    ///   Unknown for tasks declaring more than one core unless their manifest sets
+    ///   <see cref="ResourceManifest.CpuCoresMayBeLowered" />, because they may keep
+    ///   their other cores busy with threads that aren't measured.
+    /// </remarks>
+    public: ManifestFit CpuFit;
+
+    /// <summary>Average number of bytes of memory a run touched for the first time</summary>
+    public: std::size_t AverageTouchedMemory;
+    /// <summary>Highest number of bytes of memory touched by any single run</summary>
+    public: std::size_t PeakTouchedMemory;
+    /// <summary>Highest resident memory of the whole process after any run</summary>
+    /// <remarks>
+    ///   Includes everything else the process holds, but no run can have used more than
+    ///   this. Zero where unsupported.
+    /// </remarks>
+    public: std::size_t PeakResidentMemory;
+    /// <summary>Amount of system memory the task's resource manifest declared</summary>
+    public: std::size_t DeclaredSystemMemory;
+    /// <summary>How well the declared system memory matches the memory used</summary>
+    public: ManifestFit MemoryFit;
+
+    /// <summary>Average number of bytes a run read from storage devices</summary>
+    /// <remarks>
+    ///   Reads served from the page cache are not counted. Zero where unsupported.
+    /// </remarks>
+    public: std::uint64_t AverageBytesRead;
+    /// <summary>Average number of bytes a run caused to be written to storage devices</summary>
+    public: std::uint64_t AverageBytesWritten;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
+
+#endif // NUCLEX_PLATFORM_TASKS_TASKUSAGESUMMARY_H
@@ -0,0 +1,57 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_TASKS_WAKESTRATEGY_H
+#define NUCLEX_PLATFORM_TASKS_WAKESTRATEGY_H
+
+#include "Nuclex/Platform/Config.h"
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>How a task coordinator waits for newly scheduled tasks</summary>
+  /// <remarks>
+  ///   <para>
+  ///     Waking a blocked thread goes through the operating system's scheduler, which
+  ///     adds anywhere from a few microseconds to a full timer interval before the thread
+  ///     runs again. Polling for a short while before blocking avoids that delay when
+  ///     tasks arrive in quick succession, at the cost of keeping a processor busy.
+  ///   </para>
+  ///   <para>
+  ///     The coordinator always falls back to blocking once the polling window has
+  ///     passed, so no strategy keeps a processor busy while the coordinator is idle.
+  ///   </para>
+  /// </remarks>
+  enum class NUCLEX_PLATFORM_TYPE WakeStrategy {
+
+    /// <summary>Blocks in the operating system right away (a futex wait on Linux)</summary>
+    Block,
+    /// <summary>Yields the time slice to other threads while polling, then blocks</summary>
+    Yield,
+    /// <summary>Busy-waits on the processor while polling, then blocks</summary>
+    Spin
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
+
+#endif // NUCLEX_PLATFORM_TASKS_WAKESTRATEGY_H
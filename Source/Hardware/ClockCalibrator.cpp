@@ -0,0 +1,129 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./ClockCalibrator.h"
+
+#include <Nuclex/Support/Threading/StopToken.h> // for StopToken
+
+#if defined(NUCLEX_PLATFORM_X86)
+#include "../Platform/X86CpuidApi.h" // for X86CpuidApi
+#endif
+
+#include <algorithm> // for std::min(), std::nth_element()
+#include <array> // for std::array
+#include <chrono> // for std::chrono::steady_clock
+#include <cstdint> // for std::uint32_t
+#include <thread> // for std::this_thread::sleep_for()
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Number of clock reads that are timed together in one round</summary>
+  const std::size_t ClockReadsPerRound = 10000;
+
+  /// <summary>Number of rounds of clock reads, the fastest round is reported</summary>
+  const std::size_t ClockReadRoundCount = 5;
+
+  /// <summary>Number of times the sleep granularity is sampled</summary>
+  const std::size_t SleepSampleCount = 9;
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::optional<bool> ClockCalibrator::TryDetectInvariantTsc() {
+#if defined(NUCLEX_PLATFORM_X86)
+    using Nuclex::Platform::Platform::X86CpuidApi;
+
+    // Leaf 1 EDX bit 4 tells whether the CPU has a time stamp counter at all
+    std::uint32_t registers[4];
+    if(!X86CpuidApi::TryQuery(1, 0, registers)) {
+      return std::optional<bool>();
+    }
+    if((registers[X86CpuidApi::Edx] & (1U << 4)) == 0) {
+      return std::optional<bool>();
+    }
+
+    // Leaf 0x80000007 EDX bit 8 is the invariant TSC flag on both Intel and AMD CPUs
+    if(!X86CpuidApi::TryQuery(0x80000007U, 0, registers)) {
+      return false;
+    }
+
+    return ((registers[X86CpuidApi::Edx] & (1U << 8)) != 0);
+#else
+    return std::optional<bool>();
+#endif
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  double ClockCalibrator::MeasureClockReadNanoseconds() {
+    typedef std::chrono::steady_clock Clock;
+
+    Clock::duration fastestRound = Clock::duration::max();
+    for(std::size_t round = 0; round < ClockReadRoundCount; ++round) {
+      Clock::time_point startTime = Clock::now();
+      Clock::time_point endTime = startTime;
+      for(std::size_t index = 0; index < ClockReadsPerRound; ++index) {
+        endTime = Clock::now();
+      }
+
+      fastestRound = std::min(fastestRound, endTime - startTime);
+    }
+
+    double nanoseconds = std::chrono::duration<double, std::nano>(fastestRound).count();
+    return nanoseconds / static_cast<double>(ClockReadsPerRound);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  double ClockCalibrator::MeasureSleepGranularityMicroseconds(
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller
+  ) {
+    typedef std::chrono::steady_clock Clock;
+
+    // The median is used rather than the minimum because an occasional lucky sample
+    // (i.e. a timer interrupt arriving just after the sleep began) is not representative
+    // of what a thread will usually experience.
+    std::array<double, SleepSampleCount> samples;
+    for(std::size_t index = 0; index < SleepSampleCount; ++index) {
+      canceller->ThrowIfCanceled();
+
+      Clock::time_point startTime = Clock::now();
+      std::this_thread::sleep_for(std::chrono::microseconds(1));
+      Clock::time_point endTime = Clock::now();
+
+      samples[index] = std::chrono::duration<double, std::micro>(endTime - startTime).count();
+    }
+
+    std::nth_element(samples.begin(), samples.begin() + SleepSampleCount / 2, samples.end());
+    return samples[SleepSampleCount / 2];
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
@@ -0,0 +1,73 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_CLOCKCALIBRATOR_H
+#define NUCLEX_PLATFORM_HARDWARE_CLOCKCALIBRATOR_H
+
+#include "Nuclex/Platform/Config.h"
+
+#include <memory> // for std::shared_ptr
+#include <optional> // for std::optional
+
+namespace Nuclex { namespace Support { namespace Threading {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  class StopToken;
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Support::Threading
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Measures the cost and resolution of the system's timing facilities</summary>
+  /// <remarks>
+  ///   All measurements are taken on the calling thread and repeated a few times so
+  ///   that a single preemption by the scheduler does not skew the results.
+  /// </remarks>
+  class ClockCalibrator {
+
+    /// <summary>Checks whether the CPU's time stamp counter runs at a constant rate</summary>
+    /// <returns>
+    ///   True if the time stamp counter is invariant, false if it is not and nothing
+    ///   if the CPU has no time stamp counter or is not an x86 CPU
+    /// </returns>
+    public: static std::optional<bool> TryDetectInvariantTsc();
+
+    /// <summary>Measures how long a call to the steady clock takes on average</summary>
+    /// <returns>The average duration of a call to the steady clock in nanoseconds</returns>
+    public: static double MeasureClockReadNanoseconds();
+
+    /// <summary>Measures how long a thread really sleeps when asked to sleep 1 µs</summary>
+    /// <param name="canceller">Allows the measurement to be cancelled</param>
+    /// <returns>The median time slept in microseconds</returns>
+    public: static double MeasureSleepGranularityMicroseconds(
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller
+    );
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_CLOCKCALIBRATOR_H
@@ -0,0 +1,326 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "Nuclex/Platform/Hardware/CpuLoadSampler.h"
+
+#include "./SequenceLockHelper.h" // for SequenceLockHelper
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+#include "./LinuxProcStatReader.h" // for LinuxProcStatReader
+#elif defined(NUCLEX_PLATFORM_WINDOWS)
+#include "../Platform/WindowsApi.h" // for ::GetSystemTimes()
+#endif
+
+#include <cstdint> // for std::uint64_t
+#include <thread> // for std::thread::hardware_concurrency()
+#include <utility> // for std::swap()
+#include <vector> // for std::vector
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Calculates the difference between two readings of a tick counter</summary>
+  /// <param name="before">Value of the counter in the earlier reading</param>
+  /// <param name="after">Value of the counter in the later reading</param>
+  /// <returns>The number of ticks that passed, zero if the counter went backwards</returns>
+  /// <remarks>
+  ///   Linux' iowait counter is known to go backwards occasionally on some kernels.
+  /// </remarks>
+  std::uint64_t ticksBetween(std::uint64_t before, std::uint64_t after) {
+    if(after > before) {
+      return after - before;
+    } else {
+      return 0;
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Calculates a percentage from two tick counts</summary>
+  /// <param name="ticks">Ticks spent in the state being measured</param>
+  /// <param name="totalTicks">Ticks that passed in total</param>
+  /// <returns>The percentage of total ticks spent in the state, clamped to 100</returns>
+  float percentOf(std::uint64_t ticks, std::uint64_t totalTicks) {
+    if(totalTicks == 0) {
+      return 0.0f;
+    } else if(ticks >= totalTicks) {
+      return 100.0f;
+    } else {
+      return static_cast<float>(ticks) * 100.0f / static_cast<float>(totalTicks);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+  /// <summary>Calculates the load between two readings of a processor's counters</summary>
+  /// <param name="before">Counters of the processor in the earlier reading</param>
+  /// <param name="after">Counters of the processor in the later reading</param>
+  /// <returns>How the processor spent its time between the readings</returns>
+  Nuclex::Platform::Hardware::CpuLoad loadBetween(
+    const Nuclex::Platform::Hardware::LinuxCpuTimes &before,
+    const Nuclex::Platform::Hardware::LinuxCpuTimes &after
+  ) {
+    std::uint64_t totalTicks = ticksBetween(before.TotalTicks, after.TotalTicks);
+
+    Nuclex::Platform::Hardware::CpuLoad load;
+    load.BusyPercent = percentOf(ticksBetween(before.BusyTicks, after.BusyTicks), totalTicks);
+    load.IoWaitPercent = percentOf(
+      ticksBetween(before.IoWaitTicks, after.IoWaitTicks), totalTicks
+    );
+    load.StealPercent = percentOf(
+      ticksBetween(before.StealTicks, after.StealTicks), totalTicks
+    );
+    return load;
+  }
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+  // ------------------------------------------------------------------------------------------- //
+
+#if defined(NUCLEX_PLATFORM_WINDOWS)
+  /// <summary>Converts a FILETIME into a 64 bit integer</summary>
+  /// <param name="fileTime">File time that will be converted</param>
+  /// <returns>The number of 100 ns intervals stored in the file time</returns>
+  std::uint64_t toTicks(const ::FILETIME &fileTime) {
+    return (
+      (static_cast<std::uint64_t>(fileTime.dwHighDateTime) << 32) |
+      static_cast<std::uint64_t>(fileTime.dwLowDateTime)
+    );
+  }
+#endif // defined(NUCLEX_PLATFORM_WINDOWS)
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Load of one processor in a form that can be read without locking</summary>
+  struct CpuLoadSampler::PublishedLoad {
+
+    /// <summary>Published busy percentage</summary>
+    public: std::atomic<float> BusyPercent;
+    /// <summary>Published I/O wait percentage</summary>
+    public: std::atomic<float> IoWaitPercent;
+    /// <summary>Published steal percentage</summary>
+    public: std::atomic<float> StealPercent;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Platform-specific counters and the previous readings</summary>
+  struct CpuLoadSampler::Sampler {
+
+    /// <summary>Initializes the sampler and takes the baseline reading</summary>
+    public: Sampler() :
+#if defined(NUCLEX_PLATFORM_LINUX)
+      reader(),
+      previousTotal(),
+      currentTotal(),
+      previousProcessors(),
+      currentProcessors(),
+#elif defined(NUCLEX_PLATFORM_WINDOWS)
+      previousIdleTicks(0),
+      previousKernelTicks(0),
+      previousUserTicks(0),
+#endif
+      Loads() {
+#if defined(NUCLEX_PLATFORM_LINUX)
+      std::size_t processorCount = this->reader.CountProcessors();
+      this->previousProcessors.resize(processorCount, LinuxCpuTimes());
+      this->currentProcessors.resize(processorCount, LinuxCpuTimes());
+      this->reader.TryRead(this->previousTotal, this->previousProcessors);
+#elif defined(NUCLEX_PLATFORM_WINDOWS)
+      std::size_t processorCount = std::thread::hardware_concurrency();
+      ::FILETIME idleTime, kernelTime, userTime;
+      if(::GetSystemTimes(&idleTime, &kernelTime, &userTime) != FALSE) {
+        this->previousIdleTicks = toTicks(idleTime);
+        this->previousKernelTicks = toTicks(kernelTime);
+        this->previousUserTicks = toTicks(userTime);
+      }
+#else
+      std::size_t processorCount = std::thread::hardware_concurrency();
+#endif
+      this->Loads.resize(processorCount + 1, CpuLoad { 0.0f, 0.0f, 0.0f });
+    }
+
+    /// <summary>Reads the counters and calculates the load since the last reading</summary>
+    /// <returns>True if the counters were read, false otherwise</returns>
+    /// <remarks>
+    ///   The system-wide load is stored in the first element of <see cref="Loads" />,
+    ///   followed by the load of each processor.
+    /// </remarks>
+    public: bool Sample() {
+#if defined(NUCLEX_PLATFORM_LINUX)
+      if(unlikely(!this->reader.TryRead(this->currentTotal, this->currentProcessors))) {
+        return false;
+      }
+
+      this->Loads[0] = loadBetween(this->previousTotal, this->currentTotal);
+      for(std::size_t index = 0; index < this->currentProcessors.size(); ++index) {
+        this->Loads[index + 1] = loadBetween(
+          this->previousProcessors[index], this->currentProcessors[index]
+        );
+      }
+
+      // Swap instead of copying so the vectors keep their capacity and never reallocate
+      std::swap(this->previousTotal, this->currentTotal);
+      this->previousProcessors.swap(this->currentProcessors);
+      return true;
+#elif defined(NUCLEX_PLATFORM_WINDOWS)
+      ::FILETIME idleTime, kernelTime, userTime;
+      if(unlikely(::GetSystemTimes(&idleTime, &kernelTime, &userTime) == FALSE)) {
+        return false;
+      }
+
+      // Kernel time includes the time spent idle, so it has to be subtracted for busy time
+      std::uint64_t idleTicks = ticksBetween(this->previousIdleTicks, toTicks(idleTime));
+      std::uint64_t totalTicks = (
+        ticksBetween(this->previousKernelTicks, toTicks(kernelTime)) +
+        ticksBetween(this->previousUserTicks, toTicks(userTime))
+      );
+      this->previousIdleTicks = toTicks(idleTime);
+      this->previousKernelTicks = toTicks(kernelTime);
+      this->previousUserTicks = toTicks(userTime);
+
+      CpuLoad load;
+      load.BusyPercent = percentOf(ticksBetween(idleTicks, totalTicks), totalTicks);
+      load.IoWaitPercent = 0.0f;
+      load.StealPercent = 0.0f;
+      for(CpuLoad &processorLoad : this->Loads) {
+        processorLoad = load;
+      }
+      return true;
+#else
+      return false;
+#endif
+    }
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+    /// <summary>Keeps /proc/stat open between samples</summary>
+    private: LinuxProcStatReader reader;
+    /// <summary>System-wide counters of the previous reading</summary>
+    private: LinuxCpuTimes previousTotal;
+    /// <summary>System-wide counters of the current reading</summary>
+    private: LinuxCpuTimes currentTotal;
+    /// <summary>Counters of each processor in the previous reading</summary>
+    private: std::vector<LinuxCpuTimes> previousProcessors;
+    /// <summary>Counters of each processor in the current reading</summary>
+    private: std::vector<LinuxCpuTimes> currentProcessors;
+#elif defined(NUCLEX_PLATFORM_WINDOWS)
+    /// <summary>Idle time of all processors in the previous reading</summary>
+    private: std::uint64_t previousIdleTicks;
+    /// <summary>Kernel time (including idle time) of all processors last reading</summary>
+    private: std::uint64_t previousKernelTicks;
+    /// <summary>User time of all processors in the previous reading</summary>
+    private: std::uint64_t previousUserTicks;
+#endif
+
+    /// <summary>Loads calculated by the most recent sample</summary>
+    public: std::vector<CpuLoad> Loads;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  CpuLoadSampler::CpuLoadSampler() :
+    samplerMutex(),
+    sampler(std::make_unique<Sampler>()),
+    processorCount(this->sampler->Loads.size() - 1),
+    sequenceNumber(0),
+    publishedLoads(new PublishedLoad[this->sampler->Loads.size()]) {
+    for(std::size_t index = 0; index < this->sampler->Loads.size(); ++index) {
+      this->publishedLoads[index].BusyPercent.store(0.0f, std::memory_order_relaxed);
+      this->publishedLoads[index].IoWaitPercent.store(0.0f, std::memory_order_relaxed);
+      this->publishedLoads[index].StealPercent.store(0.0f, std::memory_order_relaxed);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  CpuLoadSampler::~CpuLoadSampler() = default;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool CpuLoadSampler::Sample() {
+    std::lock_guard<std::mutex> samplerLock(this->samplerMutex);
+    if(unlikely(!this->sampler->Sample())) {
+      return false;
+    }
+
+    // Only one thread publishes at a time (guarded by the sampler mutex)
+    const std::vector<CpuLoad> &loads = this->sampler->Loads;
+    SequenceLockHelper::Publish(
+      this->sequenceNumber,
+      [&]() {
+        for(std::size_t index = 0; index < loads.size(); ++index) {
+          PublishedLoad &published = this->publishedLoads[index];
+          published.BusyPercent.store(loads[index].BusyPercent, std::memory_order_relaxed);
+          published.IoWaitPercent.store(loads[index].IoWaitPercent, std::memory_order_relaxed);
+          published.StealPercent.store(loads[index].StealPercent, std::memory_order_relaxed);
+        }
+      }
+    );
+
+    return true;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  CpuLoad CpuLoadSampler::GetTotalLoad() const noexcept {
+    return read(this->publishedLoads[0]);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  CpuLoad CpuLoadSampler::GetProcessorLoad(std::size_t processorIndex) const noexcept {
+    if(unlikely(processorIndex >= this->processorCount)) {
+      return CpuLoad { 0.0f, 0.0f, 0.0f };
+    }
+
+    return read(this->publishedLoads[processorIndex + 1]);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  CpuLoad CpuLoadSampler::read(const PublishedLoad &published) const noexcept {
+    CpuLoad load;
+
+    SequenceLockHelper::Read(
+      this->sequenceNumber,
+      [&]() {
+        load.BusyPercent = published.BusyPercent.load(std::memory_order_relaxed);
+        load.IoWaitPercent = published.IoWaitPercent.load(std::memory_order_relaxed);
+        load.StealPercent = published.StealPercent.load(std::memory_order_relaxed);
+      }
+    );
+
+    return load;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
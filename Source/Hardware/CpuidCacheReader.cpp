@@ -0,0 +1,220 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./CpuidCacheReader.h"
+
+#include "../Platform/X86CpuidApi.h" // for X86CpuidApi
+
+#include <string> // for std::string
+
+#include <algorithm> // for std::sort()
+#include <cstdint> // for std::uint32_t
+
+// The cache leaves are documented in Intel's Software Developer's Manual, Volume 2A,
+// under the CPUID instruction and in AMD's APM Volume 3, Appendix E.
+
+#if defined(NUCLEX_PLATFORM_X86)
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Highest number of caches the reader will look for</summary>
+  const std::uint32_t MaximumCacheCount = 16;
+
+  /// <summary>Associativity for each encoding of AMD's legacy L2/L3 cache leaf</summary>
+  /// <remarks>
+  ///   Zero stands for either a disabled cache (encoding 0), a fully associative
+  ///   cache (encoding 15) or a reserved encoding.
+  /// </remarks>
+  const std::size_t LegacyAmdAssociativities[16] = {
+    0, 1, 2, 3, 4, 6, 8, 0, 16, 0, 32, 48, 64, 96, 128, 0
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads caches from a deterministic cache parameters leaf</summary>
+  /// <param name="leaf">Either 4 (Intel) or 0x8000001D (AMD), both use the same layout</param>
+  /// <param name="caches">List to which the caches will be added</param>
+  void readDeterministicCacheLeaf(
+    std::uint32_t leaf, std::vector<Nuclex::Platform::Hardware::CacheInfo> &caches
+  ) {
+    using Nuclex::Platform::Platform::X86CpuidApi;
+    using Nuclex::Platform::Hardware::CacheType;
+
+    for(std::uint32_t subleaf = 0; subleaf < MaximumCacheCount; ++subleaf) {
+      std::uint32_t registers[4];
+      if(!X86CpuidApi::TryQuery(leaf, subleaf, registers)) {
+        break;
+      }
+
+      // Cache type 0 terminates the list
+      Nuclex::Platform::Hardware::CacheInfo cache;
+      switch(registers[X86CpuidApi::Eax] & 0x1F) {
+        case 1: { cache.Type = CacheType::Data; break; }
+        case 2: { cache.Type = CacheType::Instruction; break; }
+        case 3: { cache.Type = CacheType::Unified; break; }
+        default: { return; }
+      }
+      cache.Level = (registers[X86CpuidApi::Eax] >> 5) & 0x7;
+
+      std::size_t lineSize = (registers[X86CpuidApi::Ebx] & 0xFFF) + 1;
+      std::size_t partitionCount = ((registers[X86CpuidApi::Ebx] >> 12) & 0x3FF) + 1;
+      std::size_t wayCount = ((registers[X86CpuidApi::Ebx] >> 22) & 0x3FF) + 1;
+      std::size_t setCount = static_cast<std::size_t>(registers[X86CpuidApi::Ecx]) + 1;
+
+      cache.SizeInBytes = wayCount * partitionCount * lineSize * setCount;
+      cache.LineSizeInBytes = lineSize;
+      if((registers[X86CpuidApi::Eax] & (1U << 9)) != 0) {
+        cache.Associativity = 0; // Fully associative
+      } else {
+        cache.Associativity = wayCount;
+      }
+
+      caches.push_back(cache);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads caches from the summary leaves of AMD CPUs before Bulldozer</summary>
+  /// <param name="caches">List to which the caches will be added</param>
+  void readLegacyAmdCacheLeaves(std::vector<Nuclex::Platform::Hardware::CacheInfo> &caches) {
+    using Nuclex::Platform::Platform::X86CpuidApi;
+    using Nuclex::Platform::Hardware::CacheType;
+
+    std::uint32_t registers[4];
+    if(X86CpuidApi::TryQuery(0x80000005U, 0, registers)) {
+      const std::size_t levelOneRegisters[2] = { X86CpuidApi::Ecx, X86CpuidApi::Edx };
+      const CacheType levelOneTypes[2] = { CacheType::Data, CacheType::Instruction };
+      for(std::size_t index = 0; index < 2; ++index) {
+        std::uint32_t description = registers[levelOneRegisters[index]];
+        if((description >> 24) != 0) {
+          Nuclex::Platform::Hardware::CacheInfo &cache = caches.emplace_back();
+          cache.Level = 1;
+          cache.Type = levelOneTypes[index];
+          cache.SizeInBytes = static_cast<std::size_t>(description >> 24) * 1024;
+          cache.LineSizeInBytes = description & 0xFF;
+          cache.Associativity = (description >> 16) & 0xFF;
+          if(cache.Associativity == 0xFF) {
+            cache.Associativity = 0; // Fully associative
+          }
+        }
+      }
+    }
+
+    if(X86CpuidApi::TryQuery(0x80000006U, 0, registers)) {
+      std::uint32_t description = registers[X86CpuidApi::Ecx];
+      if(((description >> 12) & 0xF) != 0) {
+        Nuclex::Platform::Hardware::CacheInfo &cache = caches.emplace_back();
+        cache.Level = 2;
+        cache.Type = CacheType::Unified;
+        cache.SizeInBytes = static_cast<std::size_t>(description >> 16) * 1024;
+        cache.LineSizeInBytes = description & 0xFF;
+        cache.Associativity = LegacyAmdAssociativities[(description >> 12) & 0xF];
+      }
+
+      // The L3 size is given in units of 512 KiB
+      description = registers[X86CpuidApi::Edx];
+      if(((description >> 12) & 0xF) != 0) {
+        Nuclex::Platform::Hardware::CacheInfo &cache = caches.emplace_back();
+        cache.Level = 3;
+        cache.Type = CacheType::Unified;
+        cache.SizeInBytes = static_cast<std::size_t>(description >> 18) * 512 * 1024;
+        cache.LineSizeInBytes = description & 0xFF;
+        cache.Associativity = LegacyAmdAssociativities[(description >> 12) & 0xF];
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+#endif // defined(NUCLEX_PLATFORM_X86)
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<CacheInfo> CpuidCacheReader::TryReadCaches() {
+    std::vector<CacheInfo> caches;
+
+#if defined(NUCLEX_PLATFORM_X86)
+    using Nuclex::Platform::Platform::X86CpuidApi;
+
+    // AMD CPUs answer leaf 4 with zeros. Since Bulldozer, they have an equivalent leaf
+    // in the extended range, indicated by the topology extensions flag.
+    std::string vendorId = X86CpuidApi::GetVendorId();
+    bool isAmd = (vendorId == u8"AuthenticAMD") || (vendorId == u8"HygonGenuine");
+    if(isAmd) {
+      std::uint32_t registers[4];
+      bool hasTopologyExtensions = (
+        X86CpuidApi::TryQuery(0x80000001U, 0, registers) &&
+        ((registers[X86CpuidApi::Ecx] & (1U << 22)) != 0)
+      );
+      if(hasTopologyExtensions) {
+        readDeterministicCacheLeaf(0x8000001DU, caches);
+      } else {
+        readLegacyAmdCacheLeaves(caches);
+      }
+    } else {
+      readDeterministicCacheLeaf(4, caches);
+    }
+
+    std::sort(
+      caches.begin(), caches.end(),
+      [](const CacheInfo &left, const CacheInfo &right) {
+        if(left.Level == right.Level) {
+          return static_cast<int>(left.Type) < static_cast<int>(right.Type);
+        } else {
+          return left.Level < right.Level;
+        }
+      }
+    );
+#endif // defined(NUCLEX_PLATFORM_X86)
+
+    return caches;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void CpuidCacheReader::AddToCoresWithoutCaches(std::vector<CpuInfo> &cpuInfos) {
+    std::vector<CacheInfo> caches;
+    bool cachesRead = false;
+
+    for(CpuInfo &cpuInfo : cpuInfos) {
+      for(CoreInfo &coreInfo : cpuInfo.Cores) {
+        if(coreInfo.Caches.empty()) {
+          if(!cachesRead) {
+            caches = TryReadCaches();
+            cachesRead = true;
+          }
+          coreInfo.Caches = caches;
+        }
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
@@ -0,0 +1,66 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_CPUIDCACHEREADER_H
+#define NUCLEX_PLATFORM_HARDWARE_CPUIDCACHEREADER_H
+
+#include "Nuclex/Platform/Config.h"
+#include "Nuclex/Platform/Hardware/CpuInfo.h" // for CacheInfo, CpuInfo
+
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Queries the cache layout from the CPU itself via the CPUID instruction</summary>
+  /// <remarks>
+  ///   <para>
+  ///     This is the fallback for when the operating system doesn't tell us about the caches
+  ///     (Linux in some virtual machines and containers with a trimmed sysfs, or Windows).
+  ///     Intel CPUs describe their caches in leaf 4, AMD CPUs in leaf 0x8000001D and older
+  ///     AMD CPUs only in the summary leaves 0x80000005 and 0x80000006.
+  ///   </para>
+  ///   <para>
+  ///     CPUID only reports on the core it is executed on and only says how many processors
+  ///     share a cache, not which ones, so the caches have no shared processors listed.
+  ///     On anything but x86 and AMD64, no caches are reported at all.
+  ///   </para>
+  /// </remarks>
+  class CpuidCacheReader {
+
+    /// <summary>Attempts to read the caches of the processor the caller runs on</summary>
+    /// <returns>All caches the CPU reported, ordered by level and type</returns>
+    public: static std::vector<CacheInfo> TryReadCaches();
+
+    /// <summary>Fills in the caches of all cores for which no caches are known</summary>
+    /// <param name="cpuInfos">CPUs whose cores will receive the caches</param>
+    /// <remarks>
+    ///   CPUID is only executed if there is at least one core without caches.
+    ///   All cores receive the same caches, including the eco cores of hybrid CPUs.
+    /// </remarks>
+    public: static void AddToCoresWithoutCaches(std::vector<CpuInfo> &cpuInfos);
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_CPUIDCACHEREADER_H
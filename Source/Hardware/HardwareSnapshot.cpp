@@ -0,0 +1,400 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "Nuclex/Platform/Hardware/HardwareSnapshot.h"
+#include "Nuclex/Platform/Hardware/PlatformAppraiser.h" // for PlatformAppraiser
+
+#include <Nuclex/Support/Threading/StopSource.h> // for StopSource
+#include <Nuclex/Support/Threading/StopToken.h> // for StopToken
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+#include "./LinuxHardwareFingerprinter.h" // for LinuxHardwareFingerprinter
+#else
+#include <atomic> // for std::atomic
+#endif
+
+#include <algorithm> // for std::remove_if()
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+#if !defined(NUCLEX_PLATFORM_LINUX)
+  /// <summary>Provides a fingerprint that is different each time</summary>
+  /// <returns>A new fingerprint that has not been handed out before</returns>
+  /// <remarks>
+  ///   Used on platforms where we don't know any cheap sources to check for changes,
+  ///   which means the parts of the hardware description are always analyzed again.
+  /// </remarks>
+  std::uint64_t makeUniqueFingerprint() {
+    static std::atomic<std::uint64_t> lastFingerprint(0);
+    return lastFingerprint.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+#endif // !defined(NUCLEX_PLATFORM_LINUX)
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Calculates the fingerprint of the system's sources describing a part</summary>
+  /// <param name="part">Part of the hardware whose sources will be fingerprinted</param>
+  /// <returns>The fingerprint of the part's sources</returns>
+  std::uint64_t fingerprintSystemSources(Nuclex::Platform::Hardware::HardwareChange part) {
+#if defined(NUCLEX_PLATFORM_LINUX)
+    return Nuclex::Platform::Hardware::LinuxHardwareFingerprinter::Calculate(part);
+#else
+    (void)part;
+    return makeUniqueFingerprint();
+#endif
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Creates a stop token that will never be canceled</summary>
+  /// <returns>A stop token for the analysis methods that will never be canceled</returns>
+  std::shared_ptr<const Nuclex::Support::Threading::StopToken> makeDummyCanceller() {
+    return Nuclex::Support::Threading::StopSource::Create()->GetToken();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  HardwareSnapshot::HardwareSnapshot(
+    std::chrono::steady_clock::duration refreshInterval /* = std::chrono::seconds(1) */,
+    const FingerprintFunction &fingerprint /* = FingerprintFunction() */
+  ) :
+    refreshInterval(refreshInterval),
+    fingerprintFunction(
+      fingerprint ? fingerprint : FingerprintFunction(&fingerprintSystemSources)
+    ),
+    analysisMutex(),
+    stateMutex(),
+    subscriberMutex(),
+    cpuTopology(),
+    cpuTopologyFingerprint(0),
+    memory(),
+    memoryFingerprint(0),
+    storageVolumes(),
+    storageVolumesFingerprint(0),
+    storeLocator(),
+    lastRefreshTime(std::chrono::steady_clock::now()),
+    refreshFuture(),
+    nextSubscriptionId(1),
+    subscribers() {}
+
+  // ------------------------------------------------------------------------------------------- //
+
+  HardwareSnapshot::~HardwareSnapshot() {
+    std::shared_future<void> runningRefresh;
+    {
+      std::lock_guard<std::mutex> stateLock(this->stateMutex);
+      runningRefresh = this->refreshFuture;
+    }
+    if(runningRefresh.valid()) {
+      runningRefresh.wait();
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::shared_ptr<const std::vector<CpuInfo>> HardwareSnapshot::GetCpuTopology() {
+    {
+      std::lock_guard<std::mutex> stateLock(this->stateMutex);
+      if(likely(static_cast<bool>(this->cpuTopology))) {
+        startRefreshIfDue();
+        return this->cpuTopology;
+      }
+    }
+
+    // This is the first query, so analyze the CPU topology right here. If another thread
+    // was faster, the analysis mutex makes us wait for it and we can use its result.
+    std::lock_guard<std::mutex> analysisLock(this->analysisMutex);
+    {
+      std::lock_guard<std::mutex> stateLock(this->stateMutex);
+      if(static_cast<bool>(this->cpuTopology)) {
+        return this->cpuTopology;
+      }
+    }
+
+    std::uint64_t fingerprint = this->fingerprintFunction(HardwareChange::CpuTopology);
+    std::shared_ptr<const std::vector<CpuInfo>> result = (
+      std::make_shared<std::vector<CpuInfo>>(
+        PlatformAppraiser::analyzeCpuTopologyAsync(makeDummyCanceller())
+      )
+    );
+    {
+      std::lock_guard<std::mutex> stateLock(this->stateMutex);
+      this->cpuTopology = result;
+      this->cpuTopologyFingerprint = fingerprint;
+    }
+
+    return result;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::shared_ptr<const MemoryInfo> HardwareSnapshot::GetMemory() {
+    {
+      std::lock_guard<std::mutex> stateLock(this->stateMutex);
+      if(likely(static_cast<bool>(this->memory))) {
+        startRefreshIfDue();
+        return this->memory;
+      }
+    }
+
+    std::lock_guard<std::mutex> analysisLock(this->analysisMutex);
+    {
+      std::lock_guard<std::mutex> stateLock(this->stateMutex);
+      if(static_cast<bool>(this->memory)) {
+        return this->memory;
+      }
+    }
+
+    std::uint64_t fingerprint = this->fingerprintFunction(HardwareChange::Memory);
+    std::shared_ptr<const MemoryInfo> result = std::make_shared<MemoryInfo>(
+      PlatformAppraiser::analyzeMemoryAsync(makeDummyCanceller())
+    );
+    {
+      std::lock_guard<std::mutex> stateLock(this->stateMutex);
+      this->memory = result;
+      this->memoryFingerprint = fingerprint;
+    }
+
+    return result;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::shared_ptr<const std::vector<StoreInfo>> HardwareSnapshot::GetStorageVolumes() {
+    {
+      std::lock_guard<std::mutex> stateLock(this->stateMutex);
+      if(likely(static_cast<bool>(this->storageVolumes))) {
+        startRefreshIfDue();
+        return this->storageVolumes;
+      }
+    }
+
+    std::lock_guard<std::mutex> analysisLock(this->analysisMutex);
+    {
+      std::lock_guard<std::mutex> stateLock(this->stateMutex);
+      if(static_cast<bool>(this->storageVolumes)) {
+        return this->storageVolumes;
+      }
+    }
+
+    std::uint64_t fingerprint = this->fingerprintFunction(HardwareChange::StorageVolumes);
+    std::shared_ptr<const std::vector<StoreInfo>> result = (
+      std::make_shared<std::vector<StoreInfo>>(
+        PlatformAppraiser::analyzeStorageVolumesAsync(makeDummyCanceller())
+      )
+    );
+    {
+      std::lock_guard<std::mutex> stateLock(this->stateMutex);
+      this->storageVolumes = result;
+      this->storageVolumesFingerprint = fingerprint;
+    }
+
+    return result;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::shared_ptr<const StoreLocator> HardwareSnapshot::GetStoreLocator() {
+    GetStorageVolumes();
+
+    // Check against the current storage volumes rather than the ones we just got,
+    // otherwise a slow thread could replace a newer locator with an outdated one
+    std::lock_guard<std::mutex> stateLock(this->stateMutex);
+    bool isCurrent = (
+      static_cast<bool>(this->storeLocator) &&
+      (&this->storeLocator->GetStores() == this->storageVolumes.get())
+    );
+    if(!isCurrent) {
+      this->storeLocator = std::make_shared<StoreLocator>(this->storageVolumes);
+    }
+
+    return this->storeLocator;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::shared_future<void> HardwareSnapshot::Refresh() {
+    std::lock_guard<std::mutex> stateLock(this->stateMutex);
+    startRefresh();
+    return this->refreshFuture;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::size_t HardwareSnapshot::Subscribe(const ChangeCallback &callback) {
+    std::lock_guard<std::mutex> subscriberLock(this->subscriberMutex);
+
+    std::size_t subscriptionId = this->nextSubscriptionId;
+    ++this->nextSubscriptionId;
+
+    this->subscribers.emplace_back(subscriptionId, callback);
+    return subscriptionId;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void HardwareSnapshot::Unsubscribe(std::size_t subscriptionId) {
+    std::lock_guard<std::mutex> subscriberLock(this->subscriberMutex);
+
+    this->subscribers.erase(
+      std::remove_if(
+        this->subscribers.begin(), this->subscribers.end(),
+        [subscriptionId](const std::pair<std::size_t, ChangeCallback> &subscriber) {
+          return (subscriber.first == subscriptionId);
+        }
+      ),
+      this->subscribers.end()
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void HardwareSnapshot::startRefreshIfDue() {
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if(now - this->lastRefreshTime >= this->refreshInterval) {
+      startRefresh();
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void HardwareSnapshot::startRefresh() {
+    if(this->refreshFuture.valid()) {
+      std::future_status status = this->refreshFuture.wait_for(std::chrono::seconds(0));
+      if(status != std::future_status::ready) {
+        return; // A check is still running, it will pick up any changes
+      }
+    }
+
+    this->lastRefreshTime = std::chrono::steady_clock::now();
+    this->refreshFuture = std::async(
+      std::launch::async, &HardwareSnapshot::refreshChangedParts, this
+    ).share();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void HardwareSnapshot::refreshChangedParts() {
+    std::vector<HardwareChange> changes;
+    {
+      std::lock_guard<std::mutex> analysisLock(this->analysisMutex);
+
+      bool hasCpuTopology, hasMemory, hasStorageVolumes;
+      std::uint64_t oldCpuTopologyFingerprint, oldMemoryFingerprint, oldStorageFingerprint;
+      {
+        std::lock_guard<std::mutex> stateLock(this->stateMutex);
+        hasCpuTopology = static_cast<bool>(this->cpuTopology);
+        oldCpuTopologyFingerprint = this->cpuTopologyFingerprint;
+        hasMemory = static_cast<bool>(this->memory);
+        oldMemoryFingerprint = this->memoryFingerprint;
+        hasStorageVolumes = static_cast<bool>(this->storageVolumes);
+        oldStorageFingerprint = this->storageVolumesFingerprint;
+      }
+
+      // The fingerprints are taken before the analysis, so if a source changes while
+      // we're analyzing, the next check will see a different fingerprint again.
+      // If an analysis fails, the old result is kept and the next check tries again.
+      if(hasCpuTopology) {
+        std::uint64_t fingerprint = this->fingerprintFunction(HardwareChange::CpuTopology);
+        if(fingerprint != oldCpuTopologyFingerprint) {
+          try {
+            std::shared_ptr<const std::vector<CpuInfo>> result = (
+              std::make_shared<std::vector<CpuInfo>>(
+                PlatformAppraiser::analyzeCpuTopologyAsync(makeDummyCanceller())
+              )
+            );
+            std::lock_guard<std::mutex> stateLock(this->stateMutex);
+            this->cpuTopology = result;
+            this->cpuTopologyFingerprint = fingerprint;
+            changes.push_back(HardwareChange::CpuTopology);
+          }
+          catch(const std::exception &) {}
+        }
+      }
+
+      if(hasMemory) {
+        std::uint64_t fingerprint = this->fingerprintFunction(HardwareChange::Memory);
+        if(fingerprint != oldMemoryFingerprint) {
+          try {
+            std::shared_ptr<const MemoryInfo> result = std::make_shared<MemoryInfo>(
+              PlatformAppraiser::analyzeMemoryAsync(makeDummyCanceller())
+            );
+            std::lock_guard<std::mutex> stateLock(this->stateMutex);
+            this->memory = result;
+            this->memoryFingerprint = fingerprint;
+            changes.push_back(HardwareChange::Memory);
+          }
+          catch(const std::exception &) {}
+        }
+      }
+
+      if(hasStorageVolumes) {
+        std::uint64_t fingerprint = this->fingerprintFunction(HardwareChange::StorageVolumes);
+        if(fingerprint != oldStorageFingerprint) {
+          try {
+            std::shared_ptr<const std::vector<StoreInfo>> result = (
+              std::make_shared<std::vector<StoreInfo>>(
+                PlatformAppraiser::analyzeStorageVolumesAsync(makeDummyCanceller())
+              )
+            );
+            std::lock_guard<std::mutex> stateLock(this->stateMutex);
+            this->storageVolumes = result;
+            this->storageVolumesFingerprint = fingerprint;
+            changes.push_back(HardwareChange::StorageVolumes);
+          }
+          catch(const std::exception &) {}
+        }
+      }
+    } // analysis lock scope
+
+    for(HardwareChange change : changes) {
+      notifySubscribers(change);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void HardwareSnapshot::notifySubscribers(HardwareChange change) {
+
+    // Work on a copy so subscribers can unsubscribe from within their callback
+    std::vector<std::pair<std::size_t, ChangeCallback>> currentSubscribers;
+    {
+      std::lock_guard<std::mutex> subscriberLock(this->subscriberMutex);
+      currentSubscribers = this->subscribers;
+    }
+
+    for(const std::pair<std::size_t, ChangeCallback> &subscriber : currentSubscribers) {
+      subscriber.second(change);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
@@ -0,0 +1,220 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./InstructionSetReader.h"
+
+#if defined(NUCLEX_PLATFORM_X86)
+#include "../Platform/X86CpuidApi.h" // for X86CpuidApi
+#elif defined(NUCLEX_PLATFORM_ARM) && defined(NUCLEX_PLATFORM_LINUX)
+#include <sys/auxv.h> // for ::getauxval()
+#elif defined(NUCLEX_PLATFORM_ARM) && defined(NUCLEX_PLATFORM_WINDOWS)
+#include "../Platform/WindowsApi.h" // for ::IsProcessorFeaturePresent()
+#endif
+
+#include <cstdint> // for std::uint32_t, std::uint64_t
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+#if defined(NUCLEX_PLATFORM_X86)
+
+  /// <summary>An x86 feature flag reported in a CPUID register</summary>
+  struct CpuidFeatureBit {
+
+    /// <summary>Index of the register the flag is reported in</summary>
+    public: std::size_t Register;
+    /// <summary>Index of the bit that indicates the feature</summary>
+    public: std::uint32_t Bit;
+    /// <summary>Instruction set extension the flag stands for</summary>
+    public: Nuclex::Platform::Hardware::InstructionSet InstructionSet;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Checks a list of CPUID feature flags and records the extensions</summary>
+  /// <param name="registers">Registers returned by the CPUID leaf</param>
+  /// <param name="featureBits">Feature flags that will be checked</param>
+  /// <param name="featureBitCount">Number of feature flags in the list</param>
+  /// <param name="support">Receives the extensions whose flags are set</param>
+  void addFeaturesFromRegisters(
+    const std::uint32_t (&registers)[4],
+    const CpuidFeatureBit *featureBits, std::size_t featureBitCount,
+    Nuclex::Platform::Hardware::InstructionSetSupport &support
+  ) {
+    for(std::size_t index = 0; index < featureBitCount; ++index) {
+      const CpuidFeatureBit &featureBit = featureBits[index];
+      if((registers[featureBit.Register] & (1U << featureBit.Bit)) != 0) {
+        support.Add(featureBit.InstructionSet);
+      }
+    }
+  }
+
+#endif // defined(NUCLEX_PLATFORM_X86)
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  InstructionSetSupport InstructionSetReader::ReadSupportedInstructionSets() {
+    InstructionSetSupport support;
+
+#if defined(NUCLEX_PLATFORM_X86)
+    using Nuclex::Platform::Platform::X86CpuidApi;
+
+    // Leaf 1 has the classic feature flags. AVX, F16C and FMA are listed here as well,
+    // but are only usable if the OS preserves the YMM registers (XCR0 bits 1 and 2).
+    std::uint32_t registers[4];
+    if(!X86CpuidApi::TryQuery(1, 0, registers)) {
+      return support;
+    }
+    {
+      const CpuidFeatureBit basicFeatureBits[] = {
+        { X86CpuidApi::Edx, 26, InstructionSet::Sse2 },
+        { X86CpuidApi::Ecx, 0, InstructionSet::Sse3 },
+        { X86CpuidApi::Ecx, 1, InstructionSet::Pclmul },
+        { X86CpuidApi::Ecx, 9, InstructionSet::Ssse3 },
+        { X86CpuidApi::Ecx, 19, InstructionSet::Sse41 },
+        { X86CpuidApi::Ecx, 20, InstructionSet::Sse42 },
+        { X86CpuidApi::Ecx, 23, InstructionSet::Popcnt },
+        { X86CpuidApi::Ecx, 25, InstructionSet::Aes }
+      };
+      addFeaturesFromRegisters(
+        registers, basicFeatureBits, sizeof(basicFeatureBits) / sizeof(CpuidFeatureBit), support
+      );
+    }
+
+    bool avxUsable = false;
+    bool avx512Usable = false;
+    if((registers[X86CpuidApi::Ecx] & (1U << 27)) != 0) { // OSXSAVE
+      std::uint64_t enabledFeatures = X86CpuidApi::GetEnabledXsaveFeatures();
+      avxUsable = ((enabledFeatures & 0x06) == 0x06); // XMM and YMM state
+      avx512Usable = avxUsable && ((enabledFeatures & 0xE0) == 0xE0); // opmask, ZMM state
+    }
+    if(avxUsable) {
+      const CpuidFeatureBit avxFeatureBits[] = {
+        { X86CpuidApi::Ecx, 12, InstructionSet::Fma },
+        { X86CpuidApi::Ecx, 28, InstructionSet::Avx },
+        { X86CpuidApi::Ecx, 29, InstructionSet::F16c }
+      };
+      addFeaturesFromRegisters(
+        registers, avxFeatureBits, sizeof(avxFeatureBits) / sizeof(CpuidFeatureBit), support
+      );
+    }
+
+    // Leaf 7 has the newer extensions, including AVX2 and the AVX-512 family
+    if(X86CpuidApi::TryQuery(7, 0, registers)) {
+      const CpuidFeatureBit extendedFeatureBits[] = {
+        { X86CpuidApi::Ebx, 3, InstructionSet::Bmi1 },
+        { X86CpuidApi::Ebx, 8, InstructionSet::Bmi2 },
+        { X86CpuidApi::Ebx, 29, InstructionSet::Sha }
+      };
+      addFeaturesFromRegisters(
+        registers, extendedFeatureBits,
+        sizeof(extendedFeatureBits) / sizeof(CpuidFeatureBit), support
+      );
+
+      if(avxUsable) {
+        const CpuidFeatureBit avx2FeatureBits[] = {
+          { X86CpuidApi::Ebx, 5, InstructionSet::Avx2 }
+        };
+        addFeaturesFromRegisters(
+          registers, avx2FeatureBits, sizeof(avx2FeatureBits) / sizeof(CpuidFeatureBit), support
+        );
+      }
+      if(avx512Usable) {
+        const CpuidFeatureBit avx512FeatureBits[] = {
+          { X86CpuidApi::Ebx, 16, InstructionSet::Avx512F },
+          { X86CpuidApi::Ebx, 17, InstructionSet::Avx512Dq },
+          { X86CpuidApi::Ebx, 28, InstructionSet::Avx512Cd },
+          { X86CpuidApi::Ebx, 30, InstructionSet::Avx512Bw },
+          { X86CpuidApi::Ebx, 31, InstructionSet::Avx512Vl },
+          { X86CpuidApi::Ecx, 11, InstructionSet::Avx512Vnni }
+        };
+        addFeaturesFromRegisters(
+          registers, avx512FeatureBits,
+          sizeof(avx512FeatureBits) / sizeof(CpuidFeatureBit), support
+        );
+      }
+    }
+#elif defined(NUCLEX_PLATFORM_ARM) && defined(NUCLEX_PLATFORM_LINUX)
+    // The bit numbers are from the kernel's arch/arm*/include/uapi/asm/hwcap.h, spelled
+    // out here because the userspace headers of older toolchains lack the newer ones
+    unsigned long hardwareCapabilities = ::getauxval(AT_HWCAP);
+    unsigned long hardwareCapabilities2 = ::getauxval(AT_HWCAP2);
+#if defined(__aarch64__)
+    if((hardwareCapabilities & (1UL << 1)) != 0) { // HWCAP_ASIMD
+      support.Add(InstructionSet::Neon);
+    }
+    if((hardwareCapabilities & (1UL << 3)) != 0) { // HWCAP_AES
+      support.Add(InstructionSet::ArmAes);
+    }
+    if((hardwareCapabilities & (1UL << 6)) != 0) { // HWCAP_SHA2
+      support.Add(InstructionSet::ArmSha2);
+    }
+    if((hardwareCapabilities & (1UL << 7)) != 0) { // HWCAP_CRC32
+      support.Add(InstructionSet::ArmCrc32);
+    }
+    if((hardwareCapabilities & (1UL << 22)) != 0) { // HWCAP_SVE
+      support.Add(InstructionSet::Sve);
+    }
+    if((hardwareCapabilities2 & (1UL << 1)) != 0) { // HWCAP2_SVE2
+      support.Add(InstructionSet::Sve2);
+    }
+#else
+    if((hardwareCapabilities & (1UL << 12)) != 0) { // HWCAP_NEON
+      support.Add(InstructionSet::Neon);
+    }
+    if((hardwareCapabilities2 & (1UL << 0)) != 0) { // HWCAP2_AES
+      support.Add(InstructionSet::ArmAes);
+    }
+    if((hardwareCapabilities2 & (1UL << 3)) != 0) { // HWCAP2_SHA2
+      support.Add(InstructionSet::ArmSha2);
+    }
+    if((hardwareCapabilities2 & (1UL << 4)) != 0) { // HWCAP2_CRC32
+      support.Add(InstructionSet::ArmCrc32);
+    }
+#endif
+#elif defined(NUCLEX_PLATFORM_ARM) && defined(NUCLEX_PLATFORM_WINDOWS)
+    if(::IsProcessorFeaturePresent(PF_ARM_NEON_INSTRUCTIONS_AVAILABLE) != FALSE) {
+      support.Add(InstructionSet::Neon);
+    }
+    if(::IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE) != FALSE) {
+      support.Add(InstructionSet::ArmAes);
+      support.Add(InstructionSet::ArmSha2);
+    }
+    if(::IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) != FALSE) {
+      support.Add(InstructionSet::ArmCrc32);
+    }
+#endif
+
+    return support;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
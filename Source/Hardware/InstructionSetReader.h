@@ -0,0 +1,55 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_INSTRUCTIONSETREADER_H
+#define NUCLEX_PLATFORM_HARDWARE_INSTRUCTIONSETREADER_H
+
+#include "Nuclex/Platform/Config.h"
+#include "Nuclex/Platform/Hardware/InstructionSetSupport.h" // for InstructionSetSupport
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Determines the instruction set extensions the CPU supports</summary>
+  /// <remarks>
+  ///   <para>
+  ///     On x86 and AMD64, the extensions are read via CPUID. Extensions using the AVX
+  ///     or AVX-512 registers are additionally checked against the XCR0 register, which
+  ///     tells whether the operating system preserves those registers.
+  ///   </para>
+  ///   <para>
+  ///     On ARM Linux, the kernel passes the supported extensions to each process in its
+  ///     auxiliary vector (AT_HWCAP and AT_HWCAP2). On ARM Windows, NEON is mandatory
+  ///     and the remaining extensions are queried via IsProcessorFeaturePresent().
+  ///   </para>
+  /// </remarks>
+  class InstructionSetReader {
+
+    /// <summary>Reads the instruction set extensions the CPU supports</summary>
+    /// <returns>The supported extensions, empty on unknown architectures</returns>
+    public: static InstructionSetSupport ReadSupportedInstructionSets();
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_INSTRUCTIONSETREADER_H
@@ -0,0 +1,181 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./LinuxCgroupReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "./StringHelper.h" // for StringHelper
+#include "./LinuxSysNodeTreeReader.h" // for LinuxSysNodeTreeReader::ParseCpuList()
+#include "../Platform/LinuxFileApi.h" // for LinuxFileApi
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::string_view LinuxCgroupReader::FindUnifiedCgroupPath(const std::string_view &contents) {
+
+    // Each line has the format 'hierarchy-id:controllers:path'. The cgroup v2 hierarchy
+    // always has the ID 0 and an empty controller list, so we're looking for '0::'.
+    std::string_view remaining = contents;
+    while(!remaining.empty()) {
+      std::string_view::size_type lineEnd = remaining.find('\n');
+      std::string_view line = remaining.substr(0, lineEnd);
+      if(line.substr(0, 3) == u8"0::") {
+        return line.substr(3);
+      }
+
+      if(lineEnd == std::string_view::npos) {
+        break;
+      }
+      remaining.remove_prefix(lineEnd + 1);
+    }
+
+    return std::string_view();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::string LinuxCgroupReader::LocateOwnCgroup(
+    const std::string &procPath /* = u8"/proc" */,
+    const std::string &cgroupRootPath /* = u8"/sys/fs/cgroup" */
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    std::string contents;
+    bool cgroupFileRead = LinuxFileApi::TryReadFileInOneReadCall(
+      LinuxFileApi::JoinPaths(procPath, u8"self/cgroup"), contents
+    );
+    if(!cgroupFileRead) {
+      return std::string();
+    }
+
+    std::string_view cgroupPath = FindUnifiedCgroupPath(contents);
+    if(cgroupPath.empty()) {
+      return std::string();
+    }
+
+    // Inside a container with its own cgroup namespace, the process sits at the root
+    std::string groupDirectory = cgroupRootPath;
+    if(cgroupPath != u8"/") {
+      groupDirectory.append(cgroupPath);
+    }
+
+    return groupDirectory;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<std::string> LinuxCgroupReader::ListGroupAndAncestors(
+    const std::string &cgroupRootPath, const std::string &groupDirectory
+  ) {
+    std::vector<std::string> directories;
+
+    std::string directory = groupDirectory;
+    for(;;) {
+      directories.push_back(directory);
+      if(directory.length() <= cgroupRootPath.length()) {
+        break;
+      }
+
+      std::string::size_type lastSlashIndex = directory.rfind('/');
+      if(lastSlashIndex == std::string::npos) {
+        break;
+      }
+      directory.resize(lastSlashIndex);
+    }
+
+    return directories;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::optional<double> LinuxCgroupReader::TryReadCpuQuota(
+    const std::string &cgroupRootPath, const std::string &groupDirectory
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    std::optional<double> tightestQuota;
+
+    // The 'cpu.max' file contains '$MAX $PERIOD', where $MAX is either a number of
+    // microseconds or the word 'max'. A cgroup may use $MAX microseconds of CPU time
+    // every $PERIOD microseconds, so the quotient is the number of processors it can
+    // keep busy. The root cgroup has no 'cpu.max' file.
+    std::string contents;
+    for(const std::string &directory : ListGroupAndAncestors(cgroupRootPath, groupDirectory)) {
+      bool quotaFileRead = LinuxFileApi::TryReadFileInOneReadCall(
+        LinuxFileApi::JoinPaths(directory, u8"cpu.max"), contents
+      );
+      if(!quotaFileRead) {
+        continue;
+      }
+
+      std::string_view remainder(contents);
+      std::size_t maximumMicroseconds;
+      if(!StringHelper::TryTakeNumber(remainder, maximumMicroseconds) || remainder.empty()) {
+        continue; // This is the 'max' case (or garbage), meaning there is no limit
+      }
+
+      std::size_t periodMicroseconds;
+      remainder.remove_prefix(1); // skip the space
+      if(!StringHelper::TryTakeNumber(remainder, periodMicroseconds)) {
+        continue;
+      }
+      if(periodMicroseconds == 0) {
+        continue;
+      }
+
+      double quota = (
+        static_cast<double>(maximumMicroseconds) / static_cast<double>(periodMicroseconds)
+      );
+      if(!tightestQuota.has_value() || (quota < tightestQuota.value())) {
+        tightestQuota = quota;
+      }
+    }
+
+    return tightestQuota;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<std::size_t> LinuxCgroupReader::TryReadEffectiveCpus(
+    const std::string &groupDirectory
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    // Unlike 'cpuset.cpus', the effective file already takes the ancestors into account
+    std::string contents;
+    bool cpusetFileRead = LinuxFileApi::TryReadFileInOneReadCall(
+      LinuxFileApi::JoinPaths(groupDirectory, u8"cpuset.cpus.effective"), contents
+    );
+    if(!cpusetFileRead) {
+      return std::vector<std::size_t>();
+    }
+
+    return LinuxSysNodeTreeReader::ParseCpuList(contents);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,115 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_LINUXCGROUPREADER_H
+#define NUCLEX_PLATFORM_HARDWARE_LINUXCGROUPREADER_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include <cstddef> // for std::size_t
+#include <optional> // for std::optional
+#include <string> // for std::string
+#include <string_view> // for std::string_view
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads resource limits from the cgroup v2 filesystem</summary>
+  /// <remarks>
+  ///   <para>
+  ///     Container runtimes and systemd place processes into control groups which limit
+  ///     how much CPU time and memory the processes may use. The hardware is still fully
+  ///     visible in /proc and /sys, so without looking at the cgroup, a process in a small
+  ///     container would size itself for the whole host.
+  ///   </para>
+  ///   <para>
+  ///     Only the unified (v2) hierarchy is supported. On systems still using cgroup v1,
+  ///     no cgroup will be found and no limits will be reported.
+  ///   </para>
+  /// </remarks>
+  class LinuxCgroupReader {
+
+    /// <summary>Looks up the cgroup v2 path from the contents of /proc/self/cgroup</summary>
+    /// <param name="contents">Contents of the /proc/self/cgroup file</param>
+    /// <returns>
+    ///   The process' cgroup relative to the cgroup root (i.e. '/user.slice/app.scope')
+    ///   or an empty string if the process is not in a cgroup v2 hierarchy
+    /// </returns>
+    public: static std::string_view FindUnifiedCgroupPath(const std::string_view &contents);
+
+    /// <summary>Determines the directory of the calling process' cgroup</summary>
+    /// <param name="procPath">Path at which procfs is mounted, can be changed for tests</param>
+    /// <param name="cgroupRootPath">
+    ///   Path at which the cgroup v2 filesystem is mounted, can be changed for tests
+    /// </param>
+    /// <returns>
+    ///   The absolute path of the process' cgroup directory or an empty string if
+    ///   the process is not in a cgroup v2 hierarchy
+    /// </returns>
+    public: static std::string LocateOwnCgroup(
+      const std::string &procPath = u8"/proc",
+      const std::string &cgroupRootPath = u8"/sys/fs/cgroup"
+    );
+
+    /// <summary>Lists the directories of a cgroup and all its ancestors</summary>
+    /// <param name="cgroupRootPath">Path at which the cgroup v2 filesystem is mounted</param>
+    /// <param name="groupDirectory">Directory of the cgroup to start at</param>
+    /// <returns>The directories from the cgroup itself up to the cgroup root</returns>
+    /// <remarks>
+    ///   Limits are inherited, so the effective limit is the tightest one found
+    ///   in any of these directories.
+    /// </remarks>
+    public: static std::vector<std::string> ListGroupAndAncestors(
+      const std::string &cgroupRootPath, const std::string &groupDirectory
+    );
+
+    /// <summary>Determines how many processors' worth of CPU time a cgroup may use</summary>
+    /// <param name="cgroupRootPath">Path at which the cgroup v2 filesystem is mounted</param>
+    /// <param name="groupDirectory">Directory of the cgroup whose quota will be read</param>
+    /// <returns>
+    ///   The tightest 'cpu.max' quota divided by its period of the cgroup and all its
+    ///   ancestors, or nothing if none of them has a CPU quota
+    /// </returns>
+    public: static std::optional<double> TryReadCpuQuota(
+      const std::string &cgroupRootPath, const std::string &groupDirectory
+    );
+
+    /// <summary>Reads the processors a cgroup's tasks may be scheduled to</summary>
+    /// <param name="groupDirectory">Directory of the cgroup whose cpuset will be read</param>
+    /// <returns>
+    ///   The processors from the 'cpuset.cpus.effective' file in ascending order or
+    ///   an empty list if the cpuset controller is not enabled for the cgroup
+    /// </returns>
+    public: static std::vector<std::size_t> TryReadEffectiveCpus(
+      const std::string &groupDirectory
+    );
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+#endif // NUCLEX_PLATFORM_HARDWARE_LINUXCGROUPREADER_H
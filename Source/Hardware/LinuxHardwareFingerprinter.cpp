@@ -0,0 +1,185 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./LinuxHardwareFingerprinter.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../Platform/LinuxFileApi.h" // for LinuxFileApi
+
+#include <sys/stat.h> // for ::stat()
+
+#include <string_view> // for std::string_view
+#include <vector> // for std::vector
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Fingerprint of a source that hasn't been looked at yet</summary>
+  const std::uint64_t EmptyFingerprint = 14695981039346656037ULL;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Folds a series of bytes into a fingerprint</summary>
+  /// <param name="fingerprint">Fingerprint the bytes will be folded into</param>
+  /// <param name="bytes">Bytes that will be folded into the fingerprint</param>
+  /// <param name="byteCount">Number of bytes that will be folded in</param>
+  /// <returns>The updated fingerprint</returns>
+  /// <remarks>
+  ///   This is the 64 bit FNV-1a hash. It is not cryptographically secure, but we're
+  ///   only trying to tell whether a handful of small files have changed.
+  /// </remarks>
+  std::uint64_t foldIntoFingerprint(
+    std::uint64_t fingerprint, const void *bytes, std::size_t byteCount
+  ) {
+    const std::uint8_t *current = static_cast<const std::uint8_t *>(bytes);
+    for(std::size_t index = 0; index < byteCount; ++index) {
+      fingerprint ^= current[index];
+      fingerprint *= 1099511628211ULL;
+    }
+
+    return fingerprint;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Folds the modification time, size and contents of a file into a fingerprint</summary>
+  /// <param name="fingerprint">Fingerprint the file will be folded into</param>
+  /// <param name="path">Path of the file that will be folded into the fingerprint</param>
+  /// <returns>The updated fingerprint</returns>
+  std::uint64_t foldFileIntoFingerprint(std::uint64_t fingerprint, const std::string &path) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    struct ::stat fileStatus;
+    int result = ::stat(path.c_str(), &fileStatus);
+    if(unlikely(result != 0)) {
+      return foldIntoFingerprint(fingerprint, u8"missing", 7);
+    }
+
+    fingerprint = foldIntoFingerprint(
+      fingerprint, &fileStatus.st_mtim, sizeof(fileStatus.st_mtim)
+    );
+    fingerprint = foldIntoFingerprint(
+      fingerprint, &fileStatus.st_size, sizeof(fileStatus.st_size)
+    );
+
+    std::vector<std::uint8_t> contents;
+    try {
+      contents = LinuxFileApi::ReadFileIntoMemory(path);
+    }
+    catch(const std::exception &) {
+      return foldIntoFingerprint(fingerprint, u8"unreadable", 10);
+    }
+
+    return foldIntoFingerprint(fingerprint, contents.data(), contents.size());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Folds the lines of a file beginning with a prefix into a fingerprint</summary>
+  /// <param name="fingerprint">Fingerprint the lines will be folded into</param>
+  /// <param name="path">Path of the file whose lines will be folded into the fingerprint</param>
+  /// <param name="linePrefix">Prefix of the lines that will be folded in</param>
+  /// <returns>The updated fingerprint</returns>
+  /// <remarks>
+  ///   This is used to leave out values that change constantly, such as the amount of
+  ///   free memory. The modification time and size are ignored for the same reason.
+  /// </remarks>
+  std::uint64_t foldFileLinesIntoFingerprint(
+    std::uint64_t fingerprint, const std::string &path, const std::string_view &linePrefix
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    std::vector<std::uint8_t> contents;
+    try {
+      contents = LinuxFileApi::ReadFileIntoMemory(path);
+    }
+    catch(const std::exception &) {
+      return foldIntoFingerprint(fingerprint, u8"unreadable", 10);
+    }
+
+    std::string_view remaining(reinterpret_cast<const char *>(contents.data()), contents.size());
+    while(!remaining.empty()) {
+      std::string_view::size_type lineEnd = remaining.find('\n');
+      std::string_view line = remaining.substr(0, lineEnd);
+      if(line.substr(0, linePrefix.length()) == linePrefix) {
+        fingerprint = foldIntoFingerprint(fingerprint, line.data(), line.length());
+      }
+
+      if(lineEnd == std::string_view::npos) {
+        break;
+      }
+      remaining.remove_prefix(lineEnd + 1);
+    }
+
+    return fingerprint;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::uint64_t LinuxHardwareFingerprinter::Calculate(
+    HardwareChange part,
+    const std::string &sysPath /* = u8"/sys" */,
+    const std::string &procPath /* = u8"/proc" */
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    switch(part) {
+      case HardwareChange::CpuTopology: {
+        std::string cpuPath = LinuxFileApi::JoinPaths(sysPath, u8"devices/system/cpu");
+        std::uint64_t fingerprint = EmptyFingerprint;
+        fingerprint = foldFileIntoFingerprint(
+          fingerprint, LinuxFileApi::JoinPaths(cpuPath, u8"present")
+        );
+        fingerprint = foldFileIntoFingerprint(
+          fingerprint, LinuxFileApi::JoinPaths(cpuPath, u8"online")
+        );
+        return fingerprint;
+      }
+      case HardwareChange::Memory: {
+        return foldFileLinesIntoFingerprint(
+          EmptyFingerprint, LinuxFileApi::JoinPaths(procPath, u8"meminfo"), u8"MemTotal:"
+        );
+      }
+      case HardwareChange::StorageVolumes: {
+        return foldFileIntoFingerprint(
+          EmptyFingerprint, LinuxFileApi::JoinPaths(procPath, u8"self/mountinfo")
+        );
+      }
+      default: {
+        return EmptyFingerprint;
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
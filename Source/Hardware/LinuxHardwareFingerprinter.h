@@ -0,0 +1,70 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_LINUXHARDWAREFINGERPRINTER_H
+#define NUCLEX_PLATFORM_HARDWARE_LINUXHARDWAREFINGERPRINTER_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "Nuclex/Platform/Hardware/HardwareSnapshot.h" // for HardwareChange
+
+#include <cstdint> // for std::uint64_t
+#include <string> // for std::string
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Fingerprints the small files describing the structure of the hardware</summary>
+  /// <remarks>
+  ///   <para>
+  ///     The CPU topology is described by /sys/devices/system/cpu/present and 'online',
+  ///     the installed memory by the 'MemTotal:' line of /proc/meminfo and the storage
+  ///     volumes by /proc/self/mountinfo. If the fingerprint of a part's files changes,
+  ///     the <see cref="HardwareSnapshot" /> analyzes that part again.
+  ///   </para>
+  ///   <para>
+  ///     Files in procfs and sysfs report a size of zero and keep the modification time
+  ///     they had when their inode was created, so for those, the contents are what counts.
+  ///   </para>
+  /// </remarks>
+  class LinuxHardwareFingerprinter {
+
+    /// <summary>Calculates the fingerprint of the sources describing a hardware part</summary>
+    /// <param name="part">Part of the hardware whose sources will be fingerprinted</param>
+    /// <param name="sysPath">Path to the sysfs root, can be changed for unit tests</param>
+    /// <param name="procPath">Path to the procfs root, can be changed for unit tests</param>
+    /// <returns>The fingerprint of the part's sources</returns>
+    public: static std::uint64_t Calculate(
+      HardwareChange part,
+      const std::string &sysPath = u8"/sys",
+      const std::string &procPath = u8"/proc"
+    );
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+#endif // NUCLEX_PLATFORM_HARDWARE_LINUXHARDWAREFINGERPRINTER_H
@@ -0,0 +1,235 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./LinuxMemoryPressureReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "./LinuxCgroupReader.h" // for LinuxCgroupReader
+#include "./StringHelper.h" // for StringHelper
+#include "../Platform/LinuxFileApi.h" // for LinuxFileApi
+
+#include <algorithm> // for std::min()
+#include <utility> // for std::move()
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Number of bytes in one megabyte</summary>
+  const std::size_t BytesPerMegabyte = 1024 * 1024;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Looks up the amount of kilobytes a line in /proc/meminfo reports</summary>
+  /// <param name="memInfo">Contents of the /proc/meminfo file</param>
+  /// <param name="key">Key including the colon, i.e. 'MemTotal:'</param>
+  /// <param name="kilobytes">Receives the number of kilobytes</param>
+  /// <returns>True if the key was found and its value parsed, false otherwise</returns>
+  bool tryFindKilobytes(
+    const std::string_view &memInfo, const std::string_view &key, std::size_t &kilobytes
+  ) {
+    using Nuclex::Platform::Hardware::StringHelper;
+
+    std::string_view::size_type index = memInfo.find(key);
+    while(index != std::string_view::npos) {
+      if((index == 0) || (memInfo[index - 1] == '\n')) {
+        std::string_view value = memInfo.substr(index + key.length());
+        std::string_view::size_type valueStart = value.find_first_not_of(u8" \t");
+        if(valueStart == std::string_view::npos) {
+          return false;
+        }
+        return StringHelper::TryParseNumber(value.substr(valueStart), kilobytes);
+      }
+
+      index = memInfo.find(key, index + 1);
+    }
+
+    return false;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Finds the value of the 'avg10' field in a pressure stall information line</summary>
+  /// <param name="line">Line in which the field will be searched</param>
+  /// <returns>The value of the field or nothing if it was not found</returns>
+  std::optional<float> findTenSecondAverage(const std::string_view &line) {
+    using Nuclex::Platform::Hardware::StringHelper;
+
+    std::string_view::size_type index = line.find(u8"avg10=");
+    if(index == std::string_view::npos) {
+      return std::optional<float>();
+    }
+
+    float percent;
+    if(StringHelper::TryParseNumber(line.substr(index + 6), percent)) {
+      return percent;
+    } else {
+      return std::optional<float>();
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  LinuxMemoryPressureReader::LinuxMemoryPressureReader(
+    const std::string &procPath /* = u8"/proc" */,
+    const std::string &cgroupRootPath /* = u8"/sys/fs/cgroup" */
+  ) :
+    memInfoReader(),
+    pressureReader(),
+    groupUsageReader(),
+    groupLimitReaders() {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    // Either file may be missing on older kernels, the readers just stay closed then
+    this->memInfoReader.TryOpen(LinuxFileApi::JoinPaths(procPath, u8"meminfo"));
+    this->pressureReader.TryOpen(LinuxFileApi::JoinPaths(procPath, u8"pressure/memory"));
+
+    // Find out which cgroup we're in. This is only done once, processes can be moved
+    // between cgroups, but that's not something that happens to applications normally.
+    std::string groupDirectory = LinuxCgroupReader::LocateOwnCgroup(procPath, cgroupRootPath);
+    if(groupDirectory.empty()) {
+      return;
+    }
+
+    // The effective limit is the lowest limit of the cgroup and all its ancestors,
+    // so open the 'memory.max' file in each directory up to the cgroup root
+    this->groupUsageReader.TryOpen(LinuxFileApi::JoinPaths(groupDirectory, u8"memory.current"));
+    std::vector<std::string> directories = LinuxCgroupReader::ListGroupAndAncestors(
+      cgroupRootPath, groupDirectory
+    );
+    for(const std::string &directory : directories) {
+      Platform::LinuxProcFileReader limitReader;
+      if(limitReader.TryOpen(LinuxFileApi::JoinPaths(directory, u8"memory.max"))) {
+        this->groupLimitReaders.push_back(std::move(limitReader));
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void LinuxMemoryPressureReader::Sample(MemoryPressure &pressure) {
+    std::string_view contents;
+
+    pressure.TotalMegabytes = 0;
+    pressure.AvailableMegabytes = 0;
+    if(this->memInfoReader.TryRead(contents)) {
+      std::size_t kilobytes;
+      if(tryFindKilobytes(contents, u8"MemTotal:", kilobytes)) {
+        pressure.TotalMegabytes = kilobytes / 1024;
+      }
+
+      // Kernels before 3.14 do not report 'MemAvailable', take 'MemFree' as a lower bound
+      if(tryFindKilobytes(contents, u8"MemAvailable:", kilobytes)) {
+        pressure.AvailableMegabytes = kilobytes / 1024;
+      } else if(tryFindKilobytes(contents, u8"MemFree:", kilobytes)) {
+        pressure.AvailableMegabytes = kilobytes / 1024;
+      }
+    }
+
+    pressure.SomeStallPercent.reset();
+    pressure.FullStallPercent.reset();
+    if(this->pressureReader.TryRead(contents)) {
+      ParsePressureStallInfo(contents, pressure.SomeStallPercent, pressure.FullStallPercent);
+    }
+
+    // Each ancestor's 'memory.max' either holds a byte count or the word 'max'
+    pressure.GroupLimitMegabytes.reset();
+    for(Platform::LinuxProcFileReader &limitReader : this->groupLimitReaders) {
+      std::size_t limitBytes;
+      if(limitReader.TryRead(contents) && StringHelper::TryParseNumber(contents, limitBytes)) {
+        std::size_t limitMegabytes = limitBytes / BytesPerMegabyte;
+        if(pressure.GroupLimitMegabytes.has_value()) {
+          pressure.GroupLimitMegabytes = std::min(
+            pressure.GroupLimitMegabytes.value(), limitMegabytes
+          );
+        } else {
+          pressure.GroupLimitMegabytes = limitMegabytes;
+        }
+      }
+    }
+
+    pressure.GroupUsageMegabytes.reset();
+    {
+      std::size_t usageBytes;
+      bool usageKnown = (
+        this->groupUsageReader.TryRead(contents) &&
+        StringHelper::TryParseNumber(contents, usageBytes)
+      );
+      if(usageKnown) {
+        pressure.GroupUsageMegabytes = usageBytes / BytesPerMegabyte;
+      }
+    }
+
+    pressure.UsableMegabytes = pressure.AvailableMegabytes;
+    if(pressure.GroupLimitMegabytes.has_value()) {
+      std::size_t remainingMegabytes = pressure.GroupLimitMegabytes.value();
+      if(pressure.GroupUsageMegabytes.has_value()) {
+        if(pressure.GroupUsageMegabytes.value() >= remainingMegabytes) {
+          remainingMegabytes = 0;
+        } else {
+          remainingMegabytes -= pressure.GroupUsageMegabytes.value();
+        }
+      }
+      pressure.UsableMegabytes = std::min(pressure.UsableMegabytes, remainingMegabytes);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void LinuxMemoryPressureReader::ParsePressureStallInfo(
+    const std::string_view &contents,
+    std::optional<float> &someStallPercent,
+    std::optional<float> &fullStallPercent
+  ) {
+
+    // The file has up to two lines, looking like this:
+    //   some avg10=0.00 avg60=0.00 avg300=0.00 total=0
+    //   full avg10=0.00 avg60=0.00 avg300=0.00 total=0
+    std::string_view remaining = contents;
+    while(!remaining.empty()) {
+      std::string_view::size_type lineEnd = remaining.find('\n');
+      std::string_view line = remaining.substr(0, lineEnd);
+      if(line.substr(0, 5) == u8"some ") {
+        someStallPercent = findTenSecondAverage(line);
+      } else if(line.substr(0, 5) == u8"full ") {
+        fullStallPercent = findTenSecondAverage(line);
+      }
+
+      if(lineEnd == std::string_view::npos) {
+        break;
+      }
+      remaining.remove_prefix(lineEnd + 1);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,110 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_LINUXMEMORYPRESSUREREADER_H
+#define NUCLEX_PLATFORM_HARDWARE_LINUXMEMORYPRESSUREREADER_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "Nuclex/Platform/Hardware/MemoryPressure.h"
+#include "../Platform/LinuxProcFileReader.h" // for LinuxProcFileReader
+
+#include <string> // for std::string
+#include <string_view> // for std::string_view
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Samples memory usage and limits from procfs and the cgroup v2 filesystem</summary>
+  /// <remarks>
+  ///   <para>
+  ///     All files are opened once when the reader is constructed and then re-read via
+  ///     pread() into a persistent buffer each time a sample is taken, so sampling costs
+  ///     a handful of system calls and no memory allocations.
+  ///   </para>
+  ///   <para>
+  ///     The following sources are used:
+  ///     <list type="bullet">
+  ///       <item><term>/proc/meminfo</term> for total and available memory</item>
+  ///       <item><term>/proc/pressure/memory</term> for the memory stall percentages</item>
+  ///       <item>
+  ///         <term>memory.max</term> of the process' cgroup and all of its ancestors
+  ///         for the effective memory limit
+  ///       </item>
+  ///       <item><term>memory.current</term> of the process' cgroup for its usage</item>
+  ///     </list>
+  ///     Sources that don't exist (older kernels, cgroup v1 systems) are skipped.
+  ///   </para>
+  /// </remarks>
+  class LinuxMemoryPressureReader {
+
+    /// <summary>Initializes a new memory pressure reader and opens its sources</summary>
+    /// <param name="procPath">Path at which procfs is mounted, can be changed for tests</param>
+    /// <param name="cgroupRootPath">
+    ///   Path at which the cgroup v2 filesystem is mounted, can be changed for tests
+    /// </param>
+    public: LinuxMemoryPressureReader(
+      const std::string &procPath = u8"/proc",
+      const std::string &cgroupRootPath = u8"/sys/fs/cgroup"
+    );
+
+    /// <summary>Closes all files opened by the reader</summary>
+    public: ~LinuxMemoryPressureReader() = default;
+
+    /// <summary>Reads the current memory usage and limits</summary>
+    /// <param name="pressure">Receives the sampled memory state</param>
+    public: void Sample(MemoryPressure &pressure);
+
+    /// <summary>Extracts the 10 second averages from a pressure stall information file</summary>
+    /// <param name="contents">Contents of a file in /proc/pressure</param>
+    /// <param name="someStallPercent">Receives the 'some' average if present</param>
+    /// <param name="fullStallPercent">Receives the 'full' average if present</param>
+    public: static void ParsePressureStallInfo(
+      const std::string_view &contents,
+      std::optional<float> &someStallPercent,
+      std::optional<float> &fullStallPercent
+    );
+
+    private: LinuxMemoryPressureReader(const LinuxMemoryPressureReader &other) = delete;
+    private: LinuxMemoryPressureReader &operator =(
+      const LinuxMemoryPressureReader &other
+    ) = delete;
+
+    /// <summary>Reads the /proc/meminfo file, not opened if unavailable</summary>
+    private: Platform::LinuxProcFileReader memInfoReader;
+    /// <summary>Reads the /proc/pressure/memory file, not opened if unavailable</summary>
+    private: Platform::LinuxProcFileReader pressureReader;
+    /// <summary>Reads the process cgroup's memory.current, not opened if unavailable</summary>
+    private: Platform::LinuxProcFileReader groupUsageReader;
+    /// <summary>Read the memory.max files from the process' cgroup upwards</summary>
+    private: std::vector<Platform::LinuxProcFileReader> groupLimitReaders;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+#endif // NUCLEX_PLATFORM_HARDWARE_LINUXMEMORYPRESSUREREADER_H
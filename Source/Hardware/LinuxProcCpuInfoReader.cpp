@@ -24,16 +24,33 @@ limitations under the License.
 
 #if defined(NUCLEX_PLATFORM_LINUX)
 
-#include <Nuclex/Support/Text/LexicalCast.h> // for lexical_cast
 #include <Nuclex/Support/Text/ParserHelper.h> // for ParserHelper
 #include <Nuclex/Support/Threading/StopToken.h> // for StopToken
 
 #include "../Platform/LinuxFileApi.h" // for LinuxFileApi::ReadFileIntoMemory()
 
+#include <charconv> // for std::from_chars()
+#include <cstring> // for std::memchr()
+
 namespace {
 
   // ------------------------------------------------------------------------------------------- //
 
+  /// <summary>Parses a number from a value found in /proc/cpuinfo</summary>
+  /// <typeparam name="TValue">Type of number that will be parsed</typeparam>
+  /// <param name="value">Value as found in the /proc/cpuinfo file</param>
+  /// <param name="result">Receives the parsed number, left untouched on failure</param>
+  /// <remarks>
+  ///   The file can be hundreds of kilobytes on big machines, so we parse the numbers
+  ///   directly from the file contents rather than copying them into strings.
+  /// </remarks>
+  template<typename TValue>
+  void parseNumber(const std::string_view &value, TValue &result) {
+    std::from_chars(value.data(), value.data() + value.length(), result);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
   /// <summary>Collects and summarizes informations about the system's CPUs</summary>
   /// <remarks>
   ///   This helper gets fed each line read from /proc/cpuinfo and extracts useful
@@ -97,7 +114,10 @@ namespace {
     /// <summary>Index of the current processor</summary>
     private: std::size_t processorIndex;
     /// <summary>Human-readable make and model of the current processor</summary>
-    private: std::string modelName;
+    /// <remarks>
+    ///   Points into the /proc/cpuinfo contents, which stay in memory until parsing is done
+    /// </remarks>
+    private: std::string_view modelName;
     /// <summary>Unique id of the physical CPU whose processor is being described</summary>
     private: std::size_t physicalId;
     /// <summary>Unique id of the CPU core currently being described</summary>
@@ -155,10 +175,11 @@ namespace {
   void CpuInfoCollector::ReportProcessor() {
 
     // Check if any information has been collected yet. This makes the method safe
-    // for redundant calls which we allow.
-    if(this->physicalId != std::size_t(-1)) {
+    // for redundant calls which we allow. Not all architectures list the physical id
+    // (ARM doesn't), so the processor index is the only thing we can rely on.
+    if(this->processorIndex != std::size_t(-1)) {
       (*this->callback)(
-        nullptr,
+        this->userPointer,
         this->processorIndex,
         this->physicalId,
         this->coreId,
@@ -175,24 +196,26 @@ namespace {
   void CpuInfoCollector::processKeyValuePair(
     const std::string_view &key, const std::string_view &value
   ) {
-    using Nuclex::Support::Text::lexical_cast;
-
     if(key == u8"processor") {
       ReportProcessor();
       startNewProcessor();
-      this->processorIndex = lexical_cast<std::size_t>(std::string(value));
+      parseNumber(value, this->processorIndex);
     } else if(key == u8"model name") {
       this->modelName = value;
     } else if(key == u8"cpu MHz") {
-      this->currentMhz = lexical_cast<double>(std::string(value));
+      parseNumber(value, this->currentMhz);
     } else if(key == u8"cpu GHz") {
-      this->currentMhz = lexical_cast<double>(std::string(value)) * 1000.0;
+      double currentGhz = -1.0;
+      parseNumber(value, currentGhz);
+      if(currentGhz > 0.0) {
+        this->currentMhz = currentGhz * 1000.0;
+      }
     } else if(key == u8"physical id") {
-      this->physicalId = lexical_cast<std::size_t>(std::string(value));
+      parseNumber(value, this->physicalId);
     } else if(key == u8"core id") {
-      this->coreId = lexical_cast<std::size_t>(std::string(value));
+      parseNumber(value, this->coreId);
     } else if(key == u8"bogomips") {
-      this->bogoMips = lexical_cast<double>(std::string(value));
+      parseNumber(value, this->bogoMips);
     }
   }
 
@@ -202,7 +225,7 @@ namespace {
 
     // Reset the running state so it can be filled from the next processor paragraph
     this->processorIndex = std::size_t(-1);
-    this->modelName.clear();
+    this->modelName = std::string_view();
     this->physicalId = std::size_t(-1);
     this->coreId = std::size_t(-1);
     this->currentMhz = -1.0;
@@ -222,37 +245,49 @@ namespace Nuclex { namespace Platform { namespace Hardware {
     void *userPointer,
     CallbackFunction *callback,
     const std::shared_ptr<const Support::Threading::StopToken> &canceller
+  ) {
+    std::vector<std::uint8_t> cpuInfoContents = (
+      Platform::LinuxFileApi::ReadFileIntoMemory(u8"/proc/cpuinfo")
+    );
+
+    canceller->ThrowIfCanceled();
+
+    ParseCpuInfo(
+      std::string_view(
+        reinterpret_cast<const char *>(cpuInfoContents.data()), cpuInfoContents.size()
+      ),
+      userPointer,
+      callback
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void LinuxProcCpuInfoReader::ParseCpuInfo(
+    const std::string_view &cpuInfoContents,
+    void *userPointer,
+    CallbackFunction *callback
   ) {
     CpuInfoCollector collector(callback, userPointer);
-    {
-      std::vector<std::uint8_t> cpuInfoContents = (
-        Platform::LinuxFileApi::ReadFileIntoMemory(u8"/proc/cpuinfo")
-      );
-      const char *cpuInfoText = reinterpret_cast<const char *>(cpuInfoContents.data());
-
-      canceller->ThrowIfCanceled();
-
-      // Walk through the file contents, looking for '\n' character to cookie-cut
-      // each line as a string_view and process it with the CPU information collection
-      std::size_t lineStartIndex = 0;
-      std::size_t index = 1;
-      while(index < cpuInfoContents.size()) {
-        if(cpuInfoText[index] == '\n') {
-          collector.ProcessLine(
-            std::string_view(cpuInfoText + lineStartIndex, index - lineStartIndex)
-          );
-          lineStartIndex = index + 1;
-        }
 
-        ++index;
+    // Cookie-cut each line as a string_view and process it with the CPU information
+    // collector. std::memchr() is vectorized in any decent C library, so this scans
+    // for line breaks much faster than checking character by character.
+    const char *current = cpuInfoContents.data();
+    const char *end = current + cpuInfoContents.length();
+    while(current < end) {
+      const char *lineEnd = static_cast<const char *>(
+        std::memchr(current, '\n', static_cast<std::size_t>(end - current))
+      );
+      if(lineEnd == nullptr) {
+        lineEnd = end; // Last line didn't end with a newline character
       }
 
-      // If the last line didn't end with a newline character, make sure it's processed
-      if(index > lineStartIndex + 1) {
-        collector.ProcessLine(
-          std::string_view(cpuInfoText + lineStartIndex, index - lineStartIndex)
-        );
-      }
+      collector.ProcessLine(
+        std::string_view(current, static_cast<std::size_t>(lineEnd - current))
+      );
+
+      current = lineEnd + 1;
     }
 
     // Report the last procesor recorded as well.
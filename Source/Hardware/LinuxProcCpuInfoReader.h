@@ -25,6 +25,7 @@ limitations under the License.
 #if defined(NUCLEX_PLATFORM_LINUX)
 
 #include <string> // for std::string
+#include <string_view> // for std::string_view
 #include <cstddef> // for std::size_t
 #include <memory> // for std::shared_ptr
 #include <vector> // for std::vector
@@ -51,12 +52,17 @@ namespace Nuclex { namespace Platform { namespace Hardware {
     /// <summary>
     ///   Signature for the callback function invoked by <see cref="TryQueryCpuInfos" />
     /// </summary>
+    /// <remarks>
+    ///   Ids not listed in /proc/cpuinfo are reported as std::size_t(-1), an unknown name
+    ///   as an empty string and unknown frequencies or BogoMIPS as negative numbers.
+    ///   The name points into the parsed file contents and is only valid during the call.
+    /// </remarks>
     public: typedef void CallbackFunction(
       void *userPointer,
       std::size_t processorIndex,
       std::size_t physicalCpuId,
       std::size_t coreId,
-      const std::string &name,
+      const std::string_view &name,
       double frequencyInMhz,
       double bogoMips
     );
@@ -77,6 +83,20 @@ namespace Nuclex { namespace Platform { namespace Hardware {
       const std::shared_ptr<const Support::Threading::StopToken> &canceller
     );
 
+    /// <summary>Parses the contents of the /proc/cpuinfo file</summary>
+    /// <param name="cpuInfoContents">Contents of the /proc/cpuinfo file</param>
+    /// <param name="userPointer">Will be passed to the callback unmodified</param>
+    /// <param name="callback">Callback that will be invoked for each processor</param>
+    /// <remarks>
+    ///   The parser works directly on the provided contents and does not allocate any
+    ///   memory of its own, even on machines with hundreds of processors.
+    /// </remarks>
+    public: static void ParseCpuInfo(
+      const std::string_view &cpuInfoContents,
+      void *userPointer,
+      CallbackFunction *callback
+    );
+
   };
 
   // ------------------------------------------------------------------------------------------- //
@@ -29,6 +29,7 @@ limitations under the License.
 #include <Nuclex/Support/Threading/StopToken.h> // for StopToken
 
 #include "../Platform/LinuxFileApi.h" // for LinuxFileApi::ReadFileIntoMemory()
+#include "./LinuxSysNodeTreeReader.h" // for LinuxSysNodeTreeReader::TryReadNodes()
 
 namespace {
 
@@ -62,6 +63,30 @@ namespace {
 
   // ------------------------------------------------------------------------------------------- //
 
+  /// <summary>Parses a plain count or a kilobyte amount listed in /proc/meminfo</summary>
+  /// <param name="value">Count or memory value as found in the /proc/meminfo file</param>
+  /// <returns>The number the value starts with</returns>
+  std::size_t countFromMemInfoValue(const std::string_view &value) {
+    using Nuclex::Support::Text::lexical_cast;
+
+    std::string_view::size_type end = 0;
+    while(end < value.length()) {
+      if((value[end] >= '0') && (value[end] <= '9')) {
+        ++end;
+      } else {
+        break;
+      }
+    }
+
+    if(end == 0) {
+      return 0;
+    } else {
+      return lexical_cast<std::size_t>(std::string(value.substr(0, end)));
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
   /// <summary>Collects and summarizes informations about the system's memory</summary>
   /// <remarks>
   ///   This helper gets fed each line read from /proc/meminfo and extracts useful
@@ -69,11 +94,14 @@ namespace {
   /// </remarks>
   class MemInfoCollector {
 
-    /// <summary>Initializes a new CPU info collector</summary>
+    /// <summary>Initializes a new memory info collector</summary>
     public: MemInfoCollector() :
       TotalMegabytes(0.0),
       FreeMegabytes(0.0),
-      AvailableMegabytes(0.0) {}
+      AvailableMegabytes(0.0),
+      HugePageKilobytes(0),
+      HugePageTotalCount(0),
+      HugePageFreeCount(0) {}
 
     /// <summary>Processes one line read from the /proc/meminfo file</summary>
     /// <param name="line">Line that will be processed</param>
@@ -97,6 +125,12 @@ namespace {
     public: std::size_t FreeMegabytes;
     /// <summary>Human-readable amount of memory that remains unused</summary>
     public: std::size_t AvailableMegabytes;
+    /// <summary>Size of a default huge page in kilobytes</summary>
+    public: std::size_t HugePageKilobytes;
+    /// <summary>Number of huge pages reserved in the huge page pool</summary>
+    public: std::size_t HugePageTotalCount;
+    /// <summary>Number of huge pages in the pool that are still unused</summary>
+    public: std::size_t HugePageFreeCount;
 
   };
 
@@ -151,6 +185,12 @@ namespace {
       this->FreeMegabytes = megabytesFromMemoryValue(value);
     } else if(key == u8"MemAvailable") {
       this->AvailableMegabytes = megabytesFromMemoryValue(value);
+    } else if(key == u8"HugePages_Total") {
+      this->HugePageTotalCount = countFromMemInfoValue(value);
+    } else if(key == u8"HugePages_Free") {
+      this->HugePageFreeCount = countFromMemInfoValue(value);
+    } else if(key == u8"Hugepagesize") {
+      this->HugePageKilobytes = countFromMemInfoValue(value); // always listed in kB
     }
   }
 
@@ -163,12 +203,16 @@ namespace Nuclex { namespace Platform { namespace Hardware {
   // ------------------------------------------------------------------------------------------- //
 
   MemoryInfo LinuxProcMemInfoReader::TryReadMemInfo(
-    const std::shared_ptr<const Support::Threading::StopToken> &canceller
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller,
+    const std::string &procPath /* = u8"/proc" */,
+    const std::string &sysPath /* = u8"/sys" */
   ) {
     MemInfoCollector collector;
     {
       std::vector<std::uint8_t> memInfoContents = (
-        Platform::LinuxFileApi::ReadFileIntoMemory(u8"/proc/meminfo")
+        Platform::LinuxFileApi::ReadFileIntoMemory(
+          Platform::LinuxFileApi::JoinPaths(procPath, u8"meminfo")
+        )
       );
       const char *memInfoText = reinterpret_cast<const char *>(memInfoContents.data());
 
@@ -211,12 +255,80 @@ namespace Nuclex { namespace Platform { namespace Hardware {
         std::size_t(0xffff8800000), result.InstalledMegabytes
       );
     }
-      
+
+    result.HugePageKilobytes = collector.HugePageKilobytes;
+    result.HugePageTotalCount = collector.HugePageTotalCount;
+    result.HugePageFreeCount = collector.HugePageFreeCount;
+
+    // The transparent huge page setting lives in sysfs. If the kernel was built without
+    // THP support, the file doesn't exist and we report the feature as unsupported.
+    {
+      std::string enabledContents;
+      bool wasRead = Platform::LinuxFileApi::TryReadFileInOneReadCall(
+        Platform::LinuxFileApi::JoinPaths(sysPath, u8"kernel/mm/transparent_hugepage/enabled"),
+        enabledContents
+      );
+      if(wasRead) {
+        result.TransparentHugePages = ParseTransparentHugePageMode(enabledContents);
+      } else {
+        result.TransparentHugePages = TransparentHugePageMode::Unsupported;
+      }
+    }
+
+    canceller->ThrowIfCanceled();
+
+    // Free memory per NUMA node. Node numbers can have gaps (i.e. when a node without
+    // any memory or processors is offline), so we index by node number, not by position.
+    {
+      std::vector<LinuxSysNodeTreeReader::NodeInfo> nodes = (
+        LinuxSysNodeTreeReader::TryReadNodes(
+          Platform::LinuxFileApi::JoinPaths(sysPath, u8"devices/system")
+        )
+      );
+      for(const LinuxSysNodeTreeReader::NodeInfo &node : nodes) {
+        if(result.NodeFreeMegabytes.size() <= node.Index) {
+          result.NodeFreeMegabytes.resize(node.Index + 1, 0);
+        }
+        result.NodeFreeMegabytes[node.Index] = static_cast<std::size_t>(
+          (node.FreeMemoryInBytes + (512 * 1024)) / (1024 * 1024)
+        );
+      }
+    }
+
     return result;
   }
 
   // ------------------------------------------------------------------------------------------- //
 
+  TransparentHugePageMode LinuxProcMemInfoReader::ParseTransparentHugePageMode(
+    const std::string_view &contents
+  ) {
+    std::string_view::size_type openingBracketIndex = contents.find('[');
+    if(openingBracketIndex == std::string_view::npos) {
+      return TransparentHugePageMode::Unsupported;
+    }
+
+    std::string_view::size_type closingBracketIndex = contents.find(']', openingBracketIndex);
+    if(closingBracketIndex == std::string_view::npos) {
+      return TransparentHugePageMode::Unsupported;
+    }
+
+    std::string_view activeMode = contents.substr(
+      openingBracketIndex + 1, closingBracketIndex - openingBracketIndex - 1
+    );
+    if(activeMode == u8"always") {
+      return TransparentHugePageMode::Always;
+    } else if(activeMode == u8"madvise") {
+      return TransparentHugePageMode::OnRequest;
+    } else if(activeMode == u8"never") {
+      return TransparentHugePageMode::Never;
+    } else {
+      return TransparentHugePageMode::Unsupported;
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
 }}} // namespace Nuclex::Platform::Hardware
 
 #endif // defined(NUCLEX_PLATFORM_LINUX)
\ No newline at end of file
@@ -26,7 +26,9 @@ limitations under the License.
 
 #include "Nuclex/Platform/Hardware/MemoryInfo.h"
 
-#include <memory>
+#include <memory> // for std::shared_ptr
+#include <string> // for std::string
+#include <string_view> // for std::string_view
 
 namespace Nuclex { namespace Support { namespace Threading {
 
@@ -42,21 +44,34 @@ namespace Nuclex { namespace Platform { namespace Hardware {
 
   // ------------------------------------------------------------------------------------------- //
 
-  /// <summary>Queries physical and logical CPUs using the /proc/cpuinfo pseudofile</summary>
+  /// <summary>Queries the system's memory using the /proc/meminfo pseudofile</summary>
+  /// <remarks>
+  ///   Besides /proc/meminfo, this also looks at the transparent huge page setting in
+  ///   /sys/kernel/mm/transparent_hugepage and at the free memory of each NUMA node.
+  /// </remarks>
   class LinuxProcMemInfoReader {
 
-    /// <summary>Attempts to read informations about processors via /proc/cpuinfo</summary>
-    /// <param name="processorCount">Number of processors to query</param>
-    /// <param name="userPointer">Will be passed to the callback unmodified</param>
-    /// <param name="callback">
-    ///   Callback that will be invoked for each processor, provided with the
-    ///   user pointer, processor index, processor name and base frequency in GHz
-    /// </param>
+    /// <summary>Attempts to read informations about the memory via /proc/meminfo</summary>
     /// <param name="canceller">
     ///   Stop token by which the query process can be aborted early
     /// </param>
+    /// <param name="procPath">Path to the proc file system, can be changed for unit tests</param>
+    /// <param name="sysPath">Path to the sysfs file system, can be changed for unit tests</param>
+    /// <returns>A description of the installed and available memory</returns>
     public: static MemoryInfo TryReadMemInfo(
-      const std::shared_ptr<const Support::Threading::StopToken> &canceller
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller,
+      const std::string &procPath = u8"/proc",
+      const std::string &sysPath = u8"/sys"
+    );
+
+    /// <summary>Interprets the contents of the transparent huge page 'enabled' file</summary>
+    /// <param name="contents">
+    ///   Contents of the file, listing all modes with the active one in brackets,
+    ///   for example 'always [madvise] never'
+    /// </param>
+    /// <returns>The active transparent huge page mode</returns>
+    public: static TransparentHugePageMode ParseTransparentHugePageMode(
+      const std::string_view &contents
     );
 
   };
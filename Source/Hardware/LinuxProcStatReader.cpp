@@ -0,0 +1,158 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./LinuxProcStatReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "./StringHelper.h" // for StringHelper
+#include "../Platform/LinuxFileApi.h" // for LinuxFileApi
+
+#include <algorithm> // for std::max()
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Parses the counters following the 'cpu' or 'cpuN' label</summary>
+  /// <param name="line">Remainder of the line after the label</param>
+  /// <param name="times">Receives the parsed counters</param>
+  /// <returns>True if at least the first four counters were present</returns>
+  bool tryParseCounters(
+    std::string_view line, Nuclex::Platform::Hardware::LinuxCpuTimes &times
+  ) {
+    using Nuclex::Platform::Hardware::StringHelper;
+
+    // user nice system idle iowait irq softirq steal (guest guest_nice)
+    // Older kernels stop after idle (2.4), iowait (2.5.41) or softirq (2.6.11).
+    std::uint64_t counters[8] = { 0 };
+    std::size_t count = 0;
+    while(count < 8) {
+      StringHelper::SkipWhitespace(line);
+      if(!StringHelper::TryTakeNumber(line, counters[count])) {
+        break;
+      }
+      ++count;
+    }
+    if(count < 4) {
+      return false;
+    }
+
+    times.BusyTicks = counters[0] + counters[1] + counters[2] + counters[5] + counters[6];
+    times.IoWaitTicks = counters[4];
+    times.StealTicks = counters[7];
+    times.TotalTicks = times.BusyTicks + counters[3] + counters[4] + counters[7];
+    return true;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  LinuxProcStatReader::LinuxProcStatReader(const std::string &procPath /* = u8"/proc" */) :
+    statReader() {
+    this->statReader.TryOpen(Platform::LinuxFileApi::JoinPaths(procPath, u8"stat"));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::size_t LinuxProcStatReader::CountProcessors() {
+    std::string_view contents;
+    if(!this->statReader.TryRead(contents)) {
+      return 0;
+    }
+
+    LinuxCpuTimes total;
+    std::vector<LinuxCpuTimes> noProcessors;
+    return ParseCpuTimes(contents, total, noProcessors);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool LinuxProcStatReader::TryRead(
+    LinuxCpuTimes &total, std::vector<LinuxCpuTimes> &processors
+  ) {
+    std::string_view contents;
+    if(unlikely(!this->statReader.TryRead(contents))) {
+      return false;
+    }
+
+    return (ParseCpuTimes(contents, total, processors) > 0);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::size_t LinuxProcStatReader::ParseCpuTimes(
+    const std::string_view &contents,
+    LinuxCpuTimes &total,
+    std::vector<LinuxCpuTimes> &processors
+  ) {
+    bool totalFound = false;
+    std::size_t processorCount = 0;
+
+    // The 'cpu' lines always come first, so stop at the first line that isn't one
+    // rather than walking through the long 'intr' line that follows them.
+    std::string_view remaining = contents;
+    while(remaining.substr(0, 3) == u8"cpu") {
+      std::string_view::size_type lineEnd = remaining.find('\n');
+      std::string_view line = remaining.substr(3, lineEnd - 3);
+
+      if(line.empty() || (line[0] == ' ')) {
+        totalFound = tryParseCounters(line, total);
+      } else {
+        std::size_t processorIndex;
+        std::from_chars_result outcome = std::from_chars(
+          line.data(), line.data() + line.length(), processorIndex
+        );
+        if(outcome.ec == std::errc()) {
+          line.remove_prefix(static_cast<std::size_t>(outcome.ptr - line.data()));
+          if(processorIndex < processors.size()) {
+            tryParseCounters(line, processors[processorIndex]);
+          }
+          if(processorIndex >= processorCount) {
+            processorCount = processorIndex + 1;
+          }
+        }
+      }
+
+      if(lineEnd == std::string_view::npos) {
+        break;
+      }
+      remaining.remove_prefix(lineEnd + 1);
+    }
+
+    if(totalFound) {
+      return std::max<std::size_t>(processorCount, 1);
+    } else {
+      return 0;
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
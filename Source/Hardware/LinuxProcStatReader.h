@@ -0,0 +1,123 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_LINUXPROCSTATREADER_H
+#define NUCLEX_PLATFORM_HARDWARE_LINUXPROCSTATREADER_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../Platform/LinuxProcFileReader.h" // for LinuxProcFileReader
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t
+#include <string> // for std::string
+#include <string_view> // for std::string_view
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Accumulated time a processor spent in different states since boot</summary>
+  /// <remarks>
+  ///   All values are in clock ticks (USER_HZ, usually 1/100th of a second). Only
+  ///   differences between two readings are meaningful.
+  /// </remarks>
+  struct LinuxCpuTimes {
+
+    /// <summary>Ticks spent in user mode, kernel mode and handling interrupts</summary>
+    public: std::uint64_t BusyTicks;
+    /// <summary>Ticks spent idle while I/O was outstanding</summary>
+    public: std::uint64_t IoWaitTicks;
+    /// <summary>Ticks the hypervisor gave to other virtual machines</summary>
+    public: std::uint64_t StealTicks;
+    /// <summary>Sum of the ticks spent in all states, including idle</summary>
+    public: std::uint64_t TotalTicks;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads the processor time counters from /proc/stat</summary>
+  /// <remarks>
+  ///   <para>
+  ///     The file is opened once and re-read each time, so taking a reading costs one
+  ///     pread() and, once the buffer has settled, no memory allocations.
+  ///   </para>
+  ///   <para>
+  ///     The lines of interest look like this (all numbers are clock ticks):
+  ///     <code>
+  ///       cpu  user nice system idle iowait irq softirq steal guest guest_nice
+  ///       cpu0 user nice system idle iowait irq softirq steal guest guest_nice
+  ///     </code>
+  ///     Guest time is already included in user time and therefore skipped.
+  ///     Offline processors have no line, so the processor indices can have gaps.
+  ///   </para>
+  /// </remarks>
+  class LinuxProcStatReader {
+
+    /// <summary>Initializes a new /proc/stat reader and opens the file</summary>
+    /// <param name="procPath">Path at which procfs is mounted, can be changed for tests</param>
+    public: LinuxProcStatReader(const std::string &procPath = u8"/proc");
+
+    /// <summary>Counts the processors listed in the file</summary>
+    /// <returns>
+    ///   The highest processor index plus one, or 0 if the file could not be read
+    /// </returns>
+    public: std::size_t CountProcessors();
+
+    /// <summary>Reads the current time counters of all processors</summary>
+    /// <param name="total">Receives the counters summed over all processors</param>
+    /// <param name="processors">
+    ///   Receives the counters of the individual processors. Processors beyond the size
+    ///   of the vector are ignored, processors not listed are left unchanged.
+    /// </param>
+    /// <returns>True if the file was read, false otherwise</returns>
+    public: bool TryRead(LinuxCpuTimes &total, std::vector<LinuxCpuTimes> &processors);
+
+    /// <summary>Extracts the time counters from the contents of /proc/stat</summary>
+    /// <param name="contents">Contents of the /proc/stat file</param>
+    /// <param name="total">Receives the counters summed over all processors</param>
+    /// <param name="processors">
+    ///   Receives the counters of the individual processors. Processors beyond the size
+    ///   of the vector are ignored, processors not listed are left unchanged.
+    /// </param>
+    /// <returns>
+    ///   The highest processor index seen plus one, or 0 if the summary line is missing
+    /// </returns>
+    public: static std::size_t ParseCpuTimes(
+      const std::string_view &contents,
+      LinuxCpuTimes &total,
+      std::vector<LinuxCpuTimes> &processors
+    );
+
+    /// <summary>Keeps /proc/stat open between readings</summary>
+    private: Platform::LinuxProcFileReader statReader;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+#endif // NUCLEX_PLATFORM_HARDWARE_LINUXPROCSTATREADER_H
@@ -0,0 +1,843 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./LinuxStoreInfoReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include <Nuclex/Support/Threading/StopToken.h> // for StopToken
+
+#include "./StringHelper.h" // for StringHelper
+#include "../Platform/LinuxFileApi.h" // for LinuxFileApi
+
+#include <cctype> // for std::isxdigit()
+#include <cstdint> // for std::uint64_t
+#include <cstdlib> // for std::strtoul()
+#include <stdexcept> // for std::exception
+#include <optional> // for std::optional
+
+#include <sys/statvfs.h> // for ::statvfs()
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>A block device or partition found in the /sys/block tree</summary>
+  struct BlockDeviceNode {
+
+    /// <summary>Name of the device node, i.e. 'sda1' or 'nvme0n1p2'</summary>
+    public: std::string Name;
+    /// <summary>Major number of the device</summary>
+    public: std::size_t Major;
+    /// <summary>Minor number of the device</summary>
+    public: std::size_t Minor;
+    /// <summary>Size of the device or partition in megabytes, if known</summary>
+    public: std::optional<std::size_t> CapacityInMegabytes;
+    /// <summary>Index of the store (whole device) the node belongs to</summary>
+    public: std::size_t StoreIndex;
+    /// <summary>Index of the partition in the store or -1 if nothing is mounted</summary>
+    public: std::size_t PartitionIndex;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Parses a device number in the 'major:minor' notation</summary>
+  /// <param name="text">Text containing the device number</param>
+  /// <param name="major">Receives the major number of the device</param>
+  /// <param name="minor">Receives the minor number of the device</param>
+  /// <returns>True if the device number was parsed, false if it was malformed</returns>
+  bool tryParseDeviceNumber(std::string_view text, std::size_t &major, std::size_t &minor) {
+    using Nuclex::Platform::Hardware::StringHelper;
+
+    StringHelper::TrimWhitespace(text);
+    if(!StringHelper::TryTakeNumber(text, major)) {
+      return false;
+    }
+    if(text.empty() || (text.front() != ':')) {
+      return false;
+    }
+    text.remove_prefix(1);
+
+    return StringHelper::TryTakeNumber(text, minor) && text.empty();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads a sysfs attribute and strips the trailing line break</summary>
+  /// <param name="path">Path of the sysfs attribute that will be read</param>
+  /// <param name="value">Receives the value of the attribute</param>
+  /// <returns>True if the attribute existed and could be read, false otherwise</returns>
+  bool tryReadAttribute(const std::string &path, std::string &value) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+    using Nuclex::Platform::Hardware::StringHelper;
+
+    if(!LinuxFileApi::TryReadFileInOneReadCall(path, value)) {
+      return false;
+    }
+
+    std::string_view trimmed(value);
+    StringHelper::TrimWhitespace(trimmed);
+    value.assign(trimmed);
+
+    return true;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads a sysfs attribute holding a single number</summary>
+  /// <param name="path">Path of the sysfs attribute that will be read</param>
+  /// <param name="value">Receives the number stored in the attribute</param>
+  /// <returns>True if the attribute existed and contained a number, false otherwise</returns>
+  bool tryReadNumberAttribute(const std::string &path, std::size_t &value) {
+    std::uint64_t number;
+    if(!Nuclex::Platform::Platform::LinuxFileApi::TryReadNumberFromFile(path, number)) {
+      return false;
+    }
+
+    value = static_cast<std::size_t>(number);
+    return true;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Returns the last path component of a path</summary>
+  /// <param name="path">Path whose last component will be returned</param>
+  /// <returns>The part of the path following the final slash</returns>
+  std::string_view getLastPathComponent(const std::string_view &path) {
+    std::string_view::size_type slashIndex = path.rfind('/');
+    if(slashIndex == std::string_view::npos) {
+      return path;
+    } else {
+      return path.substr(slashIndex + 1);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Checks whether a string starts with the specified prefix</summary>
+  /// <param name="text">String that will be checked</param>
+  /// <param name="prefix">Prefix the string needs to start with</param>
+  /// <returns>True if the string starts with the prefix, false otherwise</returns>
+  bool startsWith(const std::string_view &text, const std::string_view &prefix) {
+    return (text.length() >= prefix.length()) && (text.substr(0, prefix.length()) == prefix);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Decodes the octal escapes the kernel uses in mountinfo fields</summary>
+  /// <param name="field">Field that will be decoded</param>
+  /// <returns>The decoded field</returns>
+  std::string decodeOctalEscapes(const std::string_view &field) {
+    std::string decoded;
+    decoded.reserve(field.length());
+
+    std::string_view::size_type index = 0;
+    while(index < field.length()) {
+      bool isEscape = (
+        (field[index] == '\\') &&
+        (index + 3 < field.length()) &&
+        (field[index + 1] >= '0') && (field[index + 1] <= '3') &&
+        (field[index + 2] >= '0') && (field[index + 2] <= '7') &&
+        (field[index + 3] >= '0') && (field[index + 3] <= '7')
+      );
+      if(isEscape) {
+        decoded.push_back(
+          static_cast<char>(
+            ((field[index + 1] - '0') << 6) |
+            ((field[index + 2] - '0') << 3) |
+            (field[index + 3] - '0')
+          )
+        );
+        index += 4;
+      } else {
+        decoded.push_back(field[index]);
+        ++index;
+      }
+    }
+
+    return decoded;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Decodes the hexadecimal escapes udev uses in /dev/disk link names</summary>
+  /// <param name="name">Link name that will be decoded</param>
+  /// <returns>The decoded link name</returns>
+  std::string decodeHexEscapes(const std::string_view &name) {
+    std::string decoded;
+    decoded.reserve(name.length());
+
+    std::string_view::size_type index = 0;
+    while(index < name.length()) {
+      bool isEscape = (
+        (name[index] == '\\') &&
+        (index + 3 < name.length()) &&
+        (name[index + 1] == 'x') &&
+        std::isxdigit(static_cast<unsigned char>(name[index + 2])) &&
+        std::isxdigit(static_cast<unsigned char>(name[index + 3]))
+      );
+      if(isEscape) {
+        char digits[3] = { name[index + 2], name[index + 3], 0 };
+        decoded.push_back(static_cast<char>(std::strtoul(digits, nullptr, 16)));
+        index += 4;
+      } else {
+        decoded.push_back(name[index]);
+        ++index;
+      }
+    }
+
+    return decoded;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Extracts the name of the server a network share is mounted from</summary>
+  /// <param name="source">Mount source as listed in mountinfo</param>
+  /// <returns>The host name or address of the server</returns>
+  /// <remarks>
+  ///   NFS uses 'server:/export', CIFS uses '//server/share' and sshfs adds
+  ///   the user name as in 'user@server:/path'.
+  /// </remarks>
+  std::string_view getServerFromMountSource(std::string_view source) {
+    if(startsWith(source, std::string_view(u8"//", 2))) {
+      source.remove_prefix(2);
+      return source.substr(0, source.find('/'));
+    }
+
+    std::string_view::size_type atIndex = source.find('@');
+    if(atIndex != std::string_view::npos) {
+      source.remove_prefix(atIndex + 1);
+    }
+
+    // IPv6 addresses are enclosed in brackets because they contain colons themselves
+    if(!source.empty() && (source.front() == '[')) {
+      std::string_view::size_type closingIndex = source.find(']');
+      if(closingIndex != std::string_view::npos) {
+        return source.substr(1, closingIndex - 1);
+      }
+    }
+
+    return source.substr(0, source.find(':'));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Determines the capacity of a mounted file system</summary>
+  /// <param name="mountPath">Path at which the file system is mounted</param>
+  /// <returns>The capacity of the file system in megabytes or nothing if unknown</returns>
+  std::optional<std::size_t> tryGetFileSystemCapacity(const std::string &mountPath) {
+    struct ::statvfs fileSystemStatus;
+    int result = ::statvfs(mountPath.c_str(), &fileSystemStatus);
+    if(result != 0) {
+      return std::optional<std::size_t>();
+    }
+
+    std::uint64_t capacityInBytes = (
+      static_cast<std::uint64_t>(fileSystemStatus.f_blocks) *
+      static_cast<std::uint64_t>(fileSystemStatus.f_frsize)
+    );
+    return static_cast<std::size_t>(capacityInBytes / (1024 * 1024));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Determines how a block device is connected to the system</summary>
+  /// <param name="deviceName">Name of the block device, i.e. 'sda' or 'sr0'</param>
+  /// <param name="devicePath">Path of the block device's directory in /sys/block</param>
+  /// <param name="linkTarget">Target of the block device's link in /sys/block</param>
+  /// <returns>The type of store the block device is</returns>
+  Nuclex::Platform::Hardware::StoreType determineStoreType(
+    const std::string &deviceName, const std::string &devicePath, const std::string &linkTarget
+  ) {
+    using Nuclex::Platform::Hardware::StoreType;
+
+    if(startsWith(deviceName, std::string_view(u8"sr", 2))) {
+      return StoreType::LocalDiscDrive;
+    }
+    if(linkTarget.find(u8"/usb", 0, 4) != std::string::npos) {
+      return StoreType::LocalExternalDrive;
+    }
+
+    std::size_t isRemovable;
+    if(tryReadNumberAttribute(devicePath + u8"/removable", isRemovable) && (isRemovable != 0)) {
+      return StoreType::LocalExternalDrive;
+    }
+
+    return StoreType::LocalInternalDrive;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Determines the bus or protocol through which a block device is accessed</summary>
+  /// <param name="deviceName">Name of the block device, i.e. 'sda' or 'nvme0n1'</param>
+  /// <param name="linkTarget">Target of the block device's link in /sys/block</param>
+  /// <returns>The interface through which the block device is accessed</returns>
+  /// <remarks>
+  ///   Everything that speaks the SCSI command set is called 'sd&lt;x&gt;' on Linux,
+  ///   including SATA and USB drives, so for those the device path is checked for
+  ///   the controller the device hangs off.
+  /// </remarks>
+  Nuclex::Platform::Hardware::StoreInterface determineInterface(
+    const std::string &deviceName, const std::string &linkTarget
+  ) {
+    using Nuclex::Platform::Hardware::StoreInterface;
+
+    if(startsWith(deviceName, std::string_view(u8"nvme", 4))) {
+      return StoreInterface::Nvme;
+    }
+    if(startsWith(deviceName, std::string_view(u8"mmcblk", 6))) {
+      return StoreInterface::MemoryCard;
+    }
+
+    bool isVirtual = (
+      startsWith(deviceName, std::string_view(u8"vd", 2)) ||
+      startsWith(deviceName, std::string_view(u8"xvd", 3)) ||
+      startsWith(deviceName, std::string_view(u8"dm-", 3)) ||
+      startsWith(deviceName, std::string_view(u8"md", 2)) ||
+      startsWith(deviceName, std::string_view(u8"loop", 4)) ||
+      startsWith(deviceName, std::string_view(u8"zram", 4))
+    );
+    if(isVirtual) {
+      return StoreInterface::Virtual;
+    }
+
+    bool isScsiDevice = (
+      startsWith(deviceName, std::string_view(u8"sd", 2)) ||
+      startsWith(deviceName, std::string_view(u8"sr", 2))
+    );
+    if(isScsiDevice) {
+      if(linkTarget.find(u8"/usb", 0, 4) != std::string::npos) {
+        return StoreInterface::Usb;
+      } else if(linkTarget.find(u8"/ata", 0, 4) != std::string::npos) {
+        return StoreInterface::Sata;
+      } else if(linkTarget.find(u8"/virtio", 0, 7) != std::string::npos) {
+        return StoreInterface::Virtual;
+      } else {
+        return StoreInterface::Scsi;
+      }
+    }
+
+    return StoreInterface::Unknown;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Extracts the active I/O scheduler from the contents of a scheduler file</summary>
+  /// <param name="schedulers">Contents of the block device's queue/scheduler file</param>
+  /// <returns>The name of the active scheduler or an empty string if none is marked</returns>
+  /// <remarks>
+  ///   The kernel lists all available schedulers and puts the active one in brackets,
+  ///   i.e. 'mq-deadline kyber [bfq] none'.
+  /// </remarks>
+  std::string_view getActiveScheduler(const std::string_view &schedulers) {
+    std::string_view::size_type openingIndex = schedulers.find('[');
+    if(openingIndex == std::string_view::npos) {
+      return std::string_view();
+    }
+
+    std::string_view::size_type closingIndex = schedulers.find(']', openingIndex);
+    if(closingIndex == std::string_view::npos) {
+      return std::string_view();
+    }
+
+    return schedulers.substr(openingIndex + 1, closingIndex - openingIndex - 1);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads the request queue characteristics of a block device</summary>
+  /// <param name="devicePath">Path of the block device's directory in /sys/block</param>
+  /// <param name="store">Store that will receive the queue characteristics</param>
+  void readQueueCharacteristics(
+    const std::string &devicePath, Nuclex::Platform::Hardware::StoreInfo &store
+  ) {
+    std::string queuePath = devicePath + u8"/queue/";
+    std::string::size_type queuePathLength = queuePath.length();
+
+    std::size_t value;
+    if(tryReadNumberAttribute(queuePath.append(u8"nr_requests", 11), value)) {
+      store.QueueDepth = value;
+    }
+    queuePath.resize(queuePathLength);
+    if(tryReadNumberAttribute(queuePath.append(u8"logical_block_size", 18), value)) {
+      store.LogicalBlockSize = value;
+    }
+    queuePath.resize(queuePathLength);
+    if(tryReadNumberAttribute(queuePath.append(u8"physical_block_size", 19), value)) {
+      store.PhysicalBlockSize = value;
+    }
+
+    // Devices without a preference report an optimal I/O size of zero
+    queuePath.resize(queuePathLength);
+    if(tryReadNumberAttribute(queuePath.append(u8"optimal_io_size", 15), value)) {
+      if(value > 0) {
+        store.OptimalTransferSize = value;
+      }
+    }
+    queuePath.resize(queuePathLength);
+    if(tryReadNumberAttribute(queuePath.append(u8"max_sectors_kb", 14), value)) {
+      store.MaximumTransferSize = value * 1024;
+    }
+
+    std::string schedulers;
+    queuePath.resize(queuePathLength);
+    if(tryReadAttribute(queuePath.append(u8"scheduler", 9), schedulers)) {
+      store.IoScheduler.assign(getActiveScheduler(schedulers));
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads the block devices and their partitions from the /sys/block tree</summary>
+  /// <param name="canceller">Stop token by which the enumeration can be aborted</param>
+  /// <param name="sysPath">Path at which sysfs is mounted</param>
+  /// <param name="stores">Receives a store for each block device</param>
+  /// <param name="nodes">Receives the block devices and partitions that can be mounted</param>
+  void readBlockDevices(
+    const std::shared_ptr<const Nuclex::Support::Threading::StopToken> &canceller,
+    const std::string &sysPath,
+    std::vector<Nuclex::Platform::Hardware::StoreInfo> &stores,
+    std::vector<BlockDeviceNode> &nodes
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    std::string blockDirectory = LinuxFileApi::JoinPaths(sysPath, u8"block");
+    std::vector<std::string> deviceNames;
+    if(!LinuxFileApi::TryListDirectory(blockDirectory, deviceNames)) {
+      return;
+    }
+
+    std::string contents;
+    std::vector<std::string> entryNames;
+    for(const std::string &deviceName : deviceNames) {
+      if(canceller) {
+        canceller->ThrowIfCanceled();
+      }
+
+      std::string devicePath = LinuxFileApi::JoinPaths(blockDirectory, deviceName);
+
+      BlockDeviceNode deviceNode;
+      if(!tryReadAttribute(devicePath + u8"/dev", contents)) {
+        continue;
+      }
+      if(!tryParseDeviceNumber(contents, deviceNode.Major, deviceNode.Minor)) {
+        continue;
+      }
+
+      // The size is always given in 512 byte sectors, whatever the device's sector size
+      std::size_t sectorCount;
+      if(tryReadNumberAttribute(devicePath + u8"/size", sectorCount) && (sectorCount > 0)) {
+        deviceNode.CapacityInMegabytes = sectorCount / 2048;
+      }
+
+      // The entries in /sys/block are links into the device tree, so the link target
+      // tells us via which bus the device is attached (i.e. '../devices/.../usb2/...')
+      std::string linkTarget;
+      if(!LinuxFileApi::TryReadLink(devicePath, linkTarget)) {
+        linkTarget.clear();
+      }
+
+      Nuclex::Platform::Hardware::StoreInfo store;
+      store.Identifier = deviceName;
+      store.CapacityInMegabytes = deviceNode.CapacityInMegabytes;
+      store.Type = determineStoreType(deviceName, devicePath, linkTarget);
+      store.Interface = determineInterface(deviceName, linkTarget);
+      readQueueCharacteristics(devicePath, store);
+
+      std::size_t isRotational;
+      if(tryReadNumberAttribute(devicePath + u8"/queue/rotational", isRotational)) {
+        store.IsSolidState = (isRotational == 0);
+      }
+      if(tryReadAttribute(devicePath + u8"/device/vendor", contents)) {
+        store.ManufacturerName = contents;
+      }
+      if(tryReadAttribute(devicePath + u8"/device/model", contents)) {
+        store.ModelName = contents;
+      }
+
+      deviceNode.Name = deviceName;
+      deviceNode.StoreIndex = stores.size();
+      deviceNode.PartitionIndex = std::size_t(-1);
+      nodes.push_back(deviceNode);
+
+      // Partitions are subdirectories of the block device that have a 'partition' file
+      // holding the partition number. The other subdirectories are things like 'queue'.
+      entryNames.clear();
+      if(LinuxFileApi::TryListDirectory(devicePath, entryNames)) {
+        for(const std::string &entryName : entryNames) {
+          std::string partitionPath = LinuxFileApi::JoinPaths(devicePath, entryName);
+
+          std::size_t partitionNumber;
+          if(!tryReadNumberAttribute(partitionPath + u8"/partition", partitionNumber)) {
+            continue;
+          }
+
+          BlockDeviceNode partitionNode;
+          if(!tryReadAttribute(partitionPath + u8"/dev", contents)) {
+            continue;
+          }
+          if(!tryParseDeviceNumber(contents, partitionNode.Major, partitionNode.Minor)) {
+            continue;
+          }
+          if(tryReadNumberAttribute(partitionPath + u8"/size", sectorCount)) {
+            partitionNode.CapacityInMegabytes = sectorCount / 2048;
+          }
+
+          partitionNode.Name = entryName;
+          partitionNode.StoreIndex = stores.size();
+          partitionNode.PartitionIndex = std::size_t(-1);
+          nodes.push_back(std::move(partitionNode));
+        }
+      }
+
+      stores.push_back(std::move(store));
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Looks up the block device or partition a file system was mounted from</summary>
+  /// <param name="nodes">Block devices and partitions that have been found</param>
+  /// <param name="mount">Mount whose block device will be looked up</param>
+  /// <param name="devPath">Path of the device directory</param>
+  /// <returns>The block device or partition or a null pointer if none matched</returns>
+  BlockDeviceNode *findMountedNode(
+    std::vector<BlockDeviceNode> &nodes,
+    const Nuclex::Platform::Hardware::LinuxStoreInfoReader::MountEntry &mount,
+    const std::string &devPath
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    for(BlockDeviceNode &node : nodes) {
+      if((node.Major == mount.DeviceMajor) && (node.Minor == mount.DeviceMinor)) {
+        return &node;
+      }
+    }
+
+    // Btrfs and a few others report anonymous device numbers, so fall back to matching
+    // the device node the file system was mounted from. Device mapper volumes are
+    // mounted via links in /dev/mapper, so follow the link if it is one.
+    static const std::string_view devPrefix(u8"/dev/", 5);
+    if(!startsWith(mount.Source, devPrefix)) {
+      return nullptr;
+    }
+
+    std::string sourcePath = LinuxFileApi::JoinPaths(devPath, mount.Source.substr(5));
+    std::string target;
+    std::string_view deviceName;
+    if(LinuxFileApi::TryReadLink(sourcePath, target)) {
+      deviceName = getLastPathComponent(target);
+    } else {
+      deviceName = getLastPathComponent(mount.Source);
+    }
+
+    for(BlockDeviceNode &node : nodes) {
+      if(node.Name == deviceName) {
+        return &node;
+      }
+    }
+
+    return nullptr;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Assigns attributes from the links udev places in /dev/disk</summary>
+  /// <param name="linkDirectory">Directory holding the links, i.e. /dev/disk/by-label</param>
+  /// <param name="nodes">Block devices and partitions that have been found</param>
+  /// <param name="stores">Stores whose mounted partitions will be updated</param>
+  /// <param name="assignLabel">True to assign labels, false to assign serials</param>
+  void assignDiskLinkNames(
+    const std::string &linkDirectory,
+    const std::vector<BlockDeviceNode> &nodes,
+    std::vector<Nuclex::Platform::Hardware::StoreInfo> &stores,
+    bool assignLabel
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    std::vector<std::string> linkNames;
+    if(!LinuxFileApi::TryListDirectory(linkDirectory, linkNames)) {
+      return;
+    }
+
+    std::string target;
+    for(const std::string &linkName : linkNames) {
+      std::string linkPath = LinuxFileApi::JoinPaths(linkDirectory, linkName);
+      if(!LinuxFileApi::TryReadLink(linkPath, target)) {
+        continue;
+      }
+
+      std::string_view deviceName = getLastPathComponent(target);
+      for(const BlockDeviceNode &node : nodes) {
+        if((node.PartitionIndex != std::size_t(-1)) && (node.Name == deviceName)) {
+          Nuclex::Platform::Hardware::PartitionInfo &partition = (
+            stores[node.StoreIndex].Partitions[node.PartitionIndex]
+          );
+          if(assignLabel) {
+            partition.Label = decodeHexEscapes(linkName);
+          } else {
+            partition.Serial = linkName;
+          }
+        }
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Adds a network share to the store of the server providing it</summary>
+  /// <param name="stores">Stores to which the network share will be added</param>
+  /// <param name="mount">Mount of the network share</param>
+  void addNetworkShare(
+    std::vector<Nuclex::Platform::Hardware::StoreInfo> &stores,
+    const Nuclex::Platform::Hardware::LinuxStoreInfoReader::MountEntry &mount
+  ) {
+    using Nuclex::Platform::Hardware::StoreInfo;
+    using Nuclex::Platform::Hardware::StoreType;
+    using Nuclex::Platform::Hardware::StoreInterface;
+    using Nuclex::Platform::Hardware::PartitionInfo;
+
+    std::string_view server = getServerFromMountSource(mount.Source);
+
+    StoreInfo *store = nullptr;
+    for(StoreInfo &existingStore : stores) {
+      if((existingStore.Type == StoreType::NetworkServer) && (existingStore.Identifier == server)) {
+        store = &existingStore;
+        break;
+      }
+    }
+    if(store == nullptr) {
+      store = &stores.emplace_back();
+      store->Identifier.assign(server);
+      store->Type = StoreType::NetworkServer;
+      store->Interface = StoreInterface::Network;
+    }
+
+    // Each share mounted from the server is treated as a partition labeled with the share's
+    // address. The same share can be mounted multiple times, then its mount paths are merged.
+    for(PartitionInfo &partition : store->Partitions) {
+      if(partition.Label == mount.Source) {
+        partition.MountPaths.push_back(mount.MountPath);
+        return;
+      }
+    }
+
+    PartitionInfo &partition = store->Partitions.emplace_back();
+    partition.Label = mount.Source;
+    partition.FileSystem = mount.FileSystem;
+    partition.MountPaths.push_back(mount.MountPath);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Checks whether a block device is a virtual one backed by a file or memory</summary>
+  /// <param name="deviceName">Name of the block device that will be checked</param>
+  /// <returns>True if the block device is a loop device or RAM disk</returns>
+  bool isVirtualBlockDevice(const std::string &deviceName) {
+    return (
+      startsWith(deviceName, std::string_view(u8"loop", 4)) ||
+      startsWith(deviceName, std::string_view(u8"ram", 3)) ||
+      startsWith(deviceName, std::string_view(u8"zram", 4))
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<LinuxStoreInfoReader::MountEntry> LinuxStoreInfoReader::ParseMountInfo(
+    const std::string_view &contents
+  ) {
+    std::vector<MountEntry> mounts;
+
+    std::string_view remaining(contents);
+    std::vector<std::string_view> fields;
+    while(!remaining.empty()) {
+      std::string_view line;
+      {
+        std::string_view::size_type lineEndIndex = remaining.find('\n');
+        if(lineEndIndex == std::string_view::npos) {
+          line = remaining;
+          remaining = std::string_view();
+        } else {
+          line = remaining.substr(0, lineEndIndex);
+          remaining.remove_prefix(lineEndIndex + 1);
+        }
+      }
+
+      // Fields are separated by single spaces, spaces within fields are escaped
+      fields.clear();
+      while(!line.empty()) {
+        std::string_view::size_type spaceIndex = line.find(' ');
+        if(spaceIndex == std::string_view::npos) {
+          fields.push_back(line);
+          break;
+        }
+        if(spaceIndex > 0) {
+          fields.push_back(line.substr(0, spaceIndex));
+        }
+        line.remove_prefix(spaceIndex + 1);
+      }
+
+      // The format is 'id parent major:minor root mountpoint options [tags...] - type source'
+      // with any number of optional tags, terminated by a lone dash.
+      std::size_t separatorIndex = 6;
+      while((separatorIndex < fields.size()) && (fields[separatorIndex] != u8"-")) {
+        ++separatorIndex;
+      }
+      if(separatorIndex + 2 >= fields.size()) {
+        continue;
+      }
+
+      MountEntry mount;
+      if(!tryParseDeviceNumber(fields[2], mount.DeviceMajor, mount.DeviceMinor)) {
+        continue;
+      }
+      mount.MountPath = decodeOctalEscapes(fields[4]);
+      mount.FileSystem = decodeOctalEscapes(fields[separatorIndex + 1]);
+      mount.Source = decodeOctalEscapes(fields[separatorIndex + 2]);
+
+      mounts.push_back(std::move(mount));
+    }
+
+    return mounts;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool LinuxStoreInfoReader::IsNetworkFileSystem(const std::string_view &fileSystem) {
+    static const std::string_view networkFileSystems[] = {
+      u8"nfs", u8"nfs4", u8"cifs", u8"smb3", u8"smbfs", u8"ncpfs", u8"afs", u8"9p",
+      u8"ceph", u8"glusterfs", u8"lustre", u8"fuse.sshfs", u8"fuse.glusterfs"
+    };
+    for(const std::string_view &networkFileSystem : networkFileSystems) {
+      if(fileSystem == networkFileSystem) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<StoreInfo> LinuxStoreInfoReader::TryReadStores(
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller,
+    const std::string &procPath /* = u8"/proc" */,
+    const std::string &sysPath /* = u8"/sys" */,
+    const std::string &devPath /* = u8"/dev" */
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    std::vector<StoreInfo> stores;
+    std::vector<BlockDeviceNode> nodes;
+    readBlockDevices(canceller, sysPath, stores, nodes);
+
+    std::vector<MountEntry> mounts;
+    {
+      std::vector<std::uint8_t> contents;
+      try {
+        contents = LinuxFileApi::ReadFileIntoMemory(
+          LinuxFileApi::JoinPaths(procPath, u8"self/mountinfo")
+        );
+      }
+      catch(const std::exception &) {
+        // Without procfs we can still report the block devices, just not their mounts
+      }
+      mounts = ParseMountInfo(
+        std::string_view(reinterpret_cast<const char *>(contents.data()), contents.size())
+      );
+    }
+
+    if(canceller) {
+      canceller->ThrowIfCanceled();
+    }
+
+    bool anyPartitionMounted = false;
+    for(const MountEntry &mount : mounts) {
+      if(IsNetworkFileSystem(mount.FileSystem)) {
+        addNetworkShare(stores, mount);
+        continue;
+      }
+
+      BlockDeviceNode *node = findMountedNode(nodes, mount, devPath);
+      if(node == nullptr) {
+        continue; // Pseudo file systems such as proc, tmpfs or overlay
+      }
+
+      StoreInfo &store = stores[node->StoreIndex];
+      if(node->PartitionIndex == std::size_t(-1)) {
+        node->PartitionIndex = store.Partitions.size();
+
+        PartitionInfo &partition = store.Partitions.emplace_back();
+        partition.FileSystem = mount.FileSystem;
+        partition.CapacityInMegabytes = tryGetFileSystemCapacity(mount.MountPath);
+        if(!partition.CapacityInMegabytes.has_value()) {
+          partition.CapacityInMegabytes = node->CapacityInMegabytes;
+        }
+
+        anyPartitionMounted = true;
+      }
+
+      store.Partitions[node->PartitionIndex].MountPaths.push_back(mount.MountPath);
+    }
+
+    if(anyPartitionMounted) {
+      std::string diskDirectory = LinuxFileApi::JoinPaths(devPath, u8"disk");
+      assignDiskLinkNames(
+        LinuxFileApi::JoinPaths(diskDirectory, u8"by-label"), nodes, stores, true
+      );
+      assignDiskLinkNames(
+        LinuxFileApi::JoinPaths(diskDirectory, u8"by-uuid"), nodes, stores, false
+      );
+    }
+
+    // Loop devices and RAM disks are only interesting if something lives on them
+    std::vector<StoreInfo>::iterator end = stores.begin();
+    for(std::vector<StoreInfo>::iterator it = stores.begin(); it != stores.end(); ++it) {
+      bool isUnusedVirtualDevice = (
+        (it->Type != StoreType::NetworkServer) &&
+        it->Partitions.empty() &&
+        isVirtualBlockDevice(it->Identifier)
+      );
+      if(!isUnusedVirtualDevice) {
+        if(end != it) {
+          *end = std::move(*it);
+        }
+        ++end;
+      }
+    }
+    stores.erase(end, stores.end());
+
+    return stores;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
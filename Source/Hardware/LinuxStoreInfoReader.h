@@ -0,0 +1,130 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_LINUXSTOREINFOREADER_H
+#define NUCLEX_PLATFORM_HARDWARE_LINUXSTOREINFOREADER_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "Nuclex/Platform/Hardware/StoreInfo.h" // for StoreInfo
+
+#include <cstddef> // for std::size_t
+#include <memory> // for std::shared_ptr
+#include <string> // for std::string
+#include <string_view> // for std::string_view
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Support { namespace Threading {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  class StopToken;
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Support::Threading
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Enumerates block devices and network shares and where they are mounted</summary>
+  /// <remarks>
+  ///   <para>
+  ///     Block devices are listed by the kernel in /sys/block, each with its partitions
+  ///     as subdirectories. The size, whether the device is rotational or removable,
+  ///     the limits of its request queue and the model name can all be read from there.
+  ///   </para>
+  ///   <para>
+  ///     To figure out which partitions are mounted where, /proc/self/mountinfo is
+  ///     parsed. It lists the device number of each mount, which matches the 'dev'
+  ///     file of a block device or partition in sysfs. File systems such as btrfs
+  ///     report an anonymous device number, so mounts are also matched by the name
+  ///     of the device node they were mounted from.
+  ///   </para>
+  ///   <para>
+  ///     Network file systems (NFS, CIFS and friends) have no block device. Their
+  ///     shares are grouped into one store per server.
+  ///   </para>
+  /// </remarks>
+  class LinuxStoreInfoReader {
+
+    #pragma region struct MountEntry
+
+    /// <summary>A single mount as listed in /proc/self/mountinfo</summary>
+    public: struct MountEntry {
+
+      /// <summary>Major number of the device the file system lives on</summary>
+      public: std::size_t DeviceMajor;
+      /// <summary>Minor number of the device the file system lives on</summary>
+      public: std::size_t DeviceMinor;
+      /// <summary>Directory at which the file system has been mounted</summary>
+      public: std::string MountPath;
+      /// <summary>Type of the file system, i.e. 'ext4', 'btrfs' or 'nfs4'</summary>
+      public: std::string FileSystem;
+      /// <summary>Where the file system was mounted from, i.e. '/dev/sda1'</summary>
+      public: std::string Source;
+
+    };
+
+    #pragma endregion // struct MountEntry
+
+    /// <summary>Parses the contents of a mountinfo file</summary>
+    /// <param name="contents">Contents of the /proc/self/mountinfo file</param>
+    /// <returns>All mounts listed in the file, in the order they appeared</returns>
+    /// <remarks>
+    ///   Lines that do not follow the documented format are skipped. Characters the
+    ///   kernel escaped as octal sequences (i.e. '\040' for spaces) are decoded.
+    /// </remarks>
+    public: static std::vector<MountEntry> ParseMountInfo(const std::string_view &contents);
+
+    /// <summary>Checks whether a file system type is a network file system</summary>
+    /// <param name="fileSystem">File system type as listed in mountinfo</param>
+    /// <returns>True if the file system accesses its data over the network</returns>
+    public: static bool IsNetworkFileSystem(const std::string_view &fileSystem);
+
+    /// <summary>Enumerates all stores and their mounted partitions</summary>
+    /// <param name="canceller">Stop token by which the enumeration can be aborted</param>
+    /// <param name="procPath">Path at which procfs is mounted, can be changed for tests</param>
+    /// <param name="sysPath">Path at which sysfs is mounted, can be changed for tests</param>
+    /// <param name="devPath">Path of the device directory, can be changed for tests</param>
+    /// <returns>All stores with a known capacity or at least one mounted partition</returns>
+    /// <remarks>
+    ///   Loop and RAM disk devices are only reported when something is mounted from them.
+    ///   The capacity of mounted partitions is determined via statvfs(), except for
+    ///   network shares where an unreachable server could block the call for minutes.
+    /// </remarks>
+    public: static std::vector<StoreInfo> TryReadStores(
+      const std::shared_ptr<const Support::Threading::StopToken> &canceller,
+      const std::string &procPath = u8"/proc",
+      const std::string &sysPath = u8"/sys",
+      const std::string &devPath = u8"/dev"
+    );
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+#endif // NUCLEX_PLATFORM_HARDWARE_LINUXSTOREINFOREADER_H
@@ -0,0 +1,110 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./LinuxSysClockSourceReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include <Nuclex/Support/Text/ParserHelper.h> // for ParserHelper
+
+#include "../Platform/LinuxFileApi.h" // for LinuxFileApi
+
+#include <string_view> // for std::string_view
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Splits a whitespace-separated list of names into its individual names</summary>
+  /// <param name="text">Text containing the names separated by whitespace</param>
+  /// <param name="names">List to which the names will be appended</param>
+  void splitNames(const std::string_view &text, std::vector<std::string> &names) {
+    using Nuclex::Support::Text::ParserHelper;
+
+    std::string_view::size_type start = 0;
+    std::string_view::size_type length = text.length();
+    while(start < length) {
+      while((start < length) && ParserHelper::IsWhitespace(text[start])) {
+        ++start;
+      }
+
+      std::string_view::size_type end = start;
+      while((end < length) && !ParserHelper::IsWhitespace(text[end])) {
+        ++end;
+      }
+
+      if(end > start) {
+        names.emplace_back(text.substr(start, end - start));
+      }
+      start = end;
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool LinuxSysClockSourceReader::TryReadClockSources(
+    ClockInfo &clockInfo,
+    const std::string &systemDevicesPath /* = u8"/sys/devices/system" */
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    std::string clockSourceDirectory = systemDevicesPath + u8"/clocksource/clocksource0/";
+
+    std::string contents;
+    if(
+      LinuxFileApi::TryReadFileInOneReadCall(
+        clockSourceDirectory + u8"available_clocksource", contents
+      )
+    ) {
+      clockInfo.AvailableClockSources.clear();
+      splitNames(contents, clockInfo.AvailableClockSources);
+    }
+
+    if(
+      !LinuxFileApi::TryReadFileInOneReadCall(
+        clockSourceDirectory + u8"current_clocksource", contents
+      )
+    ) {
+      return false;
+    }
+
+    std::vector<std::string> currentNames;
+    splitNames(contents, currentNames);
+    if(currentNames.empty()) {
+      return false;
+    }
+
+    clockInfo.ClockSource.swap(currentNames.front());
+    return true;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,65 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_LINUXSYSCLOCKSOURCEREADER_H
+#define NUCLEX_PLATFORM_HARDWARE_LINUXSYSCLOCKSOURCEREADER_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "Nuclex/Platform/Hardware/ClockInfo.h" // for ClockInfo
+
+#include <string> // for std::string
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Queries the kernel's clock sources via the /sys/devices/system tree</summary>
+  /// <remarks>
+  ///   The Linux kernel lists its clock sources in /sys/devices/system/clocksource,
+  ///   where the 'clocksource0' directory contains a 'current_clocksource' file with
+  ///   the name of the clock source in use and an 'available_clocksource' file listing
+  ///   all clock sources it could switch to, separated by spaces.
+  /// </remarks>
+  class LinuxSysClockSourceReader {
+
+    /// <summary>Attempts to read the current and available clock sources</summary>
+    /// <param name="clockInfo">
+    ///   Clock informations whose clock source and available clock sources will be filled
+    /// </param>
+    /// <param name="systemDevicesPath">
+    ///   Path to the system devices directory, can be changed for unit tests
+    /// </param>
+    /// <returns>True if the current clock source could be read, false otherwise</returns>
+    public: static bool TryReadClockSources(
+      ClockInfo &clockInfo,
+      const std::string &systemDevicesPath = u8"/sys/devices/system"
+    );
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+#endif // NUCLEX_PLATFORM_HARDWARE_LINUXSYSCLOCKSOURCEREADER_H
@@ -17,12 +17,752 @@ limitations under the License.
 */
 #pragma endregion // Apache License 2.0
 
-/*
-https://github.com/util-linux/util-linux/blob/master/sys-utils/lscpu.h
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./LinuxSysCpuTreeReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "./StringHelper.h" // for StringHelper
+#include "./LinuxSysNodeTreeReader.h" // for LinuxSysNodeTreeReader::ParseCpuList()
+#include "../Platform/LinuxFileApi.h" // for LinuxFileApi
+
+#include <algorithm> // for std::sort(), std::binary_search(), std::min(), std::max()
+#include <cstdio> // for std::snprintf()
+#include <future> // for std::async(), std::future
+#include <optional> // for std::optional
+#include <string> // for std::string, std::to_string()
+
+// The layout of the sysfs tree is documented in the kernel sources under
+// Documentation/ABI/stable/sysfs-devices-system-cpu and the 'lscpu' tool from
+// util-linux is a good reference for what can be found there in practice.
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Number of processors below which scanning in parallel doesn't pay off</summary>
+  const std::size_t MinimumProcessorsPerThread = 64;
+
+  /// <summary>Highest number of caches per processor the scanner will look for</summary>
+  const std::size_t MaximumCacheCount = 16;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Attempts to read a processor list from a sysfs file</summary>
+  /// <param name="path">Path of the file that will be read</param>
+  /// <param name="processorIndices">Receives the processors listed in the file</param>
+  /// <returns>True if the file existed and listed at least one processor</returns>
+  bool tryReadCpuListFromFile(
+    const std::string &path, std::vector<std::size_t> &processorIndices
+  ) {
+    using Nuclex::Platform::Hardware::LinuxSysNodeTreeReader;
+
+    std::string contents;
+    if(!Nuclex::Platform::Platform::LinuxFileApi::TryReadFileInOneReadCall(path, contents)) {
+      return false;
+    }
+
+    processorIndices = LinuxSysNodeTreeReader::ParseCpuList(contents);
+    return !processorIndices.empty();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Names of the files read from the directory of each processor</summary>
+  /// <remarks>
+  ///   The 'core_cpus_list' file was called 'thread_siblings_list' before Linux 5.7 and
+  ///   the 'base_frequency' file is only provided by some cpufreq drivers (intel_pstate).
+  /// </remarks>
+  const char *const ProcessorFileNames[] = {
+    u8"topology/physical_package_id",
+    u8"topology/core_cpus_list",
+    u8"topology/thread_siblings_list",
+    u8"cpufreq/base_frequency",
+    u8"cpufreq/cpuinfo_min_freq",
+    u8"cpufreq/cpuinfo_max_freq"
+  };
+
+  /// <summary>Index of the 'physical_package_id' file in the processor file list</summary>
+  const std::size_t PackageIdFile = 0;
+  /// <summary>Index of the 'core_cpus_list' file in the processor file list</summary>
+  const std::size_t CoreCpusListFile = 1;
+  /// <summary>Index of the 'thread_siblings_list' file in the processor file list</summary>
+  const std::size_t ThreadSiblingsListFile = 2;
+  /// <summary>Index of the 'base_frequency' file in the processor file list</summary>
+  const std::size_t BaseFrequencyFile = 3;
+  /// <summary>Index of the 'cpuinfo_min_freq' file in the processor file list</summary>
+  const std::size_t MinimumFrequencyFile = 4;
+  /// <summary>Index of the 'cpuinfo_max_freq' file in the processor file list</summary>
+  const std::size_t MaximumFrequencyFile = 5;
+
+  /// <summary>Number of files read from the directory of each processor</summary>
+  const std::size_t ProcessorFileCount = (
+    sizeof(ProcessorFileNames) / sizeof(ProcessorFileNames[0])
+  );
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Names of the files read from the directory of each cache</summary>
+  const char *const CacheFileNames[] = {
+    u8"level",
+    u8"type",
+    u8"size",
+    u8"coherency_line_size",
+    u8"ways_of_associativity",
+    u8"shared_cpu_list"
+  };
+
+  /// <summary>Index of the 'level' file in the cache file list</summary>
+  const std::size_t LevelFile = 0;
+  /// <summary>Index of the 'type' file in the cache file list</summary>
+  const std::size_t TypeFile = 1;
+  /// <summary>Index of the 'size' file in the cache file list</summary>
+  const std::size_t SizeFile = 2;
+  /// <summary>Index of the 'coherency_line_size' file in the cache file list</summary>
+  const std::size_t LineSizeFile = 3;
+  /// <summary>Index of the 'ways_of_associativity' file in the cache file list</summary>
+  const std::size_t AssociativityFile = 4;
+  /// <summary>Index of the 'shared_cpu_list' file in the cache file list</summary>
+  const std::size_t SharedCpuListFile = 5;
+
+  /// <summary>Number of files read from the directory of each cache</summary>
+  const std::size_t CacheFileCount = sizeof(CacheFileNames) / sizeof(CacheFileNames[0]);
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Number of processors whose files are read in one batch</summary>
+  /// <remarks>
+  ///   With four caches per processor, this amounts to 480 files per batch. Larger
+  ///   batches save hardly any system calls but need more memory for the contents.
+  /// </remarks>
+  const std::size_t ProcessorsPerBatch = 16;
+
+  /// <summary>Number of bytes that will be read at most from each file</summary>
+  /// <remarks>
+  ///   All files read here hold a single number or a short processor list
+  /// </remarks>
+  const std::size_t MaximumFileSize = 1024;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Counts the caches listed in the directory of a processor</summary>
+  /// <param name="cpuDirectory">Path of the /sys/devices/system/cpu directory</param>
+  /// <param name="processorIndex">Index of the processor whose caches will be counted</param>
+  /// <returns>The number of caches, which are numbered from 'index0' onwards</returns>
+  std::size_t countCaches(const std::string &cpuDirectory, std::size_t processorIndex) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+    using Nuclex::Platform::Hardware::StringHelper;
+
+    std::vector<std::string> entryNames;
+    bool wasListed = LinuxFileApi::TryListDirectory(
+      LinuxFileApi::JoinPaths(
+        cpuDirectory, u8"cpu" + std::to_string(processorIndex) + u8"/cache"
+      ),
+      entryNames
+    );
+    if(!wasListed) {
+      return 0;
+    }
+
+    std::size_t cacheCount = 0;
+    for(const std::string &entryName : entryNames) {
+      if(entryName.compare(0, 5, u8"index", 5) != 0) {
+        continue;
+      }
+
+      std::size_t cacheIndex;
+      std::string_view indexText(entryName);
+      indexText.remove_prefix(5);
+      if(StringHelper::TryTakeNumber(indexText, cacheIndex) && indexText.empty()) {
+        cacheCount = std::max(cacheCount, cacheIndex + 1);
+      }
+    }
+
+    return std::min(cacheCount, MaximumCacheCount);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads the sysfs files of logical processors</summary>
+  /// <remarks>
+  ///   <para>
+  ///     Each processor has a few dozen files of interest and big machines have hundreds
+  ///     of processors. To keep the cost per file down, all files are opened relative to
+  ///     the already open /sys/devices/system/cpu directory (so the kernel doesn't have
+  ///     to walk the full path each time) and read into the same buffer (so there is no
+  ///     memory allocation per file).
+  ///   </para>
+  ///   <para>
+  ///     Optionally, the files of several processors can be read in batches through
+  ///     a <see cref="BatchedFileReader" />, which uses io_uring where available. On
+  ///     the machines measured so far, sysfs reads were punted to io_uring's worker
+  ///     threads and this was 1.4 to 2 times slower, so it is not the default.
+  ///   </para>
+  ///   <para>
+  ///     Instances are not thread-safe, but any number of instances can share the same
+  ///     directory descriptor to scan different processors in parallel.
+  ///   </para>
+  /// </remarks>
+  class ProcessorDirectoryScanner {
+
+    /// <summary>Initializes a new processor directory scanner</summary>
+    /// <param name="cpuDirectoryDescriptor">
+    ///   Descriptor of the opened /sys/devices/system/cpu directory
+    /// </param>
+    /// <param name="cacheCount">Number of caches that will be looked for per processor</param>
+    /// <param name="useBatchedReads">
+    ///   Whether the files will be read in batches rather than one by one
+    /// </param>
+    public: ProcessorDirectoryScanner(
+      int cpuDirectoryDescriptor, std::size_t cacheCount, bool useBatchedReads
+    ) :
+      cpuDirectoryDescriptor(cpuDirectoryDescriptor),
+      filesPerProcessor(ProcessorFileCount + cacheCount * CacheFileCount),
+      cacheCount(cacheCount),
+      useBatchedReads(useBatchedReads),
+      processors(nullptr),
+      batchReader(),
+      files(),
+      contents() {}
+
+    /// <summary>Reads the topology, frequencies and caches of a range of processors</summary>
+    /// <param name="processors">Processors whose index is set and who will be filled</param>
+    /// <param name="count">Number of processors that will be read</param>
+    public: void ReadProcessors(
+      Nuclex::Platform::Hardware::LinuxSysCpuTreeReader::ProcessorInfo *processors,
+      std::size_t count
+    );
+
+    /// <summary>Reads the files of one batch of processors</summary>
+    /// <param name="count">Number of processors in the batch</param>
+    private: void readBatch(std::size_t count);
+
+    /// <summary>Fills a processor's fields from its files</summary>
+    /// <param name="slot">Position of the processor within the current range</param>
+    /// <param name="processor">Processor whose remaining fields will be filled</param>
+    private: void readProcessor(
+      std::size_t slot,
+      Nuclex::Platform::Hardware::LinuxSysCpuTreeReader::ProcessorInfo &processor
+    );
+
+    /// <summary>Attempts to read a file from the directory of a processor</summary>
+    /// <param name="slot">Position of the processor within the current range</param>
+    /// <param name="file">Index of the file in the processor file list</param>
+    /// <returns>True if the file was read, false otherwise</returns>
+    /// <remarks>
+    ///   If successful, the <see cref="contents" /> field provides the file's contents
+    /// </remarks>
+    private: bool tryGetProcessorFile(std::size_t slot, std::size_t file);
+
+    /// <summary>Attempts to read a file from the directory of a processor's cache</summary>
+    /// <param name="slot">Position of the processor within the current range</param>
+    /// <param name="cacheIndex">Index of the cache whose file will be read</param>
+    /// <param name="file">Index of the file in the cache file list</param>
+    /// <returns>True if the file was read, false otherwise</returns>
+    private: bool tryGetCacheFile(std::size_t slot, std::size_t cacheIndex, std::size_t file);
+
+    /// <summary>Sets the contents to those of a file in the current batch</summary>
+    /// <param name="fileIndex">Index of the file within the current batch</param>
+    /// <returns>True if the file was read, false otherwise</returns>
+    private: bool trySelectFile(std::size_t fileIndex);
+
+    /// <summary>Attempts to read a file relative to the /sys/devices/system/cpu directory</summary>
+    /// <returns>True if the file was read, false otherwise</returns>
+    /// <remarks>
+    ///   The relative path has to be placed in the <see cref="path" /> buffer beforehand
+    /// </remarks>
+    private: bool tryReadFile();
+
+    /// <summary>Attempts to parse the contents of the current file as a number</summary>
+    /// <param name="value">Receives the number stored in the file</param>
+    /// <returns>True if the file contained a number, false otherwise</returns>
+    private: bool tryParseContentsAsNumber(std::size_t &value) const;
+
+    /// <summary>Attempts to read a frequency in kilohertz from a cpufreq file</summary>
+    /// <param name="slot">Position of the processor within the current range</param>
+    /// <param name="file">Index of the file in the processor file list</param>
+    /// <returns>The frequency in megahertz or nothing if the file could not be read</returns>
+    private: std::optional<double> tryGetFrequency(std::size_t slot, std::size_t file);
+
+    /// <summary>Attempts to read the description of a cache</summary>
+    /// <param name="slot">Position of the processor within the current range</param>
+    /// <param name="cacheIndex">Index of the cache ('cache/index&lt;n&gt;')</param>
+    /// <param name="cache">Receives the description of the cache</param>
+    /// <returns>True if the cache was described completely, false otherwise</returns>
+    private: bool tryGetCache(
+      std::size_t slot,
+      std::size_t cacheIndex,
+      Nuclex::Platform::Hardware::CacheInfo &cache
+    );
+
+    /// <summary>Descriptor of the opened /sys/devices/system/cpu directory</summary>
+    private: int cpuDirectoryDescriptor;
+    /// <summary>Number of files that are read for each processor</summary>
+    private: std::size_t filesPerProcessor;
+    /// <summary>Number of caches that are looked for per processor</summary>
+    private: std::size_t cacheCount;
+    /// <summary>Whether the files are read in batches rather than one by one</summary>
+    private: bool useBatchedReads;
+    /// <summary>Processors in the range (or batch) currently being read</summary>
+    private: const Nuclex::Platform::Hardware::LinuxSysCpuTreeReader::ProcessorInfo *processors;
+    /// <summary>Reads the batches, keeping its io_uring from one batch to the next</summary>
+    private: Nuclex::Platform::Platform::BatchedFileReader batchReader;
+    /// <summary>Contents of the files in the current batch</summary>
+    private: std::vector<std::optional<std::string>> files;
+    /// <summary>Contents of the file that was read last</summary>
+    private: std::string_view contents;
+    /// <summary>Relative path of the file that will be read next</summary>
+    private: char path[128];
+    /// <summary>Receives the contents of each file read one by one</summary>
+    private: char buffer[MaximumFileSize];
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void ProcessorDirectoryScanner::ReadProcessors(
+    Nuclex::Platform::Hardware::LinuxSysCpuTreeReader::ProcessorInfo *processors,
+    std::size_t count
+  ) {
+    if(!this->useBatchedReads) {
+      this->processors = processors;
+      for(std::size_t slot = 0; slot < count; ++slot) {
+        readProcessor(slot, processors[slot]);
+      }
+      return;
+    }
+
+    for(std::size_t start = 0; start < count; start += ProcessorsPerBatch) {
+      std::size_t batchCount = std::min(ProcessorsPerBatch, count - start);
+      this->processors = processors + start;
+      readBatch(batchCount);
+      for(std::size_t slot = 0; slot < batchCount; ++slot) {
+        readProcessor(slot, processors[start + slot]);
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void ProcessorDirectoryScanner::readBatch(std::size_t count) {
+
+    // The paths are listed in the order the lookup methods expect them:
+    // first the processor files, then each cache's files, for each processor.
+    std::vector<std::string> paths;
+    paths.reserve(count * this->filesPerProcessor);
+    for(std::size_t slot = 0; slot < count; ++slot) {
+      std::string processorDirectory(u8"cpu", 3);
+      processorDirectory.append(std::to_string(this->processors[slot].Index));
+      processorDirectory.push_back('/');
+
+      for(std::size_t file = 0; file < ProcessorFileCount; ++file) {
+        paths.push_back(processorDirectory + ProcessorFileNames[file]);
+      }
+      for(std::size_t cacheIndex = 0; cacheIndex < this->cacheCount; ++cacheIndex) {
+        std::string cacheDirectory = processorDirectory + u8"cache/index";
+        cacheDirectory.append(std::to_string(cacheIndex));
+        cacheDirectory.push_back('/');
+
+        for(std::size_t file = 0; file < CacheFileCount; ++file) {
+          paths.push_back(cacheDirectory + CacheFileNames[file]);
+        }
+      }
+    }
+
+    this->files = this->batchReader.ReadFilesAt(
+      this->cpuDirectoryDescriptor, paths, MaximumFileSize
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void ProcessorDirectoryScanner::readProcessor(
+    std::size_t slot,
+    Nuclex::Platform::Hardware::LinuxSysCpuTreeReader::ProcessorInfo &processor
+  ) {
+    using Nuclex::Platform::Hardware::LinuxSysNodeTreeReader;
+
+    // Offline processors have no topology directory, we'll treat them as their own core.
+    bool packageKnown = (
+      tryGetProcessorFile(slot, PackageIdFile) &&
+      tryParseContentsAsNumber(processor.PackageId)
+    );
+    if(!packageKnown) {
+      processor.PackageId = std::size_t(-1);
+    }
+    bool coreKnown = (
+      tryGetProcessorFile(slot, CoreCpusListFile) ||
+      tryGetProcessorFile(slot, ThreadSiblingsListFile)
+    );
+    if(coreKnown) {
+      processor.CoreProcessorIndices = LinuxSysNodeTreeReader::ParseCpuList(this->contents);
+    }
+    if(processor.CoreProcessorIndices.empty()) {
+      processor.CoreProcessorIndices.assign(1, processor.Index);
+    }
+
+    processor.BaseFrequencyInMHz = tryGetFrequency(slot, BaseFrequencyFile);
+    processor.MinimumFrequencyInMHz = tryGetFrequency(slot, MinimumFrequencyFile);
+    processor.MaximumFrequencyInMHz = tryGetFrequency(slot, MaximumFrequencyFile);
+
+    // The caches are numbered consecutively, so we simply keep going until
+    // a cache doesn't exist
+    processor.Caches.clear();
+    for(std::size_t cacheIndex = 0; cacheIndex < this->cacheCount; ++cacheIndex) {
+      Nuclex::Platform::Hardware::CacheInfo cache;
+      if(!tryGetCacheFile(slot, cacheIndex, LevelFile)) {
+        break;
+      }
+      if(tryParseContentsAsNumber(cache.Level)) {
+        if(tryGetCache(slot, cacheIndex, cache)) {
+          processor.Caches.push_back(cache);
+        }
+      }
+    }
+
+    // The kernel lists caches by level already, but let's not rely on it
+    std::sort(
+      processor.Caches.begin(), processor.Caches.end(),
+      [](
+        const Nuclex::Platform::Hardware::CacheInfo &left,
+        const Nuclex::Platform::Hardware::CacheInfo &right
+      ) {
+        if(left.Level == right.Level) {
+          return static_cast<int>(left.Type) < static_cast<int>(right.Type);
+        } else {
+          return left.Level < right.Level;
+        }
+      }
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool ProcessorDirectoryScanner::tryGetProcessorFile(std::size_t slot, std::size_t file) {
+    if(this->useBatchedReads) {
+      return trySelectFile(slot * this->filesPerProcessor + file);
+    }
+
+    int length = std::snprintf(
+      this->path, sizeof(this->path),
+      u8"cpu%zu/%s", this->processors[slot].Index, ProcessorFileNames[file]
+    );
+    if(unlikely((length < 0) || (static_cast<std::size_t>(length) >= sizeof(this->path)))) {
+      return false;
+    }
+
+    return tryReadFile();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool ProcessorDirectoryScanner::tryGetCacheFile(
+    std::size_t slot, std::size_t cacheIndex, std::size_t file
+  ) {
+    if(this->useBatchedReads) {
+      return trySelectFile(
+        slot * this->filesPerProcessor + ProcessorFileCount + cacheIndex * CacheFileCount + file
+      );
+    }
+
+    int length = std::snprintf(
+      this->path, sizeof(this->path),
+      u8"cpu%zu/cache/index%zu/%s", this->processors[slot].Index, cacheIndex, CacheFileNames[file]
+    );
+    if(unlikely((length < 0) || (static_cast<std::size_t>(length) >= sizeof(this->path)))) {
+      return false;
+    }
+
+    return tryReadFile();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool ProcessorDirectoryScanner::trySelectFile(std::size_t fileIndex) {
+    const std::optional<std::string> &file = this->files[fileIndex];
+    if(file.has_value()) {
+      this->contents = std::string_view(file.value());
+      return true;
+    } else {
+      this->contents = std::string_view();
+      return false;
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool ProcessorDirectoryScanner::tryReadFile() {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    std::size_t length;
+    bool wasRead = LinuxFileApi::TryReadFileAt(
+      this->cpuDirectoryDescriptor, this->path, this->buffer, sizeof(this->buffer), length
+    );
+    if(wasRead) {
+      this->contents = std::string_view(this->buffer, length);
+    } else {
+      this->contents = std::string_view();
+    }
+
+    return wasRead;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool ProcessorDirectoryScanner::tryParseContentsAsNumber(std::size_t &value) const {
+    using Nuclex::Platform::Hardware::StringHelper;
+
+    std::string_view text(this->contents);
+    StringHelper::SkipWhitespace(text);
+    return StringHelper::TryTakeNumber(text, value);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::optional<double> ProcessorDirectoryScanner::tryGetFrequency(
+    std::size_t slot, std::size_t file
+  ) {
+    std::size_t kilohertz;
+    bool wasRead = (
+      tryGetProcessorFile(slot, file) &&
+      tryParseContentsAsNumber(kilohertz)
+    );
+    if(wasRead && (kilohertz > 0)) {
+      return static_cast<double>(kilohertz) / 1000.0;
+    } else {
+      return std::optional<double>();
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool ProcessorDirectoryScanner::tryGetCache(
+    std::size_t slot,
+    std::size_t cacheIndex,
+    Nuclex::Platform::Hardware::CacheInfo &cache
+  ) {
+    using Nuclex::Platform::Hardware::LinuxSysNodeTreeReader;
+    using Nuclex::Platform::Hardware::StringHelper;
+    using Nuclex::Platform::Hardware::CacheType;
+
+    if(!tryGetCacheFile(slot, cacheIndex, TypeFile)) {
+      return false;
+    }
+    if(this->contents.substr(0, 4) == u8"Data") {
+      cache.Type = CacheType::Data;
+    } else if(this->contents.substr(0, 11) == u8"Instruction") {
+      cache.Type = CacheType::Instruction;
+    } else if(this->contents.substr(0, 7) == u8"Unified") {
+      cache.Type = CacheType::Unified;
+    } else {
+      return false;
+    }
+
+    // The size is given with a unit suffix, i.e. '32K' or '16M'
+    if(!tryGetCacheFile(slot, cacheIndex, SizeFile)) {
+      return false;
+    }
+    std::string_view sizeText(this->contents);
+    StringHelper::SkipWhitespace(sizeText);
+    if(!StringHelper::TryTakeNumber(sizeText, cache.SizeInBytes)) {
+      return false;
+    }
+    if(!sizeText.empty()) {
+      if(sizeText.front() == 'K') {
+        cache.SizeInBytes *= 1024;
+      } else if(sizeText.front() == 'M') {
+        cache.SizeInBytes *= 1024 * 1024;
+      } else if(sizeText.front() == 'G') {
+        cache.SizeInBytes *= 1024 * 1024 * 1024;
+      }
+    }
+
+    // The remaining files are missing on some architectures (and in virtual machines
+    // that don't pass the cache geometry through), so we don't insist on them
+    bool lineSizeKnown = (
+      tryGetCacheFile(slot, cacheIndex, LineSizeFile) &&
+      tryParseContentsAsNumber(cache.LineSizeInBytes)
+    );
+    if(!lineSizeKnown) {
+      cache.LineSizeInBytes = 0;
+    }
+    bool associativityKnown = (
+      tryGetCacheFile(slot, cacheIndex, AssociativityFile) &&
+      tryParseContentsAsNumber(cache.Associativity)
+    );
+    if(!associativityKnown) {
+      cache.Associativity = 0;
+    }
+    if(tryGetCacheFile(slot, cacheIndex, SharedCpuListFile)) {
+      cache.SharedProcessorIndices = LinuxSysNodeTreeReader::ParseCpuList(this->contents);
+    } else {
+      cache.SharedProcessorIndices.clear();
+    }
+
+    return true;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads the sysfs files of a range of processors</summary>
+  /// <param name="cpuDirectoryDescriptor">
+  ///   Descriptor of the opened /sys/devices/system/cpu directory
+  /// </param>
+  /// <param name="cacheCount">Number of caches that will be looked for per processor</param>
+  /// <param name="useBatchedReads">Whether the files will be read in batches</param>
+  /// <param name="processors">Processors whose index is set and who will be filled</param>
+  /// <param name="count">Number of processors that will be read</param>
+  void scanProcessors(
+    int cpuDirectoryDescriptor, std::size_t cacheCount, bool useBatchedReads,
+    Nuclex::Platform::Hardware::LinuxSysCpuTreeReader::ProcessorInfo *processors,
+    std::size_t count
+  ) {
+    ProcessorDirectoryScanner scanner(cpuDirectoryDescriptor, cacheCount, useBatchedReads);
+    scanner.ReadProcessors(processors, count);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<LinuxSysCpuTreeReader::ProcessorInfo> LinuxSysCpuTreeReader::TryReadProcessors(
+    const std::string &devicesPath /* = u8"/sys/devices" */,
+    std::size_t maximumThreadCount /* = 1 */,
+    bool useBatchedReads /* = false */
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+    using Nuclex::Platform::Platform::FileDescriptorClosingScope;
+
+    std::vector<ProcessorInfo> processors;
+
+    std::string cpuDirectory = LinuxFileApi::JoinPaths(devicesPath, u8"system/cpu");
+    int cpuDirectoryDescriptor;
+    if(!LinuxFileApi::TryOpenDirectory(cpuDirectory, cpuDirectoryDescriptor)) {
+      return processors;
+    }
+    FileDescriptorClosingScope closeCpuDirectory(cpuDirectoryDescriptor);
+
+    // Only look at the 'cpu<n>' directories, there are also 'cpufreq', 'cpuidle'
+    // and a few files listing processors in various states.
+    {
+      std::vector<std::string> entryNames;
+      if(!LinuxFileApi::TryListDirectory(cpuDirectory, entryNames)) {
+        return processors;
+      }
+
+      for(const std::string &entryName : entryNames) {
+        if(entryName.compare(0, 3, u8"cpu", 3) != 0) {
+          continue;
+        }
+
+        std::size_t processorIndex;
+        std::string_view indexText(entryName);
+        indexText.remove_prefix(3);
+        if(StringHelper::TryTakeNumber(indexText, processorIndex) && indexText.empty()) {
+          processors.emplace_back().Index = processorIndex;
+        }
+      }
+
+      std::sort(
+        processors.begin(), processors.end(),
+        [](const ProcessorInfo &left, const ProcessorInfo &right) {
+          return left.Index < right.Index;
+        }
+      );
+    }
+
+    // Processors of one system have the same number of caches. Should one have fewer,
+    // its missing cache directories simply can't be read.
+    std::size_t cacheCount = 0;
+    if(!processors.empty()) {
+      cacheCount = countCaches(cpuDirectory, processors.front().Index);
+    }
+
+    // On big machines, split the processors into consecutive ranges and let additional
+    // threads scan all but the first range while the calling thread scans the first
+    std::size_t processorCount = processors.size();
+    std::size_t threadCount = std::min(
+      maximumThreadCount,
+      (processorCount + MinimumProcessorsPerThread - 1) / MinimumProcessorsPerThread
+    );
+    if(threadCount >= 2) {
+      std::size_t processorsPerThread = (processorCount + threadCount - 1) / threadCount;
+
+      std::vector<std::future<void>> scans;
+      scans.reserve(threadCount - 1);
+      for(std::size_t start = processorsPerThread; start < processorCount;) {
+        std::size_t count = std::min(processorsPerThread, processorCount - start);
+        scans.push_back(
+          std::async(
+            std::launch::async,
+            &scanProcessors,
+            cpuDirectoryDescriptor, cacheCount, useBatchedReads,
+            processors.data() + start, count
+          )
+        );
+        start += count;
+      }
+
+      scanProcessors(
+        cpuDirectoryDescriptor, cacheCount, useBatchedReads,
+        processors.data(), std::min(processorsPerThread, processorCount)
+      );
+      for(std::future<void> &scan : scans) {
+        scan.get();
+      }
+    } else {
+      scanProcessors(
+        cpuDirectoryDescriptor, cacheCount, useBatchedReads, processors.data(), processorCount
+      );
+    }
+
+    // Tell apart the processors of performance cores and eco cores on hybrid CPUs
+    {
+      std::vector<std::size_t> performanceProcessorIndices, ecoProcessorIndices;
+      bool isHybridCpu = TryReadHybridProcessors(
+        performanceProcessorIndices, ecoProcessorIndices, devicesPath
+      );
+      if(isHybridCpu) {
+        for(ProcessorInfo &processor : processors) {
+          processor.IsEcoCore = std::binary_search(
+            ecoProcessorIndices.begin(), ecoProcessorIndices.end(), processor.Index
+          );
+        }
+      }
+    }
+
+    return processors;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool LinuxSysCpuTreeReader::TryReadHybridProcessors(
+    std::vector<std::size_t> &performanceProcessorIndices,
+    std::vector<std::size_t> &ecoProcessorIndices,
+    const std::string &devicesPath /* = u8"/sys/devices" */
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    // Hybrid CPUs have one PMU per core type. Intel names them 'cpu_core' and 'cpu_atom',
+    // other hybrid CPUs are not reported this way yet.
+    return (
+      tryReadCpuListFromFile(
+        LinuxFileApi::JoinPaths(devicesPath, u8"cpu_core/cpus"), performanceProcessorIndices
+      ) &&
+      tryReadCpuListFromFile(
+        LinuxFileApi::JoinPaths(devicesPath, u8"cpu_atom/cpus"), ecoProcessorIndices
+      )
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
 
-/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_min_freq
-/sys/devices/system/cpu/cpu0/cpufreq/cpuinfo_max_freq
-/sys/devices/system/cpu/cpu0/topology/physical_package_id
+}}} // namespace Nuclex::Platform::Hardware
 
-Lacks model name
-*/
\ No newline at end of file
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -16,3 +16,120 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 #pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_LINUXSYSCPUTREEREADER_H
+#define NUCLEX_PLATFORM_HARDWARE_LINUXSYSCPUTREEREADER_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "Nuclex/Platform/Hardware/CpuInfo.h" // for CacheInfo
+
+#include <cstddef> // for std::size_t
+#include <string> // for std::string
+#include <vector> // for std::vector
+#include <optional> // for std::optional
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Queries the topology of the system's processors via the sysfs tree</summary>
+  /// <remarks>
+  ///   <para>
+  ///     The Linux kernel lists each logical processor as a directory named 'cpu&lt;n&gt;'
+  ///     in /sys/devices/system/cpu. Its 'topology' subdirectory tells which physical
+  ///     package and core the processor belongs to, 'cpufreq' holds the frequency range
+  ///     and 'cache' describes the caches the processor can access.
+  ///   </para>
+  ///   <para>
+  ///     On hybrid CPUs, the kernel registers a separate PMU for each core type, so
+  ///     /sys/devices/cpu_core/cpus lists the processors of the performance cores and
+  ///     /sys/devices/cpu_atom/cpus those of the eco cores.
+  ///   </para>
+  ///   <para>
+  ///     What sysfs lacks is the model name of the CPU, which has to be taken from
+  ///     /proc/cpuinfo (see <see cref="LinuxProcCpuInfoReader" />).
+  ///   </para>
+  /// </remarks>
+  class LinuxSysCpuTreeReader {
+
+    #pragma region struct ProcessorInfo
+
+    /// <summary>Informations about a single logical processor</summary>
+    public: struct ProcessorInfo {
+
+      /// <summary>Index of the processor as assigned by the kernel</summary>
+      public: std::size_t Index;
+      /// <summary>Id of the physical CPU the processor belongs to</summary>
+      /// <remarks>Is std::size_t(-1) if the topology could not be read</remarks>
+      public: std::size_t PackageId;
+      /// <summary>Processors sharing the same core, including this one, ascending</summary>
+      /// <remarks>
+      ///   Contains only the processor itself if SMT is disabled or unsupported or if
+      ///   the topology could not be read. The first entry identifies the core.
+      /// </remarks>
+      public: std::vector<std::size_t> CoreProcessorIndices;
+      /// <summary>Nominal (unboosted) frequency of the processor, if known</summary>
+      public: std::optional<double> BaseFrequencyInMHz;
+      /// <summary>Lowest frequency the processor can run at, if known</summary>
+      public: std::optional<double> MinimumFrequencyInMHz;
+      /// <summary>Highest frequency the processor can boost to, if known</summary>
+      public: std::optional<double> MaximumFrequencyInMHz;
+      /// <summary>Whether the processor belongs to an eco core of a hybrid CPU</summary>
+      /// <remarks>Empty unless the system has a hybrid CPU</remarks>
+      public: std::optional<bool> IsEcoCore;
+      /// <summary>Caches the processor can access, ordered by level</summary>
+      public: std::vector<CacheInfo> Caches;
+
+    };
+
+    #pragma endregion // struct ProcessorInfo
+
+    /// <summary>Attempts to read all logical processors from the sysfs tree</summary>
+    /// <param name="devicesPath">
+    ///   Path to the devices directory in sysfs, can be changed for unit tests
+    /// </param>
+    /// <param name="maximumThreadCount">
+    ///   Maximum number of threads (including the calling thread) that may be used to
+    ///   read the processors in parallel. Additional threads are only used for every
+    ///   64 processors, so small systems are always scanned by the calling thread alone.
+    /// </param>
+    /// <param name="useBatchedReads">
+    ///   Whether the files of several processors should be read in batches (through
+    ///   io_uring if available) instead of one by one. This was slower on the machines
+    ///   measured so far and is only meant for comparing both ways on other machines.
+    /// </param>
+    /// <returns>
+    ///   All processors found ordered by their index, or an empty list if sysfs did not
+    ///   list any processors
+    /// </returns>
+    public: static std::vector<ProcessorInfo> TryReadProcessors(
+      const std::string &devicesPath = u8"/sys/devices",
+      std::size_t maximumThreadCount = 1,
+      bool useBatchedReads = false
+    );
+
+    /// <summary>Looks up the logical processors of a hybrid CPU's two core classes</summary>
+    /// <param name="performanceProcessorIndices">Receives the processors of the p-cores</param>
+    /// <param name="ecoProcessorIndices">Receives the processors of the e-cores</param>
+    /// <param name="devicesPath">
+    ///   Path to the devices directory in sysfs, can be changed for unit tests
+    /// </param>
+    /// <returns>True if the processors of both core classes could be determined</returns>
+    public: static bool TryReadHybridProcessors(
+      std::vector<std::size_t> &performanceProcessorIndices,
+      std::vector<std::size_t> &ecoProcessorIndices,
+      const std::string &devicesPath = u8"/sys/devices"
+    );
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+#endif // NUCLEX_PLATFORM_HARDWARE_LINUXSYSCPUTREEREADER_H
@@ -0,0 +1,262 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./LinuxSysDrmTreeReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "./StringHelper.h" // for StringHelper
+#include "../Platform/LinuxFileApi.h" // for LinuxFileApi
+
+#include <algorithm> // for std::sort()
+#include <string_view> // for std::string_view
+#include <utility> // for std::pair
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Number of bytes in one megabyte</summary>
+  const std::uint64_t BytesPerMegabyte = 1024 * 1024;
+
+  /// <summary>Video memory from which on an AMD or Intel GPU is considered dedicated</summary>
+  /// <remarks>
+  ///   Integrated GPUs report the memory carved out for them by the BIOS, which is usually
+  ///   512 MiB and rarely more than 2 GiB, while even small dedicated boards have 4 GiB.
+  /// </remarks>
+  const std::uint64_t MinimumDedicatedVideoMemory = 3 * 1024 * BytesPerMegabyte;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Attempts to read a single line of text from a sysfs file</summary>
+  /// <param name="path">Path of the file that will be read</param>
+  /// <param name="text">Receives the contents of the file without surrounding whitespace</param>
+  /// <returns>True if the file existed and was not empty, false otherwise</returns>
+  bool tryReadTextFromFile(const std::string &path, std::string &text) {
+    using Nuclex::Platform::Hardware::StringHelper;
+
+    std::string contents;
+    if(!Nuclex::Platform::Platform::LinuxFileApi::TryReadFileInOneReadCall(path, contents)) {
+      return false;
+    }
+
+    std::string_view trimmed(contents);
+    StringHelper::TrimWhitespace(trimmed);
+    text.assign(trimmed);
+
+    return !text.empty();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Determines the name of the kernel driver bound to a device</summary>
+  /// <param name="deviceDirectory">Path to the device's directory in sysfs</param>
+  /// <returns>The name of the driver or an empty string if none is bound</returns>
+  std::string getDriverName(const std::string &deviceDirectory) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    std::string target;
+    if(!LinuxFileApi::TryReadLink(LinuxFileApi::JoinPaths(deviceDirectory, u8"driver"), target)) {
+      return std::string();
+    }
+
+    // The link points to i.e. '../../../bus/pci/drivers/amdgpu', we only want the last part
+    std::string::size_type lastSlashIndex = target.find_last_of('/');
+    if(lastSlashIndex == std::string::npos) {
+      return target;
+    } else {
+      return target.substr(lastSlashIndex + 1);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Formats a 16 bit number as four hexadecimal digits</summary>
+  /// <param name="value">Number that will be formatted</param>
+  /// <returns>A string containing the number in hexadecimal</returns>
+  std::string toHex(std::uint16_t value) {
+    static const char hexDigits[] = u8"0123456789abcdef";
+
+    std::string hex(4, '0');
+    for(std::size_t index = 0; index < 4; ++index) {
+      hex[3 - index] = hexDigits[(value >> (index * 4)) & 0xF];
+    }
+
+    return hex;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<GpuInfo> LinuxSysDrmTreeReader::TryReadGpus(
+    const std::string &drmClassPath /* = u8"/sys/class/drm" */
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    typedef std::pair<std::uint64_t, GpuInfo> IndexedGpu;
+    std::vector<IndexedGpu> indexedGpus;
+
+    std::vector<std::string> entryNames;
+    if(!LinuxFileApi::TryListDirectory(drmClassPath, entryNames)) {
+      return std::vector<GpuInfo>(); // Kernel without DRM or no GPU at all
+    }
+
+    for(const std::string &entryName : entryNames) {
+
+      // Only the 'card<n>' entries are GPUs, the entries for the connectors of each card
+      // ('card0-DP-1') and render nodes ('renderD128') lead to the same devices.
+      std::uint64_t cardIndex;
+      {
+        if(entryName.compare(0, 4, u8"card", 4) != 0) {
+          continue;
+        }
+        std::string_view indexText(entryName);
+        indexText.remove_prefix(4);
+        if((indexText.length() > 1) && (indexText[0] == '0')) {
+          continue; // No leading zeros, 'card01' would not be the same card as 'card1'
+        }
+        if(!StringHelper::TryTakeNumber(indexText, cardIndex) || !indexText.empty()) {
+          continue;
+        }
+      }
+
+      // Devices without PCI IDs are virtual or firmware framebuffers (simpledrm, vkms)
+      // that can't do any work for us, so they're skipped.
+      std::string deviceDirectory = LinuxFileApi::JoinPaths(
+        LinuxFileApi::JoinPaths(drmClassPath, entryName), u8"device"
+      );
+      std::uint64_t vendorId, deviceId;
+      bool isPciDevice = (
+        LinuxFileApi::TryReadNumberFromFile(
+          LinuxFileApi::JoinPaths(deviceDirectory, u8"vendor"), vendorId
+        ) &&
+        LinuxFileApi::TryReadNumberFromFile(
+          LinuxFileApi::JoinPaths(deviceDirectory, u8"device"), deviceId
+        )
+      );
+      if(!isPciDevice) {
+        continue;
+      }
+
+      GpuInfo gpu;
+      gpu.VendorId = static_cast<std::uint16_t>(vendorId);
+      gpu.DeviceId = static_cast<std::uint16_t>(deviceId);
+      gpu.ManufacturerName = GetManufacturerName(gpu.VendorId);
+      gpu.PixelShaderVersion = 0;
+      gpu.VertexShaderVersion = 0;
+      gpu.SupportsVulkan = false;
+
+      // Without a marketing name from the driver, the PCI IDs are the best we have
+      std::string productName;
+      bool hasProductName = tryReadTextFromFile(
+        LinuxFileApi::JoinPaths(deviceDirectory, u8"product_name"), productName
+      );
+      if(hasProductName) {
+        gpu.ModelName = productName;
+      } else {
+        gpu.ModelName = gpu.ManufacturerName;
+        gpu.ModelName.append(u8" GPU [", 6);
+        gpu.ModelName.append(toHex(gpu.VendorId));
+        gpu.ModelName.push_back(':');
+        gpu.ModelName.append(toHex(gpu.DeviceId));
+        gpu.ModelName.push_back(']');
+      }
+
+      // Out-of-tree drivers such as NVidia's have a module version, in-tree drivers
+      // don't and are versioned with the kernel, so the driver's name is all we report.
+      gpu.DriverVersion = getDriverName(deviceDirectory);
+      if(!gpu.DriverVersion.empty()) {
+        std::string moduleVersion;
+        bool hasModuleVersion = tryReadTextFromFile(
+          LinuxFileApi::JoinPaths(deviceDirectory, u8"driver/module/version"), moduleVersion
+        );
+        if(hasModuleVersion) {
+          gpu.DriverVersion.push_back(' ');
+          gpu.DriverVersion.append(moduleVersion);
+        }
+      }
+
+      std::uint64_t videoMemoryBytes;
+      bool hasVideoMemory = LinuxFileApi::TryReadNumberFromFile(
+        LinuxFileApi::JoinPaths(deviceDirectory, u8"mem_info_vram_total"), videoMemoryBytes
+      );
+      if(hasVideoMemory) {
+        gpu.VideoMemoryInMegabytes = static_cast<std::size_t>(
+          videoMemoryBytes / BytesPerMegabyte
+        );
+      } else {
+        videoMemoryBytes = 0;
+        gpu.VideoMemoryInMegabytes = 0;
+      }
+
+      // NVidia only makes dedicated GPUs for PCs (leaving aside the Tegra/Jetson line),
+      // for the others, only the amount of video memory gives it away
+      gpu.IsDedicated = (
+        (gpu.VendorId == 0x10de) || (videoMemoryBytes >= MinimumDedicatedVideoMemory)
+      );
+
+      indexedGpus.emplace_back(cardIndex, std::move(gpu));
+    }
+
+    // Directory entries come in no particular order, but card indices are stable
+    std::sort(
+      indexedGpus.begin(), indexedGpus.end(),
+      [](const IndexedGpu &left, const IndexedGpu &right) { return left.first < right.first; }
+    );
+
+    std::vector<GpuInfo> gpus;
+    gpus.reserve(indexedGpus.size());
+    for(IndexedGpu &indexedGpu : indexedGpus) {
+      gpus.push_back(std::move(indexedGpu.second));
+    }
+
+    return gpus;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::string LinuxSysDrmTreeReader::GetManufacturerName(std::uint16_t vendorId) {
+    switch(vendorId) {
+      case 0x10de: { return std::string(u8"NVidia", 6); }
+      case 0x1002: { return std::string(u8"AMD", 3); }
+      case 0x8086: { return std::string(u8"Intel", 5); }
+      case 0x1af4: { return std::string(u8"Red Hat", 7); } // virtio-gpu in VMs
+      case 0x15ad: { return std::string(u8"VMware", 6); }
+      case 0x1234: { return std::string(u8"QEMU", 4); }
+      default: {
+        std::string hexVendorId(u8"0x", 2);
+        hexVendorId.append(toHex(vendorId));
+        return hexVendorId;
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
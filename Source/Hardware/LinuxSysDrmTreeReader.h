@@ -0,0 +1,78 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_LINUXSYSDRMTREEREADER_H
+#define NUCLEX_PLATFORM_HARDWARE_LINUXSYSDRMTREEREADER_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "Nuclex/Platform/Hardware/GpuInfo.h" // for GpuInfo
+
+#include <cstdint> // for std::uint16_t
+#include <string> // for std::string
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Queries the GPUs of the system via the /sys/class/drm tree</summary>
+  /// <remarks>
+  ///   <para>
+  ///     Each GPU driven by a kernel DRM driver appears as a 'card&lt;n&gt;' directory in
+  ///     /sys/class/drm. Its 'device' link leads to the PCI device, which has 'vendor' and
+  ///     'device' files with the PCI IDs and a 'driver' link to the kernel driver.
+  ///   </para>
+  ///   <para>
+  ///     Only some drivers report the amount of video memory. The amdgpu driver provides
+  ///     'mem_info_vram_total' (in bytes) and, for some boards, a 'product_name'. NVidia's
+  ///     proprietary driver reports neither, so such GPUs are listed with zero video memory.
+  ///     The connector directories ('card0-HDMI-A-1') and render nodes are skipped.
+  ///   </para>
+  /// </remarks>
+  class LinuxSysDrmTreeReader {
+
+    /// <summary>Attempts to read the GPUs from the sysfs tree</summary>
+    /// <param name="drmClassPath">
+    ///   Path to the DRM class directory, can be changed for unit tests
+    /// </param>
+    /// <returns>
+    ///   All GPUs found ordered by their card index, or an empty list if no GPUs
+    ///   with a DRM driver are present
+    /// </returns>
+    public: static std::vector<GpuInfo> TryReadGpus(
+      const std::string &drmClassPath = u8"/sys/class/drm"
+    );
+
+    /// <summary>Looks up the name of the company behind a PCI vendor ID</summary>
+    /// <param name="vendorId">PCI vendor ID whose company name will be returned</param>
+    /// <returns>The company's name or the vendor ID in hexadecimal if unknown</returns>
+    public: static std::string GetManufacturerName(std::uint16_t vendorId);
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+#endif // NUCLEX_PLATFORM_HARDWARE_LINUXSYSDRMTREEREADER_H
@@ -0,0 +1,234 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./LinuxSysNodeTreeReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "./StringHelper.h" // for StringHelper
+#include "../Platform/LinuxFileApi.h" // for LinuxFileApi
+
+#include <algorithm> // for std::sort(), std::unique()
+#include <utility> // for std::pair
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Extracts a memory amount from a node's meminfo file</summary>
+  /// <param name="memInfo">Contents of the node's meminfo file</param>
+  /// <param name="key">Key of the amount including the colon, i.e. 'MemTotal:'</param>
+  /// <returns>The amount of memory in bytes, zero if the key wasn't found</returns>
+  /// <remarks>
+  ///   Unlike /proc/meminfo, the per-node meminfo files prefix each line with the node
+  ///   index, i.e. 'Node 0 MemTotal:       32795876 kB'. The kernel always reports kB.
+  /// </remarks>
+  std::uint64_t getMemoryFromNodeMemInfo(
+    const std::string &memInfo, const std::string_view &key
+  ) {
+    using Nuclex::Platform::Hardware::StringHelper;
+
+    std::string::size_type keyIndex = memInfo.find(key.data(), 0, key.length());
+    if(keyIndex == std::string::npos) {
+      return 0;
+    }
+
+    std::string_view text(memInfo);
+    text.remove_prefix(keyIndex + key.length());
+    StringHelper::SkipWhitespace(text);
+
+    std::size_t kilobytes;
+    if(!StringHelper::TryTakeNumber(text, kilobytes)) {
+      return 0;
+    }
+
+    return static_cast<std::uint64_t>(kilobytes) * 1024;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Counts the physical cores the specified logical processors belong to</summary>
+  /// <param name="cpuDirectory">Path to the /sys/devices/system/cpu directory</param>
+  /// <param name="processorIndices">Logical processors whose cores will be counted</param>
+  /// <returns>The number of distinct physical cores the processors are part of</returns>
+  std::size_t countPhysicalCores(
+    const std::string &cpuDirectory, const std::vector<std::size_t> &processorIndices
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> packageAndCoreIds;
+    packageAndCoreIds.reserve(processorIndices.size());
+
+    std::string topologyDirectory;
+    for(std::size_t processorIndex : processorIndices) {
+      topologyDirectory.assign(u8"cpu", 3);
+      topologyDirectory.append(std::to_string(processorIndex));
+      topologyDirectory.append(u8"/topology", 9);
+      topologyDirectory = LinuxFileApi::JoinPaths(cpuDirectory, topologyDirectory);
+
+      // If the topology can't be read, we'll count the logical processor as its own core
+      std::uint64_t packageId, coreId;
+      bool topologyKnown = (
+        LinuxFileApi::TryReadNumberFromFile(
+          topologyDirectory + u8"/physical_package_id", packageId
+        ) &&
+        LinuxFileApi::TryReadNumberFromFile(topologyDirectory + u8"/core_id", coreId)
+      );
+      if(topologyKnown) {
+        packageAndCoreIds.emplace_back(packageId, coreId);
+      } else {
+        packageAndCoreIds.emplace_back(std::uint64_t(-1), processorIndex);
+      }
+    }
+
+    std::sort(packageAndCoreIds.begin(), packageAndCoreIds.end());
+    return static_cast<std::size_t>(
+      std::unique(packageAndCoreIds.begin(), packageAndCoreIds.end()) -
+      packageAndCoreIds.begin()
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<LinuxSysNodeTreeReader::NodeInfo> LinuxSysNodeTreeReader::TryReadNodes(
+    const std::string &systemDevicesPath /* = u8"/sys/devices/system" */
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    std::vector<NodeInfo> nodes;
+
+    std::string nodeDirectory = LinuxFileApi::JoinPaths(systemDevicesPath, u8"node");
+    std::vector<std::string> entryNames;
+    if(!LinuxFileApi::TryListDirectory(nodeDirectory, entryNames)) {
+      return nodes; // Kernel without NUMA support
+    }
+
+    for(const std::string &entryName : entryNames) {
+
+      // Only look at the 'node<n>' directories, there are also files such as 'online'
+      // and 'has_cpu' in the node directory that list nodes in various states.
+      std::size_t nodeIndex;
+      {
+        if(entryName.compare(0, 4, u8"node", 4) != 0) {
+          continue;
+        }
+        std::string_view indexText(entryName);
+        indexText.remove_prefix(4);
+        if(!StringHelper::TryTakeNumber(indexText, nodeIndex) || !indexText.empty()) {
+          continue;
+        }
+      }
+
+      std::string nodePath = LinuxFileApi::JoinPaths(nodeDirectory, entryName);
+      NodeInfo node;
+      node.Index = nodeIndex;
+
+      std::string contents;
+      if(LinuxFileApi::TryReadFileInOneReadCall(nodePath + u8"/cpulist", contents)) {
+        node.ProcessorIndices = ParseCpuList(contents);
+      }
+      node.CoreCount = CountPhysicalCores(node.ProcessorIndices, systemDevicesPath);
+
+      if(LinuxFileApi::TryReadFileInOneReadCall(nodePath + u8"/meminfo", contents)) {
+        node.MemoryInBytes = getMemoryFromNodeMemInfo(contents, u8"MemTotal:");
+        node.FreeMemoryInBytes = getMemoryFromNodeMemInfo(contents, u8"MemFree:");
+      } else {
+        node.MemoryInBytes = 0;
+        node.FreeMemoryInBytes = 0;
+      }
+
+      nodes.push_back(std::move(node));
+    }
+
+    std::sort(
+      nodes.begin(), nodes.end(),
+      [](const NodeInfo &left, const NodeInfo &right) { return left.Index < right.Index; }
+    );
+
+    return nodes;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::size_t LinuxSysNodeTreeReader::CountPhysicalCores(
+    const std::vector<std::size_t> &processorIndices,
+    const std::string &systemDevicesPath /* = u8"/sys/devices/system" */
+  ) {
+    return countPhysicalCores(
+      Platform::LinuxFileApi::JoinPaths(systemDevicesPath, u8"cpu"), processorIndices
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<std::size_t> LinuxSysNodeTreeReader::ParseCpuList(
+    const std::string_view &cpuList
+  ) {
+    std::vector<std::size_t> processorIndices;
+
+    std::string_view remaining(cpuList);
+    for(;;) {
+      StringHelper::SkipWhitespace(remaining);
+
+      std::size_t firstIndex;
+      if(!StringHelper::TryTakeNumber(remaining, firstIndex)) {
+        break; // Either the end of the list or something we don't understand
+      }
+
+      // Ranges are given as 'first-last' with both ends inclusive
+      std::size_t lastIndex = firstIndex;
+      if(!remaining.empty() && (remaining.front() == '-')) {
+        remaining.remove_prefix(1);
+        if(!StringHelper::TryTakeNumber(remaining, lastIndex) || (lastIndex < firstIndex)) {
+          break;
+        }
+      }
+
+      for(std::size_t index = firstIndex; index <= lastIndex; ++index) {
+        processorIndices.push_back(index);
+      }
+
+      if(remaining.empty() || (remaining.front() != ',')) {
+        break;
+      }
+      remaining.remove_prefix(1);
+    }
+
+    std::sort(processorIndices.begin(), processorIndices.end());
+    processorIndices.erase(
+      std::unique(processorIndices.begin(), processorIndices.end()), processorIndices.end()
+    );
+
+    return processorIndices;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,112 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_LINUXSYSNODETREEREADER_H
+#define NUCLEX_PLATFORM_HARDWARE_LINUXSYSNODETREEREADER_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t
+#include <string> // for std::string
+#include <string_view> // for std::string_view
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Queries the NUMA nodes of the system via the /sys/devices/system tree</summary>
+  /// <remarks>
+  ///   <para>
+  ///     The Linux kernel lists each NUMA node as a directory named 'node&lt;n&gt;' in
+  ///     /sys/devices/system/node. Each contains a 'cpulist' file with the logical
+  ///     processors of the node and a 'meminfo' file listing the node's memory.
+  ///   </para>
+  ///   <para>
+  ///     Kernels built without NUMA support lack the node directory entirely. Desktop
+  ///     systems with NUMA support will report a single node covering everything.
+  ///   </para>
+  /// </remarks>
+  class LinuxSysNodeTreeReader {
+
+    #pragma region struct NodeInfo
+
+    /// <summary>Informations about a single NUMA node</summary>
+    public: struct NodeInfo {
+
+      /// <summary>Index of the node as assigned by the kernel</summary>
+      public: std::size_t Index;
+      /// <summary>Number of physical CPU cores belonging to the node</summary>
+      public: std::size_t CoreCount;
+      /// <summary>Logical processors belonging to the node, in ascending order</summary>
+      public: std::vector<std::size_t> ProcessorIndices;
+      /// <summary>Amount of memory attached to the node in bytes</summary>
+      public: std::uint64_t MemoryInBytes;
+      /// <summary>Amount of the node's memory that is unused right now in bytes</summary>
+      public: std::uint64_t FreeMemoryInBytes;
+
+    };
+
+    #pragma endregion // struct NodeInfo
+
+    /// <summary>Attempts to read the NUMA nodes from the sysfs tree</summary>
+    /// <param name="systemDevicesPath">
+    ///   Path to the system devices directory, can be changed for unit tests
+    /// </param>
+    /// <returns>
+    ///   All NUMA nodes found ordered by their index, or an empty list if the kernel
+    ///   does not expose NUMA nodes
+    /// </returns>
+    public: static std::vector<NodeInfo> TryReadNodes(
+      const std::string &systemDevicesPath = u8"/sys/devices/system"
+    );
+
+    /// <summary>Counts the physical cores the specified logical processors belong to</summary>
+    /// <param name="processorIndices">Logical processors whose cores will be counted</param>
+    /// <param name="systemDevicesPath">
+    ///   Path to the system devices directory, can be changed for unit tests
+    /// </param>
+    /// <returns>The number of distinct physical cores the processors are part of</returns>
+    /// <remarks>
+    ///   Processors whose topology can't be read are counted as one core each.
+    /// </remarks>
+    public: static std::size_t CountPhysicalCores(
+      const std::vector<std::size_t> &processorIndices,
+      const std::string &systemDevicesPath = u8"/sys/devices/system"
+    );
+
+    /// <summary>Parses a processor list as used in sysfs and cgroup files</summary>
+    /// <param name="cpuList">
+    ///   Processor list in the kernel's list format, for example '0-3,8,10-11'
+    /// </param>
+    /// <returns>The indices of all processors in the list, in ascending order</returns>
+    public: static std::vector<std::size_t> ParseCpuList(const std::string_view &cpuList);
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+#endif // NUCLEX_PLATFORM_HARDWARE_LINUXSYSNODETREEREADER_H
@@ -0,0 +1,230 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "Nuclex/Platform/Hardware/MemoryPressureMonitor.h"
+
+#include "./SequenceLockHelper.h" // for SequenceLockHelper
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+#include "./LinuxMemoryPressureReader.h" // for LinuxMemoryPressureReader
+#elif defined(NUCLEX_PLATFORM_WINDOWS)
+#include "../Platform/WindowsSysInfoApi.h" // for WindowsSysInfoApi
+#endif
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Value published for a megabyte count that is not known</summary>
+  const std::size_t UnknownMegabytes = std::size_t(-1);
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Platform-specific sources the samples are taken from</summary>
+  struct MemoryPressureMonitor::Sampler {
+
+    /// <summary>Reads the current memory state</summary>
+    /// <param name="pressure">Receives the current memory state</param>
+    public: void Sample(MemoryPressure &pressure) {
+#if defined(NUCLEX_PLATFORM_LINUX)
+      this->reader.Sample(pressure);
+#elif defined(NUCLEX_PLATFORM_WINDOWS)
+      ::MEMORYSTATUSEX memoryStatus;
+      Platform::WindowsSysInfoApi::GetGlobalMemoryStatus(memoryStatus);
+
+      // Job object limits are not looked at yet, so there's no group limit on Windows
+      pressure.TotalMegabytes = static_cast<std::size_t>(
+        memoryStatus.ullTotalPhys / (1024 * 1024)
+      );
+      pressure.AvailableMegabytes = static_cast<std::size_t>(
+        memoryStatus.ullAvailPhys / (1024 * 1024)
+      );
+      pressure.GroupLimitMegabytes.reset();
+      pressure.GroupUsageMegabytes.reset();
+      pressure.UsableMegabytes = pressure.AvailableMegabytes;
+      pressure.SomeStallPercent.reset();
+      pressure.FullStallPercent.reset();
+#endif
+    }
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+    /// <summary>Keeps the procfs and cgroup files open between samples</summary>
+    private: LinuxMemoryPressureReader reader;
+#endif
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  MemoryPressureMonitor::MemoryPressureMonitor(
+    std::chrono::milliseconds sampleInterval /* = std::chrono::milliseconds(250) */
+  ) :
+    sampleInterval(sampleInterval),
+    samplerMutex(),
+    sampler(std::make_unique<Sampler>()),
+    sequenceNumber(0),
+    totalMegabytes(0),
+    availableMegabytes(0),
+    groupLimitMegabytes(UnknownMegabytes),
+    groupUsageMegabytes(UnknownMegabytes),
+    usableMegabytes(0),
+    someStallPercent(-1.0f),
+    fullStallPercent(-1.0f),
+    stopMutex(),
+    stopSignal(),
+    stopRequested(false),
+    samplingThread() {
+    SampleNow();
+    this->samplingThread = std::thread(&MemoryPressureMonitor::sampleContinuously, this);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  MemoryPressureMonitor::~MemoryPressureMonitor() {
+    {
+      std::lock_guard<std::mutex> stopLock(this->stopMutex);
+      this->stopRequested = true;
+    }
+    this->stopSignal.notify_one();
+
+    this->samplingThread.join();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  MemoryPressure MemoryPressureMonitor::GetCurrentPressure() const noexcept {
+    MemoryPressure pressure;
+
+    std::size_t groupLimit = UnknownMegabytes;
+    std::size_t groupUsage = UnknownMegabytes;
+    float someStall = -1.0f;
+    float fullStall = -1.0f;
+    SequenceLockHelper::Read(
+      this->sequenceNumber,
+      [&]() {
+        pressure.TotalMegabytes = this->totalMegabytes.load(std::memory_order_relaxed);
+        pressure.AvailableMegabytes = this->availableMegabytes.load(std::memory_order_relaxed);
+        groupLimit = this->groupLimitMegabytes.load(std::memory_order_relaxed);
+        groupUsage = this->groupUsageMegabytes.load(std::memory_order_relaxed);
+        pressure.UsableMegabytes = this->usableMegabytes.load(std::memory_order_relaxed);
+        someStall = this->someStallPercent.load(std::memory_order_relaxed);
+        fullStall = this->fullStallPercent.load(std::memory_order_relaxed);
+      }
+    );
+
+    if(groupLimit == UnknownMegabytes) {
+      pressure.GroupLimitMegabytes.reset();
+    } else {
+      pressure.GroupLimitMegabytes = groupLimit;
+    }
+    if(groupUsage == UnknownMegabytes) {
+      pressure.GroupUsageMegabytes.reset();
+    } else {
+      pressure.GroupUsageMegabytes = groupUsage;
+    }
+    if(someStall < 0.0f) {
+      pressure.SomeStallPercent.reset();
+    } else {
+      pressure.SomeStallPercent = someStall;
+    }
+    if(fullStall < 0.0f) {
+      pressure.FullStallPercent.reset();
+    } else {
+      pressure.FullStallPercent = fullStall;
+    }
+
+    return pressure;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  MemoryPressure MemoryPressureMonitor::SampleNow() {
+    MemoryPressure pressure;
+    {
+      std::lock_guard<std::mutex> samplerLock(this->samplerMutex);
+      this->sampler->Sample(pressure);
+      publish(pressure);
+    }
+
+    return pressure;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void MemoryPressureMonitor::sampleContinuously() {
+    std::unique_lock<std::mutex> stopLock(this->stopMutex);
+    for(;;) {
+      bool stopping = this->stopSignal.wait_for(
+        stopLock, this->sampleInterval, [this]() { return this->stopRequested; }
+      );
+      if(stopping) {
+        break;
+      }
+
+      stopLock.unlock();
+      try {
+        SampleNow();
+      }
+      catch(const std::exception &) {
+        // Keep the last sample if the sources can't be read. We're in a background
+        // thread and there is nobody we could report the error to.
+      }
+      stopLock.lock();
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void MemoryPressureMonitor::publish(const MemoryPressure &pressure) noexcept {
+
+    // Only one thread publishes at a time (guarded by the sampler mutex)
+    SequenceLockHelper::Publish(
+      this->sequenceNumber,
+      [&]() {
+        this->totalMegabytes.store(pressure.TotalMegabytes, std::memory_order_relaxed);
+        this->availableMegabytes.store(pressure.AvailableMegabytes, std::memory_order_relaxed);
+        this->groupLimitMegabytes.store(
+          pressure.GroupLimitMegabytes.value_or(UnknownMegabytes), std::memory_order_relaxed
+        );
+        this->groupUsageMegabytes.store(
+          pressure.GroupUsageMegabytes.value_or(UnknownMegabytes), std::memory_order_relaxed
+        );
+        this->usableMegabytes.store(pressure.UsableMegabytes, std::memory_order_relaxed);
+        this->someStallPercent.store(
+          pressure.SomeStallPercent.value_or(-1.0f), std::memory_order_relaxed
+        );
+        this->fullStallPercent.store(
+          pressure.FullStallPercent.value_or(-1.0f), std::memory_order_relaxed
+        );
+      }
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
@@ -30,12 +30,30 @@ limitations under the License.
 #include <Nuclex/Support/Threading/StopToken.h> // for StopToken
 
 #include "./LinuxProcCpuInfoReader.h" // for LinuxProcCpuInfoReader
+#include "./LinuxSysCpuTreeReader.h" // for LinuxSysCpuTreeReader
+#include "./LinuxCgroupReader.h" // for LinuxCgroupReader
+#include "./CpuidCacheReader.h" // for CpuidCacheReader
+#include "../Platform/LinuxThreadApi.h" // for LinuxThreadApi
 #include "./StringHelper.h" // for StringHelper
 
+#include <algorithm> // for std::sort(), std::set_intersection()
+#include <cmath> // for std::floor()
+#include <iterator> // for std::back_inserter()
+#include <thread> // for std::thread::hardware_concurrency()
+#include <deque> // for std::deque
+#include <unordered_map> // for std::unordered_map
+#include <vector> // for std::vector
+#include <tuple> // for std::tie()
+
 namespace {
 
   // ------------------------------------------------------------------------------------------- //
 
+  /// <summary>Maximum number of threads that will be used to scan the sysfs tree</summary>
+  const std::size_t MaximumSysScanThreadCount = 8;
+
+  // ------------------------------------------------------------------------------------------- //
+
   /// <summary>
   ///   Trys to parse the CPU frequency from the CPU name string or takes the reported
   ///   frequency and convert it into GHz (guessing the unit if none is provided)
@@ -98,18 +116,349 @@ namespace {
 
   // ------------------------------------------------------------------------------------------- //
 
+  /// <summary>Informations about a processor as listed in /proc/cpuinfo</summary>
+  struct ProcCpuInfoProcessor {
+
+    /// <summary>Index of the processor as assigned by the kernel</summary>
+    public: std::size_t Index;
+    /// <summary>Id of the physical CPU, std::size_t(-1) if not listed</summary>
+    public: std::size_t PhysicalCpuId;
+    /// <summary>Id of the core within the physical CPU, std::size_t(-1) if not listed</summary>
+    public: std::size_t CoreId;
+    /// <summary>Make and model of the CPU as reported by the CPU itself</summary>
+    /// <remarks>Points to an entry in the model names of <see cref="ProcCpuInfo" /></remarks>
+    public: const std::string *Name;
+    /// <summary>Frequency the processor was running at, negative if not listed</summary>
+    public: double FrequencyInMhz;
+    /// <summary>Rough benchmark value of the processor, negative if not listed</summary>
+    public: double BogoMips;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Processors and model names listed in /proc/cpuinfo</summary>
+  struct ProcCpuInfo {
+
+    /// <summary>Distinct model names the processors reported</summary>
+    /// <remarks>
+    ///   All processors of a CPU report the same model name, so each one is only stored
+    ///   once. A deque is used because it doesn't move its elements when growing.
+    /// </remarks>
+    public: std::deque<std::string> ModelNames;
+    /// <summary>Processors in the order they were listed</summary>
+    public: std::vector<ProcCpuInfoProcessor> Processors;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Looks up or adds a model name to the list of distinct model names</summary>
+  /// <param name="modelNames">Distinct model names that have been encountered so far</param>
+  /// <param name="name">Model name that will be looked up</param>
+  /// <returns>The stored copy of the model name</returns>
+  const std::string *internModelName(
+    std::deque<std::string> &modelNames, const std::string_view &name
+  ) {
+
+    // Processors of the same CPU are listed one after another, so checking the most
+    // recent model name first nearly always finds it right away
+    std::deque<std::string>::reverse_iterator iterator = modelNames.rbegin();
+    while(iterator != modelNames.rend()) {
+      if(*iterator == name) {
+        return &(*iterator);
+      }
+      ++iterator;
+    }
+
+    return &modelNames.emplace_back(name);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Records a processor reported by the /proc/cpuinfo reader</summary>
+  /// <param name="procCpuInfoAsVoid">Processor list the processor will be added to</param>
+  /// <param name="processorIndex">Index of the processor</param>
+  /// <param name="physicalCpuId">Id of the physical CPU the processor belongs to</param>
+  /// <param name="coreId">Id of the core the processor belongs to</param>
+  /// <param name="name">Make and model of the CPU</param>
+  /// <param name="frequencyInMhz">Current frequency of the processor</param>
+  /// <param name="bogoMips">Rough benchmark value of the processor</param>
   void addProcessorFromProcCpuInfo(
-    void *userPointer,
+    void *procCpuInfoAsVoid,
     std::size_t processorIndex,
     std::size_t physicalCpuId,
     std::size_t coreId,
-    const std::string &name,
+    const std::string_view &name,
     double frequencyInMhz,
     double bogoMips
   ) {
-    std::string saneName = sanitizeCpuName(name);
-    double saneFrequency = sanitizeCpuFrequency(name, frequencyInMhz);
+    ProcCpuInfo &procCpuInfo = *reinterpret_cast<ProcCpuInfo *>(procCpuInfoAsVoid);
+    procCpuInfo.Processors.push_back(
+      ProcCpuInfoProcessor {
+        processorIndex,
+        physicalCpuId,
+        coreId,
+        internModelName(procCpuInfo.ModelNames, name),
+        frequencyInMhz,
+        bogoMips
+      }
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Informations about a processor as listed in sysfs</summary>
+  typedef Nuclex::Platform::Hardware::LinuxSysCpuTreeReader::ProcessorInfo SysProcessorInfo;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Places a logical processor within the CPU topology</summary>
+  struct ProcessorPlacement {
+
+    /// <summary>Id of the physical CPU the processor belongs to</summary>
+    public: std::size_t PackageId;
+    /// <summary>Key that is identical for all processors of the same core</summary>
+    public: std::size_t CoreKey;
+    /// <summary>Index of the processor as assigned by the kernel</summary>
+    public: std::size_t ProcessorIndex;
+    /// <summary>Informations from /proc/cpuinfo, null if the processor wasn't listed</summary>
+    public: const ProcCpuInfoProcessor *ProcInfo;
+    /// <summary>Informations from sysfs, null if the processor wasn't listed</summary>
+    public: const SysProcessorInfo *SysInfo;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Determines the nominal frequency of a core</summary>
+  /// <param name="placement">Placement of the core's first processor</param>
+  /// <returns>The nominal frequency of the core in MHz or 0 if unknown</returns>
+  double getNominalFrequencyInMhz(const ProcessorPlacement &placement) {
+    if(placement.SysInfo != nullptr) {
+      if(placement.SysInfo->BaseFrequencyInMHz.has_value()) {
+        return placement.SysInfo->BaseFrequencyInMHz.value();
+      }
+    }
+
+    // The make and model string of Intel CPUs contains the nominal frequency. If it
+    // doesn't, the maximum frequency is the best we have, failing that the current one.
+    double maxMhzSeen = 0.0;
+    if((placement.SysInfo != nullptr) && placement.SysInfo->MaximumFrequencyInMHz.has_value()) {
+      maxMhzSeen = placement.SysInfo->MaximumFrequencyInMHz.value();
+    } else if((placement.ProcInfo != nullptr) && (placement.ProcInfo->FrequencyInMhz > 0.0)) {
+      maxMhzSeen = placement.ProcInfo->FrequencyInMhz;
+    }
+    if(placement.ProcInfo != nullptr) {
+      return sanitizeCpuFrequency(*placement.ProcInfo->Name, maxMhzSeen) * 1000.0;
+    } else {
+      return maxMhzSeen;
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Assembles the CPU topology from the informations in /proc and sysfs</summary>
+  /// <param name="procProcessors">Processors listed in /proc/cpuinfo</param>
+  /// <param name="sysProcessors">Processors listed in sysfs</param>
+  /// <returns>A list of CpuInfos, one for each physical CPU present</returns>
+  /// <remarks>
+  ///   Only /proc/cpuinfo provides the model name and only sysfs is reliable about the
+  ///   topology (not all architectures list physical and core ids in /proc/cpuinfo),
+  ///   so we use sysfs for the layout and /proc/cpuinfo to fill in the blanks.
+  /// </remarks>
+  std::vector<Nuclex::Platform::Hardware::CpuInfo> assembleCpuTopology(
+    const std::vector<ProcCpuInfoProcessor> &procProcessors,
+    const std::vector<SysProcessorInfo> &sysProcessors
+  ) {
+    using Nuclex::Platform::Hardware::CpuInfo;
+    using Nuclex::Platform::Hardware::CoreInfo;
+    std::unordered_map<std::size_t, const ProcCpuInfoProcessor *> procProcessorsByIndex;
+    for(const ProcCpuInfoProcessor &procProcessor : procProcessors) {
+      procProcessorsByIndex.emplace(procProcessor.Index, &procProcessor);
+    }
+
+    // Figure out which package and core each processor belongs to
+    std::vector<ProcessorPlacement> placements;
+    if(sysProcessors.empty()) {
+      placements.reserve(procProcessors.size());
+      for(const ProcCpuInfoProcessor &procProcessor : procProcessors) {
+        ProcessorPlacement &placement = placements.emplace_back();
+        placement.PackageId = procProcessor.PhysicalCpuId;
+        if(procProcessor.CoreId == std::size_t(-1)) {
+          placement.CoreKey = procProcessor.Index; // Unknown core, count as its own
+        } else {
+          placement.CoreKey = procProcessor.CoreId;
+        }
+        placement.ProcessorIndex = procProcessor.Index;
+        placement.ProcInfo = &procProcessor;
+        placement.SysInfo = nullptr;
+      }
+    } else {
+      placements.reserve(sysProcessors.size());
+      for(const SysProcessorInfo &sysProcessor : sysProcessors) {
+        ProcessorPlacement &placement = placements.emplace_back();
+        placement.ProcessorIndex = sysProcessor.Index;
+        placement.CoreKey = sysProcessor.CoreProcessorIndices.front();
+        placement.SysInfo = &sysProcessor;
+
+        std::unordered_map<std::size_t, const ProcCpuInfoProcessor *>::const_iterator iterator = (
+          procProcessorsByIndex.find(sysProcessor.Index)
+        );
+        if(iterator == procProcessorsByIndex.end()) {
+          placement.ProcInfo = nullptr;
+        } else {
+          placement.ProcInfo = iterator->second;
+        }
+
+        placement.PackageId = sysProcessor.PackageId;
+        if((placement.PackageId == std::size_t(-1)) && (placement.ProcInfo != nullptr)) {
+          placement.PackageId = placement.ProcInfo->PhysicalCpuId;
+        }
+      }
+    }
+
+    // Processors without a known package are assumed to be on a single CPU
+    for(ProcessorPlacement &placement : placements) {
+      if(placement.PackageId == std::size_t(-1)) {
+        placement.PackageId = 0;
+      }
+    }
+
+    // Bring the processors into order so that each CPU and each core is one
+    // consecutive run of processors we can turn into a CpuInfo or CoreInfo.
+    std::sort(
+      placements.begin(), placements.end(),
+      [](const ProcessorPlacement &left, const ProcessorPlacement &right) {
+        return (
+          std::tie(left.PackageId, left.CoreKey, left.ProcessorIndex) <
+          std::tie(right.PackageId, right.CoreKey, right.ProcessorIndex)
+        );
+      }
+    );
+
+    std::vector<CpuInfo> cpuInfos;
+
+    std::size_t placementCount = placements.size();
+    for(std::size_t index = 0; index < placementCount; ++index) {
+      const ProcessorPlacement &placement = placements[index];
+
+      // Is this the first processor of a new physical CPU?
+      bool isNewCpu = (
+        (index == 0) || (placements[index - 1].PackageId != placement.PackageId)
+      );
+      if(isNewCpu) {
+        CpuInfo &newCpuInfo = cpuInfos.emplace_back();
+        newCpuInfo.CoreCount = 0;
+        newCpuInfo.ThreadCount = 0;
+      }
+      CpuInfo &cpuInfo = cpuInfos.back();
+
+      // CPUs with firmware bugs or emulated CPUs can leave the model name out,
+      // so we take the first one we can find among the processors
+      if(cpuInfo.ModelName.empty()) {
+        if((placement.ProcInfo != nullptr) && !placement.ProcInfo->Name->empty()) {
+          cpuInfo.ModelName = sanitizeCpuName(*placement.ProcInfo->Name);
+        }
+      }
+
+      ++cpuInfo.ThreadCount;
+
+      // Is this the first processor of a new core?
+      bool isNewCore = (
+        isNewCpu || (placements[index - 1].CoreKey != placement.CoreKey)
+      );
+      if(isNewCore) {
+        ++cpuInfo.CoreCount;
+
+        CoreInfo &newCoreInfo = cpuInfo.Cores.emplace_back();
+        newCoreInfo.FrequencyInMHz = getNominalFrequencyInMhz(placement);
+        if((placement.ProcInfo != nullptr) && (placement.ProcInfo->BogoMips >= 0.0)) {
+          newCoreInfo.BogoMips = static_cast<std::size_t>(placement.ProcInfo->BogoMips + 0.5);
+        }
+        newCoreInfo.ThreadCount = 0;
+        if(placement.SysInfo != nullptr) {
+          newCoreInfo.IsEcoCore = placement.SysInfo->IsEcoCore;
+          newCoreInfo.MinimumFrequencyInMHz = placement.SysInfo->MinimumFrequencyInMHz;
+          newCoreInfo.MaximumFrequencyInMHz = placement.SysInfo->MaximumFrequencyInMHz;
+          newCoreInfo.Caches = placement.SysInfo->Caches;
+        }
+
+        if(newCoreInfo.IsEcoCore.has_value()) {
+          std::size_t ecoCoreCount = cpuInfo.EcoCoreCount.value_or(0);
+          if(newCoreInfo.IsEcoCore.value()) {
+            ++ecoCoreCount;
+          }
+          cpuInfo.EcoCoreCount = ecoCoreCount;
+        }
+      }
+
+      ++cpuInfo.Cores.back().ThreadCount;
+      cpuInfo.Cores.back().ProcessorIndices.push_back(placement.ProcessorIndex);
+    }
+
+    // Give CPUs that didn't tell us their name at least a distinguishable one
+    for(std::size_t index = 0; index < cpuInfos.size(); ++index) {
+      if(cpuInfos[index].ModelName.empty()) {
+        cpuInfos[index].ModelName.assign(u8"CPU #", 5);
+        Nuclex::Support::Text::lexical_append(cpuInfos[index].ModelName, index + 1);
+      }
+    }
+
+    return cpuInfos;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Analyzes the CPU topology from /proc/cpuinfo and the sysfs tree</summary>
+  /// <param name="canceller">Allows the information collection to be cancelled</param>
+  /// <param name="sysScanThreadCount">
+  ///   Maximum number of threads (including the calling one) scanning the sysfs tree
+  /// </param>
+  /// <returns>A description of the system's CPU topology</returns>
+  std::vector<Nuclex::Platform::Hardware::CpuInfo> analyzeCpuTopology(
+    const std::shared_ptr<const Nuclex::Support::Threading::StopToken> &canceller,
+    std::size_t sysScanThreadCount
+  ) {
+    using Nuclex::Platform::Hardware::CpuInfo;
+    using Nuclex::Platform::Hardware::LinuxProcCpuInfoReader;
+    using Nuclex::Platform::Hardware::LinuxSysCpuTreeReader;
+    using Nuclex::Platform::Hardware::CpuidCacheReader;
+    using Nuclex::Platform::Hardware::InstructionSetSupport;
+    using Nuclex::Platform::Hardware::PlatformAppraiser;
+
+    // We may have been canceled before the thread got a chance to start,
+    // so it makes sense to check once before actually doing anything.
+    canceller->ThrowIfCanceled();
 
+    ProcCpuInfo procCpuInfo;
+    LinuxProcCpuInfoReader::TryReadCpuInfos(
+      &procCpuInfo, &addProcessorFromProcCpuInfo, canceller
+    );
+
+    canceller->ThrowIfCanceled();
+
+    // On machines with hundreds of processors, the sysfs scan takes long enough to be
+    // worth splitting up. The reader only fans out if there are enough processors.
+    std::vector<LinuxSysCpuTreeReader::ProcessorInfo> sysProcessors = (
+      LinuxSysCpuTreeReader::TryReadProcessors(u8"/sys/devices", sysScanThreadCount)
+    );
+
+    canceller->ThrowIfCanceled();
+
+    std::vector<CpuInfo> cpuInfos = assembleCpuTopology(procCpuInfo.Processors, sysProcessors);
+
+    // Some virtual machines and containers don't expose the cache directories in sysfs,
+    // in which case we ask the CPU itself (this has to be the last resort because CPUID
+    // can't tell which processors share a cache).
+    CpuidCacheReader::AddToCoresWithoutCaches(cpuInfos);
+
+    InstructionSetSupport instructionSets = PlatformAppraiser::QueryInstructionSets();
+    for(CpuInfo &cpuInfo : cpuInfos) {
+      cpuInfo.InstructionSets = instructionSets;
+    }
+
+    return cpuInfos;
   }
 
   // ------------------------------------------------------------------------------------------- //
@@ -123,17 +472,64 @@ namespace Nuclex { namespace Platform { namespace Hardware {
   std::vector<CpuInfo> PlatformAppraiser::analyzeCpuTopologyAsync(
     std::shared_ptr<const Support::Threading::StopToken> canceller
   ) {
-    // We may have been canceled before the thread got a chance to start,
-    // so it makes sense to check once before actually doing anything.
-    canceller->ThrowIfCanceled();
+    return analyzeCpuTopology(canceller, MaximumSysScanThreadCount);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
 
-    {
-      LinuxProcCpuInfoReader::TryReadCpuInfos(
-        nullptr, &addProcessorFromProcCpuInfo, canceller
+  std::vector<CpuInfo> PlatformAppraiser::analyzeCpuTopologyInPool(
+    std::shared_ptr<const Support::Threading::StopToken> canceller
+  ) {
+    return analyzeCpuTopology(canceller, 1);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  CpuBudget PlatformAppraiser::QueryCpuBudget() {
+    CpuBudget budget;
+    budget.AvailableProcessors = Platform::LinuxThreadApi::GetCpuAffinity();
+
+    // The affinity mask should already reflect the cgroup's cpuset, but a container
+    // runtime may have set the affinity before moving the process into its cgroup
+    std::string groupDirectory = LinuxCgroupReader::LocateOwnCgroup();
+    if(!groupDirectory.empty()) {
+      std::vector<std::size_t> effectiveCpus = (
+        LinuxCgroupReader::TryReadEffectiveCpus(groupDirectory)
+      );
+      if(!effectiveCpus.empty()) {
+        if(budget.AvailableProcessors.empty()) {
+          budget.AvailableProcessors.swap(effectiveCpus);
+        } else {
+          std::vector<std::size_t> intersection;
+          std::set_intersection(
+            budget.AvailableProcessors.begin(), budget.AvailableProcessors.end(),
+            effectiveCpus.begin(), effectiveCpus.end(),
+            std::back_inserter(intersection)
+          );
+          if(!intersection.empty()) {
+            budget.AvailableProcessors.swap(intersection);
+          }
+        }
+      }
+
+      budget.CpuQuota = LinuxCgroupReader::TryReadCpuQuota(u8"/sys/fs/cgroup", groupDirectory);
+    }
+
+    budget.UsableThreadCount = budget.AvailableProcessors.size();
+    if(budget.UsableThreadCount == 0) {
+      budget.UsableThreadCount = std::thread::hardware_concurrency();
+    }
+    // A fractional processor can't keep another thread busy without throttling
+    // all threads of the process, so partial processors are not counted
+    if(budget.CpuQuota.has_value()) {
+      std::size_t quotaThreadCount = static_cast<std::size_t>(
+        std::floor(budget.CpuQuota.value())
       );
+      budget.UsableThreadCount = std::min(budget.UsableThreadCount, quotaThreadCount);
     }
+    budget.UsableThreadCount = std::max(budget.UsableThreadCount, std::size_t(1));
 
-    return std::vector<CpuInfo>();
+    return budget;
   }
 
   // ------------------------------------------------------------------------------------------- //
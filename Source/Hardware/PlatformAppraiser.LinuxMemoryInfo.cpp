@@ -30,8 +30,11 @@ limitations under the License.
 #include <Nuclex/Support/Threading/StopToken.h> // for StopToken
 
 #include "./LinuxProcMemInfoReader.h" // for LinuxProcMemInfoReader
+#include "./LinuxMemoryPressureReader.h" // for LinuxMemoryPressureReader
 #include "./StringHelper.h" // for StringHelper
 
+#include <algorithm> // for std::min()
+
 namespace {
 
   // ------------------------------------------------------------------------------------------- //
@@ -78,6 +81,20 @@ namespace Nuclex { namespace Platform { namespace Hardware {
       result.InstalledMegabytes = reportedMegabytes;
     }
 
+    canceller->ThrowIfCanceled();
+
+    // Inside a container, the process will be OOM-killed long before it gets to use
+    // the host's memory, so if the cgroup has a memory limit, the program is bound by it.
+    {
+      MemoryPressure pressure;
+      LinuxMemoryPressureReader().Sample(pressure);
+      if(pressure.GroupLimitMegabytes.has_value()) {
+        result.MaximumProgramMegabytes = std::min(
+          result.MaximumProgramMegabytes, pressure.GroupLimitMegabytes.value()
+        );
+      }
+    }
+
     return result;
 
   }
@@ -24,14 +24,36 @@ limitations under the License.
 
 #if defined(NUCLEX_PLATFORM_LINUX)
 
-#include <Nuclex/Support/BitTricks.h> // for BitTricks
 #include <Nuclex/Support/Threading/StopToken.h> // for StopToken
 
-#include "./WindowsBasicVolumeInfoReader.h" // for WindowsBasicStoreInfoReader
+#include "./LinuxStoreInfoReader.h" // for LinuxStoreInfoReader
+#include "./ThroughputTestHelper.h" // for ThroughputTestHelper
+#include "../Platform/LinuxFileApi.h" // for LinuxFileApi
+#include "../Platform/PosixApi.h" // for PosixApi
+
+#include <chrono> // for std::chrono::steady_clock
+#include <cstdint> // for std::uint64_t
+#include <vector> // for std::vector
+
+#include <fcntl.h> // for ::posix_fadvise()
+#include <stdlib.h> // for ::mkstemp()
+#include <unistd.h> // for ::unlink()
 
 namespace {
 
   // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Writes the test file to disk and evicts it from the page cache</summary>
+  /// <param name="fileDescriptor">Descriptor of the test file</param>
+  /// <param name="accessPattern">Access pattern to announce for the following reads</param>
+  void dropFromPageCache(int fileDescriptor, int accessPattern) {
+    Nuclex::Platform::Platform::LinuxFileApi::Flush(fileDescriptor);
+
+    // These are only hints, if the kernel ignores them, we'll measure the page cache
+    ::posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_DONTNEED);
+    ::posix_fadvise(fileDescriptor, 0, 0, accessPattern);
+  }
+
   // ------------------------------------------------------------------------------------------- //
 
 } // anonymous namespace
@@ -43,13 +65,107 @@ namespace Nuclex { namespace Platform { namespace Hardware {
   std::vector<StoreInfo> PlatformAppraiser::analyzeStorageVolumesAsync(
     std::shared_ptr<const Support::Threading::StopToken> canceller
   ) {
-    std::vector<StoreInfo> result;
+    return LinuxStoreInfoReader::TryReadStores(canceller);
+  }
 
-    //WindowsBasicVolumeInfoReader r;
-    //r.EnumerateWindowsVolumes();
-    throw new std::runtime_error(u8"Not implemented yet.");
+  // ------------------------------------------------------------------------------------------- //
 
-    return result;
+  StoreThroughput PlatformAppraiser::measureStoreThroughputAsync(
+    std::string directory,
+    std::size_t testFileMegabytes,
+    std::shared_ptr<const Support::Threading::StopToken> canceller
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+    using Nuclex::Platform::Platform::FileDescriptorClosingScope;
+    typedef ThroughputTestHelper Helper;
+
+    // Create the test file and unlink it right away. It stays accessible through
+    // the file descriptor and the file system will reclaim it once it is closed,
+    // even if the process crashes in the middle of the measurement.
+    int fileDescriptor;
+    {
+      std::string path = LinuxFileApi::JoinPaths(directory, u8".nuclex-throughput-XXXXXX");
+      fileDescriptor = ::mkstemp(path.data());
+      if(unlikely(fileDescriptor == -1)) {
+        int errorNumber = errno;
+
+        std::string errorMessage(u8"Could not create throughput test file in '", 42);
+        errorMessage.append(directory);
+        errorMessage.append(u8"'", 1);
+        Platform::PosixApi::ThrowExceptionForSystemError(errorMessage, errorNumber);
+      }
+
+      ::unlink(path.c_str());
+    }
+    FileDescriptorClosingScope closeTestFile(fileDescriptor);
+
+    StoreThroughput throughput;
+    throughput.TestFileSize = testFileMegabytes * Helper::SequentialBlockSize;
+    throughput.RandomReadSize = Helper::RandomBlockSize;
+
+    std::vector<std::uint8_t> buffer(Helper::SequentialBlockSize);
+    std::uint64_t randomState = Helper::InitialRandomState;
+    for(std::size_t index = 0; index < testFileMegabytes; ++index) {
+      canceller->ThrowIfCanceled();
+      Helper::FillWithNoise(buffer.data(), Helper::SequentialBlockSize, randomState);
+      LinuxFileApi::Write(fileDescriptor, buffer.data(), Helper::SequentialBlockSize);
+    }
+
+    // Sequential read test, reading the whole file in large chunks
+    dropFromPageCache(fileDescriptor, POSIX_FADV_SEQUENTIAL);
+    {
+      LinuxFileApi::Seek(fileDescriptor, 0, SEEK_SET);
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for(std::size_t index = 0; index < testFileMegabytes; ++index) {
+        canceller->ThrowIfCanceled();
+        LinuxFileApi::Read(fileDescriptor, buffer.data(), Helper::SequentialBlockSize);
+      }
+      double seconds = Helper::GetElapsedSeconds(start, std::chrono::steady_clock::now());
+
+      throughput.SequentialReadMegabytesPerSecond = (
+        static_cast<double>(testFileMegabytes) / seconds
+      );
+    }
+
+    // Random access test, reading small blocks from all over the file. This takes
+    // ages on hard drives, so it is stopped after a fixed amount of time.
+    dropFromPageCache(fileDescriptor, POSIX_FADV_RANDOM);
+    {
+      std::size_t blockCount = throughput.TestFileSize / Helper::RandomBlockSize;
+      std::size_t readCount = 0;
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      std::chrono::steady_clock::time_point end = start;
+      while(readCount < Helper::MaximumRandomReadCount) {
+        std::size_t blockIndex = static_cast<std::size_t>(
+          Helper::NextRandomNumber(randomState) % blockCount
+        );
+        LinuxFileApi::Seek(
+          fileDescriptor, static_cast<::off_t>(blockIndex * Helper::RandomBlockSize), SEEK_SET
+        );
+        LinuxFileApi::Read(fileDescriptor, buffer.data(), Helper::RandomBlockSize);
+        ++readCount;
+
+        if((readCount % 16) == 0) {
+          canceller->ThrowIfCanceled();
+          end = std::chrono::steady_clock::now();
+          if(end - start >= Helper::RandomReadTimeLimit) {
+            break;
+          }
+        }
+      }
+      end = std::chrono::steady_clock::now();
+      double seconds = Helper::GetElapsedSeconds(start, end);
+
+      throughput.RandomReadsPerSecond = static_cast<double>(readCount) / seconds;
+      throughput.RandomReadMegabytesPerSecond = (
+        throughput.RandomReadsPerSecond * static_cast<double>(Helper::RandomBlockSize) /
+        static_cast<double>(Helper::SequentialBlockSize)
+      );
+    }
+
+    return throughput;
   }
 
   // ------------------------------------------------------------------------------------------- //
@@ -33,11 +33,15 @@ limitations under the License.
 #include "./WindowsBasicCpuInfoReader.h"
 #include "./WindowsRegistryCpuInfoReader.h"
 #include "./WindowsWmiCpuInfoReader.h"
+#include "./CpuidCacheReader.h" // for CpuidCacheReader
 
 #include "./StringHelper.h" // for StringHelper
 
+#include "../Platform/WindowsApi.h" // for ::GetProcessAffinityMask()
+
 #include <vector> // for std::vector
 #include <unordered_map> // for std::unordered_map
+#include <thread> // for std::thread::hardware_concurrency()
 
 namespace {
 
@@ -391,31 +395,78 @@ namespace Nuclex { namespace Platform { namespace Hardware {
     }
 
     // If we got everything in this way and it seems okay, we package it up and return it.
+    std::vector<CpuInfo> cpuInfos;
     if(cpuInformationFromRegistrySeemsPlausible) {
-      return topologyFromBasicCpuInfo(cpuInfoReader, true);
+      cpuInfos = topologyFromBasicCpuInfo(cpuInfoReader, true);
+    } else {
+
+      // Step 3: If the registry couldn't provide all the information, try WMI
+      // (note that this is already the backup route and if it throws an exception,
+      // the OS actually failed hard at issuing a WMI query - so treat our attempt
+      // at returning incomplete information as a kind of error response :D)
+      try {
+        WindowsWmiCpuInfoReader::TryQueryCpuInfos(
+          &cpuInfos,
+          &createCpuInfoFromWmiCallback,
+          canceller
+        );
+      }
+      catch(const std::exception &) {
+        // If the WMI query failed for any reason, fall back to the basic cpu info
+        // but ignore the enhanced info from the registry (those fields are in an
+        // undefined state since the registry-source info enhancement failed)
+        cpuInfos = topologyFromBasicCpuInfo(cpuInfoReader, false);
+      }
+
     }
 
-    // Step 3: If the registry couldn't provide all the information, try WMI
-    // (note that this is already the backup route and if it throws an exception,
-    // the OS actually failed hard at issuing a WMI query - so treat our attempt
-    // at returning incomplete information as a kind of error response :D)
-    try {
-      std::vector<CpuInfo> cpuInfos;
+    // Step 4: None of the above report the caches, so ask the CPU itself
+    CpuidCacheReader::AddToCoresWithoutCaches(cpuInfos);
 
-      WindowsWmiCpuInfoReader::TryQueryCpuInfos(
-        &cpuInfos,
-        &createCpuInfoFromWmiCallback,
-        canceller
-      );
+    InstructionSetSupport instructionSets = QueryInstructionSets();
+    for(CpuInfo &cpuInfo : cpuInfos) {
+      cpuInfo.InstructionSets = instructionSets;
+    }
+
+    return cpuInfos;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
 
-      return cpuInfos;
+  std::vector<CpuInfo> PlatformAppraiser::analyzeCpuTopologyInPool(
+    std::shared_ptr<const Nuclex::Support::Threading::StopToken> canceller
+  ) {
+    return analyzeCpuTopologyAsync(canceller); // Doesn't start any threads on Windows
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  CpuBudget PlatformAppraiser::QueryCpuBudget() {
+    CpuBudget budget;
+
+    // The affinity mask only covers the process' processor group, so on systems
+    // with more than 64 processors, this reports the processors of one group.
+    // Job object CPU rate limits are not looked at yet.
+    DWORD_PTR processAffinityMask, systemAffinityMask;
+    BOOL result = ::GetProcessAffinityMask(
+      ::GetCurrentProcess(), &processAffinityMask, &systemAffinityMask
+    );
+    if(result != FALSE) {
+      for(std::size_t index = 0; index < sizeof(DWORD_PTR) * 8; ++index) {
+        if((processAffinityMask & (DWORD_PTR(1) << index)) != 0) {
+          budget.AvailableProcessors.push_back(index);
+        }
+      }
     }
-    catch(const std::exception &) {
-      // If the WMI query failed for any reason, fall back to the basic cpu info
-      // but ignore the enhanced info from the registry (those fields are in an
-      // undefined state since the registry-source info enhancement failed)
-      return topologyFromBasicCpuInfo(cpuInfoReader, false);
+
+    budget.UsableThreadCount = budget.AvailableProcessors.size();
+    if(budget.UsableThreadCount == 0) {
+      budget.UsableThreadCount = std::max(
+        std::size_t(std::thread::hardware_concurrency()), std::size_t(1)
+      );
     }
+
+    return budget;
   }
 
   // ------------------------------------------------------------------------------------------- //
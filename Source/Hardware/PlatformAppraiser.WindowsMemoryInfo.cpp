@@ -74,6 +74,34 @@ namespace Nuclex { namespace Platform { namespace Hardware {
       )
     );
 
+    // Windows allocates large pages on demand (for processes holding the 'lock pages
+    // in memory' privilege), so there is no reserved pool we could report on.
+    result.HugePageKilobytes = ::GetLargePageMinimum() / 1024;
+    result.HugePageTotalCount = 0;
+    result.HugePageFreeCount = 0;
+    result.TransparentHugePages = TransparentHugePageMode::Unsupported;
+
+    canceller->ThrowIfCanceled();
+
+    // Report the free memory on each NUMA node. If a node can't be queried, we simply
+    // list it with zero free memory rather than failing the whole memory appraisal.
+    {
+      ULONG highestNodeNumber;
+      BOOL succeeded = ::GetNumaHighestNodeNumber(&highestNodeNumber);
+      if(succeeded != FALSE) {
+        result.NodeFreeMegabytes.resize(static_cast<std::size_t>(highestNodeNumber) + 1, 0);
+        for(USHORT nodeIndex = 0; nodeIndex <= highestNodeNumber; ++nodeIndex) {
+          ULONGLONG availableBytes;
+          succeeded = ::GetNumaAvailableMemoryNodeEx(nodeIndex, &availableBytes);
+          if(succeeded != FALSE) {
+            result.NodeFreeMegabytes[nodeIndex] = static_cast<std::size_t>(
+              availableBytes / (1024 * 1024)
+            );
+          }
+        }
+      }
+    }
+
     return result;
   }
 
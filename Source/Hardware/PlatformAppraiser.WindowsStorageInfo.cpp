@@ -27,11 +27,92 @@ limitations under the License.
 #include <Nuclex/Support/BitTricks.h> // for BitTricks
 #include <Nuclex/Support/Threading/StopToken.h> // for StopToken
 
+#include <Nuclex/Support/Text/StringConverter.h> // for StringConverter
+
 #include "./WindowsBasicVolumeInfoReader.h" // for WindowsBasicStoreInfoReader
+#include "./ThroughputTestHelper.h" // for ThroughputTestHelper
+#include "../Platform/WindowsApi.h" // for WindowsApi
+
+#include <chrono> // for std::chrono::steady_clock
+#include <cstdint> // for std::uint64_t
 
 namespace {
 
   // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Closes a file handle when the scope is left</summary>
+  class TestFileClosingScope {
+
+    /// <summary>Initializes a new scope that will close the specified file</summary>
+    /// <param name="fileHandle">Handle of the file that will be closed</param>
+    public: TestFileClosingScope(::HANDLE fileHandle) :
+      fileHandle(fileHandle) {}
+
+    /// <summary>Closes the file</summary>
+    public: ~TestFileClosingScope() {
+      ::CloseHandle(this->fileHandle);
+    }
+
+    /// <summary>Handle of the file that will be closed</summary>
+    private: ::HANDLE fileHandle;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Frees memory allocated via VirtualAlloc() when the scope is left</summary>
+  class VirtualMemoryFreeingScope {
+
+    /// <summary>Initializes a new scope that will free the specified memory</summary>
+    /// <param name="memory">Memory that will be freed</param>
+    public: VirtualMemoryFreeingScope(void *memory) :
+      memory(memory) {}
+
+    /// <summary>Frees the memory</summary>
+    public: ~VirtualMemoryFreeingScope() {
+      ::VirtualFree(this->memory, 0, MEM_RELEASE);
+    }
+
+    /// <summary>Memory that will be freed</summary>
+    private: void *memory;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads or writes a block of the test file at the specified offset</summary>
+  /// <param name="fileHandle">Handle of the test file</param>
+  /// <param name="buffer">Buffer holding or receiving the data</param>
+  /// <param name="byteCount">Number of bytes that will be transferred</param>
+  /// <param name="offset">Offset in the file at which the transfer will take place</param>
+  /// <param name="write">True to write the buffer into the file, false to read</param>
+  void transferBlock(
+    ::HANDLE fileHandle, std::uint8_t *buffer, std::size_t byteCount,
+    std::uint64_t offset, bool write
+  ) {
+    ::OVERLAPPED overlapped = {};
+    overlapped.Offset = static_cast<DWORD>(offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+    DWORD transferredByteCount;
+    BOOL result;
+    if(write) {
+      result = ::WriteFile(
+        fileHandle, buffer, static_cast<DWORD>(byteCount), &transferredByteCount, &overlapped
+      );
+    } else {
+      result = ::ReadFile(
+        fileHandle, buffer, static_cast<DWORD>(byteCount), &transferredByteCount, &overlapped
+      );
+    }
+    if(unlikely(result == FALSE)) {
+      DWORD errorCode = ::GetLastError();
+      Nuclex::Platform::Platform::WindowsApi::ThrowExceptionForSystemError(
+        u8"Could not access throughput test file", errorCode
+      );
+    }
+  }
+
   // ------------------------------------------------------------------------------------------- //
 
 } // anonymous namespace
@@ -53,6 +134,129 @@ namespace Nuclex { namespace Platform { namespace Hardware {
 
   // ------------------------------------------------------------------------------------------- //
 
+  StoreThroughput PlatformAppraiser::measureStoreThroughputAsync(
+    std::string directory,
+    std::size_t testFileMegabytes,
+    std::shared_ptr<const Support::Threading::StopToken> canceller
+  ) {
+    using Nuclex::Support::Text::StringConverter;
+    typedef ThroughputTestHelper Helper;
+
+    // The test file bypasses the file system cache entirely, so there's no need to
+    // evict it after writing. It is deleted by the system when the handle is closed.
+    ::HANDLE fileHandle;
+    {
+      std::wstring path = StringConverter::WideFromUtf8(directory);
+      if(!path.empty() && (path.back() != L'\\') && (path.back() != L'/')) {
+        path.push_back(L'\\');
+      }
+      path.append(L".nuclex-throughput-");
+      path.append(std::to_wstring(::GetCurrentProcessId()));
+      path.append(L"-");
+      path.append(std::to_wstring(::GetTickCount64()));
+
+      fileHandle = ::CreateFileW(
+        path.c_str(),
+        GENERIC_READ | GENERIC_WRITE,
+        0,
+        nullptr,
+        CREATE_NEW,
+        (
+          FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE |
+          FILE_FLAG_NO_BUFFERING | FILE_FLAG_WRITE_THROUGH
+        ),
+        nullptr
+      );
+      if(unlikely(fileHandle == INVALID_HANDLE_VALUE)) {
+        DWORD errorCode = ::GetLastError();
+
+        std::string errorMessage(u8"Could not create throughput test file in '", 42);
+        errorMessage.append(directory);
+        errorMessage.append(u8"'", 1);
+        Platform::WindowsApi::ThrowExceptionForSystemError(errorMessage, errorCode);
+      }
+    }
+    TestFileClosingScope closeTestFile(fileHandle);
+
+    // Unbuffered I/O needs sector-aligned buffers, VirtualAlloc() gives us whole pages
+    std::uint8_t *buffer = reinterpret_cast<std::uint8_t *>(
+      ::VirtualAlloc(nullptr, Helper::SequentialBlockSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE)
+    );
+    if(unlikely(buffer == nullptr)) {
+      DWORD errorCode = ::GetLastError();
+      Platform::WindowsApi::ThrowExceptionForSystemError(
+        u8"Could not allocate buffer for throughput test", errorCode
+      );
+    }
+    VirtualMemoryFreeingScope freeBuffer(buffer);
+
+    StoreThroughput throughput;
+    throughput.TestFileSize = testFileMegabytes * Helper::SequentialBlockSize;
+    throughput.RandomReadSize = Helper::RandomBlockSize;
+
+    // Fill the test file with noise so compressing file systems can't shrink it
+    std::uint64_t randomState = Helper::InitialRandomState;
+    for(std::size_t index = 0; index < testFileMegabytes; ++index) {
+      canceller->ThrowIfCanceled();
+      Helper::FillWithNoise(buffer, Helper::SequentialBlockSize, randomState);
+      transferBlock(
+        fileHandle, buffer, Helper::SequentialBlockSize,
+        std::uint64_t(index) * Helper::SequentialBlockSize, true
+      );
+    }
+
+    // Sequential read test, reading the whole file in large chunks
+    {
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for(std::size_t index = 0; index < testFileMegabytes; ++index) {
+        canceller->ThrowIfCanceled();
+        transferBlock(
+          fileHandle, buffer, Helper::SequentialBlockSize,
+          std::uint64_t(index) * Helper::SequentialBlockSize, false
+        );
+      }
+      double seconds = Helper::GetElapsedSeconds(start, std::chrono::steady_clock::now());
+
+      throughput.SequentialReadMegabytesPerSecond = (
+        static_cast<double>(testFileMegabytes) / seconds
+      );
+    }
+
+    // Random access test, reading small blocks from all over the file. This takes
+    // ages on hard drives, so it is stopped after a fixed amount of time.
+    {
+      std::size_t blockCount = throughput.TestFileSize / Helper::RandomBlockSize;
+      std::size_t readCount = 0;
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      while(readCount < Helper::MaximumRandomReadCount) {
+        std::uint64_t blockIndex = Helper::NextRandomNumber(randomState) % blockCount;
+        transferBlock(
+          fileHandle, buffer, Helper::RandomBlockSize, blockIndex * Helper::RandomBlockSize, false
+        );
+        ++readCount;
+
+        if((readCount % 16) == 0) {
+          canceller->ThrowIfCanceled();
+          if(std::chrono::steady_clock::now() - start >= Helper::RandomReadTimeLimit) {
+            break;
+          }
+        }
+      }
+      double seconds = Helper::GetElapsedSeconds(start, std::chrono::steady_clock::now());
+
+      throughput.RandomReadsPerSecond = static_cast<double>(readCount) / seconds;
+      throughput.RandomReadMegabytesPerSecond = (
+        throughput.RandomReadsPerSecond * static_cast<double>(Helper::RandomBlockSize) /
+        static_cast<double>(Helper::SequentialBlockSize)
+      );
+    }
+
+    return throughput;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
 }}} // namespace Nuclex::Platform::Hardware
 
 #endif // defined(NUCLEX_PLATFORM_WINDOWS)
@@ -22,12 +22,184 @@ limitations under the License.
 
 #include "Nuclex/Platform/Hardware/PlatformAppraiser.h"
 
+#include "Nuclex/Platform/Tasks/Task.h" // for Task
+#include "Nuclex/Platform/Tasks/TaskCoordinator.h" // for TaskCoordinator
+#include "Nuclex/Platform/Tasks/ResourceManifest.h" // for ResourceManifest
+
+#include "./InstructionSetReader.h" // for InstructionSetReader
+
 #include <Nuclex/Support/Threading/StopToken.h>
+#include <Nuclex/Support/Threading/StopSource.h>
+#include <Nuclex/Support/Threading/ThreadPool.h> // for ThreadPool
+
+#include <algorithm> // for std::max()
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Provides a stop token that will never be canceled if none is given</summary>
+  /// <param name="canceller">Stop token provided by the caller, can be empty</param>
+  /// <returns>The caller's stop token or a stop token that is never canceled</returns>
+  /// <remarks>
+  ///   The analysis methods check for cancellation unconditionally, so rather than
+  ///   litter them with null checks, we hand them a dummy when the caller passed none.
+  /// </remarks>
+  std::shared_ptr<const Nuclex::Support::Threading::StopToken> cancellerOrDummy(
+    const std::shared_ptr<const Nuclex::Support::Threading::StopToken> &canceller
+  ) {
+    if(canceller) {
+      return canceller;
+    } else {
+      return Nuclex::Support::Threading::StopSource::Create()->GetToken();
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Task that runs one of the platform appraiser's analysis methods</summary>
+  /// <typeparam name="TResult">Type of result the analysis method provides</typeparam>
+  template<typename TResult>
+  class AppraisalTask : public Nuclex::Platform::Tasks::Task {
+
+    /// <summary>Signature of the analysis methods</summary>
+    public: typedef TResult AnalysisMethod(
+      std::shared_ptr<const Nuclex::Support::Threading::StopToken> canceller
+    );
+
+    /// <summary>Initializes a new appraisal task</summary>
+    /// <param name="analysisMethod">Analysis method the task will run</param>
+    /// <param name="canceller">Stop token that will be passed to the analysis method</param>
+    public: AppraisalTask(
+      AnalysisMethod *analysisMethod,
+      const std::shared_ptr<const Nuclex::Support::Threading::StopToken> &canceller
+    ) :
+      analysisMethod(analysisMethod),
+      canceller(canceller),
+      promise() {
+      this->Resources = Nuclex::Platform::Tasks::ResourceManifest::Create(
+        Nuclex::Platform::Tasks::ResourceType::CpuCores, 1
+      );
+    }
+
+    /// <summary>Provides the future through which the result will be delivered</summary>
+    /// <returns>The future that will receive the analysis method's result</returns>
+    public: std::future<TResult> GetFuture() {
+      return this->promise.get_future();
+    }
+
+    /// <summary>Runs the analysis method and delivers its result to the future</summary>
+    /// <param name="resourceUnitIndices">Resource units assigned to the task (unused)</param>
+    /// <param name="cancellationWatcher">Reports if the task coordinator shuts down</param>
+    public: void Run(
+      const Nuclex::Platform::Tasks::ResourceUnitArray &resourceUnitIndices,
+      const Nuclex::Support::Threading::StopToken &cancellationWatcher
+    ) noexcept override {
+      (void)resourceUnitIndices;
+      try {
+        cancellationWatcher.ThrowIfCanceled();
+        this->promise.set_value(this->analysisMethod(this->canceller));
+      }
+      catch(...) {
+        this->promise.set_exception(std::current_exception());
+      }
+    }
+
+    /// <summary>Analysis method the task will run</summary>
+    private: AnalysisMethod *analysisMethod;
+    /// <summary>Stop token that will be passed to the analysis method</summary>
+    private: std::shared_ptr<const Nuclex::Support::Threading::StopToken> canceller;
+    /// <summary>Promise through which the result will be delivered</summary>
+    private: std::promise<TResult> promise;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Schedules an analysis method as a task on a task coordinator</summary>
+  /// <typeparam name="TResult">Type of result the analysis method provides</typeparam>
+  /// <param name="taskCoordinator">Task coordinator that will run the analysis</param>
+  /// <param name="analysisMethod">Analysis method that will be run</param>
+  /// <param name="canceller">Stop token that will be passed to the analysis method</param>
+  /// <returns>A future that will receive the analysis method's result</returns>
+  template<typename TResult>
+  std::future<TResult> scheduleAppraisal(
+    Nuclex::Platform::Tasks::TaskCoordinator &taskCoordinator,
+    typename AppraisalTask<TResult>::AnalysisMethod *analysisMethod,
+    const std::shared_ptr<const Nuclex::Support::Threading::StopToken> &canceller
+  ) {
+    std::shared_ptr<AppraisalTask<TResult>> task = std::make_shared<AppraisalTask<TResult>>(
+      analysisMethod, canceller
+    );
+    std::future<TResult> result = task->GetFuture();
+
+    taskCoordinator.Schedule(task);
+
+    return result;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Combines the futures of the individual analyses into one</summary>
+  /// <param name="cpuTopology">Future that will provide the CPU topology</param>
+  /// <param name="memory">Future that will provide the memory description</param>
+  /// <param name="storageVolumes">Future that will provide the storage volumes</param>
+  /// <returns>A deferred future that collects the results of all analyses</returns>
+  /// <remarks>
+  ///   Using a deferred future means no thread has to sit and wait for the analyses,
+  ///   the results are collected in the thread that calls the future's get() method.
+  /// </remarks>
+  std::future<Nuclex::Platform::Hardware::PlatformInfo> combineAppraisals(
+    std::future<std::vector<Nuclex::Platform::Hardware::CpuInfo>> &&cpuTopology,
+    std::future<Nuclex::Platform::Hardware::MemoryInfo> &&memory,
+    std::future<std::vector<Nuclex::Platform::Hardware::StoreInfo>> &&storageVolumes,
+    std::future<std::vector<Nuclex::Platform::Hardware::GpuInfo>> &&gpus
+  ) {
+    using Nuclex::Platform::Hardware::CpuInfo;
+    using Nuclex::Platform::Hardware::MemoryInfo;
+    using Nuclex::Platform::Hardware::StoreInfo;
+    using Nuclex::Platform::Hardware::GpuInfo;
+    using Nuclex::Platform::Hardware::PlatformInfo;
+
+    return std::async(
+      std::launch::deferred,
+      [](
+        std::future<std::vector<CpuInfo>> cpuTopology,
+        std::future<MemoryInfo> memory,
+        std::future<std::vector<StoreInfo>> storageVolumes,
+        std::future<std::vector<GpuInfo>> gpus
+      ) {
+        PlatformInfo result;
+        result.CpuTopology = cpuTopology.get();
+        result.Memory = memory.get();
+        result.StorageVolumes = storageVolumes.get();
+        result.Gpus = gpus.get();
+        return result;
+      },
+      std::move(cpuTopology), std::move(memory), std::move(storageVolumes), std::move(gpus)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
 
 namespace Nuclex { namespace Platform { namespace Hardware {
 
   // ------------------------------------------------------------------------------------------- //
 
+  InstructionSetSupport PlatformAppraiser::QueryInstructionSets() {
+
+    // Function-local statics are initialized exactly once, even if multiple threads
+    // call in at the same time, and the CPU won't learn new instructions while we run.
+    static const InstructionSetSupport supportedInstructionSets = (
+      InstructionSetReader::ReadSupportedInstructionSets()
+    );
+    return supportedInstructionSets;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
   std::future<std::vector<CpuInfo>> PlatformAppraiser::AnalyzeCpuTopology(
     const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
       std::shared_ptr<const Tasks::StopToken>()
@@ -35,7 +207,7 @@ namespace Nuclex { namespace Platform { namespace Hardware {
   ) {
     return std::async(
       std::launch::async,
-      &PlatformAppraiser::analyzeCpuTopologyAsync, canceller
+      &PlatformAppraiser::analyzeCpuTopologyAsync, cancellerOrDummy(canceller)
     );
   }
 
@@ -48,7 +220,7 @@ namespace Nuclex { namespace Platform { namespace Hardware {
   ) {
     return std::async(
       std::launch::async,
-      &PlatformAppraiser::analyzeMemoryAsync, canceller
+      &PlatformAppraiser::analyzeMemoryAsync, cancellerOrDummy(canceller)
     );
   }
 
@@ -61,7 +233,226 @@ namespace Nuclex { namespace Platform { namespace Hardware {
   ) {
     return std::async(
       std::launch::async,
-      &PlatformAppraiser::analyzeStorageVolumesAsync, canceller
+      &PlatformAppraiser::analyzeStorageVolumesAsync, cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<std::vector<GpuInfo>> PlatformAppraiser::AnalyzeGpus(
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return std::async(
+      std::launch::async,
+      &PlatformAppraiser::analyzeGpusAsync, cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+  std::future<std::vector<CpuInfo>> PlatformAppraiser::AnalyzeCpuTopology(
+    Support::Threading::ThreadPool &threadPool,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return threadPool.Schedule(
+      &PlatformAppraiser::analyzeCpuTopologyInPool, cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<std::vector<CpuInfo>> PlatformAppraiser::AnalyzeCpuTopology(
+    Tasks::TaskCoordinator &taskCoordinator,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return scheduleAppraisal<std::vector<CpuInfo>>(
+      taskCoordinator, &PlatformAppraiser::analyzeCpuTopologyInPool, cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<MemoryInfo> PlatformAppraiser::AnalyzeMemory(
+    Support::Threading::ThreadPool &threadPool,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return threadPool.Schedule(
+      &PlatformAppraiser::analyzeMemoryAsync, cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<MemoryInfo> PlatformAppraiser::AnalyzeMemory(
+    Tasks::TaskCoordinator &taskCoordinator,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return scheduleAppraisal<MemoryInfo>(
+      taskCoordinator, &PlatformAppraiser::analyzeMemoryAsync, cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<std::vector<StoreInfo>> PlatformAppraiser::AnalyzeStorageVolumes(
+    Support::Threading::ThreadPool &threadPool,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return threadPool.Schedule(
+      &PlatformAppraiser::analyzeStorageVolumesAsync, cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<std::vector<StoreInfo>> PlatformAppraiser::AnalyzeStorageVolumes(
+    Tasks::TaskCoordinator &taskCoordinator,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return scheduleAppraisal<std::vector<StoreInfo>>(
+      taskCoordinator, &PlatformAppraiser::analyzeStorageVolumesAsync, cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<std::vector<GpuInfo>> PlatformAppraiser::AnalyzeGpus(
+    Support::Threading::ThreadPool &threadPool,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return threadPool.Schedule(
+      &PlatformAppraiser::analyzeGpusAsync, cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<std::vector<GpuInfo>> PlatformAppraiser::AnalyzeGpus(
+    Tasks::TaskCoordinator &taskCoordinator,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return scheduleAppraisal<std::vector<GpuInfo>>(
+      taskCoordinator, &PlatformAppraiser::analyzeGpusAsync, cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<PlatformInfo> PlatformAppraiser::AnalyzeAll(
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return combineAppraisals(
+      AnalyzeCpuTopology(canceller),
+      AnalyzeMemory(canceller),
+      AnalyzeStorageVolumes(canceller),
+      AnalyzeGpus(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<PlatformInfo> PlatformAppraiser::AnalyzeAll(
+    Support::Threading::ThreadPool &threadPool,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return combineAppraisals(
+      AnalyzeCpuTopology(threadPool, canceller),
+      AnalyzeMemory(threadPool, canceller),
+      AnalyzeStorageVolumes(threadPool, canceller),
+      AnalyzeGpus(threadPool, canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<PlatformInfo> PlatformAppraiser::AnalyzeAll(
+    Tasks::TaskCoordinator &taskCoordinator,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return combineAppraisals(
+      AnalyzeCpuTopology(taskCoordinator, canceller),
+      AnalyzeMemory(taskCoordinator, canceller),
+      AnalyzeStorageVolumes(taskCoordinator, canceller),
+      AnalyzeGpus(taskCoordinator, canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<StoreThroughput> PlatformAppraiser::MeasureStoreThroughput(
+    const std::string &directory,
+    std::size_t testFileMegabytes /* = 64 */,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return std::async(
+      std::launch::async,
+      &PlatformAppraiser::measureStoreThroughputAsync,
+      directory, std::max(testFileMegabytes, std::size_t(1)), cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<ClockInfo> PlatformAppraiser::MeasureClocks(
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return std::async(
+      std::launch::async,
+      &PlatformAppraiser::measureClocksAsync,
+      cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<ClockInfo> PlatformAppraiser::MeasureClocks(
+    Support::Threading::ThreadPool &threadPool,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return threadPool.Schedule(
+      &PlatformAppraiser::measureClocksAsync, cancellerOrDummy(canceller)
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<ClockInfo> PlatformAppraiser::MeasureClocks(
+    Tasks::TaskCoordinator &taskCoordinator,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Tasks::StopToken>()
+    ) */
+  ) {
+    return scheduleAppraisal<ClockInfo>(
+      taskCoordinator, &PlatformAppraiser::measureClocksAsync, cancellerOrDummy(canceller)
     );
   }
 
@@ -0,0 +1,100 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_SEQUENCELOCKHELPER_H
+#define NUCLEX_PLATFORM_HARDWARE_SEQUENCELOCKHELPER_H
+
+#include "Nuclex/Platform/Config.h"
+
+#include <atomic> // for std::atomic, std::atomic_thread_fence()
+#include <thread> // for std::this_thread::yield()
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Publishes and reads samples guarded by a sequence number</summary>
+  /// <remarks>
+  ///   <para>
+  ///     The sequence number is incremented before and after a sample is published,
+  ///     so while it is odd, a sample is being written. Readers copy the fields and
+  ///     try again if the sequence number was odd or changed while they were copying.
+  ///     Readers never block the publishing thread and take no locks themselves.
+  ///   </para>
+  ///   <para>
+  ///     The published fields have to be atomics accessed with relaxed memory order,
+  ///     so a reader copying them during an update only gets values it will discard.
+  ///     Only one thread may publish at a time.
+  ///   </para>
+  /// </remarks>
+  class SequenceLockHelper {
+
+    /// <summary>Publishes a sample by storing it through the specified method</summary>
+    /// <typeparam name="TStoreMethod">Method that stores the sample's fields</typeparam>
+    /// <param name="sequenceNumber">Sequence number guarding the sample's fields</param>
+    /// <param name="store">Method that will be called to store the sample's fields</param>
+    public: template<typename TStoreMethod>
+    static void Publish(std::atomic<std::size_t> &sequenceNumber, TStoreMethod &&store) noexcept {
+
+      // Only one thread publishes at a time, so a plain load and store of
+      // the sequence number is enough to mark the update in progress
+      std::size_t sequence = sequenceNumber.load(std::memory_order_relaxed);
+      sequenceNumber.store(sequence + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+
+      store();
+
+      sequenceNumber.store(sequence + 2, std::memory_order_release);
+    }
+
+    /// <summary>Reads a consistent sample through the specified method</summary>
+    /// <typeparam name="TLoadMethod">Method that loads the sample's fields</typeparam>
+    /// <param name="sequenceNumber">Sequence number guarding the sample's fields</param>
+    /// <param name="load">
+    ///   Method that will be called to load the sample's fields, possibly several times
+    /// </param>
+    /// <remarks>
+    ///   Samples are published rarely, so this will almost never have to try again
+    /// </remarks>
+    public: template<typename TLoadMethod>
+    static void Read(const std::atomic<std::size_t> &sequenceNumber, TLoadMethod &&load) noexcept {
+      for(;;) {
+        std::size_t sequenceBefore = sequenceNumber.load(std::memory_order_acquire);
+        if((sequenceBefore & 1) != 0) {
+          std::this_thread::yield();
+          continue;
+        }
+
+        load();
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        std::size_t sequenceAfter = sequenceNumber.load(std::memory_order_relaxed);
+        if(sequenceBefore == sequenceAfter) {
+          return;
+        }
+      }
+    }
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_SEQUENCELOCKHELPER_H
@@ -0,0 +1,233 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "Nuclex/Platform/Hardware/StoreLocator.h"
+
+#include <algorithm> // for std::stable_sort()
+#include <cctype> // for std::tolower(), std::isalpha()
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Brings a path into a form in which it can be compared to mount paths</summary>
+  /// <param name="path">Path that will be normalized</param>
+  /// <param name="normalized">Receives the normalized path</param>
+  /// <returns>True if the path was absolute and could be normalized, false otherwise</returns>
+  /// <remarks>
+  ///   Empty and '.' segments are dropped, '..' segments remove the preceding segment
+  ///   and trailing slashes are removed, so the root directory becomes an empty string.
+  ///   On Windows, where paths are case-insensitive and backslashes are used, these are
+  ///   turned into forward slashes and the whole path is converted to lowercase.
+  /// </remarks>
+  bool tryNormalizePath(const std::string &path, std::string &normalized) {
+    normalized.clear();
+    normalized.reserve(path.length());
+
+    std::string::size_type index = 0;
+    std::string::size_type length = path.length();
+#if defined(NUCLEX_PLATFORM_WINDOWS)
+    // Drive letters become the first segment, everything else must start with a slash
+    bool hasDriveLetter = (
+      (length >= 2) &&
+      std::isalpha(static_cast<unsigned char>(path[0])) &&
+      (path[1] == ':')
+    );
+    if(hasDriveLetter) {
+      normalized.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(path[0]))));
+      normalized.push_back(':');
+      index = 2;
+    } else if((length == 0) || ((path[0] != '/') && (path[0] != '\\'))) {
+      return false;
+    }
+#else
+    if((length == 0) || (path[0] != '/')) {
+      return false;
+    }
+#endif
+
+    std::string::size_type rootLength = normalized.length();
+    while(index < length) {
+      std::string::size_type segmentEnd = index;
+      while(segmentEnd < length) {
+#if defined(NUCLEX_PLATFORM_WINDOWS)
+        if((path[segmentEnd] == '/') || (path[segmentEnd] == '\\')) {
+          break;
+        }
+#else
+        if(path[segmentEnd] == '/') {
+          break;
+        }
+#endif
+        ++segmentEnd;
+      }
+
+      std::string::size_type segmentLength = segmentEnd - index;
+      if(segmentLength == 0) {
+        // Empty segment from a leading or doubled slash, skip it
+      } else if((segmentLength == 1) && (path[index] == '.')) {
+        // Reference to the current directory, skip it
+      } else if((segmentLength == 2) && (path[index] == '.') && (path[index + 1] == '.')) {
+        std::string::size_type slashIndex = normalized.rfind('/');
+        if((slashIndex == std::string::npos) || (slashIndex < rootLength)) {
+          normalized.resize(rootLength); // '..' in the root directory stays in the root
+        } else {
+          normalized.resize(slashIndex);
+        }
+      } else {
+        normalized.push_back('/');
+#if defined(NUCLEX_PLATFORM_WINDOWS)
+        for(std::string::size_type charIndex = index; charIndex < segmentEnd; ++charIndex) {
+          normalized.push_back(
+            static_cast<char>(std::tolower(static_cast<unsigned char>(path[charIndex])))
+          );
+        }
+#else
+        normalized.append(path, index, segmentLength);
+#endif
+      }
+
+      index = segmentEnd + 1;
+    }
+
+    return true;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Checks whether a path is located at or below a mount path</summary>
+  /// <param name="path">Normalized path that will be checked</param>
+  /// <param name="mountPath">Normalized mount path the path may be below</param>
+  /// <returns>True if the path is the mount path or located below it</returns>
+  bool isAtOrBelow(const std::string &path, const std::string &mountPath) {
+    std::string::size_type mountPathLength = mountPath.length();
+    if(path.length() < mountPathLength) {
+      return false;
+    }
+    if(path.compare(0, mountPathLength, mountPath) != 0) {
+      return false;
+    }
+
+    // Make sure '/home' does not match '/homework'
+    return (path.length() == mountPathLength) || (path[mountPathLength] == '/');
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  StoreLocator::StoreLocator(const std::shared_ptr<const std::vector<StoreInfo>> &stores) :
+    stores(stores),
+    mounts() {
+
+    if(!static_cast<bool>(this->stores)) {
+      this->stores = std::make_shared<std::vector<StoreInfo>>();
+    }
+
+    std::size_t storeCount = this->stores->size();
+    for(std::size_t storeIndex = 0; storeIndex < storeCount; ++storeIndex) {
+      const std::vector<PartitionInfo> &partitions = this->stores->at(storeIndex).Partitions;
+
+      std::size_t partitionCount = partitions.size();
+      for(std::size_t partitionIndex = 0; partitionIndex < partitionCount; ++partitionIndex) {
+        const std::vector<std::string> &mountPaths = partitions[partitionIndex].MountPaths;
+
+        std::size_t mountPathCount = mountPaths.size();
+        for(std::size_t mountPathIndex = 0; mountPathIndex < mountPathCount; ++mountPathIndex) {
+          MountEntry mount;
+          if(!tryNormalizePath(mountPaths[mountPathIndex], mount.NormalizedPath)) {
+            continue;
+          }
+          mount.StoreIndex = storeIndex;
+          mount.PartitionIndex = partitionIndex;
+          mount.MountPathIndex = mountPathIndex;
+          this->mounts.push_back(std::move(mount));
+        }
+      }
+    }
+
+    // Longest paths first, so the first match is always the innermost mount
+    std::stable_sort(
+      this->mounts.begin(), this->mounts.end(),
+      [](const MountEntry &left, const MountEntry &right) {
+        return left.NormalizedPath.length() > right.NormalizedPath.length();
+      }
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  StoreLocator::~StoreLocator() = default;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::optional<StoreLocation> StoreLocator::Locate(const std::string &path) const {
+    std::string normalizedPath;
+    if(!tryNormalizePath(path, normalizedPath)) {
+      return std::optional<StoreLocation>();
+    }
+
+    for(const MountEntry &mount : this->mounts) {
+      if(isAtOrBelow(normalizedPath, mount.NormalizedPath)) {
+        StoreLocation location;
+        location.StoreIndex = mount.StoreIndex;
+        location.PartitionIndex = mount.PartitionIndex;
+        location.MountPath = (
+          this->stores->at(mount.StoreIndex).
+            Partitions[mount.PartitionIndex].
+            MountPaths[mount.MountPathIndex]
+        );
+        return location;
+      }
+    }
+
+    return std::optional<StoreLocation>();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::size_t StoreLocator::GetDriveMask(const std::string &path) const {
+    std::string normalizedPath;
+    if(!tryNormalizePath(path, normalizedPath)) {
+      return 0;
+    }
+
+    for(const MountEntry &mount : this->mounts) {
+      if(isAtOrBelow(normalizedPath, mount.NormalizedPath)) {
+        if(mount.StoreIndex < sizeof(std::size_t) * 8) {
+          return std::size_t(1) << mount.StoreIndex;
+        } else {
+          return 0;
+        }
+      }
+    }
+
+    return 0;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
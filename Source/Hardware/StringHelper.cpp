@@ -124,4 +124,34 @@ namespace Nuclex { namespace Platform { namespace Hardware {
 
   // ------------------------------------------------------------------------------------------- //
 
+  void StringHelper::SkipWhitespace(std::string_view &text) {
+    using Nuclex::Support::Text::ParserHelper;
+
+    std::string_view::size_type index = 0;
+    while(index < text.length()) {
+      if(ParserHelper::IsWhitespace(text[index])) {
+        ++index;
+      } else {
+        break;
+      }
+    }
+
+    text.remove_prefix(index);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void StringHelper::TrimWhitespace(std::string_view &text) {
+    using Nuclex::Support::Text::ParserHelper;
+
+    while(!text.empty() && ParserHelper::IsWhitespace(text.front())) {
+      text.remove_prefix(1);
+    }
+    while(!text.empty() && ParserHelper::IsWhitespace(text.back())) {
+      text.remove_suffix(1);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
 }}} // namespace Nuclex::Platform::Hardware
\ No newline at end of file
@@ -24,7 +24,9 @@ limitations under the License.
 
 #include <Nuclex/Support/Text/ParserHelper.h>
 
+#include <charconv> // for std::from_chars()
 #include <string> // for std::string
+#include <string_view> // for std::string_view
 
 namespace Nuclex { namespace Platform { namespace Hardware {
 
@@ -41,6 +43,46 @@ namespace Nuclex { namespace Platform { namespace Hardware {
       const std::string_view &text, std::string::size_type startIndex = 0
     );
 
+    /// <summary>Skips any whitespace at the beginning of a string view</summary>
+    /// <param name="text">String view from which leading whitespace will be removed</param>
+    public: static void SkipWhitespace(std::string_view &text);
+
+    /// <summary>Removes whitespace from both ends of a string view</summary>
+    /// <param name="text">String view that will be trimmed</param>
+    public: static void TrimWhitespace(std::string_view &text);
+
+    /// <summary>Parses a number from the beginning of a string view</summary>
+    /// <typeparam name="TValue">Type of number that will be parsed</typeparam>
+    /// <param name="text">Text that starts with the number</param>
+    /// <param name="value">Receives the parsed number</param>
+    /// <returns>True if the text started with a number that fit into the type</returns>
+    /// <remarks>
+    ///   Anything following the number is ignored. Use <see cref="TryTakeNumber" /> if
+    ///   the text after the number is of interest.
+    /// </remarks>
+    public: template<typename TValue>
+    static bool TryParseNumber(const std::string_view &text, TValue &value) {
+      const char *end = text.data() + text.length();
+      return (std::from_chars(text.data(), end, value).ec == std::errc());
+    }
+
+    /// <summary>Parses a number from the beginning of a string view and removes it</summary>
+    /// <typeparam name="TValue">Type of number that will be parsed</typeparam>
+    /// <param name="text">Text that starts with the number, will be advanced past it</param>
+    /// <param name="value">Receives the parsed number</param>
+    /// <returns>True if the text started with a number that fit into the type</returns>
+    public: template<typename TValue>
+    static bool TryTakeNumber(std::string_view &text, TValue &value) {
+      const char *end = text.data() + text.length();
+      std::from_chars_result result = std::from_chars(text.data(), end, value);
+      if(result.ec != std::errc()) {
+        return false;
+      }
+
+      text.remove_prefix(static_cast<std::string_view::size_type>(result.ptr - text.data()));
+      return true;
+    }
+
   };
 
   // ------------------------------------------------------------------------------------------- //
@@ -0,0 +1,51 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./ThroughputTestHelper.h"
+
+#include <algorithm> // for std::max(), std::copy_n()
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void ThroughputTestHelper::FillWithNoise(
+    std::uint8_t *buffer, std::size_t byteCount, std::uint64_t &state
+  ) {
+    for(std::size_t index = 0; index < byteCount; index += sizeof(std::uint64_t)) {
+      std::uint64_t value = NextRandomNumber(state);
+      std::copy_n(reinterpret_cast<const std::uint8_t *>(&value), sizeof(value), buffer + index);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  double ThroughputTestHelper::GetElapsedSeconds(
+    std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end
+  ) {
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return std::max(seconds, 0.000001);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
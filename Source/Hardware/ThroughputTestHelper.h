@@ -0,0 +1,97 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_HARDWARE_THROUGHPUTTESTHELPER_H
+#define NUCLEX_PLATFORM_HARDWARE_THROUGHPUTTESTHELPER_H
+
+#include "Nuclex/Platform/Config.h"
+
+#include <chrono> // for std::chrono::steady_clock, std::chrono::milliseconds
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t, std::uint8_t
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Platform-neutral parts of the storage throughput measurement</summary>
+  /// <remarks>
+  ///   The file access differs between Linux (page cache hints on an unlinked file) and
+  ///   Windows (unbuffered access to a delete-on-close file), but the test parameters,
+  ///   the noise written into the test file and the timing are the same on both.
+  /// </remarks>
+  class ThroughputTestHelper {
+
+    /// <summary>Size of the chunks written and read in the sequential read test</summary>
+    public: static constexpr std::size_t SequentialBlockSize = 1024 * 1024;
+
+    /// <summary>Size of the blocks read in the random access test</summary>
+    /// <remarks>
+    ///   Unbuffered I/O requires reads to be aligned to the drive's sector size,
+    ///   which is either 512 or 4096 bytes, so this works for either.
+    /// </remarks>
+    public: static constexpr std::size_t RandomBlockSize = 4096;
+
+    /// <summary>Maximum number of blocks read in the random access test</summary>
+    public: static constexpr std::size_t MaximumRandomReadCount = 16384;
+
+    /// <summary>Time after which the random access test is stopped</summary>
+    public: static constexpr std::chrono::milliseconds RandomReadTimeLimit =
+      std::chrono::milliseconds(1000);
+
+    /// <summary>Seed for the random number generator, any non-zero value works</summary>
+    public: static constexpr std::uint64_t InitialRandomState = 0x9E3779B97F4A7C15ULL;
+
+    /// <summary>Advances a xorshift random number generator</summary>
+    /// <param name="state">State of the random number generator, must not be zero</param>
+    /// <returns>The next random number</returns>
+    public: static std::uint64_t NextRandomNumber(std::uint64_t &state) {
+      state ^= state << 13;
+      state ^= state >> 7;
+      state ^= state << 17;
+      return state;
+    }
+
+    /// <summary>Fills a buffer with random garbage</summary>
+    /// <param name="buffer">Buffer that will be filled</param>
+    /// <param name="byteCount">Number of bytes in the buffer, must be a multiple of 8</param>
+    /// <param name="state">State of the random number generator</param>
+    /// <remarks>
+    ///   The test file is filled with noise so that file systems with compression or
+    ///   deduplication can't shrink it down to nothing.
+    /// </remarks>
+    public: static void FillWithNoise(
+      std::uint8_t *buffer, std::size_t byteCount, std::uint64_t &state
+    );
+
+    /// <summary>Calculates the number of seconds elapsed between two points in time</summary>
+    /// <param name="start">Point in time at which the measurement began</param>
+    /// <param name="end">Point in time at which the measurement ended</param>
+    /// <returns>The elapsed time in seconds, never exactly zero</returns>
+    public: static double GetElapsedSeconds(
+      std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end
+    );
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // NUCLEX_PLATFORM_HARDWARE_THROUGHPUTTESTHELPER_H
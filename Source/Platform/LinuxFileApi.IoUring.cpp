@@ -0,0 +1,510 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "LinuxFileApi.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "PosixApi.h" // Linux uses Posix error handling
+
+#include <fcntl.h> // for O_RDONLY, O_CLOEXEC, AT_FDCWD
+#include <unistd.h> // for ::syscall(), ::close()
+#include <sys/mman.h> // for ::mmap(), ::munmap()
+#include <sys/syscall.h> // for __NR_io_uring_setup, __NR_io_uring_enter
+#include <linux/io_uring.h> // for io_uring structures and constants
+
+#include <algorithm> // for std::min(), std::max()
+#include <cerrno> // To access ::errno directly
+#include <cstdint> // for std::uint8_t, std::uintptr_t
+#include <cstring> // for std::memset()
+
+// io_uring gained the opcodes for opening, reading and closing files in Linux 5.6,
+// IORING_FEAT_RW_CUR_POS was introduced at the same time and tells whether the kernel
+// headers we're compiled against know them. Otherwise only the fallback is built.
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_RW_CUR_POS)
+#define NUCLEX_PLATFORM_HAVE_IO_URING 1
+#endif
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads a single file using plain system calls</summary>
+  /// <param name="directoryDescriptor">Directory the path is relative to</param>
+  /// <param name="path">Path of the file that will be read</param>
+  /// <param name="maximumFileSize">Maximum number of bytes that will be read</param>
+  /// <returns>The contents of the file or nothing if it could not be read</returns>
+  std::optional<std::string> readFileDirectly(
+    int directoryDescriptor, const std::string &path, std::size_t maximumFileSize
+  ) {
+    using Nuclex::Platform::Platform::LinuxFileApi;
+
+    std::string contents(maximumFileSize, '\0');
+    std::size_t length;
+    bool wasRead = LinuxFileApi::TryReadFileAt(
+      directoryDescriptor, path.c_str(), contents.data(), maximumFileSize, length
+    );
+    if(!wasRead) {
+      return std::optional<std::string>();
+    }
+
+    contents.resize(length);
+    return contents;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+#if defined(NUCLEX_PLATFORM_HAVE_IO_URING)
+
+  /// <summary>Number of entries in the submission queue of the ring</summary>
+  /// <remarks>
+  ///   This is also the number of files processed per batch. Each batch costs three
+  ///   io_uring_enter() calls (open, read, close), so reading 300 sysfs files takes
+  ///   9 system calls instead of 900.
+  /// </remarks>
+  const unsigned RingEntryCount = 128;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Minimal io_uring instance for batches of synchronous operations</summary>
+  /// <remarks>
+  ///   The library doesn't depend on liburing, so this talks to the kernel directly.
+  ///   Only what's needed to queue a batch of operations and wait for all of them
+  ///   to complete is implemented.
+  /// </remarks>
+  class IoUring {
+
+    /// <summary>Initializes a new, not yet set up ring</summary>
+    public: IoUring() :
+      ringFileDescriptor(-1),
+      submissionRing(nullptr),
+      submissionRingSize(0),
+      completionRing(nullptr),
+      completionRingSize(0),
+      submissionEntries(nullptr),
+      submissionEntriesSize(0),
+      parameters(),
+      queuedCount(0) {}
+
+    /// <summary>Unmaps the ring's memory and closes it</summary>
+    public: ~IoUring() {
+      if(this->submissionEntries != nullptr) {
+        ::munmap(this->submissionEntries, this->submissionEntriesSize);
+      }
+      if((this->completionRing != nullptr) && (this->completionRing != this->submissionRing)) {
+        ::munmap(this->completionRing, this->completionRingSize);
+      }
+      if(this->submissionRing != nullptr) {
+        ::munmap(this->submissionRing, this->submissionRingSize);
+      }
+      if(this->ringFileDescriptor != -1) {
+        ::close(this->ringFileDescriptor);
+      }
+    }
+
+    /// <summary>Tries to create the ring and map its queues into memory</summary>
+    /// <returns>True if the ring is ready for use, false if io_uring is unavailable</returns>
+    public: bool TrySetup() {
+      std::memset(&this->parameters, 0, sizeof(this->parameters));
+      int result = static_cast<int>(
+        ::syscall(__NR_io_uring_setup, RingEntryCount, &this->parameters)
+      );
+      if(result < 0) {
+        return false; // ENOSYS on old kernels, EPERM if blocked by seccomp or sysctl
+      }
+      this->ringFileDescriptor = result;
+
+      if((this->parameters.features & IORING_FEAT_RW_CUR_POS) == 0) {
+        return false; // Kernel older than 5.6, it won't know how to open files
+      }
+
+      this->submissionRingSize = (
+        this->parameters.sq_off.array + this->parameters.sq_entries * sizeof(unsigned)
+      );
+      this->completionRingSize = (
+        this->parameters.cq_off.cqes +
+        this->parameters.cq_entries * sizeof(struct ::io_uring_cqe)
+      );
+      bool isSingleMapping = ((this->parameters.features & IORING_FEAT_SINGLE_MMAP) != 0);
+      if(isSingleMapping) {
+        this->submissionRingSize = std::max(this->submissionRingSize, this->completionRingSize);
+        this->completionRingSize = this->submissionRingSize;
+      }
+
+      this->submissionRing = mapRegion(this->submissionRingSize, IORING_OFF_SQ_RING);
+      if(this->submissionRing == nullptr) {
+        return false;
+      }
+      if(isSingleMapping) {
+        this->completionRing = this->submissionRing;
+      } else {
+        this->completionRing = mapRegion(this->completionRingSize, IORING_OFF_CQ_RING);
+        if(this->completionRing == nullptr) {
+          return false;
+        }
+      }
+
+      this->submissionEntriesSize = (
+        this->parameters.sq_entries * sizeof(struct ::io_uring_sqe)
+      );
+      this->submissionEntries = static_cast<struct ::io_uring_sqe *>(
+        mapRegion(this->submissionEntriesSize, IORING_OFF_SQES)
+      );
+      return (this->submissionEntries != nullptr);
+    }
+
+    /// <summary>Fetches the next free submission queue entry</summary>
+    /// <returns>A cleared submission queue entry that can be filled by the caller</returns>
+    /// <remarks>
+    ///   The caller is responsible for not queueing more entries than the ring holds
+    ///   before calling <see cref="SubmitAndWait" />.
+    /// </remarks>
+    public: struct ::io_uring_sqe &Push() {
+      unsigned *tail = submissionField(this->parameters.sq_off.tail);
+      unsigned mask = *submissionField(this->parameters.sq_off.ring_mask);
+      unsigned index = (*tail + this->queuedCount) & mask; // Only we write to the tail
+      submissionField(this->parameters.sq_off.array)[index] = index;
+
+      struct ::io_uring_sqe &entry = this->submissionEntries[index];
+      std::memset(&entry, 0, sizeof(entry));
+
+      // The kernel may only see the new tail after the entry has been filled, so
+      // the tail is published by SubmitAndWait() with release semantics
+      ++this->queuedCount;
+      return entry;
+    }
+
+    /// <summary>Submits all queued entries and collects their results</summary>
+    /// <param name="results">
+    ///   Receives the result of each operation, indexed by the user data of the entry
+    /// </param>
+    public: void SubmitAndWait(std::vector<int> &results) {
+      unsigned *tail = submissionField(this->parameters.sq_off.tail);
+      __atomic_store_n(tail, *tail + this->queuedCount, __ATOMIC_RELEASE);
+
+      unsigned *completionHead = completionField(this->parameters.cq_off.head);
+      unsigned *completionTail = completionField(this->parameters.cq_off.tail);
+      unsigned completionMask = *completionField(this->parameters.cq_off.ring_mask);
+      struct ::io_uring_cqe *completions = reinterpret_cast<struct ::io_uring_cqe *>(
+        static_cast<std::uint8_t *>(this->completionRing) + this->parameters.cq_off.cqes
+      );
+
+      unsigned unsubmittedCount = this->queuedCount;
+      unsigned outstandingCount = this->queuedCount;
+      this->queuedCount = 0;
+      while(outstandingCount > 0) {
+        int result = static_cast<int>(
+          ::syscall(
+            __NR_io_uring_enter, this->ringFileDescriptor,
+            unsubmittedCount, outstandingCount, IORING_ENTER_GETEVENTS, nullptr, 0
+          )
+        );
+        if(unlikely(result < 0)) {
+          int errorNumber = errno;
+          if((errorNumber == EINTR) || (errorNumber == EAGAIN) || (errorNumber == EBUSY)) {
+            continue;
+          }
+          Nuclex::Platform::Platform::PosixApi::ThrowExceptionForSystemError(
+            u8"Could not submit batched file accesses to io_uring", errorNumber
+          );
+        }
+        unsubmittedCount -= static_cast<unsigned>(result);
+
+        unsigned head = *completionHead; // Only we write to the head
+        unsigned tail = __atomic_load_n(completionTail, __ATOMIC_ACQUIRE);
+        while(head != tail) {
+          const struct ::io_uring_cqe &completion = completions[head & completionMask];
+          results[static_cast<std::size_t>(completion.user_data)] = completion.res;
+          ++head;
+          --outstandingCount;
+        }
+        __atomic_store_n(completionHead, head, __ATOMIC_RELEASE);
+      }
+    }
+
+    /// <summary>Maps one of the ring's memory regions into the process</summary>
+    /// <param name="size">Size of the region in bytes</param>
+    /// <param name="offset">Magic offset identifying the region</param>
+    /// <returns>The address of the mapped region or null if mapping failed</returns>
+    private: void *mapRegion(std::size_t size, unsigned long long offset) {
+      void *address = ::mmap(
+        nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+        this->ringFileDescriptor, static_cast<::off_t>(offset)
+      );
+      if(address == MAP_FAILED) {
+        return nullptr;
+      } else {
+        return address;
+      }
+    }
+
+    /// <summary>Looks up a field in the submission ring's shared memory</summary>
+    /// <param name="offset">Offset of the field as reported by the kernel</param>
+    /// <returns>The address of the field</returns>
+    private: unsigned *submissionField(unsigned offset) {
+      return reinterpret_cast<unsigned *>(
+        static_cast<std::uint8_t *>(this->submissionRing) + offset
+      );
+    }
+
+    /// <summary>Looks up a field in the completion ring's shared memory</summary>
+    /// <param name="offset">Offset of the field as reported by the kernel</param>
+    /// <returns>The address of the field</returns>
+    private: unsigned *completionField(unsigned offset) {
+      return reinterpret_cast<unsigned *>(
+        static_cast<std::uint8_t *>(this->completionRing) + offset
+      );
+    }
+
+    private: IoUring(const IoUring &other) = delete;
+    private: IoUring &operator =(const IoUring &other) = delete;
+
+    /// <summary>File descriptor representing the ring, -1 if not created</summary>
+    private: int ringFileDescriptor;
+    /// <summary>Mapped memory holding the submission queue's indices</summary>
+    private: void *submissionRing;
+    /// <summary>Size of the submission queue mapping in bytes</summary>
+    private: std::size_t submissionRingSize;
+    /// <summary>Mapped memory holding the completion queue, may be the same mapping</summary>
+    private: void *completionRing;
+    /// <summary>Size of the completion queue mapping in bytes</summary>
+    private: std::size_t completionRingSize;
+    /// <summary>Mapped array of submission queue entries</summary>
+    private: struct ::io_uring_sqe *submissionEntries;
+    /// <summary>Size of the submission queue entry array in bytes</summary>
+    private: std::size_t submissionEntriesSize;
+    /// <summary>Offsets and features reported by the kernel when the ring was set up</summary>
+    private: struct ::io_uring_params parameters;
+    /// <summary>Number of entries pushed since the last submission</summary>
+    private: unsigned queuedCount;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>RAII scope that closes the file descriptors of a batch upon destruction</summary>
+  /// <remarks>
+  ///   If submitting the read step to io_uring fails, the files opened by the first step
+  ///   would otherwise stay open. Negative entries (files that failed to open) are skipped.
+  /// </remarks>
+  class FileDescriptorsClosingScope {
+
+    /// <summary>Initializes a new file descriptors closing scope</summary>
+    /// <param name="fileDescriptors">
+    ///   File descriptors that will be closed when the instance is destroyed
+    /// </param>
+    public: FileDescriptorsClosingScope(std::vector<int> &fileDescriptors) :
+      fileDescriptors(&fileDescriptors) {}
+
+    /// <summary>Closes the file descriptors when the instance is destroyed</summary>
+    public: ~FileDescriptorsClosingScope() {
+      if(this->fileDescriptors != nullptr) {
+        for(int fileDescriptor : *this->fileDescriptors) {
+          if(fileDescriptor >= 0) {
+            ::close(fileDescriptor);
+          }
+        }
+      }
+    }
+
+    /// <summary>Stops the scope from closing the file descriptors</summary>
+    /// <remarks>
+    ///   Used once the file descriptors have been handed to the kernel for closing
+    /// </remarks>
+    public: void Release() {
+      this->fileDescriptors = nullptr;
+    }
+
+    /// <summary>File descriptors that will be closed upon destruction</summary>
+    private: std::vector<int> *fileDescriptors;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Opens, reads and closes one batch of files through io_uring</summary>
+  /// <param name="ring">Ring through which the files will be accessed</param>
+  /// <param name="directoryDescriptor">Directory the paths are relative to</param>
+  /// <param name="paths">Paths of all files that are being read</param>
+  /// <param name="start">Index of the first file in the batch</param>
+  /// <param name="count">Number of files in the batch</param>
+  /// <param name="maximumFileSize">Maximum number of bytes read from each file</param>
+  /// <param name="contents">Receives the contents of the files</param>
+  void readBatchViaIoUring(
+    IoUring &ring, int directoryDescriptor,
+    const std::vector<std::string> &paths, std::size_t start, std::size_t count,
+    std::size_t maximumFileSize,
+    std::vector<std::optional<std::string>> &contents
+  ) {
+    std::vector<int> fileDescriptors(count, -1);
+    FileDescriptorsClosingScope closeFileDescriptors(fileDescriptors);
+
+    // Step 1: open all files in the batch
+    for(std::size_t index = 0; index < count; ++index) {
+      struct ::io_uring_sqe &entry = ring.Push();
+      entry.opcode = IORING_OP_OPENAT;
+      entry.fd = directoryDescriptor;
+      entry.addr = reinterpret_cast<std::uintptr_t>(paths[start + index].c_str());
+      entry.open_flags = O_RDONLY | O_CLOEXEC;
+      entry.user_data = index;
+    }
+    ring.SubmitAndWait(fileDescriptors);
+
+    // Step 2: read each file that could be opened into its output string
+    std::vector<int> results(count, -1);
+    for(std::size_t index = 0; index < count; ++index) {
+      if(fileDescriptors[index] >= 0) {
+        std::optional<std::string> &target = contents[start + index];
+        target.emplace(maximumFileSize, '\0');
+
+        struct ::io_uring_sqe &entry = ring.Push();
+        entry.opcode = IORING_OP_READ;
+        entry.fd = fileDescriptors[index];
+        entry.addr = reinterpret_cast<std::uintptr_t>(target.value().data());
+        entry.len = static_cast<std::uint32_t>(maximumFileSize);
+        entry.off = 0;
+        entry.user_data = index;
+      }
+    }
+    ring.SubmitAndWait(results);
+
+    // Step 3: close the files again and trim the output strings to the bytes read.
+    // From here on, the kernel owns the file descriptors. If the submission fails,
+    // closing them ourselves could hit a descriptor number that was already reused.
+    closeFileDescriptors.Release();
+    std::vector<int> closeResults(count);
+    for(std::size_t index = 0; index < count; ++index) {
+      if(fileDescriptors[index] >= 0) {
+        struct ::io_uring_sqe &entry = ring.Push();
+        entry.opcode = IORING_OP_CLOSE;
+        entry.fd = fileDescriptors[index];
+        entry.user_data = index;
+
+        std::optional<std::string> &target = contents[start + index];
+        if(results[index] >= 0) {
+          target.value().resize(static_cast<std::size_t>(results[index]));
+        } else {
+          target.reset();
+        }
+      }
+    }
+    ring.SubmitAndWait(closeResults);
+  }
+
+#endif // defined(NUCLEX_PLATFORM_HAVE_IO_URING)
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Platform {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<std::optional<std::string>> LinuxFileApi::ReadManyFiles(
+    const std::vector<std::string> &paths, std::size_t maximumFileSize /* = 4096 */
+  ) {
+    return ReadManyFilesAt(AT_FDCWD, paths, maximumFileSize);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<std::optional<std::string>> LinuxFileApi::ReadManyFilesAt(
+    int directoryDescriptor,
+    const std::vector<std::string> &paths,
+    std::size_t maximumFileSize /* = 4096 */
+  ) {
+    BatchedFileReader reader;
+    return reader.ReadFilesAt(directoryDescriptor, paths, maximumFileSize);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+#if defined(NUCLEX_PLATFORM_HAVE_IO_URING)
+  class BatchedFileReader::Ring : public IoUring {};
+#else
+  class BatchedFileReader::Ring {};
+#endif
+
+  // ------------------------------------------------------------------------------------------- //
+
+  BatchedFileReader::BatchedFileReader() :
+    ring(),
+    isRingUnavailable(false) {}
+
+  // ------------------------------------------------------------------------------------------- //
+
+  BatchedFileReader::~BatchedFileReader() = default;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<std::optional<std::string>> BatchedFileReader::ReadFilesAt(
+    int directoryDescriptor,
+    const std::vector<std::string> &paths,
+    std::size_t maximumFileSize /* = 4096 */
+  ) {
+    std::vector<std::optional<std::string>> contents(paths.size());
+    if(paths.empty()) {
+      return contents;
+    }
+
+#if defined(NUCLEX_PLATFORM_HAVE_IO_URING)
+    // Setting up a ring costs a handful of system calls, so only bother with it
+    // if there are enough files to make up for that. Once set up, it is kept for
+    // all further batches.
+    if(!this->ring && !this->isRingUnavailable && (paths.size() >= 8)) {
+      std::unique_ptr<Ring> newRing = std::make_unique<Ring>();
+      if(newRing->TrySetup()) {
+        this->ring = std::move(newRing);
+      } else {
+        this->isRingUnavailable = true;
+      }
+    }
+    if(this->ring) {
+      try {
+        for(std::size_t start = 0; start < paths.size(); start += RingEntryCount) {
+          std::size_t count = std::min<std::size_t>(RingEntryCount, paths.size() - start);
+          readBatchViaIoUring(
+            *this->ring, directoryDescriptor, paths, start, count, maximumFileSize, contents
+          );
+        }
+      }
+      catch(...) {
+        this->ring.reset(); // Entries may still be queued, so don't reuse the ring
+        throw;
+      }
+      return contents;
+    }
+#endif // defined(NUCLEX_PLATFORM_HAVE_IO_URING)
+
+    for(std::size_t index = 0; index < paths.size(); ++index) {
+      contents[index] = readFileDirectly(directoryDescriptor, paths[index], maximumFileSize);
+    }
+
+    return contents;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Platform
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -25,42 +25,16 @@ limitations under the License.
 #if defined(NUCLEX_PLATFORM_LINUX)
 
 #include "PosixApi.h" // Linux uses Posix error handling
+#include "../Hardware/StringHelper.h" // for StringHelper
 
 #include <linux/limits.h> // for PATH_MAX
 #include <fcntl.h> // ::open() and flags
 #include <unistd.h> // ::read(), ::write(), ::close(), etc.
 
 #include <cerrno> // To access ::errno directly
+#include <charconv> // for std::from_chars()
 #include <vector> // std::vector
 
-namespace {
-
-  // ------------------------------------------------------------------------------------------- //
-
-  /// <summary>RAII scope that closes a file descriptor upon destruction</summary>
-  class FileDescriptorClosingScope {
-
-    /// <summary>Initializes a new file descriptor closing scope</summary>
-    /// <param name="fileDescriptor">
-    ///   File descriptor that will be closed when the instance is destroyed
-    /// </param>
-    public: FileDescriptorClosingScope(int fileDescriptor) :
-      fileDescriptor(fileDescriptor) {}
-
-    /// <summary>Closes the file descriptor when the instance is destroyed</summary>
-    public: ~FileDescriptorClosingScope() {
-      Nuclex::Platform::Platform::LinuxFileApi::Close(this->fileDescriptor, false);
-    }
-
-    /// <summary>File descriptor that will be closed upon destruction</summary>
-    private: int fileDescriptor;
-
-  };
-
-  // ------------------------------------------------------------------------------------------- //
-
-} // anonymous namespace
-
 namespace Nuclex { namespace Platform { namespace Platform {
 
   // ------------------------------------------------------------------------------------------- //
@@ -194,11 +168,15 @@ namespace Nuclex { namespace Platform { namespace Platform {
       // was inaccessible or if it is outside of the allowed error cases.
       if(unlikely(pathByteCount == ssize_t(-1))) {
         int errorNumber = errno;
-        if((errorNumber == EACCES) || (errorNumber == ENOTDIR) || (errorNumber == ENOENT)) {
+        bool isExpectedError = (
+          (errorNumber == EACCES) || (errorNumber == ENOTDIR) ||
+          (errorNumber == ENOENT) || (errorNumber == EINVAL)
+        );
+        if(isExpectedError) {
           if(causingErrorNumber != nullptr) {
             *causingErrorNumber = errorNumber;
           }
-          return false; // link doesn't exist or is inaccessible
+          return false; // link doesn't exist, isn't a link or is inaccessible
         }
 
         std::string errorMessage(u8"Could not read target of symlink '", 34);
@@ -267,60 +245,210 @@ namespace Nuclex { namespace Platform { namespace Platform {
     if(unlikely(fileDescriptor < 0)) {
       return false;
     }
+    FileDescriptorClosingScope closeFileDescriptor(fileDescriptor);
+
+    // Check the size of the file. Pseudo files in procfs, sysfs and cgroupfs report
+    // a size of 0 or 4096 bytes no matter what they contain, so this is only a hint.
+    std::size_t expectedSize;
     {
-      FileDescriptorClosingScope closeFileDescriptor(fileDescriptor);
-      for(std::size_t attempt = 0; attempt < 3; ++attempt) {
-
-        // Check the size of the file (it may change after this call, but it's a starting
-        // point and unless someone's trolling us it shouldn't keep increasing :D)
-        std::size_t expectedSize;
-        {
-          struct ::stat fileStatus;
-          int result = ::fstat(fileDescriptor, &fileStatus);
-          if(unlikely(result != 0)) {
-            return false;
-          }
+      struct ::stat fileStatus;
+      int result = ::fstat(fileDescriptor, &fileStatus);
+      if(unlikely(result != 0)) {
+        return false;
+      }
 
-          expectedSize = fileStatus.st_size;
-        }
+      expectedSize = fileStatus.st_size;
+    }
+
+    // Resize the string so it can take the whole file. We add a little bit extra so
+    // we can detect if the file is larger than its reported size.
+    contents.resize(std::max(expectedSize + 256, std::size_t(1024)));
 
-        // Resize the string so it can take the whole file. We add a little bit extra so
-        // we can detect if the file changed in size, even if it has grown.
-        {
-          std::size_t bufferSize = std::max(expectedSize + 256, std::size_t(1024));
-          contents.resize(bufferSize);
+    // Try to read the whole file in one go. This gives us the best chance avoiding
+    // a mess in case the file is updated while we're reading. If the file turns out
+    // to be larger than the buffer or the read comes back short, keep reading until
+    // the end of the file, otherwise large procfs files would be cut off.
+    std::size_t length = 0;
+    for(;;) {
+      ssize_t readByteCount = ::read(
+        fileDescriptor, contents.data() + length, contents.size() - length
+      );
+      if(readByteCount == 0) { // 0 bytes are only returned at the end of the file
+        break;
+      }
+      if(unlikely(readByteCount < 0)) {
+        if(errno == EINTR) {
+          continue;
         }
+        return false; // Read failed, we're broke...
+      }
 
-        // Try to read the whole file in one go. This gives us the best chance avoiding
-        // a mess in case the file is updated while we're reading.
-        // This is defensive programming taken a step too far. Probably...
-        {
-          ssize_t readByteCount = ::read(fileDescriptor, contents.data(), contents.size());
-          if(unlikely(readByteCount == static_cast<ssize_t>(-1))) {
-            return false; // Read failed, we're broke...
-          }
+      length += static_cast<std::size_t>(readByteCount);
 
-          // If we got all of the file's contents with this read, we're happy
-          if(likely(static_cast<std::size_t>(readByteCount) == expectedSize)) {
-            contents.resize(static_cast<std::size_t>(readByteCount));
-            return true;
-          }
+      // A regular file that delivered exactly its reported size has been read completely
+      bool isComplete = (
+        (expectedSize > 0) && (length == expectedSize) && (length < contents.size())
+      );
+      if(likely(isComplete)) {
+        break;
+      }
 
-          // If we got a different number of bytes, the read may have been interrupted by
-          // a signal or the file changed between calling fstat() and read(). In either case,
-          // we retry, and from the beginning, too. We absolutely want to read it in one go.
-          off_t newPosition = ::lseek(fileDescriptor, 0, SEEK_SET);
-          if(unlikely(newPosition == static_cast<off_t>(-1))) {
-            return false; // Seek failed, we're broke...
-          }
+      if(length == contents.size()) {
+        contents.resize(length * 2);
+      }
+    }
+
+    contents.resize(length);
+    return true;
+
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool LinuxFileApi::TryReadNumberFromFile(
+    const std::string &path, std::uint64_t &value
+  ) noexcept {
+    using Nuclex::Platform::Hardware::StringHelper;
+
+    std::string contents;
+    if(!TryReadFileInOneReadCall(path, contents)) {
+      return false;
+    }
+
+    std::string_view text(contents);
+    StringHelper::TrimWhitespace(text);
+
+    int base = 10;
+    if((text.length() > 2) && (text[0] == '0') && ((text[1] == 'x') || (text[1] == 'X'))) {
+      base = 16;
+      text.remove_prefix(2);
+    }
+
+    const char *end = text.data() + text.length();
+    std::from_chars_result result = std::from_chars(text.data(), end, value, base);
+    return (result.ec == std::errc()) && (result.ptr == end) && !text.empty();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool LinuxFileApi::TryOpenDirectory(
+    const std::string &path, int &directoryDescriptor
+  ) noexcept {
+    directoryDescriptor = ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    return (directoryDescriptor >= 0);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool LinuxFileApi::TryOpenFileForReading(
+    const std::string &path, int &fileDescriptor
+  ) noexcept {
+    fileDescriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    return (fileDescriptor >= 0);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool LinuxFileApi::TryReadFromStart(
+    int fileDescriptor, char *buffer, std::size_t capacity, std::size_t &length
+  ) noexcept {
+
+    // Pseudo files generate as much of their contents as fits into the requested size,
+    // so a read that comes up short has reached the end and no second call is needed.
+    length = 0;
+    while(length < capacity) {
+      std::size_t requestedByteCount = capacity - length;
+      ssize_t readByteCount = ::pread(
+        fileDescriptor, buffer + length, requestedByteCount, static_cast<::off_t>(length)
+      );
+      if(unlikely(readByteCount < 0)) {
+        if(errno == EINTR) {
+          continue;
         }
+        return false;
+      }
+
+      length += static_cast<std::size_t>(readByteCount);
+      if(static_cast<std::size_t>(readByteCount) < requestedByteCount) {
+        break;
+      }
+    }
+
+    return true;
+  }
 
-      } // for each read attempt
+  // ------------------------------------------------------------------------------------------- //
 
-    } // file descriptor closing scope
+  bool LinuxFileApi::TryReadFileAt(
+    int directoryDescriptor, const char *relativePath,
+    char *buffer, std::size_t capacity, std::size_t &length
+  ) noexcept {
+    int fileDescriptor = ::openat(directoryDescriptor, relativePath, O_RDONLY | O_CLOEXEC);
+    if(unlikely(fileDescriptor < 0)) {
+      return false;
+    }
+
+    FileDescriptorClosingScope closeFileDescriptor(fileDescriptor);
+
+    // Sysfs hands out an attribute's entire contents on the first read, but regular
+    // files (such as in unit tests) may be returned in pieces, so keep reading.
+    length = 0;
+    while(length < capacity) {
+      ssize_t readByteCount = ::read(fileDescriptor, buffer + length, capacity - length);
+      if(readByteCount == 0) {
+        break;
+      }
+      if(unlikely(readByteCount < 0)) {
+        if(errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      length += static_cast<std::size_t>(readByteCount);
+    }
 
     return true;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
 
+  bool LinuxFileApi::TryListDirectory(
+    const std::string &path, std::vector<std::string> &entryNames
+  ) {
+    ::DIR *directory = ::opendir(path.c_str());
+    if(unlikely(directory == nullptr)) {
+      return false;
+    }
+
+    entryNames.clear();
+    for(;;) {
+      errno = 0;
+      struct ::dirent *entry = ::readdir(directory);
+      if(entry == nullptr) {
+        int errorNumber = errno;
+        ::closedir(directory);
+        if(unlikely(errorNumber != 0)) {
+          std::string errorMessage(u8"Could not list the contents of directory '", 42);
+          errorMessage.append(path);
+          errorMessage.push_back('\'');
+
+          Platform::PosixApi::ThrowExceptionForSystemError(errorMessage, errorNumber);
+        }
+
+        return true;
+      }
+
+      // Skip the '.' and '..' entries, nobody wants to recurse into those
+      const char *name = entry->d_name;
+      bool isSelfOrParent = (
+        (name[0] == '.') && (
+          (name[1] == 0) || ((name[1] == '.') && (name[2] == 0))
+        )
+      );
+      if(!isSelfOrParent) {
+        entryNames.emplace_back(name);
+      }
+    }
   }
 
   // ------------------------------------------------------------------------------------------- //
@@ -27,6 +27,8 @@ limitations under the License.
 #include <string> // std::string
 #include <cstdint> // std::uint8_t and std::size_t
 #include <vector> // for std::vector
+#include <optional> // for std::optional
+#include <memory> // for std::unique_ptr
 
 #include <sys/stat.h> // ::fstat() and permission flags
 #include <dirent.h> // struct ::dirent
@@ -111,8 +113,8 @@ namespace Nuclex { namespace Platform { namespace Platform {
     /// </param>
     /// <returns>
     ///   True if the path was written into the target string, false if the link
-    ///   didn't exist or couldn't be accessed (permissions). Any other problem will
-    ///   still result in an exception being thrown.
+    ///   didn't exist, wasn't a symlink or couldn't be accessed (permissions). Any other
+    ///   problem will still result in an exception being thrown.
     /// </returns>
     public: static bool TryReadLink(
       const std::string &path, std::string &target, int *causingErrorNumber = nullptr
@@ -133,13 +135,145 @@ namespace Nuclex { namespace Platform { namespace Platform {
     ///   If the read fails, the contents and length of the output string are undefined.
     ///   This method makes an effort to read the whole file specified in one go into
     ///   the provided output string. This is useful to minimize the chance of mixed-up
-    ///   file data when a file might be modified during the read. It's only used for
-    ///   the XDG settings file, a small text file.
+    ///   file data when a file might be modified during the read. Pseudo files in procfs
+    ///   and sysfs do not report their real size, so if the first read does not deliver
+    ///   the whole file, reading continues until the end of the file is reached.
     /// </remarks>
     public: static bool TryReadFileInOneReadCall(
       const std::string &path, std::string &contents
     ) noexcept;
 
+    /// <summary>Attempts to read a single number from a file</summary>
+    /// <param name="path">Path of the file that will be read</param>
+    /// <param name="value">Receives the number stored in the file</param>
+    /// <returns>True if the file existed and contained only a number, false otherwise</returns>
+    /// <remarks>
+    ///   This is intended for the many sysfs files that hold a single value followed by
+    ///   a line break. Surrounding whitespace is ignored and numbers with a '0x' prefix
+    ///   (as used for PCI vendor and device IDs) are parsed as hexadecimal.
+    /// </remarks>
+    public: static bool TryReadNumberFromFile(
+      const std::string &path, std::uint64_t &value
+    ) noexcept;
+
+    /// <summary>Opens a directory so that files within can be opened relative to it</summary>
+    /// <param name="path">Path of the directory that will be opened</param>
+    /// <param name="directoryDescriptor">Receives the descriptor of the opened directory</param>
+    /// <returns>True if the directory was opened, false if it could not be opened</returns>
+    /// <remarks>
+    ///   The directory descriptor has to be closed via <see cref="Close" /> when done.
+    /// </remarks>
+    public: static bool TryOpenDirectory(
+      const std::string &path, int &directoryDescriptor
+    ) noexcept;
+
+    /// <summary>Attempts to open a file that will be read repeatedly</summary>
+    /// <param name="path">Path of the file that will be opened</param>
+    /// <param name="fileDescriptor">Receives the descriptor of the opened file</param>
+    /// <returns>True if the file was opened, false if it could not be opened</returns>
+    /// <remarks>
+    ///   The file descriptor has to be closed via <see cref="Close" /> when done.
+    /// </remarks>
+    public: static bool TryOpenFileForReading(
+      const std::string &path, int &fileDescriptor
+    ) noexcept;
+
+    /// <summary>Reads a file from its beginning without moving the file pointer</summary>
+    /// <param name="fileDescriptor">Descriptor of the file that will be read</param>
+    /// <param name="buffer">Buffer that will receive the contents of the file</param>
+    /// <param name="capacity">Number of bytes that fit into the buffer</param>
+    /// <param name="length">Receives the number of bytes that have been read</param>
+    /// <returns>True if the file was read, false if reading failed</returns>
+    /// <remarks>
+    ///   Uses pread() at offset zero, which makes procfs and cgroupfs regenerate
+    ///   the file's contents. This allows a file to be opened once and sampled again
+    ///   and again without paying for path resolution each time. Files larger than
+    ///   the buffer are truncated. A read delivering less than requested is taken as
+    ///   the end of the file, so a file that fits into the buffer costs one pread().
+    /// </remarks>
+    public: static bool TryReadFromStart(
+      int fileDescriptor, char *buffer, std::size_t capacity, std::size_t &length
+    ) noexcept;
+
+    /// <summary>
+    ///   Attempts to read a small file relative to a directory into a caller-provided buffer
+    /// </summary>
+    /// <param name="directoryDescriptor">Descriptor of the directory holding the file</param>
+    /// <param name="relativePath">Path of the file relative to the directory</param>
+    /// <param name="buffer">Buffer that will receive the contents of the file</param>
+    /// <param name="capacity">Number of bytes that fit into the buffer</param>
+    /// <param name="length">Receives the number of bytes that have been read</param>
+    /// <returns>True if the file was read, false if it could not be opened or read</returns>
+    /// <remarks>
+    ///   Meant for scanning the thousands of tiny files in sysfs where resolving the full
+    ///   path each time and allocating a string per file adds up. Sysfs attributes never
+    ///   exceed a page, so a 4 KiB buffer will be enough for anything found there.
+    ///   Files larger than the buffer are truncated.
+    /// </remarks>
+    public: static bool TryReadFileAt(
+      int directoryDescriptor, const char *relativePath,
+      char *buffer, std::size_t capacity, std::size_t &length
+    ) noexcept;
+
+    /// <summary>Reads many small files in as few system calls as possible</summary>
+    /// <param name="paths">Absolute paths of the files that will be read</param>
+    /// <param name="maximumFileSize">
+    ///   Maximum number of bytes read from each file, files larger than this are truncated
+    /// </param>
+    /// <returns>
+    ///   The contents of each file in the same order as the paths, an empty optional is
+    ///   returned for files that could not be opened or read
+    /// </returns>
+    /// <remarks>
+    ///   <para>
+    ///     Meant for hardware probing where hundreds of tiny sysfs and procfs files are
+    ///     read and the system call round trips cost more than the reads themselves.
+    ///     If the kernel supports it, the files are opened, read and closed through
+    ///     io_uring, submitting each step for a whole batch of files in one system call.
+    ///   </para>
+    ///   <para>
+    ///     On kernels before 5.6 or when io_uring is disabled (by seccomp filters in
+    ///     containers or via the io_uring_disabled sysctl), the files are read one by one
+    ///     using the same system calls as <see cref="TryReadFileAt" />.
+    ///   </para>
+    /// </remarks>
+    public: static std::vector<std::optional<std::string>> ReadManyFiles(
+      const std::vector<std::string> &paths, std::size_t maximumFileSize = 4096
+    );
+
+    /// <summary>Reads many small files relative to an opened directory</summary>
+    /// <param name="directoryDescriptor">
+    ///   Descriptor of the directory the paths are relative to
+    /// </param>
+    /// <param name="paths">Paths of the files relative to the directory</param>
+    /// <param name="maximumFileSize">
+    ///   Maximum number of bytes read from each file, files larger than this are truncated
+    /// </param>
+    /// <returns>
+    ///   The contents of each file in the same order as the paths, an empty optional is
+    ///   returned for files that could not be opened or read
+    /// </returns>
+    /// <remarks>
+    ///   Works like <see cref="ReadManyFiles" />, but saves the kernel from walking
+    ///   the directory's full path again for each file.
+    /// </remarks>
+    public: static std::vector<std::optional<std::string>> ReadManyFilesAt(
+      int directoryDescriptor,
+      const std::vector<std::string> &paths,
+      std::size_t maximumFileSize = 4096
+    );
+
+    /// <summary>Lists the names of all entries in a directory</summary>
+    /// <param name="path">Path of the directory whose entries will be listed</param>
+    /// <param name="entryNames">Vector that will receive the names of all entries</param>
+    /// <returns>
+    ///   True if the directory was listed, false if it didn't exist or could not be
+    ///   opened. The '.' and '..' entries are not included.
+    /// </returns>
+    public: static bool TryListDirectory(
+      const std::string &path, std::vector<std::string> &entryNames
+    );
+
     /// <summary>Joins two paths together, inserted a forward slash when needed</summary>
     /// <param name="base">Base path, typically an absolute path or directory name</param>
     /// <param name="sub">Sub path, typically a filename with or without subdirectory</param>
@@ -150,6 +284,80 @@ namespace Nuclex { namespace Platform { namespace Platform {
 
   // ------------------------------------------------------------------------------------------- //
 
+  /// <summary>RAII scope that closes a file descriptor upon destruction</summary>
+  class FileDescriptorClosingScope {
+
+    /// <summary>Initializes a new file descriptor closing scope</summary>
+    /// <param name="fileDescriptor">
+    ///   File descriptor that will be closed when the instance is destroyed
+    /// </param>
+    public: FileDescriptorClosingScope(int fileDescriptor) :
+      fileDescriptor(fileDescriptor) {}
+
+    /// <summary>Closes the file descriptor when the instance is destroyed</summary>
+    public: ~FileDescriptorClosingScope() {
+      LinuxFileApi::Close(this->fileDescriptor, false);
+    }
+
+    /// <summary>File descriptor that will be closed upon destruction</summary>
+    private: int fileDescriptor;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads batches of small files, keeping its io_uring between batches</summary>
+  /// <remarks>
+  ///   <para>
+  ///     <see cref="LinuxFileApi.ReadManyFilesAt" /> has to set up and tear down an io_uring
+  ///     on each call, which costs several system calls and memory mappings. Callers reading
+  ///     their files in several batches can use this class instead so the ring is only set
+  ///     up once (on the first batch that is large enough to make use of it).
+  ///   </para>
+  ///   <para>
+  ///     Instances are not thread-safe, each thread should use its own reader.
+  ///   </para>
+  /// </remarks>
+  class BatchedFileReader {
+
+    /// <summary>Initializes a new batched file reader</summary>
+    public: BatchedFileReader();
+    /// <summary>Closes the io_uring if one was set up</summary>
+    public: ~BatchedFileReader();
+
+    /// <summary>Reads many small files relative to an opened directory</summary>
+    /// <param name="directoryDescriptor">
+    ///   Descriptor of the directory the paths are relative to
+    /// </param>
+    /// <param name="paths">Paths of the files relative to the directory</param>
+    /// <param name="maximumFileSize">
+    ///   Maximum number of bytes read from each file, files larger than this are truncated
+    /// </param>
+    /// <returns>
+    ///   The contents of each file in the same order as the paths, an empty optional is
+    ///   returned for files that could not be opened or read
+    /// </returns>
+    public: std::vector<std::optional<std::string>> ReadFilesAt(
+      int directoryDescriptor,
+      const std::vector<std::string> &paths,
+      std::size_t maximumFileSize = 4096
+    );
+
+    private: BatchedFileReader(const BatchedFileReader &other) = delete;
+    private: BatchedFileReader &operator =(const BatchedFileReader &other) = delete;
+
+    /// <summary>io_uring instance used to read the files</summary>
+    private: class Ring;
+
+    /// <summary>Ring through which the files are read, null if not set up yet</summary>
+    private: std::unique_ptr<Ring> ring;
+    /// <summary>Whether setting up the ring failed, so reads go file by file</summary>
+    private: bool isRingUnavailable;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
 }}} // namespace Nuclex::Platform::Platform
 
 #endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,138 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./LinuxProcFileReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "./LinuxFileApi.h" // for LinuxFileApi
+
+#include <new> // for std::align_val_t
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Size of the buffer allocated when the file is first read</summary>
+  const std::size_t InitialBufferSize = 4096;
+
+  /// <summary>Alignment of the buffer, one cache line on common CPUs</summary>
+  const std::align_val_t BufferAlignment = std::align_val_t(64);
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Platform {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  LinuxProcFileReader::LinuxProcFileReader() :
+    fileDescriptor(-1),
+    buffer(nullptr),
+    capacity(0) {}
+
+  // ------------------------------------------------------------------------------------------- //
+
+  LinuxProcFileReader::LinuxProcFileReader(LinuxProcFileReader &&other) noexcept :
+    fileDescriptor(other.fileDescriptor),
+    buffer(other.buffer),
+    capacity(other.capacity) {
+    other.fileDescriptor = -1;
+    other.buffer = nullptr;
+    other.capacity = 0;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  LinuxProcFileReader::~LinuxProcFileReader() {
+    close();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool LinuxProcFileReader::TryOpen(const std::string &path) noexcept {
+    if(this->fileDescriptor != -1) {
+      LinuxFileApi::Close(this->fileDescriptor, false);
+      this->fileDescriptor = -1;
+    }
+
+    return LinuxFileApi::TryOpenFileForReading(path, this->fileDescriptor);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool LinuxProcFileReader::TryRead(std::string_view &contents) {
+    if(unlikely(this->fileDescriptor == -1)) {
+      return false;
+    }
+
+    if(unlikely(this->buffer == nullptr)) {
+      this->buffer = static_cast<char *>(::operator new(InitialBufferSize, BufferAlignment));
+      this->capacity = InitialBufferSize;
+    }
+
+    // If the file filled the buffer completely, its contents may have been cut off,
+    // so double the buffer and read again until the file's end is seen.
+    for(;;) {
+      std::size_t length;
+      bool wasRead = LinuxFileApi::TryReadFromStart(
+        this->fileDescriptor, this->buffer, this->capacity, length
+      );
+      if(unlikely(!wasRead)) {
+        return false;
+      }
+
+      if(likely(length < this->capacity)) {
+        contents = std::string_view(this->buffer, length);
+        return true;
+      }
+
+      std::size_t doubledCapacity = this->capacity * 2;
+      char *doubledBuffer = static_cast<char *>(
+        ::operator new(doubledCapacity, BufferAlignment)
+      );
+      ::operator delete(this->buffer, BufferAlignment);
+      this->buffer = doubledBuffer;
+      this->capacity = doubledCapacity;
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void LinuxProcFileReader::close() noexcept {
+    if(this->fileDescriptor != -1) {
+      LinuxFileApi::Close(this->fileDescriptor, false);
+      this->fileDescriptor = -1;
+    }
+    if(this->buffer != nullptr) {
+      ::operator delete(this->buffer, BufferAlignment);
+      this->buffer = nullptr;
+      this->capacity = 0;
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Platform
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,99 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_PLATFORM_LINUXPROCFILEREADER_H
+#define NUCLEX_PLATFORM_PLATFORM_LINUXPROCFILEREADER_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include <string> // for std::string
+#include <string_view> // for std::string_view
+#include <cstddef> // for std::size_t
+
+namespace Nuclex { namespace Platform { namespace Platform {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Keeps a procfs, sysfs or cgroupfs file open for repeated sampling</summary>
+  /// <remarks>
+  ///   <para>
+  ///     Pseudo files regenerate their contents whenever they are read from offset zero,
+  ///     so a monitor polling /proc/meminfo or /proc/stat does not need to open and close
+  ///     the file each time. This reader opens the file once and then re-reads it via
+  ///     pread() into a buffer that is kept between reads.
+  ///   </para>
+  ///   <para>
+  ///     The buffer starts at one page and doubles whenever a read fills it completely
+  ///     (the file may have been truncated). Once the file fits, a sample is a single
+  ///     pread() that comes up short of the buffer's capacity, which marks the end of
+  ///     the file, and needs no memory allocations. The returned string view points
+  ///     into the buffer and remains valid until the next read.
+  ///   </para>
+  /// </remarks>
+  class LinuxProcFileReader {
+
+    /// <summary>Initializes a new reader that has no file opened</summary>
+    public: LinuxProcFileReader();
+
+    /// <summary>Takes over the file and buffer of another reader</summary>
+    /// <param name="other">Reader whose file and buffer will be taken over</param>
+    public: LinuxProcFileReader(LinuxProcFileReader &&other) noexcept;
+
+    /// <summary>Closes the file and frees the buffer</summary>
+    public: ~LinuxProcFileReader();
+
+    /// <summary>Opens the specified file, closing the previously opened one</summary>
+    /// <param name="path">Path of the file that will be opened</param>
+    /// <returns>True if the file was opened, false if it could not be opened</returns>
+    public: bool TryOpen(const std::string &path) noexcept;
+
+    /// <summary>Whether the reader currently has a file opened</summary>
+    /// <returns>True if a file is opened, false otherwise</returns>
+    public: bool IsOpen() const noexcept { return (this->fileDescriptor != -1); }
+
+    /// <summary>Reads the current contents of the file</summary>
+    /// <param name="contents">Receives the contents of the file</param>
+    /// <returns>True if the file was read, false if no file is open or reading failed</returns>
+    public: bool TryRead(std::string_view &contents);
+
+    /// <summary>Closes the file and frees the buffer</summary>
+    private: void close() noexcept;
+
+    private: LinuxProcFileReader(const LinuxProcFileReader &other) = delete;
+    private: LinuxProcFileReader &operator =(const LinuxProcFileReader &other) = delete;
+    private: LinuxProcFileReader &operator =(LinuxProcFileReader &&other) = delete;
+
+    /// <summary>Descriptor of the opened file, -1 if no file is open</summary>
+    private: int fileDescriptor;
+    /// <summary>Cache line-aligned buffer receiving the file's contents</summary>
+    private: char *buffer;
+    /// <summary>Number of bytes that fit into the buffer</summary>
+    private: std::size_t capacity;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Platform
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+#endif // NUCLEX_PLATFORM_PLATFORM_LINUXPROCFILEREADER_H
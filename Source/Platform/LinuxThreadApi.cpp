@@ -0,0 +1,142 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "LinuxThreadApi.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "PosixApi.h" // Linux uses Posix error handling
+
+#include <sched.h> // for ::sched_getaffinity(), ::sched_setaffinity(), CPU_ALLOC()
+
+#include <cerrno> // To access ::errno directly
+#include <algorithm> // for std::max_element()
+#include <stdexcept> // for std::logic_error
+#include <new> // for std::bad_alloc
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>RAII scope that frees a dynamically allocated CPU set upon destruction</summary>
+  class CpuSetFreeingScope {
+
+    /// <summary>Initializes a new CPU set freeing scope</summary>
+    /// <param name="cpuSet">CPU set that will be freed when the instance is destroyed</param>
+    public: CpuSetFreeingScope(::cpu_set_t *cpuSet) :
+      cpuSet(cpuSet) {}
+
+    /// <summary>Frees the CPU set when the instance is destroyed</summary>
+    public: ~CpuSetFreeingScope() {
+      CPU_FREE(this->cpuSet);
+    }
+
+    /// <summary>CPU set that will be freed upon destruction</summary>
+    private: ::cpu_set_t *cpuSet;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Platform {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<std::size_t> LinuxThreadApi::GetCpuAffinity() {
+
+    // The kernel's CPU mask may be larger than the fixed-size cpu_set_t (which only covers
+    // 1024 processors), so we start with that and keep doubling if the kernel says EINVAL.
+    for(std::size_t processorCount = CPU_SETSIZE; ; processorCount *= 2) {
+      ::cpu_set_t *cpuSet = CPU_ALLOC(processorCount);
+      if(unlikely(cpuSet == nullptr)) {
+        throw std::bad_alloc();
+      }
+      CpuSetFreeingScope cpuSetScope(cpuSet);
+
+      std::size_t cpuSetSize = CPU_ALLOC_SIZE(processorCount);
+      CPU_ZERO_S(cpuSetSize, cpuSet);
+
+      int result = ::sched_getaffinity(0, cpuSetSize, cpuSet);
+      if(unlikely(result != 0)) {
+        int errorNumber = errno;
+        if((errorNumber == EINVAL) && (processorCount < 1048576)) {
+          continue;
+        }
+
+        Platform::PosixApi::ThrowExceptionForSystemError(
+          u8"Could not query the CPU affinity of the calling thread", errorNumber
+        );
+      }
+
+      std::vector<std::size_t> processorIndices;
+      processorIndices.reserve(CPU_COUNT_S(cpuSetSize, cpuSet));
+      for(std::size_t index = 0; index < processorCount; ++index) {
+        if(CPU_ISSET_S(index, cpuSetSize, cpuSet)) {
+          processorIndices.push_back(index);
+        }
+      }
+
+      return processorIndices;
+    }
+
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void LinuxThreadApi::SetCpuAffinity(const std::vector<std::size_t> &processorIndices) {
+    if(processorIndices.empty()) {
+      throw std::logic_error(u8"CPU affinity must contain at least one logical processor");
+    }
+
+    std::size_t processorCount = (
+      *std::max_element(processorIndices.begin(), processorIndices.end()) + 1
+    );
+
+    ::cpu_set_t *cpuSet = CPU_ALLOC(processorCount);
+    if(unlikely(cpuSet == nullptr)) {
+      throw std::bad_alloc();
+    }
+    CpuSetFreeingScope cpuSetScope(cpuSet);
+
+    std::size_t cpuSetSize = CPU_ALLOC_SIZE(processorCount);
+    CPU_ZERO_S(cpuSetSize, cpuSet);
+    for(std::size_t index : processorIndices) {
+      CPU_SET_S(index, cpuSetSize, cpuSet);
+    }
+
+    // Passing 0 as the process id addresses the calling thread only, not the whole process
+    int result = ::sched_setaffinity(0, cpuSetSize, cpuSet);
+    if(unlikely(result != 0)) {
+      int errorNumber = errno;
+      Platform::PosixApi::ThrowExceptionForSystemError(
+        u8"Could not change the CPU affinity of the calling thread", errorNumber
+      );
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Platform
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
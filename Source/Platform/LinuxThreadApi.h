@@ -0,0 +1,65 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_PLATFORM_LINUXTHREADAPI_H
+#define NUCLEX_PLATFORM_PLATFORM_LINUXTHREADAPI_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include <cstddef> // for std::size_t
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Platform { namespace Platform {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Wraps the Linux thread and scheduler API</summary>
+  class LinuxThreadApi {
+
+    /// <summary>Retrieves the logical processors the calling thread may run on</summary>
+    /// <returns>The indices of all logical processors the thread can be scheduled to</returns>
+    /// <remarks>
+    ///   The indices are the same the kernel uses (i.e. in /proc/cpuinfo and in
+    ///   /sys/devices/system/cpu/cpu*) and are returned in ascending order. This also
+    ///   reflects any restrictions placed on the process via taskset or a cgroup cpuset.
+    /// </remarks>
+    public: static std::vector<std::size_t> GetCpuAffinity();
+
+    /// <summary>Restricts the calling thread to the specified logical processors</summary>
+    /// <param name="processorIndices">
+    ///   Indices of the logical processors the thread is allowed to run on
+    /// </param>
+    /// <remarks>
+    ///   Only affects the calling thread, other threads in the process keep their affinity.
+    ///   If none of the specified processors is available to the process, the kernel will
+    ///   reject the request and an exception will be thrown.
+    /// </remarks>
+    public: static void SetCpuAffinity(const std::vector<std::size_t> &processorIndices);
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Platform
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+#endif // NUCLEX_PLATFORM_PLATFORM_LINUXTHREADAPI_H
@@ -0,0 +1,113 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "X86CpuidApi.h"
+
+#if defined(NUCLEX_PLATFORM_X86)
+
+#if defined(_MSC_VER)
+#include <intrin.h> // for __cpuidex(), _xgetbv()
+#else
+#include <cpuid.h> // for __get_cpuid_max(), __cpuid_count()
+#endif
+
+#include <cstring> // for std::memcpy()
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Executes the CPUID instruction without checking the leaf</summary>
+  /// <param name="leaf">Leaf (function number in EAX) that will be queried</param>
+  /// <param name="subleaf">Subleaf (in ECX) for leaves that have them</param>
+  /// <param name="registers">Receives the EAX, EBX, ECX and EDX registers</param>
+  void executeCpuid(
+    std::uint32_t leaf, std::uint32_t subleaf, std::uint32_t (&registers)[4]
+  ) noexcept {
+#if defined(_MSC_VER)
+    int signedRegisters[4];
+    ::__cpuidex(signedRegisters, static_cast<int>(leaf), static_cast<int>(subleaf));
+    std::memcpy(registers, signedRegisters, sizeof(registers));
+#else
+    __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Platform {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool X86CpuidApi::TryQuery(
+    std::uint32_t leaf, std::uint32_t subleaf, std::uint32_t (&registers)[4]
+  ) noexcept {
+
+    // Leaf 0 reports the highest basic leaf, leaf 0x80000000 the highest extended leaf.
+    // Processors answer leaves beyond that with the contents of their highest basic leaf,
+    // which would look like valid (but wrong) data, so we have to check first.
+    std::uint32_t rangeStart = (leaf & 0x80000000U);
+    executeCpuid(rangeStart, 0, registers);
+    if(leaf > registers[Eax]) {
+      return false;
+    }
+
+    executeCpuid(leaf, subleaf, registers);
+    return true;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::string X86CpuidApi::GetVendorId() {
+    std::uint32_t registers[4];
+    executeCpuid(0, 0, registers);
+
+    // The vendor string is stored in EBX, EDX and ECX, in that order
+    char vendorId[12];
+    std::memcpy(vendorId, &registers[Ebx], 4);
+    std::memcpy(vendorId + 4, &registers[Edx], 4);
+    std::memcpy(vendorId + 8, &registers[Ecx], 4);
+
+    return std::string(vendorId, 12);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::uint64_t X86CpuidApi::GetEnabledXsaveFeatures() noexcept {
+#if defined(_MSC_VER)
+    return static_cast<std::uint64_t>(::_xgetbv(0));
+#else
+    // GCC only offers the _xgetbv() intrinsic when compiling with -mxsave,
+    // which would allow it to use XSAVE instructions everywhere else, too.
+    std::uint32_t low, high;
+    __asm__ __volatile__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+    return (static_cast<std::uint64_t>(high) << 32) | low;
+#endif
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Platform
+
+#endif // defined(NUCLEX_PLATFORM_X86)
@@ -0,0 +1,83 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_PLATFORM_X86CPUIDAPI_H
+#define NUCLEX_PLATFORM_PLATFORM_X86CPUIDAPI_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_X86)
+
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint32_t, std::uint64_t
+#include <string> // for std::string
+
+namespace Nuclex { namespace Platform { namespace Platform {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Wraps the CPUID instruction of x86 and AMD64 processors</summary>
+  /// <remarks>
+  ///   CPUID reports about the processor it executes on. On hybrid CPUs, the answers
+  ///   can differ between performance and eco cores (mostly in the cache sizes).
+  /// </remarks>
+  class X86CpuidApi {
+
+    /// <summary>Index of the EAX register in the register array</summary>
+    public: static const std::size_t Eax = 0;
+    /// <summary>Index of the EBX register in the register array</summary>
+    public: static const std::size_t Ebx = 1;
+    /// <summary>Index of the ECX register in the register array</summary>
+    public: static const std::size_t Ecx = 2;
+    /// <summary>Index of the EDX register in the register array</summary>
+    public: static const std::size_t Edx = 3;
+
+    /// <summary>Queries a leaf of the CPUID instruction</summary>
+    /// <param name="leaf">Leaf (function number in EAX) that will be queried</param>
+    /// <param name="subleaf">Subleaf (in ECX) for leaves that have them</param>
+    /// <param name="registers">Receives the EAX, EBX, ECX and EDX registers</param>
+    /// <returns>
+    ///   True if the processor supports the leaf, false if it is beyond the highest
+    ///   basic or extended leaf the processor knows about
+    /// </returns>
+    public: static bool TryQuery(
+      std::uint32_t leaf, std::uint32_t subleaf, std::uint32_t (&registers)[4]
+    ) noexcept;
+
+    /// <summary>Retrieves the vendor string of the processor</summary>
+    /// <returns>The vendor string, such as 'GenuineIntel' or 'AuthenticAMD'</returns>
+    public: static std::string GetVendorId();
+
+    /// <summary>Retrieves the register states the operating system saves and restores</summary>
+    /// <returns>The contents of the XCR0 extended control register</returns>
+    /// <remarks>
+    ///   Must only be called if CPUID leaf 1 reports the OSXSAVE flag (ECX bit 27),
+    ///   otherwise the XGETBV instruction will raise an invalid opcode exception.
+    /// </remarks>
+    public: static std::uint64_t GetEnabledXsaveFeatures() noexcept;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Platform
+
+#endif // defined(NUCLEX_PLATFORM_X86)
+
+#endif // NUCLEX_PLATFORM_PLATFORM_X86CPUIDAPI_H
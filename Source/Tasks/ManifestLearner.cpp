@@ -0,0 +1,477 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./ManifestLearner.h"
+#include "./TaskUsageLedger.h" // for TaskUsageLedger::GetReadableTypeName()
+#include "Nuclex/Platform/Tasks/ResourceManifest.h" // for ResourceManifest
+#include "../Hardware/StringHelper.h" // for StringHelper
+
+#include <Nuclex/Support/Text/LexicalAppend.h> // for lexical_append()
+
+#include <algorithm> // for std::min(), std::max(), std::clamp()
+#include <cmath> // for std::sqrt(), std::ceil()
+#include <limits> // for std::numeric_limits
+#include <vector> // for std::vector
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Fraction of the declared amount below which no amount will be lowered</summary>
+  /// <remarks>
+  ///   Only applies to CPU cores of tasks that declared a single core or opted in via
+  ///   <see cref="ResourceManifest.CpuCoresMayBeLowered" />. Everything else is never
+  ///   lowered below the declared amount.
+  /// </remarks>
+  const double MinimumDeclaredFraction = 0.25;
+
+  /// <summary>Multiple of the declared amount above which no amount will be raised</summary>
+  const double MaximumDeclaredMultiple = 2.0;
+
+  /// <summary>Number of standard deviations added on top of the average</summary>
+  const double DeviationAllowance = 2.0;
+
+  /// <summary>Number of tab-separated fields in each line of a profile</summary>
+  const std::size_t ProfileFieldCount = 8;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Updates an exponentially weighted moving average and variance</summary>
+  /// <param name="mean">Moving average that will be updated</param>
+  /// <param name="variance">Moving variance that will be updated</param>
+  /// <param name="isFirst">Whether this is the first value ever observed</param>
+  /// <param name="value">Value that has been observed</param>
+  /// <param name="smoothingFactor">Weight of the new value</param>
+  void updateMovingStatistics(
+    double &mean, double &variance, bool isFirst, double value, double smoothingFactor
+  ) {
+    if(isFirst) {
+      mean = value;
+      variance = 0.0;
+    } else {
+      double difference = value - mean;
+      double increment = smoothingFactor * difference;
+      mean += increment;
+      variance = (1.0 - smoothingFactor) * (variance + difference * increment);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Builds a resource manifest from the amounts of each resource</summary>
+  /// <param name="amounts">Amount of each resource, indexed by resource type</param>
+  /// <param name="isPresent">Whether each resource is listed in the manifest</param>
+  /// <returns>A new resource manifest listing the present resources</returns>
+  std::shared_ptr<Nuclex::Platform::Tasks::ResourceManifest> buildManifest(
+    const std::array<std::size_t, Nuclex::Platform::Tasks::MaximumResourceType + 1> &amounts,
+    const std::array<bool, Nuclex::Platform::Tasks::MaximumResourceType + 1> &isPresent
+  ) {
+    using Nuclex::Platform::Tasks::ResourceManifest;
+    using Nuclex::Platform::Tasks::ResourceType;
+
+    std::shared_ptr<ResourceManifest> manifest;
+    for(std::size_t index = 0; index < amounts.size(); ++index) {
+      if(isPresent[index]) {
+        std::shared_ptr<ResourceManifest> single = ResourceManifest::Create(
+          static_cast<ResourceType>(index), amounts[index]
+        );
+        if(manifest) {
+          manifest = ResourceManifest::Combine(manifest, single);
+        } else {
+          manifest = single;
+        }
+      }
+    }
+
+    return manifest;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Splits a line of text at tab characters</summary>
+  /// <param name="line">Line that will be split</param>
+  /// <returns>The individual fields in the line</returns>
+  std::vector<std::string_view> splitAtTabs(const std::string_view &line) {
+    std::vector<std::string_view> fields;
+
+    std::string_view::size_type start = 0;
+    for(;;) {
+      std::string_view::size_type end = line.find('\t', start);
+      if(end == std::string_view::npos) {
+        fields.push_back(line.substr(start));
+        return fields;
+      }
+      fields.push_back(line.substr(start, end - start));
+      start = end + 1;
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Parses a non-negative, finite number from a field of a profile</summary>
+  /// <param name="field">Field that will be parsed</param>
+  /// <param name="value">Receives the parsed number</param>
+  /// <returns>True if the field contained a usable number and nothing else</returns>
+  bool tryParseAmount(std::string_view field, double &value) {
+    using Nuclex::Platform::Hardware::StringHelper;
+
+    if(!StringHelper::TryTakeNumber(field, value) || !field.empty()) {
+      return false;
+    }
+
+    return (value >= 0.0) && (value <= std::numeric_limits<double>::max());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  const std::size_t ManifestLearner::MinimumObservationCount = 3;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  ManifestLearner::ManifestLearner(
+    double smoothingFactor /* = 0.2 */, double safetyMargin /* = 0.25 */
+  ) :
+    smoothingFactor(smoothingFactor),
+    safetyMargin(safetyMargin),
+    resourceMaximums(),
+    statisticsMutex(),
+    statistics(),
+    pendingStatistics(),
+    typeNames() {
+    this->resourceMaximums.fill(std::numeric_limits<std::size_t>::max());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void ManifestLearner::SetResourceMaximum(ResourceType resourceType, std::size_t maximumAmount) {
+    std::lock_guard<std::mutex> statisticsLock(this->statisticsMutex);
+    this->resourceMaximums[static_cast<std::size_t>(resourceType)] = maximumAmount;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void ManifestLearner::Observe(
+    const std::type_info &taskType, double coresUsed, double touchedMemory,
+    double peakResidentMemory /* = -1.0 */
+  ) {
+    std::lock_guard<std::mutex> statisticsLock(this->statisticsMutex);
+
+    Statistics &taskStatistics = getStatistics(taskType);
+    updateMovingStatistics(
+      taskStatistics.CoresMean, taskStatistics.CoresVariance,
+      (taskStatistics.ObservationCount == 0), std::max(coresUsed, 0.0),
+      this->smoothingFactor
+    );
+    ++taskStatistics.ObservationCount;
+
+    if(touchedMemory >= 0.0) {
+      updateMovingStatistics(
+        taskStatistics.MemoryMean, taskStatistics.MemoryVariance,
+        (taskStatistics.MemoryObservationCount == 0), touchedMemory,
+        this->smoothingFactor
+      );
+      ++taskStatistics.MemoryObservationCount;
+    }
+    if(peakResidentMemory > 0.0) {
+      taskStatistics.MemoryCeiling = std::max(taskStatistics.MemoryCeiling, peakResidentMemory);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::shared_ptr<ResourceManifest> ManifestLearner::GetEffectiveManifest(
+    const std::type_info &taskType, const std::shared_ptr<ResourceManifest> &declared
+  ) {
+    if(!declared) {
+      return declared;
+    }
+
+    std::lock_guard<std::mutex> statisticsLock(this->statisticsMutex);
+
+    Statistics &taskStatistics = getStatistics(taskType);
+    if(taskStatistics.ObservationCount < MinimumObservationCount) {
+      return declared;
+    }
+
+    // Sum up the declared amounts by type first, a manifest may list a type twice
+    std::array<std::size_t, MaximumResourceType + 1> amounts;
+    std::array<bool, MaximumResourceType + 1> isPresent;
+    amounts.fill(0);
+    isPresent.fill(false);
+    for(std::size_t index = 0; index < declared->Count; ++index) {
+      std::size_t typeIndex = static_cast<std::size_t>(declared->Resources[index].Type);
+      amounts[typeIndex] += declared->Resources[index].Amount;
+      isPresent[typeIndex] = true;
+    }
+
+    bool isAdjusted = false;
+    {
+      const std::size_t coresIndex = static_cast<std::size_t>(ResourceType::CpuCores);
+      if(amounts[coresIndex] > 0) {
+
+        // Only the processor time of the thread calling Run() is measured, so a task
+        // that spreads its work over several threads would look like it used one core.
+        bool mayBeLowered = (amounts[coresIndex] == 1) || declared->CpuCoresMayBeLowered;
+        std::size_t effectiveCores = getEffectiveAmount(
+          ResourceType::CpuCores,
+          taskStatistics.CoresMean, taskStatistics.CoresVariance, amounts[coresIndex],
+          mayBeLowered
+        );
+        isAdjusted |= (effectiveCores != amounts[coresIndex]);
+        amounts[coresIndex] = effectiveCores;
+      }
+
+      const std::size_t memoryIndex = static_cast<std::size_t>(ResourceType::SystemMemory);
+      bool isMemoryKnown = (taskStatistics.MemoryObservationCount >= MinimumObservationCount);
+      if(isMemoryKnown && (amounts[memoryIndex] > 0)) {
+
+        // Page faults only reveal memory the task touched for the first time, a task
+        // reusing memory its allocator already holds would seem to use almost nothing.
+        // So the touched memory is only used to raise the amount.
+        std::size_t effectiveMemory = getEffectiveAmount(
+          ResourceType::SystemMemory,
+          taskStatistics.MemoryMean, taskStatistics.MemoryVariance, amounts[memoryIndex],
+          false
+        );
+
+        // No task can use more memory than the whole process holds, so if the process
+        // never came close to the declared amount, the declaration can safely be lowered
+        if((effectiveMemory == amounts[memoryIndex]) && (taskStatistics.MemoryCeiling > 0.0)) {
+          effectiveMemory = std::min(
+            effectiveMemory,
+            getEffectiveAmount(
+              ResourceType::SystemMemory,
+              taskStatistics.MemoryCeiling, 0.0, amounts[memoryIndex], true
+            )
+          );
+        }
+        isAdjusted |= (effectiveMemory != amounts[memoryIndex]);
+        amounts[memoryIndex] = effectiveMemory;
+      }
+    }
+    if(!isAdjusted) {
+      return declared;
+    }
+
+    // Most tasks of a type share the same manifest and the learned amounts settle
+    // quickly, so reuse the previous effective manifest if nothing changed
+    if(taskStatistics.CachedEffective && (taskStatistics.CachedDeclared == declared)) {
+      const ResourceManifest &cached = *taskStatistics.CachedEffective;
+      bool isSame = true;
+      for(std::size_t index = 0; index < cached.Count; ++index) {
+        std::size_t typeIndex = static_cast<std::size_t>(cached.Resources[index].Type);
+        isSame &= (cached.Resources[index].Amount == amounts[typeIndex]);
+      }
+      if(isSame) {
+        return taskStatistics.CachedEffective;
+      }
+    }
+
+    std::shared_ptr<ResourceManifest> effective = buildManifest(amounts, isPresent);
+    effective->AccessedHardDriveMask = declared->AccessedHardDriveMask;
+    effective->CpuCoresMayBeLowered = declared->CpuCoresMayBeLowered;
+
+    taskStatistics.CachedDeclared = declared;
+    taskStatistics.CachedEffective = effective;
+
+    return effective;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::string ManifestLearner::Serialize() const {
+    using Nuclex::Support::Text::lexical_append;
+
+    std::string profile;
+
+    std::lock_guard<std::mutex> statisticsLock(this->statisticsMutex);
+
+    const auto appendLine = [&profile](const std::string &name, const Statistics &values) {
+      profile.append(name);
+      profile.push_back('\t');
+      lexical_append(profile, values.ObservationCount);
+      profile.push_back('\t');
+      lexical_append(profile, values.CoresMean);
+      profile.push_back('\t');
+      lexical_append(profile, values.CoresVariance);
+      profile.push_back('\t');
+      lexical_append(profile, values.MemoryObservationCount);
+      profile.push_back('\t');
+      lexical_append(profile, values.MemoryMean);
+      profile.push_back('\t');
+      lexical_append(profile, values.MemoryVariance);
+      profile.push_back('\t');
+      lexical_append(profile, values.MemoryCeiling);
+      profile.push_back('\n');
+    };
+
+    for(const auto &entry : this->statistics) {
+      if(entry.second.ObservationCount > 0) {
+        appendLine(this->typeNames.at(entry.first), entry.second);
+      }
+    }
+
+    // Keep what was loaded for task types that didn't run this time, otherwise
+    // rarely used tasks would forget everything learned about them on each save
+    for(const auto &entry : this->pendingStatistics) {
+      appendLine(entry.first, entry.second);
+    }
+
+    return profile;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void ManifestLearner::Deserialize(const std::string_view &profile) {
+    std::lock_guard<std::mutex> statisticsLock(this->statisticsMutex);
+
+    std::string_view::size_type lineStart = 0;
+    while(lineStart < profile.length()) {
+      std::string_view::size_type lineEnd = profile.find('\n', lineStart);
+      if(lineEnd == std::string_view::npos) {
+        lineEnd = profile.length();
+      }
+
+      std::string_view line = profile.substr(lineStart, lineEnd - lineStart);
+      lineStart = lineEnd + 1;
+      if(!line.empty() && (line.back() == '\r')) {
+        line.remove_suffix(1);
+      }
+
+      std::vector<std::string_view> fields = splitAtTabs(line);
+      if((fields.size() != ProfileFieldCount) || fields[0].empty()) {
+        continue;
+      }
+
+      double observationCount, memoryObservationCount;
+      Statistics loaded = Statistics();
+      bool isValid = (
+        tryParseAmount(fields[1], observationCount) &&
+        tryParseAmount(fields[2], loaded.CoresMean) &&
+        tryParseAmount(fields[3], loaded.CoresVariance) &&
+        tryParseAmount(fields[4], memoryObservationCount) &&
+        tryParseAmount(fields[5], loaded.MemoryMean) &&
+        tryParseAmount(fields[6], loaded.MemoryVariance) &&
+        tryParseAmount(fields[7], loaded.MemoryCeiling)
+      );
+      if(!isValid || (observationCount < 1.0)) {
+        continue;
+      }
+
+      loaded.ObservationCount = static_cast<std::size_t>(observationCount);
+      loaded.MemoryObservationCount = static_cast<std::size_t>(memoryObservationCount);
+
+      // Task types that already ran in this process have fresher statistics
+      std::string name(fields[0]);
+      bool isAlreadyObserved = false;
+      for(const auto &entry : this->typeNames) {
+        if(entry.second == name) {
+          isAlreadyObserved = (this->statistics[entry.first].ObservationCount > 0);
+          if(!isAlreadyObserved) {
+            this->statistics[entry.first] = loaded;
+            isAlreadyObserved = true;
+          }
+          break;
+        }
+      }
+      if(!isAlreadyObserved) {
+        this->pendingStatistics[name] = loaded;
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  ManifestLearner::Statistics &ManifestLearner::getStatistics(const std::type_info &taskType) {
+    std::type_index typeIndex(taskType);
+
+    std::unordered_map<std::type_index, Statistics>::iterator iterator = (
+      this->statistics.find(typeIndex)
+    );
+    if(iterator != this->statistics.end()) {
+      return iterator->second;
+    }
+
+    // First time this type is seen, pick up statistics loaded from a profile if any
+    std::string name = TaskUsageLedger::GetReadableTypeName(typeIndex);
+    Statistics &taskStatistics = this->statistics[typeIndex];
+
+    std::unordered_map<std::string, Statistics>::iterator pending = (
+      this->pendingStatistics.find(name)
+    );
+    if(pending == this->pendingStatistics.end()) {
+      taskStatistics = Statistics();
+    } else {
+      taskStatistics = pending->second;
+      this->pendingStatistics.erase(pending);
+    }
+
+    this->typeNames.emplace(typeIndex, std::move(name));
+
+    return taskStatistics;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::size_t ManifestLearner::getEffectiveAmount(
+    ResourceType resourceType,
+    double mean, double variance, std::size_t declared, bool mayBeLowered
+  ) const {
+    double learned = mean + DeviationAllowance * std::sqrt(std::max(variance, 0.0));
+    learned *= (1.0 + this->safetyMargin);
+
+    // Never go above the largest unit, unless the task declared more than that itself
+    // (in which case it wouldn't have been admitted with its declared amount either)
+    double lowest = static_cast<double>(declared);
+    if(mayBeLowered) {
+      lowest *= MinimumDeclaredFraction;
+    }
+    double highest = std::min(
+      static_cast<double>(declared) * MaximumDeclaredMultiple,
+      static_cast<double>(
+        std::max(declared, this->resourceMaximums[static_cast<std::size_t>(resourceType)])
+      )
+    );
+
+    // CPU time is only measured for the thread calling Run(), so the observed cores
+    // never exceed one and can't show that a task needs more cores than it declared
+    if(resourceType == ResourceType::CpuCores) {
+      highest = std::min(highest, static_cast<double>(declared));
+    }
+
+    double effective = std::ceil(std::clamp(learned, lowest, highest));
+    if(effective < 1.0) {
+      return 1; // A task that declared the resource keeps at least one unit of it
+    }
+
+    return static_cast<std::size_t>(effective);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
@@ -0,0 +1,205 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_TASKS_MANIFESTLEARNER_H
+#define NUCLEX_PLATFORM_TASKS_MANIFESTLEARNER_H
+
+#include "Nuclex/Platform/Config.h"
+#include "Nuclex/Platform/Tasks/ResourceType.h" // for ResourceType
+
+#include <array> // for std::array
+#include <cstddef> // for std::size_t
+#include <memory> // for std::shared_ptr
+#include <mutex> // for std::mutex
+#include <string> // for std::string
+#include <string_view> // for std::string_view
+#include <typeindex> // for std::type_index
+#include <unordered_map> // for std::unordered_map
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  class ResourceManifest;
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Learns how many CPU cores and how much memory types of tasks really use</summary>
+  /// <remarks>
+  ///   <para>
+  ///     For each type of task, an exponentially weighted moving average and variance
+  ///     of the CPU cores kept busy and the memory touched is maintained. Once enough
+  ///     runs have been observed, the declared amounts in the task's resource manifest
+  ///     are replaced by the average plus two standard deviations plus a safety margin.
+  ///   </para>
+  ///   <para>
+  ///     The adjusted amounts never exceed twice the declared amount, so a task whose
+  ///     behavior changes suddenly (different input data) cannot starve the system.
+  ///     CPU cores are never raised above the declared amount at all because a single
+  ///     thread can't show more than one busy core. Resources a task did not declare
+  ///     are never added.
+  ///   </para>
+  ///   <para>
+  ///     The per-task measurements can only ever underestimate: CPU time is taken from
+  ///     the thread running the task and memory from its page faults, which miss memory
+  ///     reused from the allocator. So they are only used to raise memory and CPU cores
+  ///     are only lowered if the task declared a single core or its manifest allows it via
+  ///     <see cref="ResourceManifest.CpuCoresMayBeLowered" />, down to a quarter.
+  ///   </para>
+  ///   <para>
+  ///     Memory is lowered (down to a quarter as well) only by the peak resident memory
+  ///     of the whole process, which no task can exceed. This works for processes whose
+  ///     tasks declare far more memory than the process ever holds, but the more other
+  ///     memory the process keeps, the less room there is to lower anything.
+  ///   </para>
+  /// </remarks>
+  class ManifestLearner {
+
+    /// <summary>Number of runs that need to be observed before adjusting a manifest</summary>
+    public: static const std::size_t MinimumObservationCount;
+
+    /// <summary>Initializes a new manifest learner</summary>
+    /// <param name="smoothingFactor">
+    ///   Weight of each new observation in the moving averages, between 0 and 1
+    /// </param>
+    /// <param name="safetyMargin">
+    ///   Fraction by which the learned amounts are increased before being used
+    /// </param>
+    public: ManifestLearner(double smoothingFactor = 0.2, double safetyMargin = 0.25);
+
+    /// <summary>Limits how far the amount of a resource may be raised</summary>
+    /// <param name="resourceType">Resource whose maximum will be set</param>
+    /// <param name="maximumAmount">Largest amount the resource can be admitted with</param>
+    /// <remarks>
+    ///   Without this, a task declaring an amount close to what the system has could be
+    ///   raised above it by the learned amount and would then never be admitted.
+    /// </remarks>
+    public: void SetResourceMaximum(ResourceType resourceType, std::size_t maximumAmount);
+
+    /// <summary>Records the resources one run of a task has used</summary>
+    /// <param name="taskType">Type of the task that was run</param>
+    /// <param name="coresUsed">Number of CPU cores the task kept busy on average</param>
+    /// <param name="touchedMemory">
+    ///   Bytes of memory the task touched, negative if memory use could not be measured
+    /// </param>
+    /// <param name="peakResidentMemory">
+    ///   Highest resident memory of the whole process so far in bytes, negative if unknown
+    /// </param>
+    public: void Observe(
+      const std::type_info &taskType, double coresUsed, double touchedMemory,
+      double peakResidentMemory = -1.0
+    );
+
+    /// <summary>Provides the manifest that should be used to admit a task</summary>
+    /// <param name="taskType">Type of the task that will be admitted</param>
+    /// <param name="declared">Resource manifest the task has declared</param>
+    /// <returns>
+    ///   The declared manifest if too little is known about the task, otherwise
+    ///   a copy of the declared manifest with the learned amounts
+    /// </returns>
+    public: std::shared_ptr<ResourceManifest> GetEffectiveManifest(
+      const std::type_info &taskType, const std::shared_ptr<ResourceManifest> &declared
+    );
+
+    /// <summary>Writes everything learned so far into a string</summary>
+    /// <returns>A string containing one line of learned values per type of task</returns>
+    public: std::string Serialize() const;
+
+    /// <summary>Takes over values learned earlier, i.e. by a previous run of the program</summary>
+    /// <param name="profile">String produced by <see cref="Serialize" /></param>
+    /// <remarks>
+    ///   Lines that can't be parsed are skipped. Task types that have already been
+    ///   observed in this run keep what has been learned for them.
+    /// </remarks>
+    public: void Deserialize(const std::string_view &profile);
+
+    #pragma region struct Statistics
+
+    /// <summary>Moving statistics learned for one type of task</summary>
+    private: struct Statistics {
+
+      /// <summary>Number of runs that have been observed</summary>
+      public: std::size_t ObservationCount;
+      /// <summary>Moving average of the CPU cores kept busy</summary>
+      public: double CoresMean;
+      /// <summary>Moving variance of the CPU cores kept busy</summary>
+      public: double CoresVariance;
+      /// <summary>Number of runs in which the touched memory was measured</summary>
+      public: std::size_t MemoryObservationCount;
+      /// <summary>Moving average of the memory touched in bytes</summary>
+      public: double MemoryMean;
+      /// <summary>Moving variance of the memory touched</summary>
+      public: double MemoryVariance;
+      /// <summary>Highest resident memory of the process seen after a run, 0 if unknown</summary>
+      public: double MemoryCeiling;
+      /// <summary>Declared manifest the cached effective manifest was made from</summary>
+      public: std::shared_ptr<ResourceManifest> CachedDeclared;
+      /// <summary>Effective manifest that was last made for the task type</summary>
+      public: std::shared_ptr<ResourceManifest> CachedEffective;
+
+    };
+
+    #pragma endregion // struct Statistics
+
+    /// <summary>Looks up or creates the statistics for a type of task</summary>
+    /// <param name="taskType">Type of task whose statistics will be returned</param>
+    /// <returns>The statistics of the specified type of task</returns>
+    /// <remarks>The caller must hold the statistics mutex</remarks>
+    private: Statistics &getStatistics(const std::type_info &taskType);
+
+    /// <summary>Calculates the amount of a resource that should be admitted</summary>
+    /// <param name="resourceType">Resource the amount is calculated for</param>
+    /// <param name="mean">Moving average of the amount used</param>
+    /// <param name="variance">Moving variance of the amount used</param>
+    /// <param name="declared">Amount the task declared</param>
+    /// <param name="mayBeLowered">Whether the amount may drop below the declared amount</param>
+    /// <returns>The amount that should be reserved for the task</returns>
+    private: std::size_t getEffectiveAmount(
+      ResourceType resourceType,
+      double mean, double variance, std::size_t declared, bool mayBeLowered
+    ) const;
+
+    /// <summary>Weight of each new observation in the moving averages</summary>
+    private: double smoothingFactor;
+    /// <summary>Fraction by which the learned amounts are increased</summary>
+    private: double safetyMargin;
+    /// <summary>Largest amount of each resource a task can be admitted with</summary>
+    private: std::array<std::size_t, MaximumResourceType + 1> resourceMaximums;
+    /// <summary>Must be held while accessing the statistics</summary>
+    private: mutable std::mutex statisticsMutex;
+    /// <summary>Statistics of all task types that have been run</summary>
+    private: std::unordered_map<std::type_index, Statistics> statistics;
+    /// <summary>Statistics loaded from a profile for types not seen yet, by name</summary>
+    private: std::unordered_map<std::string, Statistics> pendingStatistics;
+    /// <summary>Readable names of the task types in the statistics</summary>
+    private: std::unordered_map<std::type_index, std::string> typeNames;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
+
+#endif // NUCLEX_PLATFORM_TASKS_MANIFESTLEARNER_H
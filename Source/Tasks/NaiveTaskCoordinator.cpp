@@ -21,14 +21,150 @@ limitations under the License.
 #define NUCLEX_PLATFORM_SOURCE 1
 
 #include "Nuclex/Platform/Tasks/NaiveTaskCoordinator.h"
+#include "Nuclex/Platform/Tasks/NaiveTaskCoordinatorFactory.h"
+#include "Nuclex/Platform/Tasks/Task.h"
+#include "Nuclex/Platform/Tasks/TaskEnvironment.h"
+#include "Nuclex/Platform/Tasks/ResourceManifest.h"
+#include "Nuclex/Platform/Hardware/ClockInfo.h"
+#include "Nuclex/Platform/Hardware/MemoryInfo.h"
+#include "Nuclex/Platform/Hardware/MemoryPressure.h"
 #include "./ResourceBudget.h"
+#include "./TaskUsageLedger.h"
+#include "./ManifestLearner.h"
+#include "../Platform/LinuxThreadApi.h"
+#include "../Platform/LinuxFileApi.h"
+#include "../Platform/WindowsFileApi.h"
+#include "../Platform/WindowsApi.h"
+#include "../Hardware/LinuxSysNodeTreeReader.h"
+#include "../Hardware/LinuxSysCpuTreeReader.h"
+#include "../Hardware/LinuxMemoryPressureReader.h"
+
+#include <Nuclex/Support/Threading/StopSource.h> // for StopSource
+#include <Nuclex/Support/Text/StringConverter.h> // for StringConverter
 
 #include <stdexcept> // for std::runtime_error
+#include <algorithm> // for std::find(), std::find_if(), std::min(), std::max()
+#include <iterator> // for std::back_inserter()
+#include <typeinfo> // for typeid
+#include <thread> // for std::this_thread::yield()
+
+#if defined(NUCLEX_PLATFORM_X86)
+#include <immintrin.h> // for _mm_pause()
+#endif
 
 namespace {
 
   // ------------------------------------------------------------------------------------------- //
 
+  /// <summary>Minimum number of extra threads that can be used by blocked tasks</summary>
+  const std::size_t MinimumBlockedTaskThreadCount = 8;
+
+  /// <summary>Slowest clock read in nanoseconds at which polling is still worthwhile</summary>
+  const double MaximumPollingClockReadNanoseconds = 1000.0;
+
+  /// <summary>Slowest clock read in nanoseconds at which spinning is still worthwhile</summary>
+  const double MaximumSpinningClockReadNanoseconds = 100.0;
+
+  /// <summary>Minimum number of CPU cores before the coordinator will spin</summary>
+  const std::size_t MinimumSpinningCpuCoreCount = 4;
+
+  /// <summary>Shortest and longest time the coordination thread will poll</summary>
+  const std::chrono::microseconds MinimumWakePollDuration(10), MaximumWakePollDuration(200);
+
+  /// <summary>Number of times the wake-up count is checked between clock reads</summary>
+  const std::size_t WakeUpChecksPerClockRead = 16;
+
+  /// <summary>Number of bytes in a megabyte</summary>
+  const std::uint64_t BytesPerMegabyte = 1024 * 1024;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Tells the processor that the calling thread is in a spin-wait loop</summary>
+  /// <remarks>
+  ///   This lets a hyper-threaded core give its resources to the sibling thread and
+  ///   avoids a pipeline flush when the spin loop ends.
+  /// </remarks>
+  inline void relaxProcessor() {
+#if defined(NUCLEX_PLATFORM_X86)
+    _mm_pause();
+#elif defined(NUCLEX_PLATFORM_ARM) && (defined(__GNUC__) || defined(__clang__))
+    __asm__ __volatile__("yield");
+#endif
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Tracks the task a thread pool thread is executing</summary>
+  struct TaskThreadState {
+
+    /// <summary>Task coordinator whose task is being executed, null if none</summary>
+    public: Nuclex::Platform::Tasks::NaiveTaskCoordinator *Coordinator;
+    /// <summary>Number of blocking regions the task has entered</summary>
+    public: std::size_t BlockingRegionDepth;
+    /// <summary>Resource units the task has been assigned</summary>
+    public: const Nuclex::Platform::Tasks::ResourceUnitArray *AssignedUnits;
+    /// <summary>Number of CPU cores the task itself (not its environment) occupies</summary>
+    public: std::size_t CpuCoreCount;
+    /// <summary>Whether the task's CPU cores are currently handed back to the budget</summary>
+    public: bool AreCpuCoresReleased;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Task the calling thread is executing for a task coordinator</summary>
+  thread_local TaskThreadState currentTaskThreadState = { nullptr, 0, nullptr, 0, false };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Adds up the CPU cores listed in a resource manifest</summary>
+  /// <param name="manifest">Resource manifest whose CPU cores will be counted</param>
+  /// <returns>The number of CPU cores the manifest lists</returns>
+  std::size_t countCpuCores(
+    const std::shared_ptr<Nuclex::Platform::Tasks::ResourceManifest> &manifest
+  ) {
+    using Nuclex::Platform::Tasks::ResourceType;
+
+    std::size_t cpuCoreCount = 0;
+    if(manifest) {
+      for(std::size_t index = 0; index < manifest->Count; ++index) {
+        if(manifest->Resources[index].Type == ResourceType::CpuCores) {
+          cpuCoreCount += manifest->Resources[index].Amount;
+        }
+      }
+    }
+
+    return cpuCoreCount;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Copies a resource manifest, leaving out its CPU cores</summary>
+  /// <param name="manifest">Resource manifest that will be copied</param>
+  /// <returns>A manifest with all resources except CPU cores, null if none are left</returns>
+  std::shared_ptr<Nuclex::Platform::Tasks::ResourceManifest> withoutCpuCores(
+    const std::shared_ptr<Nuclex::Platform::Tasks::ResourceManifest> &manifest
+  ) {
+    using Nuclex::Platform::Tasks::ResourceManifest;
+    using Nuclex::Platform::Tasks::ResourceType;
+
+    std::shared_ptr<ResourceManifest> remaining;
+    for(std::size_t index = 0; index < manifest->Count; ++index) {
+      const ResourceManifest::Entry &entry = manifest->Resources[index];
+      if(entry.Type != ResourceType::CpuCores) {
+        std::shared_ptr<ResourceManifest> single = ResourceManifest::Create(
+          entry.Type, entry.Amount
+        );
+        if(remaining) {
+          remaining = ResourceManifest::Combine(remaining, single);
+        } else {
+          remaining = single;
+        }
+      }
+    }
+
+    return remaining;
+  }
 
   // ------------------------------------------------------------------------------------------- //
 
@@ -41,13 +177,33 @@ namespace Nuclex { namespace Platform { namespace Tasks {
   NaiveTaskCoordinator::NaiveTaskCoordinator() :
     availableResources(std::make_unique<ResourceBudget>()),
     totalCpuCoreCount(0),
+    cpuCoreUnits(),
+    unpinnedProcessors(),
+    numaNodeCount(0),
+    hasHybridCpuCoreUnits(false),
+    corePinningEnabled(false),
+    usageAccountingEnabled(false),
+    usageLedger(std::make_unique<TaskUsageLedger>()),
+    manifestLearningEnabled(false),
+    manifestLearner(std::make_unique<ManifestLearner>()),
+    cancellationTrigger(Nuclex::Support::Threading::StopSource::Create()),
+    regularTaskThreadCount(0),
+    maximumTaskThreadCount(0),
+    runningTaskCount(0),
+    blockedTaskCount(0),
     threadPool(), // leave the std::optional empty for now,
     coordinationThreadRunningFlag(false),
     coordinationThreadFuture(),
     coordinationThreadShutdownFlag(false),
     queueAccessMutex(),
     waitingTasks(),
-    tasksAvailableSemaphore(0) {} 
+    tasksAvailableSemaphore(0),
+    pendingWakeUpCount(0),
+    wakeStrategy(WakeStrategy::Block),
+    wakePollDuration(std::chrono::microseconds(50)),
+    environmentAccessMutex(),
+    environmentStateChanged(),
+    activeEnvironments() {}
 
   // ------------------------------------------------------------------------------------------- //
 
@@ -56,8 +212,12 @@ namespace Nuclex { namespace Platform { namespace Tasks {
     // Set everything up so a (possibly) running coordination thread will cancel at
     // the next opportunity it has.
     this->coordinationThreadShutdownFlag.store(true, std::memory_order::memory_order_release);
+    this->pendingWakeUpCount.fetch_add(1024, std::memory_order_release);
     this->tasksAvailableSemaphore.Post(1024); // Just make sure that coordation thread wakes :)
 
+    // Tasks that are still running should wrap up as quickly as they can
+    this->cancellationTrigger->Cancel();
+
     // Now, if the coordination thread actually *was* running, wait for it to shut down.
     bool coordinationThreadWasRunning = (
       this->coordinationThreadRunningFlag.load(std::memory_order::memory_order_consume)
@@ -85,12 +245,333 @@ namespace Nuclex { namespace Platform { namespace Tasks {
 
     this->availableResources->AddResource(resourceType, amountAvailable);
     if(resourceType == ResourceType::CpuCores) {
+      this->cpuCoreUnits.push_back(
+        CpuCoreUnit { amountAvailable, std::vector<std::size_t>(), false, std::size_t(-1) }
+      );
       this->totalCpuCoreCount += amountAvailable;
     }
   }
 
   // ------------------------------------------------------------------------------------------- //
 
+  void NaiveTaskCoordinator::AddCpuCores(
+    std::size_t coreCount,
+    const std::vector<std::size_t> &processorIndices,
+    bool areEcoCores /* = false */
+  ) {
+    if(this->threadPool.has_value()) {
+      throw std::logic_error(u8"Cannot add resources after Start() has been called");
+    }
+    if(processorIndices.empty()) {
+      throw std::logic_error(u8"CPU core units must consist of at least one logical processor");
+    }
+
+    this->availableResources->AddResource(ResourceType::CpuCores, coreCount);
+    this->cpuCoreUnits.push_back(
+      CpuCoreUnit { coreCount, processorIndices, areEcoCores, std::size_t(-1) }
+    );
+    this->totalCpuCoreCount += coreCount;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::size_t NaiveTaskCoordinator::AddNumaNodeResources() {
+    return AddNumaNodeResources(u8"/sys/devices", u8"/proc", u8"/sys/fs/cgroup");
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::size_t NaiveTaskCoordinator::AddNumaNodeResources(
+    const std::string &devicesPath,
+    const std::string &procPath,
+    const std::string &cgroupRootPath
+  ) {
+    if(this->threadPool.has_value()) {
+      throw std::logic_error(u8"Cannot add resources after Start() has been called");
+    }
+
+    // Unit indices of CPU cores and system memory must line up with the NUMA nodes,
+    // which isn't possible if the user has already added units of either kind.
+    bool haveCpuOrMemoryUnits = (
+      (this->availableResources->CountResourceUnits(ResourceType::CpuCores) > 0) ||
+      (this->availableResources->CountResourceUnits(ResourceType::SystemMemory) > 0)
+    );
+    if(haveCpuOrMemoryUnits) {
+      throw std::logic_error(
+        u8"NUMA nodes must be added before any other CPU core or system memory units"
+      );
+    }
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+    std::string systemDevicesPath = Platform::LinuxFileApi::JoinPaths(devicesPath, u8"system");
+    std::vector<Hardware::LinuxSysNodeTreeReader::NodeInfo> nodes = (
+      Hardware::LinuxSysNodeTreeReader::TryReadNodes(systemDevicesPath)
+    );
+
+    // Work out the usable memory for all nodes together the same way the factory does
+    // for a single memory unit, including the reserve and a cgroup memory limit
+    std::uint64_t totalNodeMemory = 0;
+    for(const Hardware::LinuxSysNodeTreeReader::NodeInfo &node : nodes) {
+      if(!node.ProcessorIndices.empty()) {
+        totalNodeMemory += node.MemoryInBytes;
+      }
+    }
+
+    Hardware::MemoryInfo memory = Hardware::MemoryInfo();
+    memory.InstalledMegabytes = static_cast<std::size_t>(totalNodeMemory / BytesPerMegabyte);
+    memory.MaximumProgramMegabytes = memory.InstalledMegabytes;
+    {
+      Hardware::MemoryPressure pressure;
+      Hardware::LinuxMemoryPressureReader(procPath, cgroupRootPath).Sample(pressure);
+      if(pressure.GroupLimitMegabytes.has_value()) {
+        memory.MaximumProgramMegabytes = std::min(
+          memory.MaximumProgramMegabytes, pressure.GroupLimitMegabytes.value()
+        );
+      }
+    }
+    double usableFraction = 0.0;
+    if(totalNodeMemory > 0) {
+      usableFraction = (
+        static_cast<double>(NaiveTaskCoordinatorFactory::GetUsableMemory(memory)) /
+        static_cast<double>(totalNodeMemory)
+      );
+    }
+
+    // On hybrid CPUs, each node gets a unit for its p-cores and one for its e-cores
+    std::vector<std::size_t> performanceProcessors, ecoProcessors;
+    bool isHybrid = Hardware::LinuxSysCpuTreeReader::TryReadHybridProcessors(
+      performanceProcessors, ecoProcessors, devicesPath
+    );
+
+    // Each node gets its share of the usable memory in proportion to its size
+    std::vector<std::size_t> nodePerformanceProcessors, nodeEcoProcessors;
+    for(const Hardware::LinuxSysNodeTreeReader::NodeInfo &node : nodes) {
+      if(node.ProcessorIndices.empty()) {
+        continue; // Memory-only node, no threads can run there
+      }
+
+      nodePerformanceProcessors.clear();
+      nodeEcoProcessors.clear();
+      if(isHybrid) {
+        std::set_intersection(
+          node.ProcessorIndices.begin(), node.ProcessorIndices.end(),
+          performanceProcessors.begin(), performanceProcessors.end(),
+          std::back_inserter(nodePerformanceProcessors)
+        );
+        std::set_intersection(
+          node.ProcessorIndices.begin(), node.ProcessorIndices.end(),
+          ecoProcessors.begin(), ecoProcessors.end(),
+          std::back_inserter(nodeEcoProcessors)
+        );
+      }
+
+      std::size_t memoryUnitIndex = this->availableResources->CountResourceUnits(
+        ResourceType::SystemMemory
+      );
+      if(nodePerformanceProcessors.empty() || nodeEcoProcessors.empty()) {
+        AddCpuCores(node.CoreCount, node.ProcessorIndices);
+      } else {
+        AddCpuCores(
+          Hardware::LinuxSysNodeTreeReader::CountPhysicalCores(
+            nodePerformanceProcessors, systemDevicesPath
+          ),
+          nodePerformanceProcessors
+        );
+        this->cpuCoreUnits.back().SystemMemoryUnitIndex = memoryUnitIndex;
+        AddCpuCores(
+          Hardware::LinuxSysNodeTreeReader::CountPhysicalCores(
+            nodeEcoProcessors, systemDevicesPath
+          ),
+          nodeEcoProcessors,
+          true
+        );
+      }
+      this->cpuCoreUnits.back().SystemMemoryUnitIndex = memoryUnitIndex;
+
+      this->availableResources->AddResource(
+        ResourceType::SystemMemory,
+        static_cast<std::size_t>(static_cast<double>(node.MemoryInBytes) * usableFraction)
+      );
+      ++this->numaNodeCount;
+    }
+#else
+    (void)devicesPath;
+    (void)procPath;
+    (void)cgroupRootPath;
+#endif
+
+    return this->numaNodeCount;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void NaiveTaskCoordinator::EnableCorePinning(bool enable /* = true */) {
+    if(this->threadPool.has_value()) {
+      throw std::logic_error(u8"Core pinning must be configured before Start() is called");
+    }
+
+    this->corePinningEnabled = enable;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void NaiveTaskCoordinator::SetWakeStrategy(
+    WakeStrategy strategy,
+    std::chrono::microseconds pollDuration /* = std::chrono::microseconds(50) */
+  ) {
+    if(this->threadPool.has_value()) {
+      throw std::logic_error(u8"The wake strategy must be configured before Start() is called");
+    }
+
+    this->wakeStrategy = strategy;
+    this->wakePollDuration = pollDuration;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void NaiveTaskCoordinator::AdaptWakeStrategy(const Hardware::ClockInfo &clockInfo) {
+    std::chrono::microseconds pollDuration(
+      static_cast<std::chrono::microseconds::rep>(clockInfo.SleepGranularityMicroseconds)
+    );
+    pollDuration = std::max(pollDuration, MinimumWakePollDuration);
+    pollDuration = std::min(pollDuration, MaximumWakePollDuration);
+
+    SetWakeStrategy(ChooseWakeStrategy(clockInfo, this->totalCpuCoreCount), pollDuration);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  WakeStrategy NaiveTaskCoordinator::ChooseWakeStrategy(
+    const Hardware::ClockInfo &clockInfo, std::size_t cpuCoreCount
+  ) {
+
+    // With only one core, any time spent polling is taken away from the tasks, and
+    // if reading the clock needs a system call, polling would be just as slow as blocking.
+    if(cpuCoreCount < 2) {
+      return WakeStrategy::Block;
+    }
+    if(clockInfo.ClockReadNanoseconds > MaximumPollingClockReadNanoseconds) {
+      return WakeStrategy::Block;
+    }
+
+    // A time stamp counter that changes its rate with the CPU frequency makes the kernel
+    // fall back to slower clocks at any time. Non-x86 CPUs report nothing and use
+    // their own constant-rate counters, so only an explicit 'false' rules spinning out.
+    bool hasStableCounter = clockInfo.HasInvariantTsc.value_or(true);
+    if(
+      hasStableCounter &&
+      (cpuCoreCount >= MinimumSpinningCpuCoreCount) &&
+      (clockInfo.ClockReadNanoseconds <= MaximumSpinningClockReadNanoseconds)
+    ) {
+      return WakeStrategy::Spin;
+    }
+
+    return WakeStrategy::Yield;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void NaiveTaskCoordinator::EnableUsageAccounting(bool enable /* = true */) {
+    this->usageAccountingEnabled.store(enable, std::memory_order_release);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<TaskUsageSummary> NaiveTaskCoordinator::SummarizeTaskUsage() const {
+    return this->usageLedger->Summarize();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void NaiveTaskCoordinator::EnableManifestLearning(bool enable /* = true */) {
+    this->manifestLearningEnabled.store(enable, std::memory_order_release);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void NaiveTaskCoordinator::SaveLearnedManifests(const std::string &path) const {
+    std::string profile = this->manifestLearner->Serialize();
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+    int fileDescriptor = Platform::LinuxFileApi::OpenFileForWriting(path);
+    try {
+      Platform::LinuxFileApi::Write(
+        fileDescriptor, reinterpret_cast<const std::uint8_t *>(profile.data()), profile.length()
+      );
+      Platform::LinuxFileApi::SetLength(fileDescriptor, profile.length());
+    }
+    catch(const std::exception &) {
+      Platform::LinuxFileApi::Close(fileDescriptor, false);
+      throw;
+    }
+    Platform::LinuxFileApi::Close(fileDescriptor);
+#elif defined(NUCLEX_PLATFORM_WINDOWS)
+    std::wstring utf16Path = Nuclex::Support::Text::StringConverter::WideFromUtf8(path);
+    ::HANDLE fileHandle = ::CreateFileW(
+      utf16Path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr
+    );
+    if(unlikely(fileHandle == INVALID_HANDLE_VALUE)) {
+      DWORD errorCode = ::GetLastError();
+      Platform::WindowsApi::ThrowExceptionForSystemError(
+        u8"Could not create file for the learned resource manifests", errorCode
+      );
+    }
+
+    DWORD writtenByteCount = 0;
+    BOOL result = ::WriteFile(
+      fileHandle, profile.data(), static_cast<DWORD>(profile.length()), &writtenByteCount, nullptr
+    );
+    if(unlikely(result == FALSE)) {
+      DWORD errorCode = ::GetLastError();
+      Platform::WindowsFileApi::CloseFile(fileHandle, false);
+      Platform::WindowsApi::ThrowExceptionForSystemError(
+        u8"Could not write the learned resource manifests", errorCode
+      );
+    }
+    Platform::WindowsFileApi::CloseFile(fileHandle);
+#endif
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool NaiveTaskCoordinator::LoadLearnedManifests(const std::string &path) {
+    std::string profile;
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+    if(!Platform::LinuxFileApi::TryReadFileInOneReadCall(path, profile)) {
+      return false;
+    }
+#elif defined(NUCLEX_PLATFORM_WINDOWS)
+    ::HANDLE fileHandle = Platform::WindowsFileApi::TryOpenExistingFileForSharedReading(
+      Nuclex::Support::Text::StringConverter::WideFromUtf8(path)
+    );
+    if(fileHandle == INVALID_HANDLE_VALUE) {
+      return false;
+    }
+
+    // The profile is a small text file, so simply read until the end is reached
+    for(;;) {
+      char buffer[4096];
+      DWORD readByteCount = 0;
+      BOOL result = ::ReadFile(fileHandle, buffer, sizeof(buffer), &readByteCount, nullptr);
+      if(unlikely(result == FALSE)) {
+        Platform::WindowsFileApi::CloseFile(fileHandle, false);
+        return false;
+      }
+      if(readByteCount == 0) {
+        break;
+      }
+      profile.append(buffer, readByteCount);
+    }
+    Platform::WindowsFileApi::CloseFile(fileHandle);
+#endif
+
+    this->manifestLearner->Deserialize(profile);
+    return true;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
   void NaiveTaskCoordinator::Start() {
     if(this->totalCpuCoreCount == 0) {
       throw std::logic_error(u8"Please add at least one CPU core before starting");
@@ -99,13 +580,60 @@ namespace Nuclex { namespace Platform { namespace Tasks {
       throw std::logic_error(u8"Start must not be called more than once");
     }
 
+#if defined(NUCLEX_PLATFORM_LINUX)
+    if(this->corePinningEnabled) {
+      distributeProcessorsToCpuCoreUnits();
+    }
+#endif
+
+    // Learned manifests must never ask for more than the largest resource unit provides
+    for(std::size_t index = 0; index <= MaximumResourceType; ++index) {
+      ResourceType resourceType = static_cast<ResourceType>(index);
+      this->manifestLearner->SetResourceMaximum(
+        resourceType, this->availableResources->QueryResourceMaximum(resourceType)
+      );
+    }
+
+    // Core preferences of tasks only matter if there are both kinds of cores to choose from
+    {
+      bool hasPerformanceCores = false, hasEcoCores = false;
+      for(const CpuCoreUnit &unit : this->cpuCoreUnits) {
+        if(unit.IsEcoCore) {
+          hasEcoCores = true;
+        } else {
+          hasPerformanceCores = true;
+        }
+      }
+      this->hasHybridCpuCoreUnits = (hasPerformanceCores && hasEcoCores);
+    }
+
+    // If more CPU core or system memory units were added after the NUMA nodes,
+    // some units belong to no node and we can't treat the units as pairs anymore.
+    if(this->numaNodeCount > 0) {
+      std::size_t systemMemoryUnitCount = this->availableResources->CountResourceUnits(
+        ResourceType::SystemMemory
+      );
+      bool unitsStillPaired = (systemMemoryUnitCount == this->numaNodeCount);
+      for(const CpuCoreUnit &unit : this->cpuCoreUnits) {
+        if(unit.SystemMemoryUnitIndex == std::size_t(-1)) {
+          unitsStillPaired = false;
+        }
+      }
+      if(!unitsStillPaired) {
+        this->numaNodeCount = 0;
+        for(CpuCoreUnit &unit : this->cpuCoreUnits) {
+          unit.SystemMemoryUnitIndex = std::size_t(-1);
+        }
+      }
+    }
+
     // Set up the thread pool.
     //
-    // We'll allow it to grow up to the size of schedulable CPU cores, so even if the user
+    // We'll allow as many tasks to run as there are schedulable CPU cores, so even if the user
     // schedules that number of invididual tasks, each blocking just 1 CPU core and riding it
     // right in the Schedule() method, we've got enough threads.
     //
-    std::size_t maximumThreadCount = this->totalCpuCoreCount;
+    this->regularTaskThreadCount = this->totalCpuCoreCount;
 
     // On top of that, we give it 4 threads per GPU, so that 4 more tasks could run tasks on
     // the GPU(s) of the system.
@@ -113,15 +641,24 @@ namespace Nuclex { namespace Platform { namespace Tasks {
     // There's no surefire formula for an upper bound of the thread count, but I tried to
     // avoid just saying INT_MAX or something here. Perhaps I should?
     //
-    maximumThreadCount += 4 * this->availableResources->CountResourceUnits(
+    this->regularTaskThreadCount += 4 * this->availableResources->CountResourceUnits(
       ResourceType::VideoMemory
     );
 
+    // Tasks waiting for I/O inside a blocking region don't count against the above,
+    // so we let the thread pool grow by up to the same number of threads again (or
+    // a handful for tiny systems) to launch other tasks in the meantime. The extra
+    // threads are retired by the thread pool again once they've become idle.
+    //
+    this->maximumTaskThreadCount = this->regularTaskThreadCount + std::max(
+      this->regularTaskThreadCount, MinimumBlockedTaskThreadCount
+    );
+
     // And one as our coordination thread, to kick off scheduled tasks. This one will run
     // throughout the lifetime of the task coordinator and check available resources whenever
     // a task is scheduled or finishes to potentially kick off the next one(s).
     //
-    maximumThreadCount += 1;
+    std::size_t maximumThreadCount = this->maximumTaskThreadCount + 1;
 
     {
       std::lock_guard<std::mutex> queueAccessLock(this->queueAccessMutex);
@@ -152,7 +689,9 @@ namespace Nuclex { namespace Platform { namespace Tasks {
     std::lock_guard<std::mutex> queueAccessLock(this->queueAccessMutex);
 
     this->waitingTasks.emplace_back(task);
-    // TODO: Check if execution thread needs to be launched by checking number of active cores
+    if(IsCoordinationThreadWakeUpNeeded(task)) {
+      wakeCoordinationThread();
+    }
   }
 
   // ------------------------------------------------------------------------------------------- //
@@ -164,7 +703,9 @@ namespace Nuclex { namespace Platform { namespace Tasks {
     std::lock_guard<std::mutex> queueAccessLock(this->queueAccessMutex);
 
     this->waitingTasks.emplace_back(task, environment);
-    // TODO: Check if execution thread needs to be launched by checking number of active cores
+    if(IsCoordinationThreadWakeUpNeeded(task, environment)) {
+      wakeCoordinationThread();
+    }
   }
 
   // ------------------------------------------------------------------------------------------- //
@@ -212,7 +753,34 @@ namespace Nuclex { namespace Platform { namespace Tasks {
   // ------------------------------------------------------------------------------------------- //
 
   void NaiveTaskCoordinator::KickOffRunnableTasks() {
-    
+    std::lock_guard<std::mutex> queueAccessLock(this->queueAccessMutex);
+
+    // Naive approach: walk through the queue in order and launch every task for which
+    // the resources are available. Tasks needing more than is available right now stay
+    // in the queue, but do not block smaller tasks queued after them.
+    std::deque<ScheduledTask>::iterator iterator = this->waitingTasks.begin();
+    while(iterator != this->waitingTasks.end()) {
+
+      // Only launch tasks while there are threads for them. Tasks sitting in a blocking
+      // region don't count, so other tasks can use the CPU cores while they wait.
+      std::size_t threadLimit = std::min(
+        this->regularTaskThreadCount + this->blockedTaskCount.load(std::memory_order_acquire),
+        this->maximumTaskThreadCount
+      );
+      if(this->runningTaskCount.load(std::memory_order_acquire) >= threadLimit) {
+        break;
+      }
+
+      if(tryAllocateResources(*iterator)) {
+        this->runningTaskCount.fetch_add(1, std::memory_order_release);
+        this->threadPool->Schedule(
+          &NaiveTaskCoordinator::invokeScheduledTask, this, *iterator
+        );
+        iterator = this->waitingTasks.erase(iterator);
+      } else {
+        ++iterator;
+      }
+    }
   }
 
   // ------------------------------------------------------------------------------------------- //
@@ -220,11 +788,20 @@ namespace Nuclex { namespace Platform { namespace Tasks {
   void NaiveTaskCoordinator::coordinationThread() {
     for(;;) {
 
+      // Tasks often arrive in bursts, so depending on the wake strategy, watch for new
+      // tasks for a moment. This avoids the scheduler latency of waking a blocked thread.
+      if(this->wakeStrategy != WakeStrategy::Block) {
+        pollForWakeUp();
+      }
+
       // If there are no tasks and the we're not asked to shut down, go to sleep
       // to ensure we're not hogging a CPU core for no reason.
       bool wasTaskAvailable = this->tasksAvailableSemaphore.WaitForThenDecrement(
         std::chrono::milliseconds(50)
       );
+      if(wasTaskAvailable) {
+        this->pendingWakeUpCount.fetch_sub(1, std::memory_order_relaxed);
+      }
 
       // When woken up, check if the we're being asked to shut down before anything
       // else so we can facilitate a timely shutdown.
@@ -245,10 +822,489 @@ namespace Nuclex { namespace Platform { namespace Tasks {
 
   // ------------------------------------------------------------------------------------------- //
 
+  void NaiveTaskCoordinator::wakeCoordinationThread() {
+    this->pendingWakeUpCount.fetch_add(1, std::memory_order_release);
+    this->tasksAvailableSemaphore.Post();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool NaiveTaskCoordinator::pollForWakeUp() {
+    typedef std::chrono::steady_clock Clock;
+
+    Clock::time_point deadline = Clock::now() + this->wakePollDuration;
+    for(;;) {
+
+      // Reading the clock costs more than checking the wake-up count, so check
+      // the wake-up count a few times for each time the clock is read.
+      for(std::size_t index = 0; index < WakeUpChecksPerClockRead; ++index) {
+        if(this->pendingWakeUpCount.load(std::memory_order_acquire) > 0) {
+          return true;
+        }
+        if(this->wakeStrategy == WakeStrategy::Yield) {
+          std::this_thread::yield();
+        } else {
+          relaxProcessor();
+        }
+      }
+
+      if(Clock::now() >= deadline) {
+        return false;
+      }
+
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
   void NaiveTaskCoordinator::invokeCoordinationThread(NaiveTaskCoordinator *self) {
     self->coordinationThread();
   }
 
   // ------------------------------------------------------------------------------------------- //
 
+  void NaiveTaskCoordinator::distributeProcessorsToCpuCoreUnits() {
+#if defined(NUCLEX_PLATFORM_LINUX)
+    this->unpinnedProcessors = Platform::LinuxThreadApi::GetCpuAffinity();
+
+    // Collect the processors that have not been claimed by any unit explicitly and
+    // count the cores of all units that still need to be assigned their processors
+    std::vector<std::size_t> unclaimedProcessors = this->unpinnedProcessors;
+    std::size_t unassignedCoreCount = 0;
+    for(const CpuCoreUnit &unit : this->cpuCoreUnits) {
+      if(unit.ProcessorIndices.empty()) {
+        unassignedCoreCount += unit.CoreCount;
+      } else {
+        for(std::size_t processorIndex : unit.ProcessorIndices) {
+          std::vector<std::size_t>::iterator iterator = std::find(
+            unclaimedProcessors.begin(), unclaimedProcessors.end(), processorIndex
+          );
+          if(iterator != unclaimedProcessors.end()) {
+            unclaimedProcessors.erase(iterator);
+          }
+        }
+      }
+    }
+    if((unassignedCoreCount == 0) || unclaimedProcessors.empty()) {
+      return; // Units without processors will remain unpinned
+    }
+
+    // Hand out consecutive slices of the unclaimed processors, sized by core count.
+    // The kernel numbers the processors of one package consecutively, so slices tend
+    // to stay on the same physical CPU and share its caches.
+    std::size_t processorCount = unclaimedProcessors.size();
+    std::size_t assignedCoreCount = 0;
+    std::size_t processorIndex = 0;
+    for(CpuCoreUnit &unit : this->cpuCoreUnits) {
+      if(unit.ProcessorIndices.empty()) {
+        assignedCoreCount += unit.CoreCount;
+
+        std::size_t endIndex = processorCount * assignedCoreCount / unassignedCoreCount;
+        if(endIndex <= processorIndex) {
+          endIndex = std::min(processorIndex + 1, processorCount);
+        }
+        if(processorIndex < endIndex) {
+          unit.ProcessorIndices.assign(
+            unclaimedProcessors.begin() + processorIndex,
+            unclaimedProcessors.begin() + endIndex
+          );
+        } else { // More units than processors, share the last processor
+          unit.ProcessorIndices.push_back(unclaimedProcessors.back());
+        }
+
+        processorIndex = endIndex;
+      }
+    }
+#endif
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  bool NaiveTaskCoordinator::tryAllocateResources(ScheduledTask &scheduledTask) {
+    ResourceUnitArray &unitIndices = scheduledTask.AssignedResourceIndices;
+
+    // Decide which manifest the task is admitted with only once, so repeated attempts
+    // don't allocate new manifests and the same manifest is used to release again
+    if(!scheduledTask.EffectiveResources) {
+      const std::shared_ptr<ResourceManifest> &declared = scheduledTask.PrimaryTask->Resources;
+      if(this->manifestLearningEnabled.load(std::memory_order_acquire)) {
+        scheduledTask.EffectiveResources = this->manifestLearner->GetEffectiveManifest(
+          typeid(*scheduledTask.PrimaryTask), declared
+        );
+      } else {
+        scheduledTask.EffectiveResources = declared;
+      }
+    }
+
+    CorePreference preference = CorePreference::Any;
+    if(this->hasHybridCpuCoreUnits) {
+      preference = scheduledTask.PrimaryTask->PreferredCores;
+    }
+
+    // On hybrid CPUs, try the CPU core units of the wanted class first and,
+    // if the task merely prefers that class, the units of the other class after.
+    // Units belonging to a NUMA node take the system memory from the same node.
+    if(preference != CorePreference::Any) {
+      bool wantsEcoCores = (
+        (preference == CorePreference::PreferEfficiency) ||
+        (preference == CorePreference::RequireEfficiency)
+      );
+      bool mayUseOtherClass = (
+        (preference == CorePreference::PreferPerformance) ||
+        (preference == CorePreference::PreferEfficiency)
+      );
+
+      std::size_t passCount = mayUseOtherClass ? 2 : 1;
+      for(std::size_t pass = 0; pass < passCount; ++pass) {
+        bool useEcoCores = (wantsEcoCores == (pass == 0));
+
+        std::size_t unitCount = this->cpuCoreUnits.size();
+        for(std::size_t unitIndex = 0; unitIndex < unitCount; ++unitIndex) {
+          if(this->cpuCoreUnits[unitIndex].IsEcoCore != useEcoCores) {
+            continue;
+          }
+
+          unitIndices.fill(std::size_t(-1));
+          unitIndices[static_cast<std::size_t>(ResourceType::CpuCores)] = unitIndex;
+          unitIndices[static_cast<std::size_t>(ResourceType::SystemMemory)] = (
+            this->cpuCoreUnits[unitIndex].SystemMemoryUnitIndex
+          );
+
+          bool wasAllocated = this->availableResources->Allocate(
+            unitIndices, scheduledTask.PrimaryEnvironment, scheduledTask.EffectiveResources
+          );
+          if(wasAllocated) {
+            return true;
+          }
+        }
+      }
+
+      return false;
+    }
+
+    if(this->numaNodeCount == 0) {
+      unitIndices.fill(std::size_t(-1));
+      return this->availableResources->Allocate(
+        unitIndices, scheduledTask.PrimaryEnvironment, scheduledTask.EffectiveResources
+      );
+    }
+
+    // With paired NUMA units, try the CPU core units one by one, forcing the system
+    // memory unit of the same node so that a task never straddles two nodes.
+    std::size_t unitCount = this->cpuCoreUnits.size();
+    for(std::size_t unitIndex = 0; unitIndex < unitCount; ++unitIndex) {
+      unitIndices.fill(std::size_t(-1));
+      unitIndices[static_cast<std::size_t>(ResourceType::CpuCores)] = unitIndex;
+      unitIndices[static_cast<std::size_t>(ResourceType::SystemMemory)] = (
+        this->cpuCoreUnits[unitIndex].SystemMemoryUnitIndex
+      );
+
+      bool wasAllocated = this->availableResources->Allocate(
+        unitIndices, scheduledTask.PrimaryEnvironment, scheduledTask.EffectiveResources
+      );
+      if(wasAllocated) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void NaiveTaskCoordinator::activateEnvironment(
+    const std::shared_ptr<TaskEnvironment> &environment
+  ) {
+    auto isSameEnvironment = [&environment](const ActiveEnvironment &active) {
+      return (active.Environment == environment);
+    };
+
+    std::unique_lock<std::mutex> environmentAccessLock(this->environmentAccessMutex);
+
+    // If another task is already using the environment, join it. If another thread is
+    // busy activating or shutting it down, wait for that to finish and look again.
+    for(;;) {
+      std::vector<ActiveEnvironment>::iterator iterator = std::find_if(
+        this->activeEnvironments.begin(), this->activeEnvironments.end(), isSameEnvironment
+      );
+      if(iterator == this->activeEnvironments.end()) {
+        break;
+      }
+      if(iterator->IsActive) {
+        ++iterator->ActiveTaskCount;
+        return;
+      }
+
+      this->environmentStateChanged.wait(environmentAccessLock);
+    }
+
+    // The environment is not active, so this thread activates it. The entry keeps
+    // other threads waiting without holding the mutex during the activation.
+    this->activeEnvironments.push_back(ActiveEnvironment { environment, 1, false });
+    environmentAccessLock.unlock();
+
+    try {
+      environment->Activate();
+    }
+    catch(const std::exception &) {
+      environmentAccessLock.lock();
+      this->activeEnvironments.erase(
+        std::find_if(
+          this->activeEnvironments.begin(), this->activeEnvironments.end(), isSameEnvironment
+        )
+      );
+      environmentAccessLock.unlock();
+      this->environmentStateChanged.notify_all();
+      throw;
+    }
+
+    environmentAccessLock.lock();
+    std::find_if(
+      this->activeEnvironments.begin(), this->activeEnvironments.end(), isSameEnvironment
+    )->IsActive = true;
+    environmentAccessLock.unlock();
+    this->environmentStateChanged.notify_all();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void NaiveTaskCoordinator::shutDownEnvironment(
+    const std::shared_ptr<TaskEnvironment> &environment
+  ) {
+    auto isSameEnvironment = [&environment](const ActiveEnvironment &active) {
+      return (active.Environment == environment);
+    };
+
+    std::unique_lock<std::mutex> environmentAccessLock(this->environmentAccessMutex);
+
+    std::vector<ActiveEnvironment>::iterator iterator = std::find_if(
+      this->activeEnvironments.begin(), this->activeEnvironments.end(), isSameEnvironment
+    );
+    --iterator->ActiveTaskCount;
+    if(iterator->ActiveTaskCount > 0) {
+      return; // Other tasks are still using the environment
+    }
+
+    // Tasks arriving for the environment during the shutdown wait for it to complete
+    // and then activate the environment anew
+    iterator->IsActive = false;
+    environmentAccessLock.unlock();
+
+    try {
+      environment->Shutdown();
+    }
+    catch(const std::exception &) {
+      // The environment counts as shut down either way, its resources are released
+    }
+
+    environmentAccessLock.lock();
+    this->activeEnvironments.erase(
+      std::find_if(
+        this->activeEnvironments.begin(), this->activeEnvironments.end(), isSameEnvironment
+      )
+    );
+    environmentAccessLock.unlock();
+    this->environmentStateChanged.notify_all();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void NaiveTaskCoordinator::runScheduledTask(const ScheduledTask &scheduledTask) {
+    Task &task = *scheduledTask.PrimaryTask.get();
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+    std::size_t cpuCoreUnitIndex = scheduledTask.AssignedResourceIndices[
+      static_cast<std::size_t>(ResourceType::CpuCores)
+    ];
+    bool isPinned = (
+      this->corePinningEnabled &&
+      (cpuCoreUnitIndex < this->cpuCoreUnits.size()) &&
+      (!this->cpuCoreUnits[cpuCoreUnitIndex].ProcessorIndices.empty())
+    );
+
+    // Pinning is an optimization, if the kernel refuses (for example because the cgroup's
+    // cpuset was changed after Start()), the task simply runs unpinned.
+    if(isPinned) {
+      try {
+        Platform::LinuxThreadApi::SetCpuAffinity(
+          this->cpuCoreUnits[cpuCoreUnitIndex].ProcessorIndices
+        );
+      }
+      catch(const std::exception &) {
+        isPinned = false;
+      }
+    }
+#endif
+
+    // If the environment can't be activated, the task can't run. Its resources are
+    // returned below as usual and the next task will try to activate the environment.
+    bool isEnvironmentActive = true;
+    if(static_cast<bool>(scheduledTask.PrimaryEnvironment)) {
+      try {
+        activateEnvironment(scheduledTask.PrimaryEnvironment);
+      }
+      catch(const std::exception &) {
+        isEnvironmentActive = false;
+      }
+    }
+
+    if(isEnvironmentActive) {
+      std::shared_ptr<const Nuclex::Support::Threading::StopToken> cancellationWatcher = (
+        this->cancellationTrigger->GetToken()
+      );
+
+      bool isAccounted = this->usageAccountingEnabled.load(std::memory_order_acquire);
+      bool isLearning = this->manifestLearningEnabled.load(std::memory_order_acquire);
+      ThreadUsageCounters countersBefore;
+      if(isAccounted || isLearning) {
+        ThreadUsageCounters::Sample(countersBefore);
+      }
+
+      currentTaskThreadState.Coordinator = this;
+      currentTaskThreadState.AssignedUnits = &scheduledTask.AssignedResourceIndices;
+      currentTaskThreadState.CpuCoreCount = countCpuCores(scheduledTask.EffectiveResources);
+      task.Run(scheduledTask.AssignedResourceIndices, *cancellationWatcher);
+      currentTaskThreadState.Coordinator = nullptr;
+
+      if(isAccounted || isLearning) {
+        ThreadUsageCounters countersAfter;
+        ThreadUsageCounters::Sample(countersAfter);
+        try {
+          if(isAccounted) {
+            this->usageLedger->Record(
+              typeid(task), task.Resources.get(), countersBefore, countersAfter
+            );
+          }
+          if(isLearning) {
+#if defined(NUCLEX_PLATFORM_LINUX)
+            double touchedMemory = static_cast<double>(
+              ThreadUsageCounters::GetTouchedMemory(countersBefore, countersAfter)
+            );
+            double peakResidentMemory = static_cast<double>(countersAfter.PeakResidentMemory);
+#else
+            double touchedMemory = -1.0; // Page faults are only counted on Linux
+            double peakResidentMemory = -1.0;
+#endif
+            this->manifestLearner->Observe(
+              typeid(task),
+              ThreadUsageCounters::GetCoresUsed(countersBefore, countersAfter),
+              touchedMemory, peakResidentMemory
+            );
+          }
+        }
+        catch(const std::exception &) {
+          // Accounting is a diagnostic aid, losing one measurement is no reason to fail
+        }
+      }
+
+      // A task that returned from within a blocking region (only possible if it leaked
+      // its BlockingRegion instance) must not leave the thread marked as blocked.
+      if(currentTaskThreadState.BlockingRegionDepth > 0) {
+        currentTaskThreadState.BlockingRegionDepth = 0;
+        this->blockedTaskCount.fetch_sub(1, std::memory_order_release);
+      }
+
+      if(static_cast<bool>(scheduledTask.PrimaryEnvironment)) {
+        shutDownEnvironment(scheduledTask.PrimaryEnvironment);
+      }
+    }
+
+    // If the task's CPU cores were handed out while it was blocked and could not be
+    // taken back afterwards, they're not the task's to return anymore
+    bool areCpuCoresReleased = currentTaskThreadState.AreCpuCoresReleased;
+    currentTaskThreadState.AssignedUnits = nullptr;
+    currentTaskThreadState.CpuCoreCount = 0;
+    currentTaskThreadState.AreCpuCoresReleased = false;
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+    // Thread pool threads are reused for other tasks, so undo the pinning again
+    if(isPinned) {
+      try {
+        Platform::LinuxThreadApi::SetCpuAffinity(this->unpinnedProcessors);
+      }
+      catch(const std::exception &) {
+        // Nothing we can do, the thread stays on the unit's processors
+      }
+    }
+#endif
+
+    this->availableResources->Release(
+      scheduledTask.AssignedResourceIndices,
+      scheduledTask.PrimaryEnvironment,
+      areCpuCoresReleased ? (
+        withoutCpuCores(scheduledTask.EffectiveResources)
+      ) : scheduledTask.EffectiveResources
+    );
+
+    // Resources were returned, so let the coordination thread check for runnable tasks
+    this->runningTaskCount.fetch_sub(1, std::memory_order_release);
+    wakeCoordinationThread();
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  NaiveTaskCoordinator *NaiveTaskCoordinator::enterBlockingRegion() {
+    NaiveTaskCoordinator *self = currentTaskThreadState.Coordinator;
+    if(self == nullptr) {
+      return nullptr; // Not called from a task, nothing to do
+    }
+
+    // Only the outermost blocking region counts, nested ones change nothing
+    ++currentTaskThreadState.BlockingRegionDepth;
+    if(currentTaskThreadState.BlockingRegionDepth == 1) {
+
+      // The task isn't using its CPU cores while it blocks, so hand them back to
+      // the budget. Otherwise the extra thread would be useless on a fully booked
+      // coordinator because no other task could get any CPU cores.
+      if(currentTaskThreadState.CpuCoreCount > 0) {
+        self->availableResources->Release(
+          *currentTaskThreadState.AssignedUnits,
+          ResourceManifest::Create(ResourceType::CpuCores, currentTaskThreadState.CpuCoreCount)
+        );
+        currentTaskThreadState.AreCpuCoresReleased = true;
+      }
+
+      self->blockedTaskCount.fetch_add(1, std::memory_order_release);
+      self->wakeCoordinationThread(); // A thread became available for another task
+    }
+
+    return self;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void NaiveTaskCoordinator::leaveBlockingRegion(NaiveTaskCoordinator *self) {
+    if(currentTaskThreadState.BlockingRegionDepth == 0) {
+      return; // Task has already ended and the region was cleaned up
+    }
+
+    --currentTaskThreadState.BlockingRegionDepth;
+    if(currentTaskThreadState.BlockingRegionDepth == 0) {
+
+      // Take the task's CPU cores back from the same unit. If another task got them
+      // in the meantime, the task continues anyway and the unit is overcommitted
+      // until one of the two tasks ends (the task won't return cores it didn't get).
+      if(currentTaskThreadState.AreCpuCoresReleased) {
+        ResourceUnitArray unitIndices = *currentTaskThreadState.AssignedUnits;
+        bool wasReacquired = self->availableResources->Allocate(
+          unitIndices,
+          ResourceManifest::Create(ResourceType::CpuCores, currentTaskThreadState.CpuCoreCount)
+        );
+        currentTaskThreadState.AreCpuCoresReleased = !wasReacquired;
+      }
+
+      self->blockedTaskCount.fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void NaiveTaskCoordinator::invokeScheduledTask(
+    NaiveTaskCoordinator *self, const ScheduledTask &scheduledTask
+  ) {
+    self->runScheduledTask(scheduledTask);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
 }}} // namespace Nuclex::Platform::Tasks
@@ -0,0 +1,463 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "Nuclex/Platform/Tasks/NaiveTaskCoordinatorFactory.h"
+#include "Nuclex/Platform/Hardware/PlatformAppraiser.h"
+
+#include "../Hardware/LinuxSysNodeTreeReader.h" // for LinuxSysNodeTreeReader
+#include "../Hardware/LinuxSysCpuTreeReader.h" // for LinuxSysCpuTreeReader
+
+#include <Nuclex/Support/Threading/StopToken.h> // for StopToken
+
+#include <thread> // for std::thread::hardware_concurrency()
+#include <algorithm> // for std::min(), std::sort(), std::binary_search()
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Number of bytes in one megabyte</summary>
+  const std::size_t BytesPerMegabyte = 1024 * 1024;
+
+  /// <summary>Largest amount of memory that will be reserved for the operating system</summary>
+  const std::size_t MaximumReservedMegabytes = 4096;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Adds a video memory unit for each GPU that has its own memory</summary>
+  /// <param name="coordinator">Task coordinator to which the units will be added</param>
+  /// <param name="gpus">GPUs whose memory will be added</param>
+  void addVideoMemoryUnits(
+    Nuclex::Platform::Tasks::NaiveTaskCoordinator &coordinator,
+    const std::vector<Nuclex::Platform::Hardware::GpuInfo> &gpus
+  ) {
+    for(const Nuclex::Platform::Hardware::GpuInfo &gpu : gpus) {
+      if(gpu.VideoMemoryInMegabytes > 0) {
+        coordinator.AddResource(
+          Nuclex::Platform::Tasks::ResourceType::VideoMemory,
+          gpu.VideoMemoryInMegabytes * BytesPerMegabyte
+        );
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+  /// <summary>Checks whether the system has more than one NUMA node with CPUs</summary>
+  /// <returns>True if there are multiple NUMA nodes that can run threads</returns>
+  bool hasMultipleNumaNodes() {
+    using Nuclex::Platform::Hardware::LinuxSysNodeTreeReader;
+
+    std::vector<LinuxSysNodeTreeReader::NodeInfo> nodes = (
+      LinuxSysNodeTreeReader::TryReadNodes()
+    );
+
+    std::size_t nodesWithCpus = 0;
+    for(const LinuxSysNodeTreeReader::NodeInfo &node : nodes) {
+      if(!node.ProcessorIndices.empty()) {
+        ++nodesWithCpus;
+      }
+    }
+
+    return (nodesWithCpus >= 2);
+  }
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+  // ------------------------------------------------------------------------------------------- //
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+  /// <summary>Collects the logical processors of a hybrid CPU's two core classes</summary>
+  /// <param name="cpu">Hybrid CPU whose processors will be collected</param>
+  /// <param name="performanceProcessors">Receives the processors of the p-cores</param>
+  /// <param name="ecoProcessors">Receives the processors of the e-cores</param>
+  /// <returns>True if the processors and type of each core were known</returns>
+  bool tryCollectHybridProcessors(
+    const Nuclex::Platform::Hardware::CpuInfo &cpu,
+    std::vector<std::size_t> &performanceProcessors, std::vector<std::size_t> &ecoProcessors
+  ) {
+    performanceProcessors.clear();
+    ecoProcessors.clear();
+
+    for(const Nuclex::Platform::Hardware::CoreInfo &core : cpu.Cores) {
+      if(core.ProcessorIndices.empty() || !core.IsEcoCore.has_value()) {
+        return false;
+      }
+
+      std::vector<std::size_t> &processors = (
+        core.IsEcoCore.value() ? ecoProcessors : performanceProcessors
+      );
+      processors.insert(
+        processors.end(), core.ProcessorIndices.begin(), core.ProcessorIndices.end()
+      );
+    }
+
+    std::sort(performanceProcessors.begin(), performanceProcessors.end());
+    std::sort(ecoProcessors.begin(), ecoProcessors.end());
+
+    return (!performanceProcessors.empty() && !ecoProcessors.empty());
+  }
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<
+    std::unique_ptr<NaiveTaskCoordinator>
+  > NaiveTaskCoordinatorFactory::CreateForThisSystem(
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Support::Threading::StopToken>()
+    ) */
+  ) {
+    return std::async(
+      std::launch::async,
+      &NaiveTaskCoordinatorFactory::createForThisSystemAsync, canceller
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<
+    std::unique_ptr<NaiveTaskCoordinator>
+  > NaiveTaskCoordinatorFactory::CreateForThisSystem(
+    Support::Threading::ThreadPool &threadPool,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Support::Threading::StopToken>()
+    ) */
+  ) {
+    return createWhenAnalyzed(
+      Hardware::PlatformAppraiser::AnalyzeAll(threadPool, canceller),
+      Hardware::PlatformAppraiser::MeasureClocks(threadPool, canceller),
+      canceller
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<
+    std::unique_ptr<NaiveTaskCoordinator>
+  > NaiveTaskCoordinatorFactory::CreateForThisSystem(
+    TaskCoordinator &taskCoordinator,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller /* = (
+      std::shared_ptr<const Support::Threading::StopToken>()
+    ) */
+  ) {
+    return createWhenAnalyzed(
+      Hardware::PlatformAppraiser::AnalyzeAll(taskCoordinator, canceller),
+      Hardware::PlatformAppraiser::MeasureClocks(taskCoordinator, canceller),
+      canceller
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::unique_ptr<NaiveTaskCoordinator> NaiveTaskCoordinatorFactory::CreateFor(
+    const std::vector<Hardware::CpuInfo> &cpus,
+    const Hardware::MemoryInfo &memory,
+    const std::vector<Hardware::GpuInfo> &gpus /* = std::vector<Hardware::GpuInfo>() */
+  ) {
+    std::unique_ptr<NaiveTaskCoordinator> coordinator = std::make_unique<NaiveTaskCoordinator>();
+
+    // Each physical CPU becomes its own unit. Tasks usually work on shared data, so
+    // keeping one task's threads on one CPU avoids shuffling it between CPU caches.
+    std::size_t totalCoreCount = 0;
+    for(const Hardware::CpuInfo &cpu : cpus) {
+      if(cpu.CoreCount == 0) {
+        continue;
+      }
+
+      totalCoreCount += cpu.CoreCount;
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+      // Hybrid CPUs are split into a p-core and an e-core unit so tasks can pick
+      // the class of cores they want to run on. This needs the processors of each
+      // class, otherwise the task's thread could still end up on the wrong cores.
+      bool isHybrid = (
+        (cpus.size() == 1) &&
+        cpu.EcoCoreCount.has_value() &&
+        (cpu.EcoCoreCount.value() > 0) &&
+        (cpu.EcoCoreCount.value() < cpu.CoreCount)
+      );
+      if(isHybrid) {
+        std::vector<std::size_t> performanceProcessors, ecoProcessors;
+        bool processorsKnown = (
+          tryCollectHybridProcessors(cpu, performanceProcessors, ecoProcessors) ||
+          Hardware::LinuxSysCpuTreeReader::TryReadHybridProcessors(
+            performanceProcessors, ecoProcessors
+          )
+        );
+        if(processorsKnown) {
+          std::size_t ecoCoreCount = cpu.EcoCoreCount.value();
+          coordinator->AddCpuCores(cpu.CoreCount - ecoCoreCount, performanceProcessors);
+          coordinator->AddCpuCores(ecoCoreCount, ecoProcessors, true);
+          coordinator->EnableCorePinning();
+          continue;
+        }
+      }
+#endif
+
+      coordinator->AddResource(ResourceType::CpuCores, cpu.CoreCount);
+    }
+
+    // If the CPU topology couldn't be determined, fall back to what the C++ library
+    // reports (which is the number of hardware threads, not cores, but better than none)
+    if(totalCoreCount == 0) {
+      std::size_t threadCount = std::thread::hardware_concurrency();
+      coordinator->AddResource(ResourceType::CpuCores, std::max(threadCount, std::size_t(1)));
+    }
+
+    std::size_t usableMemory = GetUsableMemory(memory);
+    if(usableMemory > 0) {
+      coordinator->AddResource(ResourceType::SystemMemory, usableMemory);
+    }
+
+    addVideoMemoryUnits(*coordinator, gpus);
+
+    return coordinator;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::size_t NaiveTaskCoordinatorFactory::GetUsableMemory(const Hardware::MemoryInfo &memory) {
+    std::size_t availableMegabytes = memory.MaximumProgramMegabytes;
+    if(availableMegabytes == 0) {
+      availableMegabytes = memory.InstalledMegabytes;
+    }
+
+    // Leave an eighth of the installed memory to the operating system and whatever else
+    // runs on the system, but don't let the reserve grow unreasonably on big servers.
+    std::size_t reservedMegabytes = std::min(
+      memory.InstalledMegabytes / 8, MaximumReservedMegabytes
+    );
+    if(availableMegabytes + reservedMegabytes > memory.InstalledMegabytes) {
+      if(availableMegabytes > reservedMegabytes) {
+        availableMegabytes -= reservedMegabytes;
+      } else {
+        availableMegabytes = 0;
+      }
+    }
+
+    return availableMegabytes * BytesPerMegabyte;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<Hardware::CpuInfo> NaiveTaskCoordinatorFactory::RestrictToBudget(
+    const std::vector<Hardware::CpuInfo> &cpus, const Hardware::CpuBudget &budget
+  ) {
+    std::size_t remainingThreadCount = std::max(budget.UsableThreadCount, std::size_t(1));
+
+    std::vector<Hardware::CpuInfo> restrictedCpus;
+    for(const Hardware::CpuInfo &cpu : cpus) {
+      if(remainingThreadCount == 0) {
+        break;
+      }
+
+      Hardware::CpuInfo restrictedCpu;
+      restrictedCpu.ModelName = cpu.ModelName;
+      restrictedCpu.InstructionSets = cpu.InstructionSets;
+
+      // Without per-core details, all we can do is shrink the CPU to the budget
+      if(cpu.Cores.empty()) {
+        restrictedCpu.ThreadCount = std::min(cpu.ThreadCount, remainingThreadCount);
+        restrictedCpu.CoreCount = std::min(cpu.CoreCount, restrictedCpu.ThreadCount);
+        remainingThreadCount -= restrictedCpu.ThreadCount;
+        if(restrictedCpu.CoreCount > 0) {
+          restrictedCpus.push_back(std::move(restrictedCpu));
+        }
+        continue;
+      }
+
+      restrictedCpu.CoreCount = 0;
+      restrictedCpu.ThreadCount = 0;
+      if(cpu.EcoCoreCount.has_value()) {
+        restrictedCpu.EcoCoreCount = 0;
+      }
+
+      for(const Hardware::CoreInfo &core : cpu.Cores) {
+        if(remainingThreadCount == 0) {
+          break;
+        }
+
+        // Keep only the processors the affinity mask and cpuset let us run on
+        Hardware::CoreInfo restrictedCore = core;
+        if(!core.ProcessorIndices.empty() && !budget.AvailableProcessors.empty()) {
+          restrictedCore.ProcessorIndices.clear();
+          for(std::size_t processorIndex : core.ProcessorIndices) {
+            bool isAvailable = std::binary_search(
+              budget.AvailableProcessors.begin(), budget.AvailableProcessors.end(),
+              processorIndex
+            );
+            if(isAvailable) {
+              restrictedCore.ProcessorIndices.push_back(processorIndex);
+            }
+          }
+          if(restrictedCore.ProcessorIndices.empty()) {
+            continue;
+          }
+
+          restrictedCore.ThreadCount = restrictedCore.ProcessorIndices.size();
+        }
+
+        // A CPU time quota can allow fewer threads than there are available processors
+        restrictedCore.ThreadCount = std::max(restrictedCore.ThreadCount, std::size_t(1));
+        if(restrictedCore.ThreadCount > remainingThreadCount) {
+          restrictedCore.ThreadCount = remainingThreadCount;
+          if(restrictedCore.ProcessorIndices.size() > remainingThreadCount) {
+            restrictedCore.ProcessorIndices.resize(remainingThreadCount);
+          }
+        }
+        remainingThreadCount -= restrictedCore.ThreadCount;
+
+        ++restrictedCpu.CoreCount;
+        restrictedCpu.ThreadCount += restrictedCore.ThreadCount;
+        if(restrictedCore.IsEcoCore.has_value() && restrictedCore.IsEcoCore.value()) {
+          restrictedCpu.EcoCoreCount = restrictedCpu.EcoCoreCount.value_or(0) + 1;
+        }
+        restrictedCpu.Cores.push_back(std::move(restrictedCore));
+      }
+
+      if(restrictedCpu.CoreCount > 0) {
+        restrictedCpus.push_back(std::move(restrictedCpu));
+      }
+    }
+
+    return restrictedCpus;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::unique_ptr<NaiveTaskCoordinator> NaiveTaskCoordinatorFactory::createForThisSystemAsync(
+    std::shared_ptr<const Support::Threading::StopToken> canceller
+  ) {
+
+    // Let the analyses run in parallel, the CPU analysis usually takes longer
+    std::future<std::vector<Hardware::CpuInfo>> cpusFuture = (
+      Hardware::PlatformAppraiser::AnalyzeCpuTopology(canceller)
+    );
+    std::future<Hardware::MemoryInfo> memoryFuture = (
+      Hardware::PlatformAppraiser::AnalyzeMemory(canceller)
+    );
+    std::future<std::vector<Hardware::GpuInfo>> gpusFuture = (
+      Hardware::PlatformAppraiser::AnalyzeGpus(canceller)
+    );
+    std::future<Hardware::ClockInfo> clocksFuture = (
+      Hardware::PlatformAppraiser::MeasureClocks(canceller)
+    );
+
+    std::vector<Hardware::CpuInfo> cpus = cpusFuture.get();
+    Hardware::MemoryInfo memory = memoryFuture.get();
+    std::vector<Hardware::GpuInfo> gpus = gpusFuture.get();
+    Hardware::ClockInfo clocks = clocksFuture.get();
+    if(canceller) {
+      canceller->ThrowIfCanceled();
+    }
+
+    return createFromAnalyses(cpus, memory, gpus, clocks);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::future<
+    std::unique_ptr<NaiveTaskCoordinator>
+  > NaiveTaskCoordinatorFactory::createWhenAnalyzed(
+    std::future<Hardware::PlatformInfo> &&platform,
+    std::future<Hardware::ClockInfo> &&clocks,
+    const std::shared_ptr<const Support::Threading::StopToken> &canceller
+  ) {
+    return std::async(
+      std::launch::deferred,
+      [](
+        std::future<Hardware::PlatformInfo> platform,
+        std::future<Hardware::ClockInfo> clocks,
+        std::shared_ptr<const Support::Threading::StopToken> canceller
+      ) {
+        Hardware::PlatformInfo platformInfo = platform.get();
+        Hardware::ClockInfo clockInfo = clocks.get();
+        if(canceller) {
+          canceller->ThrowIfCanceled();
+        }
+
+        return createFromAnalyses(
+          platformInfo.CpuTopology, platformInfo.Memory, platformInfo.Gpus, clockInfo
+        );
+      },
+      std::move(platform), std::move(clocks), canceller
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::unique_ptr<NaiveTaskCoordinator> NaiveTaskCoordinatorFactory::createFromAnalyses(
+    const std::vector<Hardware::CpuInfo> &cpus,
+    const Hardware::MemoryInfo &memory,
+    const std::vector<Hardware::GpuInfo> &gpus,
+    const Hardware::ClockInfo &clocks
+  ) {
+
+    // Inside a container or with a restricted affinity mask, the process may only be
+    // allowed to use a fraction of the CPU cores. Scheduling more tasks than that would
+    // only have them fight over the same time slices, so only the usable cores are added.
+    std::unique_ptr<NaiveTaskCoordinator> coordinator;
+    {
+      std::size_t totalThreadCount = 0;
+      for(const Hardware::CpuInfo &cpu : cpus) {
+        totalThreadCount += cpu.ThreadCount;
+      }
+
+      Hardware::CpuBudget budget = Hardware::PlatformAppraiser::QueryCpuBudget();
+      if((totalThreadCount > 0) && (budget.UsableThreadCount < totalThreadCount)) {
+        coordinator = CreateFor(RestrictToBudget(cpus, budget), memory, gpus);
+      }
+    }
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+    // On multi-socket systems, register the NUMA nodes instead so that each node's
+    // CPU cores and memory are paired up in the task coordinator. Memory is placed on
+    // the node of the thread touching it first, so tasks are pinned to their node, too.
+    if(!coordinator && hasMultipleNumaNodes()) {
+      coordinator = std::make_unique<NaiveTaskCoordinator>();
+      coordinator->AddNumaNodeResources();
+      coordinator->EnableCorePinning();
+      addVideoMemoryUnits(*coordinator, gpus);
+    }
+#endif
+
+    if(!coordinator) {
+      coordinator = CreateFor(cpus, memory, gpus);
+    }
+
+    // Sub-millisecond dispatch needs the coordinator to poll for new tasks rather than
+    // waiting to be woken up, but only where the system's clocks make that affordable.
+    coordinator->AdaptWakeStrategy(clocks);
+
+    return coordinator;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
@@ -137,6 +137,7 @@ namespace Nuclex { namespace Platform { namespace Tasks {
     resourceManifest->Count = 1;
     resourceManifest->Resources = resources;
     resourceManifest->AccessedHardDriveMask = 0;
+    resourceManifest->CpuCoresMayBeLowered = false;
 
     resources[0].Amount = resourceAmount;
     resources[0].Type = resourceType;
@@ -164,6 +165,7 @@ namespace Nuclex { namespace Platform { namespace Tasks {
     resourceManifest->Count = 2;
     resourceManifest->Resources = resources;
     resourceManifest->AccessedHardDriveMask = 0;
+    resourceManifest->CpuCoresMayBeLowered = false;
 
     resources[0].Amount = resource1Amount;
     resources[0].Type = resource1Type;
@@ -194,6 +196,7 @@ namespace Nuclex { namespace Platform { namespace Tasks {
     resourceManifest->Count = 3;
     resourceManifest->Resources = resources;
     resourceManifest->AccessedHardDriveMask = 0;
+    resourceManifest->CpuCoresMayBeLowered = false;
 
     resources[0].Amount = resource1Amount;
     resources[0].Type = resource1Type;
@@ -254,6 +257,9 @@ namespace Nuclex { namespace Platform { namespace Tasks {
     resourceManifest->AccessedHardDriveMask = (
       first->AccessedHardDriveMask | second->AccessedHardDriveMask
     );
+    resourceManifest->CpuCoresMayBeLowered = (
+      first->CpuCoresMayBeLowered && second->CpuCoresMayBeLowered
+    );
 
     // Copy the resources from the first manifest over directly
     std::size_t addedResourceTypeCount = 0;
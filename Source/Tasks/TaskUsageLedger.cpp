@@ -0,0 +1,412 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "./TaskUsageLedger.h"
+#include "Nuclex/Platform/Tasks/ResourceManifest.h" // for ResourceManifest
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+#include "../Platform/LinuxProcFileReader.h" // for LinuxProcFileReader
+#include <ctime> // for ::clock_gettime()
+#include <sys/resource.h> // for ::getrusage()
+#include <unistd.h> // for ::sysconf()
+#elif defined(NUCLEX_PLATFORM_WINDOWS)
+#include "../Platform/WindowsApi.h" // for ::GetThreadTimes()
+#endif
+
+#if defined(__GNUC__)
+#include <cxxabi.h> // for abi::__cxa_demangle()
+#include <cstdlib> // for std::free()
+#endif
+
+#include <algorithm> // for std::sort(), std::max()
+#include <charconv> // for std::from_chars()
+#include <new> // for std::bad_alloc
+#include <string_view> // for std::string_view
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Share of the declared cores a task must use not to count as over-declared</summary>
+  const double MinimumCoreUtilization = 0.5;
+
+  /// <summary>Cores a task may use beyond its declaration before it's under-declared</summary>
+  const double CoreTolerance = 0.25;
+
+  /// <summary>Share of the declared memory the process must reach not to be over-declared</summary>
+  const double MinimumMemoryUtilization = 0.5;
+
+  /// <summary>Memory a task may touch without declaring any system memory</summary>
+  const std::size_t UndeclaredMemoryTolerance = 16 * 1024 * 1024;
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Calculates the difference between two readings of a counter</summary>
+  /// <param name="before">Value of the counter in the earlier reading</param>
+  /// <param name="after">Value of the counter in the later reading</param>
+  /// <returns>The increase of the counter, zero if it went backwards</returns>
+  std::uint64_t increaseBetween(std::uint64_t before, std::uint64_t after) {
+    if(after > before) {
+      return after - before;
+    } else {
+      return 0;
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Looks up the amount of a resource listed in a resource manifest</summary>
+  /// <param name="manifest">Manifest in which the resource will be looked up</param>
+  /// <param name="resourceType">Type of resource whose amount will be returned</param>
+  /// <returns>The amount of the resource declared in the manifest, zero if none</returns>
+  std::size_t getDeclaredAmount(
+    const Nuclex::Platform::Tasks::ResourceManifest *manifest,
+    Nuclex::Platform::Tasks::ResourceType resourceType
+  ) {
+    std::size_t amount = 0;
+    if(manifest != nullptr) {
+      for(std::size_t index = 0; index < manifest->Count; ++index) {
+        if(manifest->Resources[index].Type == resourceType) {
+          amount += manifest->Resources[index].Amount;
+        }
+      }
+    }
+
+    return amount;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+#if defined(NUCLEX_PLATFORM_LINUX)
+  /// <summary>Looks up a counter in the contents of a /proc/.../io file</summary>
+  /// <param name="contents">Contents of the io file</param>
+  /// <param name="key">Key including the colon, i.e. 'read_bytes:'</param>
+  /// <returns>The value of the counter or zero if it wasn't found</returns>
+  std::uint64_t findIoCounter(const std::string_view &contents, const std::string_view &key) {
+    std::string_view::size_type index = contents.find(key);
+    while(index != std::string_view::npos) {
+      if((index == 0) || (contents[index - 1] == '\n')) {
+        std::string_view value = contents.substr(index + key.length());
+        std::string_view::size_type valueStart = value.find_first_not_of(' ');
+        if(valueStart != std::string_view::npos) {
+          std::uint64_t counter = 0;
+          std::from_chars(value.data() + valueStart, value.data() + value.length(), counter);
+          return counter;
+        }
+        return 0;
+      }
+
+      index = contents.find(key, index + 1);
+    }
+
+    return 0;
+  }
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+  // ------------------------------------------------------------------------------------------- //
+#if defined(NUCLEX_PLATFORM_LINUX)
+  /// <summary>Keeps the calling thread's /proc/thread-self/io file open</summary>
+  struct ThreadIoFile {
+
+    /// <summary>Initializes a new io file holder without opening the file</summary>
+    public: ThreadIoFile() :
+      Reader(),
+      OpenAttempted(false) {}
+
+    /// <summary>Reader through which the io file is read</summary>
+    public: Nuclex::Platform::Platform::LinuxProcFileReader Reader;
+    /// <summary>Whether opening the file has already been attempted</summary>
+    public: bool OpenAttempted;
+
+  };
+
+  /// <summary>I/O counter file of the calling thread, opened on first use</summary>
+  thread_local ThreadIoFile currentThreadIoFile;
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void ThreadUsageCounters::Sample(ThreadUsageCounters &counters) noexcept {
+    counters.Time = std::chrono::steady_clock::now();
+    counters.CpuNanoseconds = 0;
+    counters.PageFaultCount = 0;
+    counters.PeakResidentMemory = 0;
+    counters.BytesRead = 0;
+    counters.BytesWritten = 0;
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+    struct ::timespec cpuTime;
+    if(::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime) == 0) {
+      counters.CpuNanoseconds = (
+        static_cast<std::uint64_t>(cpuTime.tv_sec) * 1000000000ULL +
+        static_cast<std::uint64_t>(cpuTime.tv_nsec)
+      );
+    }
+
+    struct ::rusage threadUsage;
+    if(::getrusage(RUSAGE_THREAD, &threadUsage) == 0) {
+      counters.PageFaultCount = (
+        static_cast<std::uint64_t>(threadUsage.ru_minflt) +
+        static_cast<std::uint64_t>(threadUsage.ru_majflt)
+      );
+
+      // Even for RUSAGE_THREAD, this is the peak resident memory of the whole process
+      counters.PeakResidentMemory = static_cast<std::size_t>(threadUsage.ru_maxrss) * 1024;
+    }
+
+    // The io file is per-thread, so each thread pool thread keeps its own open.
+    // It may be missing on kernels without task I/O accounting, in which case
+    // the I/O counters simply stay at zero.
+    ThreadIoFile &ioFile = currentThreadIoFile;
+    if(unlikely(!ioFile.OpenAttempted)) {
+      ioFile.Reader.TryOpen(u8"/proc/thread-self/io");
+      ioFile.OpenAttempted = true;
+    }
+    if(ioFile.Reader.IsOpen()) {
+      try {
+        std::string_view contents;
+        if(ioFile.Reader.TryRead(contents)) {
+          counters.BytesRead = findIoCounter(contents, u8"read_bytes:");
+          counters.BytesWritten = findIoCounter(contents, u8"write_bytes:");
+        }
+      }
+      catch(const std::bad_alloc &) {
+        // Can only happen when the buffer is first allocated, leave the counters at zero
+      }
+    }
+#elif defined(NUCLEX_PLATFORM_WINDOWS)
+    ::FILETIME creationTime, exitTime, kernelTime, userTime;
+    BOOL result = ::GetThreadTimes(
+      ::GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime
+    );
+    if(result != FALSE) {
+      std::uint64_t kernelTicks = (
+        (static_cast<std::uint64_t>(kernelTime.dwHighDateTime) << 32) |
+        static_cast<std::uint64_t>(kernelTime.dwLowDateTime)
+      );
+      std::uint64_t userTicks = (
+        (static_cast<std::uint64_t>(userTime.dwHighDateTime) << 32) |
+        static_cast<std::uint64_t>(userTime.dwLowDateTime)
+      );
+      counters.CpuNanoseconds = (kernelTicks + userTicks) * 100; // 100 ns intervals
+    }
+#endif
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  double ThreadUsageCounters::GetCoresUsed(
+    const ThreadUsageCounters &before, const ThreadUsageCounters &after
+  ) noexcept {
+    double wallSeconds = std::chrono::duration<double>(after.Time - before.Time).count();
+    if(wallSeconds <= 0.0) {
+      return 0.0;
+    }
+
+    double cpuSeconds = static_cast<double>(
+      increaseBetween(before.CpuNanoseconds, after.CpuNanoseconds)
+    ) / 1000000000.0;
+
+    return cpuSeconds / wallSeconds;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::size_t ThreadUsageCounters::GetTouchedMemory(
+    const ThreadUsageCounters &before, const ThreadUsageCounters &after
+  ) noexcept {
+#if defined(NUCLEX_PLATFORM_LINUX)
+    static const std::size_t pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+#else
+    const std::size_t pageSize = 4096;
+#endif
+    return static_cast<std::size_t>(
+      increaseBetween(before.PageFaultCount, after.PageFaultCount)
+    ) * pageSize;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TaskUsageLedger::TaskUsageLedger() :
+    tallyMutex(),
+    tallies() {}
+
+  // ------------------------------------------------------------------------------------------- //
+
+  void TaskUsageLedger::Record(
+    const std::type_info &taskType,
+    const ResourceManifest *manifest,
+    const ThreadUsageCounters &before,
+    const ThreadUsageCounters &after
+  ) {
+    double wallSeconds = std::chrono::duration<double>(after.Time - before.Time).count();
+    double cpuSeconds = static_cast<double>(
+      increaseBetween(before.CpuNanoseconds, after.CpuNanoseconds)
+    ) / 1000000000.0;
+
+    std::size_t touchedMemory = ThreadUsageCounters::GetTouchedMemory(before, after);
+
+    std::size_t declaredCpuCores = getDeclaredAmount(manifest, ResourceType::CpuCores);
+    std::size_t declaredSystemMemory = getDeclaredAmount(manifest, ResourceType::SystemMemory);
+    bool cpuCoresMayBeLowered = (manifest != nullptr) && manifest->CpuCoresMayBeLowered;
+
+    std::lock_guard<std::mutex> tallyLock(this->tallyMutex);
+
+    // Brand new entries are value-initialized, so all totals start at zero
+    Tally &tally = this->tallies[std::type_index(taskType)];
+    ++tally.RunCount;
+    tally.TotalWallSeconds += wallSeconds;
+    tally.TotalCpuSeconds += cpuSeconds;
+    tally.TotalTouchedMemory += touchedMemory;
+    tally.PeakTouchedMemory = std::max(tally.PeakTouchedMemory, touchedMemory);
+    tally.PeakResidentMemory = std::max(tally.PeakResidentMemory, after.PeakResidentMemory);
+    tally.TotalBytesRead += increaseBetween(before.BytesRead, after.BytesRead);
+    tally.TotalBytesWritten += increaseBetween(before.BytesWritten, after.BytesWritten);
+    tally.DeclaredCpuCores = declaredCpuCores;
+    tally.CpuCoresMayBeLowered = cpuCoresMayBeLowered;
+    tally.DeclaredSystemMemory = declaredSystemMemory;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::vector<TaskUsageSummary> TaskUsageLedger::Summarize() const {
+    std::vector<TaskUsageSummary> summaries;
+    {
+      std::lock_guard<std::mutex> tallyLock(this->tallyMutex);
+
+      summaries.reserve(this->tallies.size());
+      for(const std::pair<const std::type_index, Tally> &entry : this->tallies) {
+        const Tally &tally = entry.second;
+        double runCount = static_cast<double>(tally.RunCount);
+
+        TaskUsageSummary &summary = summaries.emplace_back();
+        summary.TaskTypeName = GetReadableTypeName(entry.first);
+        summary.RunCount = tally.RunCount;
+
+        summary.AverageWallSeconds = tally.TotalWallSeconds / runCount;
+        summary.AverageCpuSeconds = tally.TotalCpuSeconds / runCount;
+        if(tally.TotalWallSeconds > 0.0) {
+          summary.AverageCoresUsed = tally.TotalCpuSeconds / tally.TotalWallSeconds;
+        } else {
+          summary.AverageCoresUsed = 0.0;
+        }
+        summary.DeclaredCpuCores = tally.DeclaredCpuCores;
+        summary.CpuFit = JudgeCpuFit(
+          summary.AverageCoresUsed, tally.DeclaredCpuCores, tally.CpuCoresMayBeLowered
+        );
+
+        summary.AverageTouchedMemory = static_cast<std::size_t>(
+          tally.TotalTouchedMemory / tally.RunCount
+        );
+        summary.PeakTouchedMemory = tally.PeakTouchedMemory;
+        summary.PeakResidentMemory = tally.PeakResidentMemory;
+        summary.DeclaredSystemMemory = tally.DeclaredSystemMemory;
+#if defined(NUCLEX_PLATFORM_LINUX)
+        summary.MemoryFit = JudgeMemoryFit(
+          summary.PeakTouchedMemory, summary.PeakResidentMemory, summary.DeclaredSystemMemory
+        );
+#else
+        summary.MemoryFit = ManifestFit::Unknown;
+#endif
+
+        summary.AverageBytesRead = tally.TotalBytesRead / tally.RunCount;
+        summary.AverageBytesWritten = tally.TotalBytesWritten / tally.RunCount;
+      }
+    }
+
+    std::sort(
+      summaries.begin(), summaries.end(),
+      [](const TaskUsageSummary &left, const TaskUsageSummary &right) {
+        return left.TaskTypeName < right.TaskTypeName;
+      }
+    );
+    return summaries;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  std::string TaskUsageLedger::GetReadableTypeName(const std::type_index &taskType) {
+#if defined(__GNUC__)
+    int status = 0;
+    char *demangledName = abi::__cxa_demangle(taskType.name(), nullptr, nullptr, &status);
+    if(demangledName != nullptr) {
+      std::string readableName(demangledName);
+      std::free(demangledName);
+      return readableName;
+    }
+#endif
+    return std::string(taskType.name());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  ManifestFit TaskUsageLedger::JudgeCpuFit(
+    double coresUsed, std::size_t declaredCores, bool coresMayBeLowered /* = false */
+  ) {
+    double declared = static_cast<double>(declaredCores);
+    if(coresUsed > declared + CoreTolerance) {
+      return ManifestFit::UnderDeclared;
+    } else if((declaredCores > 1) && !coresMayBeLowered) {
+      return ManifestFit::Unknown; // The task may keep its other cores busy in other threads
+    } else if(coresUsed < declared * MinimumCoreUtilization) {
+      return ManifestFit::OverDeclared;
+    } else {
+      return ManifestFit::Accurate;
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  ManifestFit TaskUsageLedger::JudgeMemoryFit(
+    std::size_t peakTouchedMemory, std::size_t peakResidentMemory, std::size_t declaredMemory
+  ) {
+    if(declaredMemory == 0) {
+      if(peakTouchedMemory > UndeclaredMemoryTolerance) {
+        return ManifestFit::UnderDeclared;
+      } else {
+        return ManifestFit::Accurate;
+      }
+    }
+
+    // Page faults miss recycled memory and count a huge page as one page, so they can
+    // only prove that a task used more than it declared. The declaration is only
+    // excessive if not even the whole process ever came close to it.
+    if(peakTouchedMemory > declaredMemory) {
+      return ManifestFit::UnderDeclared;
+    } else if(peakResidentMemory == 0) {
+      return ManifestFit::Unknown;
+    } else if(
+      static_cast<double>(peakResidentMemory) <
+      static_cast<double>(declaredMemory) * MinimumMemoryUtilization
+    ) {
+      return ManifestFit::OverDeclared;
+    } else {
+      return ManifestFit::Accurate;
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
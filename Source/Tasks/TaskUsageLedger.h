@@ -0,0 +1,204 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_TASKS_TASKUSAGELEDGER_H
+#define NUCLEX_PLATFORM_TASKS_TASKUSAGELEDGER_H
+
+#include "Nuclex/Platform/Config.h"
+#include "Nuclex/Platform/Tasks/TaskUsageSummary.h" // for TaskUsageSummary
+
+#include <chrono> // for std::chrono::steady_clock
+#include <cstddef> // for std::size_t
+#include <cstdint> // for std::uint64_t
+#include <mutex> // for std::mutex
+#include <string> // for std::string
+#include <typeindex> // for std::type_index
+#include <unordered_map> // for std::unordered_map
+#include <vector> // for std::vector
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  class ResourceManifest;
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Resource counters of a thread at one point in time</summary>
+  struct ThreadUsageCounters {
+
+    /// <summary>Captures the counters of the calling thread</summary>
+    /// <param name="counters">Receives the counters of the calling thread</param>
+    /// <remarks>
+    ///   On Linux, this calls clock_gettime(CLOCK_THREAD_CPUTIME_ID), getrusage() for
+    ///   the thread and reads /proc/thread-self/io, which is kept open for each thread.
+    ///   On Windows, only the processor time is captured via GetThreadTimes().
+    /// </remarks>
+    public: static void Sample(ThreadUsageCounters &counters) noexcept;
+
+    /// <summary>Calculates how many CPU cores a thread kept busy between two samples</summary>
+    /// <param name="before">Counters captured first</param>
+    /// <param name="after">Counters captured later</param>
+    /// <returns>The average number of CPU cores kept busy, zero if no time passed</returns>
+    public: static double GetCoresUsed(
+      const ThreadUsageCounters &before, const ThreadUsageCounters &after
+    ) noexcept;
+
+    /// <summary>Calculates how much memory a thread touched between two samples</summary>
+    /// <param name="before">Counters captured first</param>
+    /// <param name="after">Counters captured later</param>
+    /// <returns>The number of bytes in the memory pages the thread has faulted in</returns>
+    /// <remarks>
+    ///   This is a lower bound: memory reused from the allocator causes no page faults
+    ///   and a transparent huge page maps 2 MiB with a single fault.
+    /// </remarks>
+    public: static std::size_t GetTouchedMemory(
+      const ThreadUsageCounters &before, const ThreadUsageCounters &after
+    ) noexcept;
+
+    /// <summary>Point in time at which the counters were captured</summary>
+    public: std::chrono::steady_clock::time_point Time;
+    /// <summary>Processor time the thread has consumed, in nanoseconds</summary>
+    public: std::uint64_t CpuNanoseconds;
+    /// <summary>Number of page faults (minor and major) the thread has caused</summary>
+    public: std::uint64_t PageFaultCount;
+    /// <summary>Highest resident memory of the whole process so far, in bytes</summary>
+    /// <remarks>
+    ///   The memory of any task is part of the process' resident memory, so this is
+    ///   an upper bound for the memory a task can have used. Zero if unknown.
+    /// </remarks>
+    public: std::size_t PeakResidentMemory;
+    /// <summary>Bytes the thread has caused to be read from storage devices</summary>
+    public: std::uint64_t BytesRead;
+    /// <summary>Bytes the thread has caused to be written to storage devices</summary>
+    public: std::uint64_t BytesWritten;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Accumulates the resources used by tasks, grouped by the task's type</summary>
+  class TaskUsageLedger {
+
+    /// <summary>Initializes a new, empty task usage ledger</summary>
+    public: TaskUsageLedger();
+
+    /// <summary>Records the resources used by one run of a task</summary>
+    /// <param name="taskType">Type of the task that was run</param>
+    /// <param name="manifest">Resource manifest the task declared, can be null</param>
+    /// <param name="before">Counters of the thread captured before the task ran</param>
+    /// <param name="after">Counters of the thread captured after the task ran</param>
+    public: void Record(
+      const std::type_info &taskType,
+      const ResourceManifest *manifest,
+      const ThreadUsageCounters &before,
+      const ThreadUsageCounters &after
+    );
+
+    /// <summary>Summarizes the usage recorded for each type of task</summary>
+    /// <returns>One summary for each type of task that has been run</returns>
+    public: std::vector<TaskUsageSummary> Summarize() const;
+
+    /// <summary>Turns the compiler's name for a type into a readable name</summary>
+    /// <param name="taskType">Type whose name will be returned</param>
+    /// <returns>The readable name of the type</returns>
+    public: static std::string GetReadableTypeName(const std::type_index &taskType);
+
+    /// <summary>Judges whether the declared CPU cores match the cores used</summary>
+    /// <param name="coresUsed">Average number of cores the task kept busy</param>
+    /// <param name="declaredCores">Number of cores the task declared</param>
+    /// <param name="coresMayBeLowered">
+    ///   Whether the task's manifest states that it does all its work in the calling thread
+    /// </param>
+    /// <returns>How well the declared cores fit the cores used</returns>
+    /// <remarks>
+    ///   Only the thread running the task is measured, so a task declaring several cores
+    ///   may be using them through threads of its own. Unless its manifest says otherwise,
+    ///   the fit of such a task is unknown rather than over-declared.
+    /// </remarks>
+    public: static ManifestFit JudgeCpuFit(
+      double coresUsed, std::size_t declaredCores, bool coresMayBeLowered = false
+    );
+
+    /// <summary>Judges whether the declared system memory matches the memory used</summary>
+    /// <param name="peakTouchedMemory">Highest memory touched by any run in bytes</param>
+    /// <param name="peakResidentMemory">
+    ///   Highest resident memory of the whole process after any run in bytes, zero if unknown
+    /// </param>
+    /// <param name="declaredMemory">Memory the task declared in bytes</param>
+    /// <returns>How well the declared memory fits the memory used</returns>
+    /// <remarks>
+    ///   The touched memory is a lower bound, so it can only show that a task used more
+    ///   than it declared. Only the process' resident memory, an upper bound, can show
+    ///   that a task declared too much.
+    /// </remarks>
+    public: static ManifestFit JudgeMemoryFit(
+      std::size_t peakTouchedMemory, std::size_t peakResidentMemory, std::size_t declaredMemory
+    );
+
+    #pragma region struct Tally
+
+    /// <summary>Running totals for one type of task</summary>
+    private: struct Tally {
+
+      /// <summary>Number of runs that have been recorded</summary>
+      public: std::size_t RunCount;
+      /// <summary>Sum of the wall clock time of all runs</summary>
+      public: double TotalWallSeconds;
+      /// <summary>Sum of the processor time of all runs</summary>
+      public: double TotalCpuSeconds;
+      /// <summary>Sum of the memory touched by all runs</summary>
+      public: std::uint64_t TotalTouchedMemory;
+      /// <summary>Highest memory touched by a single run</summary>
+      public: std::size_t PeakTouchedMemory;
+      /// <summary>Highest resident memory of the process after any run</summary>
+      public: std::size_t PeakResidentMemory;
+      /// <summary>Sum of the bytes read by all runs</summary>
+      public: std::uint64_t TotalBytesRead;
+      /// <summary>Sum of the bytes written by all runs</summary>
+      public: std::uint64_t TotalBytesWritten;
+      /// <summary>CPU cores declared by the most recent run's manifest</summary>
+      public: std::size_t DeclaredCpuCores;
+      /// <summary>Whether the most recent run's manifest allowed lowering its cores</summary>
+      public: bool CpuCoresMayBeLowered;
+      /// <summary>System memory declared by the most recent run's manifest</summary>
+      public: std::size_t DeclaredSystemMemory;
+
+    };
+
+    #pragma endregion // struct Tally
+
+    /// <summary>Must be held while accessing the tallies</summary>
+    private: mutable std::mutex tallyMutex;
+    /// <summary>Running totals for each type of task</summary>
+    private: std::unordered_map<std::type_index, Tally> tallies;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
+
+#endif // NUCLEX_PLATFORM_TASKS_TASKUSAGELEDGER_H
@@ -0,0 +1,116 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#ifndef NUCLEX_PLATFORM_FAKEFILETREE_H
+#define NUCLEX_PLATFORM_FAKEFILETREE_H
+
+#include "Nuclex/Platform/Config.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include <string> // for std::string
+#include <vector> // for std::vector
+#include <filesystem> // for std::filesystem
+#include <fstream> // for std::ofstream
+#include <stdexcept> // for std::runtime_error
+
+#include <stdlib.h> // for ::mkdtemp()
+
+namespace Nuclex { namespace Platform {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Builds a throwaway directory tree mimicking sysfs, procfs or cgroupfs</summary>
+  /// <remarks>
+  ///   The readers for Linux pseudo file systems all take a root path so that unit tests
+  ///   can point them at a tree like this one instead of the live system. The whole
+  ///   tree is deleted again when the instance is destroyed.
+  /// </remarks>
+  class FakeFileTree {
+
+    /// <summary>Creates a new, empty fake file tree in the temp directory</summary>
+    public: FakeFileTree() {
+      std::string pathTemplate = (
+        std::filesystem::temp_directory_path() / u8"nuclex-fake-tree-XXXXXX"
+      ).string();
+
+      std::vector<char> pathBuffer(pathTemplate.begin(), pathTemplate.end());
+      pathBuffer.push_back(0);
+      if(::mkdtemp(pathBuffer.data()) == nullptr) {
+        throw std::runtime_error(u8"Could not create temporary directory for fake file tree");
+      }
+
+      this->rootPath.assign(pathBuffer.data());
+    }
+
+    /// <summary>Deletes the fake file tree and everything in it</summary>
+    public: ~FakeFileTree() {
+      std::error_code errorCode;
+      std::filesystem::remove_all(this->rootPath, errorCode);
+    }
+
+    /// <summary>Retrieves the absolute path of the fake tree's root directory</summary>
+    /// <returns>The path of the root directory</returns>
+    public: const std::string &GetRootPath() const { return this->rootPath; }
+
+    /// <summary>Forms the absolute path of an entry in the fake tree</summary>
+    /// <param name="relativePath">Path relative to the root of the fake tree</param>
+    /// <returns>The absolute path of the entry</returns>
+    public: std::string GetPath(const std::string &relativePath) const {
+      return this->rootPath + u8"/" + relativePath;
+    }
+
+    /// <summary>Creates a directory and all missing parent directories</summary>
+    /// <param name="relativePath">Path of the directory relative to the tree root</param>
+    public: void PlaceDirectory(const std::string &relativePath) {
+      std::filesystem::create_directories(GetPath(relativePath));
+    }
+
+    /// <summary>Creates or overwrites a file, creating parent directories as needed</summary>
+    /// <param name="relativePath">Path of the file relative to the tree root</param>
+    /// <param name="contents">Contents that will be written into the file</param>
+    public: void PlaceFile(const std::string &relativePath, const std::string &contents) {
+      std::filesystem::path absolutePath(GetPath(relativePath));
+      std::filesystem::create_directories(absolutePath.parent_path());
+
+      std::ofstream file(absolutePath, std::ios::binary | std::ios::trunc);
+      file.write(contents.data(), static_cast<std::streamsize>(contents.length()));
+    }
+
+    /// <summary>Creates a symbolic link, creating parent directories as needed</summary>
+    /// <param name="relativePath">Path of the symlink relative to the tree root</param>
+    /// <param name="target">Target the symbolic link will point to</param>
+    public: void PlaceSymlink(const std::string &relativePath, const std::string &target) {
+      std::filesystem::path absolutePath(GetPath(relativePath));
+      std::filesystem::create_directories(absolutePath.parent_path());
+      std::filesystem::create_symlink(target, absolutePath);
+    }
+
+    /// <summary>Absolute path of the fake tree's root directory</summary>
+    private: std::string rootPath;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+}} // namespace Nuclex::Platform
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+
+#endif // NUCLEX_PLATFORM_FAKEFILETREE_H
@@ -0,0 +1,82 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "Nuclex/Platform/Hardware/CpuLoadSampler.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono> // for std::chrono::steady_clock
+#include <thread> // for std::this_thread::sleep_for()
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(CpuLoadSamplerTest, HasDefaultConstructor) {
+    EXPECT_NO_THROW(
+      CpuLoadSampler sampler;
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(CpuLoadSamplerTest, LoadIsZeroBeforeFirstSample) {
+    CpuLoadSampler sampler;
+    EXPECT_GT(sampler.CountProcessors(), 0U);
+
+    CpuLoad load = sampler.GetTotalLoad();
+    EXPECT_EQ(load.BusyPercent, 0.0f);
+    EXPECT_EQ(load.IoWaitPercent, 0.0f);
+    EXPECT_EQ(load.StealPercent, 0.0f);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(CpuLoadSamplerTest, MeasuresBusyProcessors) {
+    CpuLoadSampler sampler;
+
+    // Keep this thread busy for a while so there's some load to measure
+    std::chrono::steady_clock::time_point end = (
+      std::chrono::steady_clock::now() + std::chrono::milliseconds(50)
+    );
+    volatile std::size_t counter = 0;
+    while(std::chrono::steady_clock::now() < end) {
+      counter = counter + 1;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    ASSERT_TRUE(sampler.Sample());
+
+    CpuLoad total = sampler.GetTotalLoad();
+    EXPECT_GE(total.BusyPercent, 0.0f);
+    EXPECT_LE(total.BusyPercent + total.IoWaitPercent + total.StealPercent, 100.01f);
+
+    for(std::size_t index = 0; index < sampler.CountProcessors(); ++index) {
+      CpuLoad processor = sampler.GetProcessorLoad(index);
+      EXPECT_GE(processor.BusyPercent, 0.0f);
+      EXPECT_LE(processor.BusyPercent, 100.0f);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
@@ -0,0 +1,69 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Hardware/CpuidCacheReader.h"
+
+#include <gtest/gtest.h>
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(CpuidCacheReaderTest, ReportedCachesHavePlausibleGeometry) {
+    std::vector<CacheInfo> caches = CpuidCacheReader::TryReadCaches();
+
+    // Hypervisors can hide the cache leaves, so an empty list is no error
+    for(std::size_t index = 0; index < caches.size(); ++index) {
+      EXPECT_GE(caches[index].Level, 1U);
+      EXPECT_GT(caches[index].SizeInBytes, 0U);
+      EXPECT_TRUE(caches[index].SharedProcessorIndices.empty());
+      if(index >= 1) {
+        EXPECT_GE(caches[index].Level, caches[index - 1].Level);
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(CpuidCacheReaderTest, OnlyCoresWithoutCachesAreFilledIn) {
+    std::vector<CpuInfo> cpuInfos(1);
+    cpuInfos[0].Cores.resize(2);
+
+    CacheInfo &knownCache = cpuInfos[0].Cores[0].Caches.emplace_back();
+    knownCache.Level = 7;
+    knownCache.Type = CacheType::Unified;
+    knownCache.SizeInBytes = 1234;
+    knownCache.LineSizeInBytes = 64;
+    knownCache.Associativity = 0;
+
+    CpuidCacheReader::AddToCoresWithoutCaches(cpuInfos);
+
+    ASSERT_EQ(cpuInfos[0].Cores[0].Caches.size(), 1U);
+    EXPECT_EQ(cpuInfos[0].Cores[0].Caches[0].Level, 7U);
+    EXPECT_EQ(
+      cpuInfos[0].Cores[1].Caches.size(), CpuidCacheReader::TryReadCaches().size()
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
@@ -0,0 +1,101 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "Nuclex/Platform/Hardware/DispatchedKernel.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Variant of a dummy kernel that pretends to need AVX-512</summary>
+  /// <param name="value">Value that will be returned with an identifying offset</param>
+  /// <returns>The value plus 512</returns>
+  int addAvx512(int value) { return value + 512; }
+
+  /// <summary>Variant of a dummy kernel that pretends to need AVX2</summary>
+  /// <param name="value">Value that will be returned with an identifying offset</param>
+  /// <returns>The value plus 256</returns>
+  int addAvx2(int value) { return value + 256; }
+
+  /// <summary>Variant of a dummy kernel that needs no extensions</summary>
+  /// <param name="value">Value that will be returned with an identifying offset</param>
+  /// <returns>The value plus 1</returns>
+  int addScalar(int value) { return value + 1; }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(DispatchedKernelTest, FirstUsableVariantIsSelected) {
+    typedef DispatchedKernel<int(int)> KernelType;
+    InstructionSetSupport supported { InstructionSet::Avx, InstructionSet::Avx2 };
+
+    KernelType::FunctionType *function = KernelType::Select(
+      supported,
+      {
+        { { InstructionSet::Avx512F, InstructionSet::Avx2 }, &addAvx512 },
+        { { InstructionSet::Avx2 }, &addAvx2 }
+      },
+      &addScalar
+    );
+    EXPECT_EQ(function, &addAvx2);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(DispatchedKernelTest, FallbackIsUsedWithoutUsableVariant) {
+    typedef DispatchedKernel<int(int)> KernelType;
+
+    KernelType::FunctionType *function = KernelType::Select(
+      InstructionSetSupport(),
+      {
+        { { InstructionSet::Avx2 }, &addAvx2 }
+      },
+      &addScalar
+    );
+    EXPECT_EQ(function, &addScalar);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(DispatchedKernelTest, SelectedVariantCanBeCalled) {
+    static const DispatchedKernel<int(int)> kernel(
+      {
+        { { InstructionSet::Sve2, InstructionSet::Avx512F }, &addAvx512 }, // no CPU has both
+        { {}, &addAvx2 } // has no requirements, so it's always usable
+      },
+      &addScalar
+    );
+
+    EXPECT_EQ(kernel.GetFunction(), &addAvx2);
+    EXPECT_EQ(kernel(10), 266);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
@@ -0,0 +1,158 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "Nuclex/Platform/Hardware/HardwareSnapshot.h"
+#include "../../Source/Hardware/LinuxHardwareFingerprinter.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+#include "../FakeFileTree.h"
+#endif
+
+#include <gtest/gtest.h>
+
+#include <atomic> // for std::atomic
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(HardwareSnapshotTest, HasDefaultConstructor) {
+    EXPECT_NO_THROW(
+      HardwareSnapshot snapshot;
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(HardwareSnapshotTest, RepeatedQueriesReturnStoredResult) {
+    HardwareSnapshot snapshot(std::chrono::hours(1));
+
+    std::shared_ptr<const std::vector<CpuInfo>> first = snapshot.GetCpuTopology();
+    std::shared_ptr<const std::vector<CpuInfo>> second = snapshot.GetCpuTopology();
+    ASSERT_TRUE(static_cast<bool>(first));
+    EXPECT_FALSE(first->empty());
+    EXPECT_EQ(first.get(), second.get());
+
+    std::shared_ptr<const MemoryInfo> memory = snapshot.GetMemory();
+    ASSERT_TRUE(static_cast<bool>(memory));
+    EXPECT_EQ(memory.get(), snapshot.GetMemory().get());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(HardwareSnapshotTest, StoreLocatorIsReusedForSameVolumes) {
+    HardwareSnapshot snapshot(std::chrono::hours(1));
+
+    std::shared_ptr<const StoreLocator> first = snapshot.GetStoreLocator();
+    std::shared_ptr<const StoreLocator> second = snapshot.GetStoreLocator();
+    ASSERT_TRUE(static_cast<bool>(first));
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(&first->GetStores(), snapshot.GetStorageVolumes().get());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+#if defined(NUCLEX_PLATFORM_LINUX)
+  TEST(HardwareSnapshotTest, UnchangedHardwareIsNotAnalyzedAgain) {
+    HardwareSnapshot snapshot(std::chrono::hours(1));
+
+    std::atomic<std::size_t> notificationCount(0);
+    snapshot.Subscribe(
+      [&notificationCount](HardwareChange) { ++notificationCount; }
+    );
+
+    std::shared_ptr<const std::vector<CpuInfo>> before = snapshot.GetCpuTopology();
+    snapshot.Refresh().wait();
+    std::shared_ptr<const std::vector<CpuInfo>> after = snapshot.GetCpuTopology();
+
+    // Unless a processor was taken offline during the test, this must be the same object
+    EXPECT_EQ(before.get(), after.get());
+    EXPECT_EQ(notificationCount.load(), 0U);
+  }
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+  // ------------------------------------------------------------------------------------------- //
+#if defined(NUCLEX_PLATFORM_LINUX)
+  TEST(HardwareSnapshotTest, ChangedSourcesAreAnalyzedAgain) {
+    FakeFileTree tree;
+    tree.PlaceFile(u8"sys/devices/system/cpu/present", u8"0-3\n");
+    tree.PlaceFile(u8"sys/devices/system/cpu/online", u8"0-3\n");
+    tree.PlaceFile(u8"proc/meminfo", u8"MemTotal: 8192 kB\nMemFree: 4096 kB\n");
+
+    std::string sysPath = tree.GetPath(u8"sys");
+    std::string procPath = tree.GetPath(u8"proc");
+    HardwareSnapshot snapshot(
+      std::chrono::hours(1),
+      [sysPath, procPath](HardwareChange part) {
+        return LinuxHardwareFingerprinter::Calculate(part, sysPath, procPath);
+      }
+    );
+
+    std::atomic<std::size_t> cpuNotificationCount(0), memoryNotificationCount(0);
+    snapshot.Subscribe(
+      [&cpuNotificationCount, &memoryNotificationCount](HardwareChange change) {
+        if(change == HardwareChange::CpuTopology) {
+          ++cpuNotificationCount;
+        } else if(change == HardwareChange::Memory) {
+          ++memoryNotificationCount;
+        }
+      }
+    );
+
+    std::shared_ptr<const std::vector<CpuInfo>> firstTopology = snapshot.GetCpuTopology();
+    std::shared_ptr<const MemoryInfo> firstMemory = snapshot.GetMemory();
+
+    // Taking a processor offline changes the CPU topology's sources,
+    // the amount of free memory is not a change to the memory's sources.
+    tree.PlaceFile(u8"sys/devices/system/cpu/online", u8"0-2\n");
+    tree.PlaceFile(u8"proc/meminfo", u8"MemTotal: 8192 kB\nMemFree: 1024 kB\n");
+    snapshot.Refresh().wait();
+
+    EXPECT_NE(snapshot.GetCpuTopology().get(), firstTopology.get());
+    EXPECT_EQ(cpuNotificationCount.load(), 1U);
+    EXPECT_EQ(snapshot.GetMemory().get(), firstMemory.get());
+    EXPECT_EQ(memoryNotificationCount.load(), 0U);
+
+    // Hot-plugging memory changes the memory's sources
+    tree.PlaceFile(u8"proc/meminfo", u8"MemTotal: 16384 kB\nMemFree: 1024 kB\n");
+    snapshot.Refresh().wait();
+
+    EXPECT_NE(snapshot.GetMemory().get(), firstMemory.get());
+    EXPECT_EQ(memoryNotificationCount.load(), 1U);
+    EXPECT_EQ(cpuNotificationCount.load(), 1U);
+  }
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(HardwareSnapshotTest, UnsubscribedCallbacksAreRemoved) {
+    HardwareSnapshot snapshot;
+
+    std::size_t first = snapshot.Subscribe([](HardwareChange) {});
+    std::size_t second = snapshot.Subscribe([](HardwareChange) {});
+    EXPECT_NE(first, second);
+
+    EXPECT_NO_THROW(snapshot.Unsubscribe(first));
+    EXPECT_NO_THROW(snapshot.Unsubscribe(second));
+    EXPECT_NO_THROW(snapshot.Refresh().wait());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
@@ -0,0 +1,127 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Hardware/LinuxCgroupReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../FakeFileTree.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Builds a fake procfs and cgroupfs for a process in a limited container</summary>
+  /// <param name="tree">Fake file tree in which the files will be placed</param>
+  /// <remarks>
+  ///   The process runs in the cgroup '/a/b'. Its parent '/a' is limited to 2.5 processors
+  ///   worth of CPU time and the cpuset controller restricts it to five processors.
+  /// </remarks>
+  void placeContainer(Nuclex::Platform::FakeFileTree &tree) {
+    tree.PlaceFile(u8"proc/self/cgroup", u8"0::/a/b\n");
+
+    tree.PlaceFile(u8"cgroup/cpu.max", u8"max 100000\n");
+    tree.PlaceFile(u8"cgroup/a/cpu.max", u8"250000 100000\n");
+    tree.PlaceFile(u8"cgroup/a/b/cpu.max", u8"max 100000\n");
+    tree.PlaceFile(u8"cgroup/a/b/cpuset.cpus.effective", u8"0-3,8\n");
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxCgroupReaderTest, FindsUnifiedCgroupPath) {
+    EXPECT_EQ(
+      LinuxCgroupReader::FindUnifiedCgroupPath(
+        u8"12:memory:/docker/abc\n0::/user.slice/app.scope\n"
+      ),
+      u8"/user.slice/app.scope"
+    );
+    EXPECT_TRUE(
+      LinuxCgroupReader::FindUnifiedCgroupPath(u8"4:memory:/docker/abc\n").empty()
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxCgroupReaderTest, CanLocateOwnCgroup) {
+    FakeFileTree tree;
+    placeContainer(tree);
+
+    std::string groupDirectory = LinuxCgroupReader::LocateOwnCgroup(
+      tree.GetPath(u8"proc"), tree.GetPath(u8"cgroup")
+    );
+    EXPECT_EQ(groupDirectory, tree.GetPath(u8"cgroup/a/b"));
+
+    std::vector<std::string> directories = LinuxCgroupReader::ListGroupAndAncestors(
+      tree.GetPath(u8"cgroup"), groupDirectory
+    );
+    ASSERT_EQ(directories.size(), 3U);
+    EXPECT_EQ(directories[0], tree.GetPath(u8"cgroup/a/b"));
+    EXPECT_EQ(directories[1], tree.GetPath(u8"cgroup/a"));
+    EXPECT_EQ(directories[2], tree.GetPath(u8"cgroup"));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxCgroupReaderTest, CpuQuotaIsInheritedFromAncestors) {
+    FakeFileTree tree;
+    placeContainer(tree);
+
+    std::optional<double> quota = LinuxCgroupReader::TryReadCpuQuota(
+      tree.GetPath(u8"cgroup"), tree.GetPath(u8"cgroup/a/b")
+    );
+    ASSERT_TRUE(quota.has_value());
+    EXPECT_DOUBLE_EQ(quota.value(), 2.5);
+
+    tree.PlaceFile(u8"cgroup/a/cpu.max", u8"max 100000\n");
+    quota = LinuxCgroupReader::TryReadCpuQuota(
+      tree.GetPath(u8"cgroup"), tree.GetPath(u8"cgroup/a/b")
+    );
+    EXPECT_FALSE(quota.has_value());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxCgroupReaderTest, CanReadEffectiveCpus) {
+    FakeFileTree tree;
+    placeContainer(tree);
+
+    std::vector<std::size_t> cpus = LinuxCgroupReader::TryReadEffectiveCpus(
+      tree.GetPath(u8"cgroup/a/b")
+    );
+    std::vector<std::size_t> expected = { 0, 1, 2, 3, 8 };
+    EXPECT_EQ(cpus, expected);
+
+    EXPECT_TRUE(LinuxCgroupReader::TryReadEffectiveCpus(tree.GetPath(u8"cgroup/a")).empty());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
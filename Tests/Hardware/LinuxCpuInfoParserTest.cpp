@@ -20,957 +20,142 @@ limitations under the License.
 // If the library is compiled as a DLL, this ensures symbols are exported
 #define NUCLEX_PLATFORM_SOURCE 1
 
+#include "../../Source/Hardware/LinuxProcCpuInfoReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "./CapturedCpuInfo.h"
+
+#include <gtest/gtest.h>
+
 #include <string>
+#include <vector>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Processor as reported to the callback of the /proc/cpuinfo parser</summary>
+  struct ReportedProcessor {
+
+    /// <summary>Index of the processor as assigned by the kernel</summary>
+    public: std::size_t Index;
+    /// <summary>Id of the physical CPU the processor belongs to</summary>
+    public: std::size_t PhysicalCpuId;
+    /// <summary>Id of the core the processor belongs to</summary>
+    public: std::size_t CoreId;
+    /// <summary>Make and model of the CPU</summary>
+    public: std::string Name;
+    /// <summary>Current frequency of the processor</summary>
+    public: double FrequencyInMhz;
+    /// <summary>Rough benchmark value of the processor</summary>
+    public: double BogoMips;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Records a processor reported by the /proc/cpuinfo parser</summary>
+  /// <param name="processorsAsVoid">Vector of processors the processor will be added to</param>
+  /// <param name="processorIndex">Index of the processor</param>
+  /// <param name="physicalCpuId">Id of the physical CPU the processor belongs to</param>
+  /// <param name="coreId">Id of the core the processor belongs to</param>
+  /// <param name="name">Make and model of the CPU</param>
+  /// <param name="frequencyInMhz">Current frequency of the processor</param>
+  /// <param name="bogoMips">Rough benchmark value of the processor</param>
+  void recordProcessor(
+    void *processorsAsVoid,
+    std::size_t processorIndex,
+    std::size_t physicalCpuId,
+    std::size_t coreId,
+    const std::string_view &name,
+    double frequencyInMhz,
+    double bogoMips
+  ) {
+    reinterpret_cast<std::vector<ReportedProcessor> *>(processorsAsVoid)->push_back(
+      ReportedProcessor {
+        processorIndex, physicalCpuId, coreId, std::string(name), frequencyInMhz, bogoMips
+      }
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Parses the specified /proc/cpuinfo contents</summary>
+  /// <param name="cpuInfo">Contents of the /proc/cpuinfo file that will be parsed</param>
+  /// <returns>All processors the parser reported</returns>
+  std::vector<ReportedProcessor> parseCpuInfo(const std::string &cpuInfo) {
+    std::vector<ReportedProcessor> processors;
+    Nuclex::Platform::Hardware::LinuxProcCpuInfoReader::ParseCpuInfo(
+      cpuInfo, &processors, &recordProcessor
+    );
+    return processors;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxCpuInfoParserTest, ReportsEveryProcessorOfDesktopCpu) {
+    std::vector<ReportedProcessor> processors = parseCpuInfo(exampleDesktopCpuInfo);
+    ASSERT_EQ(processors.size(), 4U);
+
+    for(std::size_t index = 0; index < 4; ++index) {
+      EXPECT_EQ(processors[index].Index, index);
+      EXPECT_EQ(processors[index].PhysicalCpuId, 0U);
+      EXPECT_EQ(processors[index].CoreId, (index / 2) * 2);
+      EXPECT_EQ(processors[index].Name, u8"Intel(R) Core(TM) i3 CPU       M 330  @ 2.13GHz");
+      EXPECT_DOUBLE_EQ(processors[index].FrequencyInMhz, 933.0);
+    }
+
+    EXPECT_DOUBLE_EQ(processors[0].BogoMips, 4256.49);
+    EXPECT_DOUBLE_EQ(processors[3].BogoMips, 4256.42);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxCpuInfoParserTest, ReportsEveryProcessorOfServerCpu) {
+    std::vector<ReportedProcessor> processors = parseCpuInfo(exampleServerCpuInfo);
+    ASSERT_EQ(processors.size(), 32U);
+
+    EXPECT_EQ(processors[31].Index, 31U);
+    EXPECT_EQ(processors[1].CoreId, 1U);
+    EXPECT_EQ(processors[0].Name, u8"Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz");
+    EXPECT_DOUBLE_EQ(processors[0].FrequencyInMhz, 2601.0);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxCpuInfoParserTest, ToleratesMissingIdsAndTrailingNewline) {
+    std::vector<ReportedProcessor> processors = parseCpuInfo(
+      u8"processor\t: 0\n"
+      u8"BogoMIPS\t: 48.00\n"
+      u8"CPU part\t: 0xd08\n"
+      u8"\n"
+      u8"processor\t: 1\n"
+      u8"BogoMIPS\t: 48.00"
+    );
+    ASSERT_EQ(processors.size(), 2U);
+
+    EXPECT_EQ(processors[1].Index, 1U);
+    EXPECT_EQ(processors[1].PhysicalCpuId, std::size_t(-1));
+    EXPECT_EQ(processors[1].CoreId, std::size_t(-1));
+    EXPECT_TRUE(processors[1].Name.empty());
+    EXPECT_LT(processors[1].FrequencyInMhz, 0.0);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxCpuInfoParserTest, EmptyContentsYieldNoProcessors) {
+    EXPECT_TRUE(parseCpuInfo(std::string()).empty());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
 
-std::string exampleDesktopCpuInfo(
-  "processor   : 0\n"
-  "vendor_id   : GenuineIntel\n"
-  "cpu family  : 6\n"
-  "model       : 37\n"
-  "model name  : Intel(R) Core(TM) i3 CPU       M 330  @ 2.13GHz\n"
-  "stepping    : 2\n"
-  "cpu MHz     : 933.000\n"
-  "cache size  : 3072 KB\n"
-  "physical id : 0\n"
-  "siblings    : 4\n"
-  "core id     : 0\n"
-  "cpu cores   : 2\n"
-  "apicid      : 0\n"
-  "initial apicid  : 0\n"
-  "fdiv_bug    : no\n"
-  "hlt_bug     : no\n"
-  "f00f_bug    : no\n"
-  "coma_bug    : no\n"
-  "fpu     : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level : 11\n"
-  "wp      : yes\n"
-  "flags       : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe nx rdtscp lm constant_tsc arch_perfmon pebs bts xtopology nonstop_tsc aperfmperf pni dtes64 monitor ds_cpl vmx est tm2 ssse3 cx16 xtpr pdcm sse4_1 sse4_2 popcnt lahf_lm arat dts tpr_shadow vnmi flexpriority ept vpid\n"
-  "bogomips    : 4256.49\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor   : 1\n"
-  "vendor_id   : GenuineIntel\n"
-  "cpu family  : 6\n"
-  "model       : 37\n"
-  "model name  : Intel(R) Core(TM) i3 CPU       M 330  @ 2.13GHz\n"
-  "stepping    : 2\n"
-  "cpu MHz     : 933.000\n"
-  "cache size  : 3072 KB\n"
-  "physical id : 0\n"
-  "siblings    : 4\n"
-  "core id     : 0\n"
-  "cpu cores   : 2\n"
-  "apicid      : 1\n"
-  "initial apicid  : 1\n"
-  "fdiv_bug    : no\n"
-  "hlt_bug     : no\n"
-  "f00f_bug    : no\n"
-  "coma_bug    : no\n"
-  "fpu     : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level : 11\n"
-  "wp      : yes\n"
-  "flags       : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe nx rdtscp lm constant_tsc arch_perfmon pebs bts xtopology nonstop_tsc aperfmperf pni dtes64 monitor ds_cpl vmx est tm2 ssse3 cx16 xtpr pdcm sse4_1 sse4_2 popcnt lahf_lm arat dts tpr_shadow vnmi flexpriority ept vpid\n"
-  "bogomips    : 4256.40\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor   : 2\n"
-  "vendor_id   : GenuineIntel\n"
-  "cpu family  : 6\n"
-  "model       : 37\n"
-  "model name  : Intel(R) Core(TM) i3 CPU       M 330  @ 2.13GHz\n"
-  "stepping    : 2\n"
-  "cpu MHz     : 933.000\n"
-  "cache size  : 3072 KB\n"
-  "physical id : 0\n"
-  "siblings    : 4\n"
-  "core id     : 2\n"
-  "cpu cores   : 2\n"
-  "apicid      : 4\n"
-  "initial apicid  : 4\n"
-  "fdiv_bug    : no\n"
-  "hlt_bug     : no\n"
-  "f00f_bug    : no\n"
-  "coma_bug    : no\n"
-  "fpu     : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level : 11\n"
-  "wp      : yes\n"
-  "flags       : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe nx rdtscp lm constant_tsc arch_perfmon pebs bts xtopology nonstop_tsc aperfmperf pni dtes64 monitor ds_cpl vmx est tm2 ssse3 cx16 xtpr pdcm sse4_1 sse4_2 popcnt lahf_lm arat dts tpr_shadow vnmi flexpriority ept vpid\n"
-  "bogomips    : 4256.43\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor   : 3\n"
-  "vendor_id   : GenuineIntel\n"
-  "cpu family  : 6\n"
-  "model       : 37\n"
-  "model name  : Intel(R) Core(TM) i3 CPU       M 330  @ 2.13GHz\n"
-  "stepping    : 2\n"
-  "cpu MHz     : 933.000\n"
-  "cache size  : 3072 KB\n"
-  "physical id : 0\n"
-  "siblings    : 4\n"
-  "core id     : 2\n"
-  "cpu cores   : 2\n"
-  "apicid      : 5\n"
-  "initial apicid  : 5\n"
-  "fdiv_bug    : no\n"
-  "hlt_bug     : no\n"
-  "f00f_bug    : no\n"
-  "coma_bug    : no\n"
-  "fpu     : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level : 11\n"
-  "wp      : yes\n"
-  "flags       : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe nx rdtscp lm constant_tsc arch_perfmon pebs bts xtopology nonstop_tsc aperfmperf pni dtes64 monitor ds_cpl vmx est tm2 ssse3 cx16 xtpr pdcm sse4_1 sse4_2 popcnt lahf_lm arat dts tpr_shadow vnmi flexpriority ept vpid\n"
-  "bogomips    : 4256.42\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-);
-
-std::string exampleServerCpuInfo(
-  "processor       : 0\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 0\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 1\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 1\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 2\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 2\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 3\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 3\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 4\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 4\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 5\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 5\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 6\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 6\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 7\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 7\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 8\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 8\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 9\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 9\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 10\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 10\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 11\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 11\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 12\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 12\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 13\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 13\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 14\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 14\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 15\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 0\n"
-  "siblings        : 16\n"
-  "core id         : 15\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 16\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 0\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 17\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 1\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 18\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 2\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 19\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 3\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 20\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 4\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 21\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 5\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 22\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 6\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 23\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 7\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 24\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 8\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 25\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 9\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 26\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 10\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 27\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 11\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 28\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 12\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 29\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 13\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 30\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 14\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-  "\n"
-  "processor       : 31\n"
-  "vendor_id       : GenuineIntel\n"
-  "cpu family      : 6\n"
-  "model           : 79\n"
-  "model name      : Intel(R) Xeon(R) CPU E5-2697A v4 @ 2.60GHz\n"
-  "stepping        : 1\n"
-  "microcode       : 0xffffffff\n"
-  "cpu MHz         : 2601.000\n"
-  "cache size      : 256 KB\n"
-  "physical id     : 1\n"
-  "siblings        : 16\n"
-  "core id         : 15\n"
-  "cpu cores       : 16\n"
-  "apicid          : 0\n"
-  "initial apicid  : 0\n"
-  "fpu             : yes\n"
-  "fpu_exception   : yes\n"
-  "cpuid level     : 6\n"
-  "wp              : yes\n"
-  "flags           : fpu vme de pse tsc msr pae mce cx8 apic sep mtrr pge mca cmov pat pse36 clflush dts acpi mmx fxsr sse sse2 ss ht tm pbe syscall nx pdpe1gb rdtscp lm pni pclmulqdq dtes64 monitor ds_cpl vmx smx est tm2 ssse3 fma cx16 xtpr pdcm pcid dca sse4_1 sse4_2 x2apic movbe popcnt tsc_deadline_timer aes xsave osxsave avx f16c rdrand lahf_lm abm 3dnowprefetch fsgsbase tsc_adjust bmi1 hle avx2 smep bmi2 erms invpcid rtm cqm rdt_a rdseed adx smap intel_pt ibrs ibpb stibp ssbd\n"
-  "bogomips        : 5202.00\n"
-  "clflush size    : 64\n"
-  "cache_alignment : 64\n"
-  "address sizes   : 36 bits physical, 48 bits virtual\n"
-  "power management:\n"
-);
+}}} // namespace Nuclex::Platform::Hardware
 
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,144 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Hardware/LinuxMemoryPressureReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../FakeFileTree.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Builds a fake procfs and cgroupfs for a process in a limited container</summary>
+  /// <param name="tree">Fake file tree in which the files will be placed</param>
+  /// <remarks>
+  ///   The host has 64 GiB of memory with 48 GiB available. The process runs in
+  ///   the cgroup '/app.slice/worker' whose parent is limited to 512 MiB.
+  /// </remarks>
+  void placeContainer(Nuclex::Platform::FakeFileTree &tree) {
+    tree.PlaceFile(
+      u8"proc/meminfo",
+      u8"MemTotal:       67108864 kB\n"
+      u8"MemFree:        16777216 kB\n"
+      u8"MemAvailable:   50331648 kB\n"
+      u8"Buffers:          524288 kB\n"
+    );
+    tree.PlaceFile(
+      u8"proc/pressure/memory",
+      u8"some avg10=1.25 avg60=0.50 avg300=0.10 total=123456\n"
+      u8"full avg10=0.75 avg60=0.25 avg300=0.05 total=65432\n"
+    );
+    tree.PlaceFile(u8"proc/self/cgroup", u8"0::/app.slice/worker\n");
+
+    tree.PlaceFile(u8"cgroup/memory.max", u8"max\n");
+    tree.PlaceFile(u8"cgroup/app.slice/memory.max", u8"536870912\n");
+    tree.PlaceFile(u8"cgroup/app.slice/worker/memory.max", u8"max\n");
+    tree.PlaceFile(u8"cgroup/app.slice/worker/memory.current", u8"104857600\n");
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxMemoryPressureReaderTest, ParsesPressureStallInfo) {
+    std::optional<float> someStallPercent, fullStallPercent;
+    LinuxMemoryPressureReader::ParsePressureStallInfo(
+      u8"some avg10=2.50 avg60=1.00 avg300=0.00 total=42\n",
+      someStallPercent, fullStallPercent
+    );
+
+    ASSERT_TRUE(someStallPercent.has_value());
+    EXPECT_FLOAT_EQ(someStallPercent.value(), 2.5f);
+    EXPECT_FALSE(fullStallPercent.has_value());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxMemoryPressureReaderTest, GroupLimitCapsUsableMemory) {
+    FakeFileTree tree;
+    placeContainer(tree);
+
+    LinuxMemoryPressureReader reader(tree.GetPath(u8"proc"), tree.GetPath(u8"cgroup"));
+    MemoryPressure pressure;
+    reader.Sample(pressure);
+
+    EXPECT_EQ(pressure.TotalMegabytes, 65536U);
+    EXPECT_EQ(pressure.AvailableMegabytes, 49152U);
+    ASSERT_TRUE(pressure.GroupLimitMegabytes.has_value());
+    EXPECT_EQ(pressure.GroupLimitMegabytes.value(), 512U);
+    ASSERT_TRUE(pressure.GroupUsageMegabytes.has_value());
+    EXPECT_EQ(pressure.GroupUsageMegabytes.value(), 100U);
+    EXPECT_EQ(pressure.UsableMegabytes, 412U);
+    ASSERT_TRUE(pressure.SomeStallPercent.has_value());
+    EXPECT_FLOAT_EQ(pressure.SomeStallPercent.value(), 1.25f);
+    ASSERT_TRUE(pressure.FullStallPercent.has_value());
+    EXPECT_FLOAT_EQ(pressure.FullStallPercent.value(), 0.75f);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxMemoryPressureReaderTest, SamplesReflectChangedFiles) {
+    FakeFileTree tree;
+    placeContainer(tree);
+
+    LinuxMemoryPressureReader reader(tree.GetPath(u8"proc"), tree.GetPath(u8"cgroup"));
+    MemoryPressure pressure;
+    reader.Sample(pressure);
+    EXPECT_EQ(pressure.GroupUsageMegabytes.value(), 100U);
+
+    // The files are kept open, so overwrite the contents in place
+    tree.PlaceFile(u8"cgroup/app.slice/worker/memory.current", u8"524288000\n");
+    reader.Sample(pressure);
+    EXPECT_EQ(pressure.GroupUsageMegabytes.value(), 500U);
+    EXPECT_EQ(pressure.UsableMegabytes, 12U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxMemoryPressureReaderTest, MissingSourcesAreSkipped) {
+    FakeFileTree tree;
+    tree.PlaceFile(u8"proc/meminfo", u8"MemTotal: 1048576 kB\nMemFree: 524288 kB\n");
+
+    LinuxMemoryPressureReader reader(tree.GetPath(u8"proc"), tree.GetPath(u8"cgroup"));
+    MemoryPressure pressure;
+    reader.Sample(pressure);
+
+    EXPECT_EQ(pressure.TotalMegabytes, 1024U);
+    EXPECT_EQ(pressure.AvailableMegabytes, 512U);
+    EXPECT_FALSE(pressure.GroupLimitMegabytes.has_value());
+    EXPECT_FALSE(pressure.SomeStallPercent.has_value());
+    EXPECT_EQ(pressure.UsableMegabytes, 512U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,143 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Hardware/LinuxProcMemInfoReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../FakeFileTree.h"
+
+#include <Nuclex/Support/Threading/StopSource.h> // for StopSource
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Builds a fake /proc and /sys tree for a system with huge pages</summary>
+  /// <param name="tree">Fake file tree in which the files will be placed</param>
+  /// <remarks>
+  ///   The system has a pool of 512 huge pages reserved, transparent huge pages set
+  ///   to madvise and two NUMA nodes with a gap in the node numbers.
+  /// </remarks>
+  void placeHugePageSystem(Nuclex::Platform::FakeFileTree &tree) {
+    tree.PlaceFile(
+      u8"proc/meminfo",
+      u8"MemTotal:       32795876 kB\n"
+      u8"MemFree:        20000000 kB\n"
+      u8"MemAvailable:   28000000 kB\n"
+      u8"HugePages_Total:     512\n"
+      u8"HugePages_Free:      500\n"
+      u8"HugePages_Rsvd:        0\n"
+      u8"HugePages_Surp:        0\n"
+      u8"Hugepagesize:       2048 kB\n"
+      u8"Hugetlb:         1048576 kB\n"
+    );
+    tree.PlaceFile(
+      u8"sys/kernel/mm/transparent_hugepage/enabled", u8"always [madvise] never\n"
+    );
+    tree.PlaceFile(
+      u8"sys/devices/system/node/node0/meminfo",
+      u8"Node 0 MemFree:        10485760 kB\n"
+    );
+    tree.PlaceFile(
+      u8"sys/devices/system/node/node2/meminfo",
+      u8"Node 2 MemFree:         4194304 kB\n"
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcMemInfoReaderTest, CanParseTransparentHugePageMode) {
+    EXPECT_EQ(
+      LinuxProcMemInfoReader::ParseTransparentHugePageMode(u8"[always] madvise never\n"),
+      TransparentHugePageMode::Always
+    );
+    EXPECT_EQ(
+      LinuxProcMemInfoReader::ParseTransparentHugePageMode(u8"always [madvise] never\n"),
+      TransparentHugePageMode::OnRequest
+    );
+    EXPECT_EQ(
+      LinuxProcMemInfoReader::ParseTransparentHugePageMode(u8"always madvise [never]\n"),
+      TransparentHugePageMode::Never
+    );
+    EXPECT_EQ(
+      LinuxProcMemInfoReader::ParseTransparentHugePageMode(u8""),
+      TransparentHugePageMode::Unsupported
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcMemInfoReaderTest, ReportsHugePagesAndNodeFreeMemory) {
+    FakeFileTree tree;
+    placeHugePageSystem(tree);
+
+    std::shared_ptr<Nuclex::Support::Threading::StopSource> source = (
+      Nuclex::Support::Threading::StopSource::Create()
+    );
+    MemoryInfo memory = LinuxProcMemInfoReader::TryReadMemInfo(
+      source->GetToken(), tree.GetPath(u8"proc"), tree.GetPath(u8"sys")
+    );
+
+    EXPECT_EQ(memory.InstalledMegabytes, 32027U);
+    EXPECT_EQ(memory.HugePageKilobytes, 2048U);
+    EXPECT_EQ(memory.HugePageTotalCount, 512U);
+    EXPECT_EQ(memory.HugePageFreeCount, 500U);
+    EXPECT_EQ(memory.TransparentHugePages, TransparentHugePageMode::OnRequest);
+
+    std::vector<std::size_t> expected { 10240, 0, 4096 };
+    EXPECT_EQ(memory.NodeFreeMegabytes, expected);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcMemInfoReaderTest, ReportsMissingTransparentHugePagesAsUnsupported) {
+    FakeFileTree tree;
+    tree.PlaceFile(u8"proc/meminfo", u8"MemTotal:       8388608 kB\n");
+    tree.PlaceDirectory(u8"sys");
+
+    std::shared_ptr<Nuclex::Support::Threading::StopSource> source = (
+      Nuclex::Support::Threading::StopSource::Create()
+    );
+    MemoryInfo memory = LinuxProcMemInfoReader::TryReadMemInfo(
+      source->GetToken(), tree.GetPath(u8"proc"), tree.GetPath(u8"sys")
+    );
+
+    EXPECT_EQ(memory.InstalledMegabytes, 8192U);
+    EXPECT_EQ(memory.HugePageKilobytes, 0U);
+    EXPECT_EQ(memory.TransparentHugePages, TransparentHugePageMode::Unsupported);
+    EXPECT_TRUE(memory.NodeFreeMegabytes.empty());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
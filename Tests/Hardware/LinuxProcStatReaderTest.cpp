@@ -0,0 +1,133 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Hardware/LinuxProcStatReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../FakeFileTree.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Contents of /proc/stat on a system with processor 1 offline</summary>
+  const char StatContents[] = (
+    u8"cpu  1000 100 500 8000 200 10 20 30 0 0\n"
+    u8"cpu0 600 50 300 4000 100 5 10 15 0 0\n"
+    u8"cpu2 400 50 200 4000 100 5 10 15 0 0\n"
+    u8"intr 123456 0 9 0 0 0 0 0 0 1 0 0 0 0 0 0 0\n"
+    u8"ctxt 987654\n"
+    u8"btime 1700000000\n"
+  );
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcStatReaderTest, ParsesSystemWideCounters) {
+    LinuxCpuTimes total;
+    std::vector<LinuxCpuTimes> processors;
+    std::size_t processorCount = LinuxProcStatReader::ParseCpuTimes(
+      StatContents, total, processors
+    );
+
+    EXPECT_EQ(processorCount, 3U);
+    EXPECT_EQ(total.BusyTicks, 1630U); // user + nice + system + irq + softirq
+    EXPECT_EQ(total.IoWaitTicks, 200U);
+    EXPECT_EQ(total.StealTicks, 30U);
+    EXPECT_EQ(total.TotalTicks, 9860U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcStatReaderTest, LeavesOfflineProcessorsUnchanged) {
+    LinuxCpuTimes total;
+    std::vector<LinuxCpuTimes> processors(3, LinuxCpuTimes { 1, 2, 3, 4 });
+    LinuxProcStatReader::ParseCpuTimes(StatContents, total, processors);
+
+    EXPECT_EQ(processors[0].BusyTicks, 965U);
+    EXPECT_EQ(processors[1].BusyTicks, 1U);
+    EXPECT_EQ(processors[1].TotalTicks, 4U);
+    EXPECT_EQ(processors[2].BusyTicks, 665U);
+    EXPECT_EQ(processors[2].TotalTicks, 4780U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcStatReaderTest, ToleratesOldKernelsWithFewerColumns) {
+    LinuxCpuTimes total;
+    std::vector<LinuxCpuTimes> processors;
+    std::size_t processorCount = LinuxProcStatReader::ParseCpuTimes(
+      u8"cpu  100 0 50 850\n", total, processors
+    );
+
+    EXPECT_EQ(processorCount, 1U);
+    EXPECT_EQ(total.BusyTicks, 150U);
+    EXPECT_EQ(total.IoWaitTicks, 0U);
+    EXPECT_EQ(total.StealTicks, 0U);
+    EXPECT_EQ(total.TotalTicks, 1000U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcStatReaderTest, ReadsCountersThroughOpenedFile) {
+    FakeFileTree tree;
+    tree.PlaceFile(u8"proc/stat", StatContents);
+
+    LinuxProcStatReader reader(tree.GetPath(u8"proc"));
+    ASSERT_EQ(reader.CountProcessors(), 3U);
+
+    LinuxCpuTimes total;
+    std::vector<LinuxCpuTimes> processors(3);
+    ASSERT_TRUE(reader.TryRead(total, processors));
+    EXPECT_EQ(total.TotalTicks, 9860U);
+
+    tree.PlaceFile(u8"proc/stat", u8"cpu  2000 100 500 8000 200 10 20 30 0 0\n");
+    ASSERT_TRUE(reader.TryRead(total, processors));
+    EXPECT_EQ(total.TotalTicks, 10860U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcStatReaderTest, MissingFileCannotBeRead) {
+    FakeFileTree tree;
+
+    LinuxProcStatReader reader(tree.GetPath(u8"proc"));
+    EXPECT_EQ(reader.CountProcessors(), 0U);
+
+    LinuxCpuTimes total;
+    std::vector<LinuxCpuTimes> processors;
+    EXPECT_FALSE(reader.TryRead(total, processors));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
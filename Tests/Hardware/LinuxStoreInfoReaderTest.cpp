@@ -0,0 +1,317 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Hardware/LinuxStoreInfoReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../FakeFileTree.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Places a block device in the fake sysfs tree</summary>
+  /// <param name="tree">Fake file tree in which the block device will be placed</param>
+  /// <param name="devicePath">Path of the device below sys/devices</param>
+  /// <param name="name">Name of the block device</param>
+  /// <param name="deviceNumber">Major and minor number of the block device</param>
+  /// <param name="sectorCount">Size of the block device in 512 byte sectors</param>
+  /// <param name="isRotational">Whether the block device has spinning platters</param>
+  void placeBlockDevice(
+    Nuclex::Platform::FakeFileTree &tree, const std::string &devicePath,
+    const std::string &name, const std::string &deviceNumber,
+    const std::string &sectorCount, bool isRotational
+  ) {
+    std::string directory = u8"sys/devices/" + devicePath + u8"/block/" + name;
+    tree.PlaceFile(directory + u8"/dev", deviceNumber + u8"\n");
+    tree.PlaceFile(directory + u8"/size", sectorCount + u8"\n");
+    tree.PlaceFile(directory + u8"/removable", u8"0\n");
+    tree.PlaceFile(directory + u8"/queue/rotational", isRotational ? u8"1\n" : u8"0\n");
+    tree.PlaceSymlink(u8"sys/block/" + name, u8"../devices/" + devicePath + u8"/block/" + name);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Places a partition of a block device in the fake sysfs tree</summary>
+  /// <param name="tree">Fake file tree in which the partition will be placed</param>
+  /// <param name="deviceName">Name of the block device the partition belongs to</param>
+  /// <param name="name">Name of the partition</param>
+  /// <param name="deviceNumber">Major and minor number of the partition</param>
+  /// <param name="sectorCount">Size of the partition in 512 byte sectors</param>
+  void placePartition(
+    Nuclex::Platform::FakeFileTree &tree, const std::string &deviceName,
+    const std::string &name, const std::string &deviceNumber, const std::string &sectorCount
+  ) {
+    std::string directory = u8"sys/block/" + deviceName + u8"/" + name;
+    tree.PlaceFile(directory + u8"/dev", deviceNumber + u8"\n");
+    tree.PlaceFile(directory + u8"/size", sectorCount + u8"\n");
+    tree.PlaceFile(directory + u8"/partition", name.substr(name.length() - 1) + u8"\n");
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Builds a fake system with local disks, a disc drive and network shares</summary>
+  /// <param name="tree">Fake file tree in which the files will be placed</param>
+  void placeWorkstation(Nuclex::Platform::FakeFileTree &tree) {
+    placeBlockDevice(
+      tree, u8"pci0000:00/0000:00:1d.0/nvme/nvme0", u8"nvme0n1", u8"259:0", u8"1000215216", false
+    );
+    tree.PlaceFile(u8"sys/block/nvme0n1/device/model", u8"Samsung SSD 980 1TB          \n");
+    tree.PlaceFile(u8"sys/block/nvme0n1/queue/nr_requests", u8"1023\n");
+    tree.PlaceFile(u8"sys/block/nvme0n1/queue/logical_block_size", u8"512\n");
+    tree.PlaceFile(u8"sys/block/nvme0n1/queue/physical_block_size", u8"4096\n");
+    tree.PlaceFile(u8"sys/block/nvme0n1/queue/optimal_io_size", u8"0\n");
+    tree.PlaceFile(u8"sys/block/nvme0n1/queue/max_sectors_kb", u8"128\n");
+    tree.PlaceFile(u8"sys/block/nvme0n1/queue/scheduler", u8"[none] mq-deadline\n");
+    placePartition(tree, u8"nvme0n1", u8"nvme0n1p1", u8"259:1", u8"1048576");
+    placePartition(tree, u8"nvme0n1", u8"nvme0n1p2", u8"259:2", u8"999164591");
+
+    placeBlockDevice(
+      tree, u8"pci0000:00/0000:00:17.0/ata1/host0/target0:0:0/0:0:0:0",
+      u8"sda", u8"8:0", u8"3907029168", true
+    );
+    tree.PlaceFile(u8"sys/block/sda/device/vendor", u8"ATA     \n");
+    tree.PlaceFile(u8"sys/block/sda/device/model", u8"WDC WD20EZRZ-00Z\n");
+    tree.PlaceFile(u8"sys/block/sda/queue/nr_requests", u8"64\n");
+    tree.PlaceFile(u8"sys/block/sda/queue/optimal_io_size", u8"65536\n");
+    tree.PlaceFile(u8"sys/block/sda/queue/scheduler", u8"mq-deadline kyber [bfq] none\n");
+    placePartition(tree, u8"sda", u8"sda1", u8"8:1", u8"3907026944");
+
+    placeBlockDevice(
+      tree, u8"pci0000:00/0000:00:14.0/usb2/2-1/2-1:1.0/host6/target6:0:0/6:0:0:0",
+      u8"sdb", u8"8:16", u8"62521344", false
+    );
+    placeBlockDevice(tree, u8"virtual", u8"loop0", u8"7:0", u8"0", false);
+    placeBlockDevice(tree, u8"pci0000:00/0000:00:17.0/ata2", u8"sr0", u8"11:0", u8"0", true);
+
+    tree.PlaceFile(
+      u8"proc/self/mountinfo",
+      u8"22 1 259:2 / / rw,relatime shared:1 - ext4 /dev/nvme0n1p2 rw\n"
+      u8"23 22 259:1 / /boot/efi rw,relatime shared:2 - vfat /dev/nvme0n1p1 rw\n"
+      u8"24 22 0:5 / /proc rw,nosuid shared:3 - proc proc rw\n"
+      u8"25 22 0:35 /@data /srv/data rw,relatime shared:4 - btrfs /dev/sda1 rw\n"
+      u8"26 22 0:35 /@data /home/user/My\\040Data rw,relatime - btrfs /dev/sda1 rw\n"
+      u8"27 22 0:40 / /mnt/media rw,relatime - nfs4 nas.local:/export/media rw\n"
+      u8"28 22 0:41 / /mnt/backup rw,relatime - cifs //nas.local/backup rw\n"
+      u8"29 22 0:42 / /mnt/scratch rw,relatime - nfs [fd00::5]:/scratch rw\n"
+    );
+
+    tree.PlaceSymlink(u8"dev/disk/by-label/Data\\x20Disk", u8"../../sda1");
+    tree.PlaceSymlink(u8"dev/disk/by-uuid/0B3A-1F2C", u8"../../nvme0n1p1");
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Reads the stores from the fake workstation</summary>
+  /// <param name="tree">Fake file tree holding the workstation's files</param>
+  /// <returns>The stores found in the fake file tree</returns>
+  std::vector<Nuclex::Platform::Hardware::StoreInfo> readStores(
+    const Nuclex::Platform::FakeFileTree &tree
+  ) {
+    return Nuclex::Platform::Hardware::LinuxStoreInfoReader::TryReadStores(
+      nullptr, tree.GetPath(u8"proc"), tree.GetPath(u8"sys"), tree.GetPath(u8"dev")
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Looks up a store by its identifier</summary>
+  /// <param name="stores">Stores that will be searched</param>
+  /// <param name="identifier">Identifier of the store that will be looked up</param>
+  /// <returns>The store with the specified identifier or a null pointer</returns>
+  const Nuclex::Platform::Hardware::StoreInfo *findStore(
+    const std::vector<Nuclex::Platform::Hardware::StoreInfo> &stores,
+    const std::string &identifier
+  ) {
+    for(const Nuclex::Platform::Hardware::StoreInfo &store : stores) {
+      if(store.Identifier == identifier) {
+        return &store;
+      }
+    }
+
+    return nullptr;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxStoreInfoReaderTest, CanParseMountInfo) {
+    std::vector<LinuxStoreInfoReader::MountEntry> mounts = LinuxStoreInfoReader::ParseMountInfo(
+      u8"36 35 98:0 /mnt1 /mnt/with\\040space rw,noatime master:1 - ext3 /dev/root rw\n"
+      u8"this line is garbage\n"
+      u8"37 35 0:12 / /sys rw - sysfs sysfs rw"
+    );
+
+    ASSERT_EQ(mounts.size(), 2U);
+    EXPECT_EQ(mounts[0].DeviceMajor, 98U);
+    EXPECT_EQ(mounts[0].DeviceMinor, 0U);
+    EXPECT_EQ(mounts[0].MountPath, u8"/mnt/with space");
+    EXPECT_EQ(mounts[0].FileSystem, u8"ext3");
+    EXPECT_EQ(mounts[0].Source, u8"/dev/root");
+    EXPECT_EQ(mounts[1].MountPath, u8"/sys");
+    EXPECT_EQ(mounts[1].FileSystem, u8"sysfs");
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxStoreInfoReaderTest, RecognizesNetworkFileSystems) {
+    EXPECT_TRUE(LinuxStoreInfoReader::IsNetworkFileSystem(u8"nfs4"));
+    EXPECT_TRUE(LinuxStoreInfoReader::IsNetworkFileSystem(u8"cifs"));
+    EXPECT_FALSE(LinuxStoreInfoReader::IsNetworkFileSystem(u8"ext4"));
+    EXPECT_FALSE(LinuxStoreInfoReader::IsNetworkFileSystem(u8"tmpfs"));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxStoreInfoReaderTest, DescribesBlockDevices) {
+    FakeFileTree tree;
+    placeWorkstation(tree);
+
+    std::vector<StoreInfo> stores = readStores(tree);
+    EXPECT_EQ(findStore(stores, u8"loop0"), nullptr);
+
+    const StoreInfo *nvme = findStore(stores, u8"nvme0n1");
+    ASSERT_NE(nvme, nullptr);
+    EXPECT_EQ(nvme->Type, StoreType::LocalInternalDrive);
+    EXPECT_EQ(nvme->ModelName, u8"Samsung SSD 980 1TB");
+    ASSERT_TRUE(nvme->IsSolidState.has_value());
+    EXPECT_TRUE(nvme->IsSolidState.value());
+    ASSERT_TRUE(nvme->CapacityInMegabytes.has_value());
+    EXPECT_EQ(nvme->CapacityInMegabytes.value(), 488386U);
+
+    const StoreInfo *hardDrive = findStore(stores, u8"sda");
+    ASSERT_NE(hardDrive, nullptr);
+    EXPECT_EQ(hardDrive->Type, StoreType::LocalInternalDrive);
+    EXPECT_EQ(hardDrive->ManufacturerName, u8"ATA");
+    ASSERT_TRUE(hardDrive->IsSolidState.has_value());
+    EXPECT_FALSE(hardDrive->IsSolidState.value());
+
+    const StoreInfo *usbStick = findStore(stores, u8"sdb");
+    ASSERT_NE(usbStick, nullptr);
+    EXPECT_EQ(usbStick->Type, StoreType::LocalExternalDrive);
+    EXPECT_TRUE(usbStick->Partitions.empty());
+
+    const StoreInfo *discDrive = findStore(stores, u8"sr0");
+    ASSERT_NE(discDrive, nullptr);
+    EXPECT_EQ(discDrive->Type, StoreType::LocalDiscDrive);
+    EXPECT_FALSE(discDrive->CapacityInMegabytes.has_value());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxStoreInfoReaderTest, DescribesQueueCharacteristics) {
+    FakeFileTree tree;
+    placeWorkstation(tree);
+
+    std::vector<StoreInfo> stores = readStores(tree);
+
+    const StoreInfo *nvme = findStore(stores, u8"nvme0n1");
+    ASSERT_NE(nvme, nullptr);
+    EXPECT_EQ(nvme->Interface, StoreInterface::Nvme);
+    EXPECT_EQ(nvme->QueueDepth, std::optional<std::size_t>(1023));
+    EXPECT_EQ(nvme->LogicalBlockSize, std::optional<std::size_t>(512));
+    EXPECT_EQ(nvme->PhysicalBlockSize, std::optional<std::size_t>(4096));
+    EXPECT_FALSE(nvme->OptimalTransferSize.has_value());
+    EXPECT_EQ(nvme->MaximumTransferSize, std::optional<std::size_t>(131072));
+    EXPECT_EQ(nvme->IoScheduler, u8"none");
+
+    const StoreInfo *hardDrive = findStore(stores, u8"sda");
+    ASSERT_NE(hardDrive, nullptr);
+    EXPECT_EQ(hardDrive->Interface, StoreInterface::Sata);
+    EXPECT_EQ(hardDrive->QueueDepth, std::optional<std::size_t>(64));
+    EXPECT_EQ(hardDrive->OptimalTransferSize, std::optional<std::size_t>(65536));
+    EXPECT_FALSE(hardDrive->MaximumTransferSize.has_value());
+    EXPECT_EQ(hardDrive->IoScheduler, u8"bfq");
+
+    const StoreInfo *usbStick = findStore(stores, u8"sdb");
+    ASSERT_NE(usbStick, nullptr);
+    EXPECT_EQ(usbStick->Interface, StoreInterface::Usb);
+
+    const StoreInfo *nas = findStore(stores, u8"nas.local");
+    ASSERT_NE(nas, nullptr);
+    EXPECT_EQ(nas->Interface, StoreInterface::Network);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxStoreInfoReaderTest, AssignsMountsToPartitions) {
+    FakeFileTree tree;
+    placeWorkstation(tree);
+
+    std::vector<StoreInfo> stores = readStores(tree);
+
+    const StoreInfo *nvme = findStore(stores, u8"nvme0n1");
+    ASSERT_NE(nvme, nullptr);
+    ASSERT_EQ(nvme->Partitions.size(), 2U);
+    EXPECT_EQ(nvme->Partitions[0].FileSystem, u8"ext4");
+    ASSERT_EQ(nvme->Partitions[0].MountPaths.size(), 1U);
+    EXPECT_EQ(nvme->Partitions[0].MountPaths[0], u8"/");
+    EXPECT_EQ(nvme->Partitions[1].FileSystem, u8"vfat");
+    EXPECT_EQ(nvme->Partitions[1].Serial, u8"0B3A-1F2C");
+
+    // Btrfs reports an anonymous device number, so this is matched by the source device
+    const StoreInfo *hardDrive = findStore(stores, u8"sda");
+    ASSERT_NE(hardDrive, nullptr);
+    ASSERT_EQ(hardDrive->Partitions.size(), 1U);
+    EXPECT_EQ(hardDrive->Partitions[0].FileSystem, u8"btrfs");
+    EXPECT_EQ(hardDrive->Partitions[0].Label, u8"Data Disk");
+    ASSERT_EQ(hardDrive->Partitions[0].MountPaths.size(), 2U);
+    EXPECT_EQ(hardDrive->Partitions[0].MountPaths[0], u8"/srv/data");
+    EXPECT_EQ(hardDrive->Partitions[0].MountPaths[1], u8"/home/user/My Data");
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxStoreInfoReaderTest, GroupsNetworkSharesByServer) {
+    FakeFileTree tree;
+    placeWorkstation(tree);
+
+    std::vector<StoreInfo> stores = readStores(tree);
+
+    const StoreInfo *nas = findStore(stores, u8"nas.local");
+    ASSERT_NE(nas, nullptr);
+    EXPECT_EQ(nas->Type, StoreType::NetworkServer);
+    ASSERT_EQ(nas->Partitions.size(), 2U);
+    EXPECT_EQ(nas->Partitions[0].Label, u8"nas.local:/export/media");
+    EXPECT_EQ(nas->Partitions[0].FileSystem, u8"nfs4");
+    EXPECT_EQ(nas->Partitions[1].Label, u8"//nas.local/backup");
+    EXPECT_EQ(nas->Partitions[1].FileSystem, u8"cifs");
+
+    const StoreInfo *scratch = findStore(stores, u8"fd00::5");
+    ASSERT_NE(scratch, nullptr);
+    ASSERT_EQ(scratch->Partitions.size(), 1U);
+    ASSERT_EQ(scratch->Partitions[0].MountPaths.size(), 1U);
+    EXPECT_EQ(scratch->Partitions[0].MountPaths[0], u8"/mnt/scratch");
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
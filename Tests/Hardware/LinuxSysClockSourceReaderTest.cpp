@@ -0,0 +1,77 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Hardware/LinuxSysClockSourceReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../FakeFileTree.h"
+
+#include <gtest/gtest.h>
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysClockSourceReaderTest, CanReadClockSources) {
+    FakeFileTree tree;
+    tree.PlaceFile(u8"clocksource/clocksource0/current_clocksource", u8"tsc\n");
+    tree.PlaceFile(
+      u8"clocksource/clocksource0/available_clocksource", u8"tsc hpet acpi_pm \n"
+    );
+
+    ClockInfo clocks;
+    ASSERT_TRUE(LinuxSysClockSourceReader::TryReadClockSources(clocks, tree.GetRootPath()));
+
+    EXPECT_EQ(clocks.ClockSource, u8"tsc");
+    ASSERT_EQ(clocks.AvailableClockSources.size(), 3U);
+    EXPECT_EQ(clocks.AvailableClockSources[0], u8"tsc");
+    EXPECT_EQ(clocks.AvailableClockSources[1], u8"hpet");
+    EXPECT_EQ(clocks.AvailableClockSources[2], u8"acpi_pm");
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysClockSourceReaderTest, FailsWithoutClockSourceDirectory) {
+    FakeFileTree tree;
+    tree.PlaceDirectory(u8"cpu");
+
+    ClockInfo clocks;
+    EXPECT_FALSE(LinuxSysClockSourceReader::TryReadClockSources(clocks, tree.GetRootPath()));
+    EXPECT_TRUE(clocks.ClockSource.empty());
+    EXPECT_TRUE(clocks.AvailableClockSources.empty());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysClockSourceReaderTest, CanReadClockSourcesOfThisSystem) {
+    ClockInfo clocks;
+    if(LinuxSysClockSourceReader::TryReadClockSources(clocks)) {
+      EXPECT_FALSE(clocks.ClockSource.empty());
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,296 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Hardware/LinuxSysCpuTreeReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../FakeFileTree.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Builds a fake sysfs tree resembling a small hybrid laptop CPU</summary>
+  /// <param name="tree">Fake file tree in which the sysfs files will be placed</param>
+  /// <remarks>
+  ///   One performance core with SMT (processors 0 and 1) and two eco cores
+  ///   (processors 2 and 3), all in the same package.
+  /// </remarks>
+  void placeHybridLaptop(Nuclex::Platform::FakeFileTree &tree) {
+    tree.PlaceFile(u8"cpu_core/cpus", u8"0-1\n");
+    tree.PlaceFile(u8"cpu_atom/cpus", u8"2-3\n");
+
+    tree.PlaceFile(u8"system/cpu/online", u8"0-3\n");
+    tree.PlaceDirectory(u8"system/cpu/cpuidle");
+
+    for(std::size_t index = 0; index < 4; ++index) {
+      std::string cpuPath = u8"system/cpu/cpu" + std::to_string(index) + u8"/";
+      tree.PlaceFile(cpuPath + u8"topology/physical_package_id", u8"0\n");
+      if(index < 2) {
+        tree.PlaceFile(cpuPath + u8"topology/core_cpus_list", u8"0-1\n");
+        tree.PlaceFile(cpuPath + u8"cpufreq/base_frequency", u8"2100000\n");
+        tree.PlaceFile(cpuPath + u8"cpufreq/cpuinfo_max_freq", u8"4700000\n");
+        tree.PlaceFile(cpuPath + u8"cache/index0/size", u8"48K\n");
+        tree.PlaceFile(cpuPath + u8"cache/index2/size", u8"1280K\n");
+      } else {
+        tree.PlaceFile(cpuPath + u8"topology/core_cpus_list", std::to_string(index) + u8"\n");
+        tree.PlaceFile(cpuPath + u8"cpufreq/base_frequency", u8"1600000\n");
+        tree.PlaceFile(cpuPath + u8"cpufreq/cpuinfo_max_freq", u8"3500000\n");
+        tree.PlaceFile(cpuPath + u8"cache/index0/size", u8"32K\n");
+        tree.PlaceFile(cpuPath + u8"cache/index2/size", u8"2048K\n");
+        tree.PlaceFile(cpuPath + u8"cache/index2/ways_of_associativity", u8"16\n");
+        tree.PlaceFile(cpuPath + u8"cache/index2/shared_cpu_list", u8"2-3\n");
+      }
+      tree.PlaceFile(cpuPath + u8"cpufreq/cpuinfo_min_freq", u8"400000\n");
+
+      tree.PlaceFile(cpuPath + u8"cache/index0/level", u8"1\n");
+      tree.PlaceFile(cpuPath + u8"cache/index0/type", u8"Data\n");
+      tree.PlaceFile(cpuPath + u8"cache/index0/coherency_line_size", u8"64\n");
+      tree.PlaceFile(cpuPath + u8"cache/index1/level", u8"1\n");
+      tree.PlaceFile(cpuPath + u8"cache/index1/type", u8"Instruction\n");
+      tree.PlaceFile(cpuPath + u8"cache/index1/size", u8"32K\n");
+      tree.PlaceFile(cpuPath + u8"cache/index2/level", u8"2\n");
+      tree.PlaceFile(cpuPath + u8"cache/index2/type", u8"Unified\n");
+      tree.PlaceFile(cpuPath + u8"cache/index3/level", u8"3\n");
+      tree.PlaceFile(cpuPath + u8"cache/index3/type", u8"Unified\n");
+      tree.PlaceFile(cpuPath + u8"cache/index3/size", u8"12M\n");
+      tree.PlaceFile(cpuPath + u8"cache/index3/coherency_line_size", u8"64\n");
+      tree.PlaceFile(cpuPath + u8"cache/index3/ways_of_associativity", u8"12\n");
+      tree.PlaceFile(cpuPath + u8"cache/index3/shared_cpu_list", u8"0-3\n");
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysCpuTreeReaderTest, MissingCpuDirectoryYieldsNoProcessors) {
+    FakeFileTree tree;
+    tree.PlaceDirectory(u8"system");
+
+    EXPECT_TRUE(LinuxSysCpuTreeReader::TryReadProcessors(tree.GetRootPath()).empty());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysCpuTreeReaderTest, CanReadTopologyOfHybridCpu) {
+    FakeFileTree tree;
+    placeHybridLaptop(tree);
+
+    std::vector<LinuxSysCpuTreeReader::ProcessorInfo> processors = (
+      LinuxSysCpuTreeReader::TryReadProcessors(tree.GetRootPath())
+    );
+    ASSERT_EQ(processors.size(), 4U);
+
+    for(std::size_t index = 0; index < 4; ++index) {
+      EXPECT_EQ(processors[index].Index, index);
+      EXPECT_EQ(processors[index].PackageId, 0U);
+      ASSERT_TRUE(processors[index].IsEcoCore.has_value());
+      EXPECT_EQ(processors[index].IsEcoCore.value(), (index >= 2));
+    }
+
+    EXPECT_EQ(processors[1].CoreProcessorIndices, (std::vector<std::size_t> { 0, 1 }));
+    EXPECT_EQ(processors[3].CoreProcessorIndices, (std::vector<std::size_t> { 3 }));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysCpuTreeReaderTest, CanReadFrequencies) {
+    FakeFileTree tree;
+    placeHybridLaptop(tree);
+
+    std::vector<LinuxSysCpuTreeReader::ProcessorInfo> processors = (
+      LinuxSysCpuTreeReader::TryReadProcessors(tree.GetRootPath())
+    );
+    ASSERT_EQ(processors.size(), 4U);
+
+    EXPECT_DOUBLE_EQ(processors[0].BaseFrequencyInMHz.value_or(0.0), 2100.0);
+    EXPECT_DOUBLE_EQ(processors[0].MinimumFrequencyInMHz.value_or(0.0), 400.0);
+    EXPECT_DOUBLE_EQ(processors[0].MaximumFrequencyInMHz.value_or(0.0), 4700.0);
+    EXPECT_DOUBLE_EQ(processors[2].MaximumFrequencyInMHz.value_or(0.0), 3500.0);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysCpuTreeReaderTest, CanReadCaches) {
+    FakeFileTree tree;
+    placeHybridLaptop(tree);
+
+    std::vector<LinuxSysCpuTreeReader::ProcessorInfo> processors = (
+      LinuxSysCpuTreeReader::TryReadProcessors(tree.GetRootPath())
+    );
+    ASSERT_EQ(processors.size(), 4U);
+
+    const std::vector<CacheInfo> &caches = processors[2].Caches;
+    ASSERT_EQ(caches.size(), 4U);
+    EXPECT_EQ(caches[0].Level, 1U);
+    EXPECT_EQ(caches[0].Type, CacheType::Data);
+    EXPECT_EQ(caches[0].SizeInBytes, 32U * 1024U);
+    EXPECT_EQ(caches[1].Level, 1U);
+    EXPECT_EQ(caches[1].Type, CacheType::Instruction);
+    EXPECT_EQ(caches[2].Level, 2U);
+    EXPECT_EQ(caches[2].SizeInBytes, 2048U * 1024U);
+    EXPECT_EQ(caches[3].Level, 3U);
+    EXPECT_EQ(caches[3].Type, CacheType::Unified);
+    EXPECT_EQ(caches[3].SizeInBytes, 12U * 1024U * 1024U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysCpuTreeReaderTest, CanReadCacheGeometryAndSharing) {
+    FakeFileTree tree;
+    placeHybridLaptop(tree);
+
+    std::vector<LinuxSysCpuTreeReader::ProcessorInfo> processors = (
+      LinuxSysCpuTreeReader::TryReadProcessors(tree.GetRootPath())
+    );
+    ASSERT_EQ(processors.size(), 4U);
+
+    const std::vector<CacheInfo> &caches = processors[2].Caches;
+    ASSERT_EQ(caches.size(), 4U);
+    EXPECT_EQ(caches[0].LineSizeInBytes, 64U);
+    EXPECT_EQ(caches[0].Associativity, 0U); // not listed in the fake sysfs tree
+    EXPECT_TRUE(caches[0].SharedProcessorIndices.empty());
+    EXPECT_EQ(caches[2].Associativity, 16U);
+    EXPECT_EQ(caches[2].SharedProcessorIndices, (std::vector<std::size_t> { 2, 3 }));
+    EXPECT_EQ(caches[3].LineSizeInBytes, 64U);
+    EXPECT_EQ(caches[3].Associativity, 12U);
+    EXPECT_EQ(caches[3].SharedProcessorIndices, (std::vector<std::size_t> { 0, 1, 2, 3 }));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysCpuTreeReaderTest, ProcessorsWithoutDetailsAreStillListed) {
+    FakeFileTree tree;
+    tree.PlaceDirectory(u8"system/cpu/cpu0");
+    tree.PlaceDirectory(u8"system/cpu/cpu1");
+
+    std::vector<LinuxSysCpuTreeReader::ProcessorInfo> processors = (
+      LinuxSysCpuTreeReader::TryReadProcessors(tree.GetRootPath())
+    );
+    ASSERT_EQ(processors.size(), 2U);
+
+    EXPECT_EQ(processors[1].PackageId, std::size_t(-1));
+    EXPECT_EQ(processors[1].CoreProcessorIndices, (std::vector<std::size_t> { 1 }));
+    EXPECT_FALSE(processors[1].IsEcoCore.has_value());
+    EXPECT_FALSE(processors[1].MaximumFrequencyInMHz.has_value());
+    EXPECT_TRUE(processors[1].Caches.empty());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysCpuTreeReaderTest, ManyProcessorsCanBeReadInParallel) {
+    FakeFileTree tree;
+
+    // Two packages with 100 cores each, SMT siblings are 100 processors apart
+    const std::size_t processorCount = 400;
+    for(std::size_t index = 0; index < processorCount; ++index) {
+      std::string cpuPath = u8"system/cpu/cpu" + std::to_string(index) + u8"/";
+      std::size_t coreIndex = index % 200;
+      tree.PlaceFile(
+        cpuPath + u8"topology/physical_package_id", std::to_string(coreIndex / 100) + u8"\n"
+      );
+      tree.PlaceFile(
+        cpuPath + u8"topology/core_cpus_list",
+        std::to_string(coreIndex) + u8"," + std::to_string(coreIndex + 200) + u8"\n"
+      );
+      tree.PlaceFile(cpuPath + u8"cache/index0/level", u8"2\n");
+      tree.PlaceFile(cpuPath + u8"cache/index0/type", u8"Unified\n");
+      tree.PlaceFile(cpuPath + u8"cache/index0/size", u8"1024K\n");
+    }
+
+    std::vector<LinuxSysCpuTreeReader::ProcessorInfo> processors = (
+      LinuxSysCpuTreeReader::TryReadProcessors(tree.GetRootPath(), 4)
+    );
+    ASSERT_EQ(processors.size(), processorCount);
+
+    for(std::size_t index = 0; index < processorCount; ++index) {
+      std::size_t coreIndex = index % 200;
+      EXPECT_EQ(processors[index].Index, index);
+      EXPECT_EQ(processors[index].PackageId, coreIndex / 100);
+      EXPECT_EQ(
+        processors[index].CoreProcessorIndices,
+        (std::vector<std::size_t> { coreIndex, coreIndex + 200 })
+      );
+      ASSERT_EQ(processors[index].Caches.size(), 1U);
+      EXPECT_EQ(processors[index].Caches[0].SizeInBytes, 1024U * 1024U);
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysCpuTreeReaderTest, BatchedReadsYieldTheSameProcessors) {
+    FakeFileTree tree;
+
+    const std::size_t processorCount = 40;
+    for(std::size_t index = 0; index < processorCount; ++index) {
+      std::string cpuPath = u8"system/cpu/cpu" + std::to_string(index) + u8"/";
+      tree.PlaceFile(cpuPath + u8"topology/physical_package_id", u8"0\n");
+      tree.PlaceFile(cpuPath + u8"topology/core_cpus_list", std::to_string(index) + u8"\n");
+      tree.PlaceFile(cpuPath + u8"cpufreq/cpuinfo_max_freq", u8"4200000\n");
+      tree.PlaceFile(cpuPath + u8"cache/index0/level", u8"1\n");
+      tree.PlaceFile(cpuPath + u8"cache/index0/type", u8"Data\n");
+      tree.PlaceFile(cpuPath + u8"cache/index0/size", u8"48K\n");
+      tree.PlaceFile(cpuPath + u8"cache/index1/level", u8"3\n");
+      tree.PlaceFile(cpuPath + u8"cache/index1/type", u8"Unified\n");
+      tree.PlaceFile(cpuPath + u8"cache/index1/size", u8"32M\n");
+    }
+
+    std::vector<LinuxSysCpuTreeReader::ProcessorInfo> processors = (
+      LinuxSysCpuTreeReader::TryReadProcessors(tree.GetRootPath())
+    );
+    std::vector<LinuxSysCpuTreeReader::ProcessorInfo> batchedProcessors = (
+      LinuxSysCpuTreeReader::TryReadProcessors(tree.GetRootPath(), 1, true)
+    );
+    ASSERT_EQ(processors.size(), processorCount);
+    ASSERT_EQ(batchedProcessors.size(), processorCount);
+
+    for(std::size_t index = 0; index < processorCount; ++index) {
+      EXPECT_EQ(batchedProcessors[index].Index, processors[index].Index);
+      EXPECT_EQ(batchedProcessors[index].PackageId, processors[index].PackageId);
+      EXPECT_EQ(
+        batchedProcessors[index].CoreProcessorIndices, processors[index].CoreProcessorIndices
+      );
+      EXPECT_EQ(
+        batchedProcessors[index].MaximumFrequencyInMHz, processors[index].MaximumFrequencyInMHz
+      );
+      ASSERT_EQ(processors[index].Caches.size(), 2U);
+      ASSERT_EQ(batchedProcessors[index].Caches.size(), 2U);
+      EXPECT_EQ(processors[index].Caches[1].SizeInBytes, 32U * 1024U * 1024U);
+      EXPECT_EQ(
+        batchedProcessors[index].Caches[1].SizeInBytes, processors[index].Caches[1].SizeInBytes
+      );
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,124 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Hardware/LinuxSysDrmTreeReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../FakeFileTree.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Builds a fake DRM class tree resembling a workstation with two GPUs</summary>
+  /// <param name="tree">Fake file tree in which the sysfs files will be placed</param>
+  /// <remarks>
+  ///   An Intel iGPU as card0 and an AMD board as card1, with the connector and render
+  ///   node entries the kernel creates for them plus a firmware framebuffer device.
+  /// </remarks>
+  void placeWorkstation(Nuclex::Platform::FakeFileTree &tree) {
+    tree.PlaceFile(u8"drm/version", u8"drm 1.1.0 20060810\n");
+
+    tree.PlaceFile(u8"devices/igpu/vendor", u8"0x8086\n");
+    tree.PlaceFile(u8"devices/igpu/device", u8"0x4680\n");
+    tree.PlaceDirectory(u8"drivers/i915");
+    tree.PlaceSymlink(u8"devices/igpu/driver", tree.GetPath(u8"drivers/i915"));
+    tree.PlaceSymlink(u8"drm/card0/device", tree.GetPath(u8"devices/igpu"));
+    tree.PlaceDirectory(u8"drm/card0-HDMI-A-1");
+    tree.PlaceDirectory(u8"drm/renderD128");
+
+    tree.PlaceFile(u8"devices/dgpu/vendor", u8"0x1002\n");
+    tree.PlaceFile(u8"devices/dgpu/device", u8"0x73bf\n");
+    tree.PlaceFile(u8"devices/dgpu/mem_info_vram_total", u8"17163091968\n");
+    tree.PlaceFile(u8"devices/dgpu/product_name", u8"Radeon RX 6800 XT\n");
+    tree.PlaceFile(u8"drivers/amdgpu/module/version", u8"6.7.0\n");
+    tree.PlaceSymlink(u8"devices/dgpu/driver", tree.GetPath(u8"drivers/amdgpu"));
+    tree.PlaceSymlink(u8"drm/card1/device", tree.GetPath(u8"devices/dgpu"));
+    tree.PlaceDirectory(u8"drm/card1-DP-1");
+
+    tree.PlaceDirectory(u8"devices/simple-framebuffer");
+    tree.PlaceSymlink(u8"drm/card2/device", tree.GetPath(u8"devices/simple-framebuffer"));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysDrmTreeReaderTest, MissingDrmClassYieldsNoGpus) {
+    FakeFileTree tree;
+    EXPECT_TRUE(LinuxSysDrmTreeReader::TryReadGpus(tree.GetPath(u8"drm")).empty());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysDrmTreeReaderTest, OnlyCardsWithPciDevicesAreReported) {
+    FakeFileTree tree;
+    placeWorkstation(tree);
+
+    std::vector<GpuInfo> gpus = LinuxSysDrmTreeReader::TryReadGpus(tree.GetPath(u8"drm"));
+    ASSERT_EQ(gpus.size(), 2U);
+    EXPECT_EQ(gpus[0].VendorId, 0x8086U);
+    EXPECT_EQ(gpus[1].VendorId, 0x1002U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysDrmTreeReaderTest, VideoMemoryAndModelAreReadWhenAvailable) {
+    FakeFileTree tree;
+    placeWorkstation(tree);
+
+    std::vector<GpuInfo> gpus = LinuxSysDrmTreeReader::TryReadGpus(tree.GetPath(u8"drm"));
+    ASSERT_EQ(gpus.size(), 2U);
+
+    EXPECT_EQ(gpus[0].ManufacturerName, u8"Intel");
+    EXPECT_EQ(gpus[0].ModelName, u8"Intel GPU [8086:4680]");
+    EXPECT_EQ(gpus[0].DriverVersion, u8"i915");
+    EXPECT_EQ(gpus[0].VideoMemoryInMegabytes, 0U);
+    EXPECT_FALSE(gpus[0].IsDedicated);
+
+    EXPECT_EQ(gpus[1].ManufacturerName, u8"AMD");
+    EXPECT_EQ(gpus[1].ModelName, u8"Radeon RX 6800 XT");
+    EXPECT_EQ(gpus[1].DriverVersion, u8"amdgpu 6.7.0");
+    EXPECT_EQ(gpus[1].DeviceId, 0x73bfU);
+    EXPECT_EQ(gpus[1].VideoMemoryInMegabytes, 16368U);
+    EXPECT_TRUE(gpus[1].IsDedicated);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysDrmTreeReaderTest, UnknownVendorsAreShownInHexadecimal) {
+    EXPECT_EQ(LinuxSysDrmTreeReader::GetManufacturerName(0x10de), u8"NVidia");
+    EXPECT_EQ(LinuxSysDrmTreeReader::GetManufacturerName(0x5143), u8"0x5143");
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,149 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Hardware/LinuxSysNodeTreeReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../FakeFileTree.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Builds a fake sysfs tree resembling a dual-socket server</summary>
+  /// <param name="tree">Fake file tree in which the sysfs files will be placed</param>
+  /// <remarks>
+  ///   Two packages with 4 cores each and SMT, numbered the way the kernel does it:
+  ///   first all cores of both packages, then their SMT siblings.
+  /// </remarks>
+  void placeDualSocketServer(Nuclex::Platform::FakeFileTree &tree) {
+    tree.PlaceFile(u8"node/online", u8"0-1\n");
+    tree.PlaceFile(u8"node/has_cpu", u8"0-1\n");
+    tree.PlaceDirectory(u8"node/power");
+
+    tree.PlaceFile(u8"node/node0/cpulist", u8"0-3,8-11\n");
+    tree.PlaceFile(
+      u8"node/node0/meminfo",
+      u8"Node 0 MemTotal:       32795876 kB\n"
+      u8"Node 0 MemFree:        30000000 kB\n"
+      u8"Node 0 MemUsed:         2795876 kB\n"
+    );
+    tree.PlaceFile(u8"node/node1/cpulist", u8"4-7,12-15\n");
+    tree.PlaceFile(
+      u8"node/node1/meminfo",
+      u8"Node 1 MemTotal:       16777216 kB\n"
+      u8"Node 1 MemFree:        16000000 kB\n"
+    );
+
+    for(std::size_t index = 0; index < 16; ++index) {
+      std::string topologyPath = u8"cpu/cpu" + std::to_string(index) + u8"/topology/";
+      tree.PlaceFile(topologyPath + u8"physical_package_id", std::to_string((index / 4) % 2));
+      tree.PlaceFile(topologyPath + u8"core_id", std::to_string(index % 4) + u8"\n");
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysNodeTreeReaderTest, CanParseSingleProcessor) {
+    std::vector<std::size_t> processors = LinuxSysNodeTreeReader::ParseCpuList(u8"5\n");
+    ASSERT_EQ(processors.size(), 1U);
+    EXPECT_EQ(processors[0], 5U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysNodeTreeReaderTest, CanParseProcessorRangesAndLists) {
+    std::vector<std::size_t> processors = LinuxSysNodeTreeReader::ParseCpuList(
+      u8"0-2,8,10-11\n"
+    );
+    std::vector<std::size_t> expected { 0, 1, 2, 8, 10, 11 };
+    EXPECT_EQ(processors, expected);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysNodeTreeReaderTest, EmptyProcessorListYieldsNoProcessors) {
+    EXPECT_TRUE(LinuxSysNodeTreeReader::ParseCpuList(u8"\n").empty());
+    EXPECT_TRUE(LinuxSysNodeTreeReader::ParseCpuList(u8"").empty());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysNodeTreeReaderTest, MissingNodeDirectoryYieldsNoNodes) {
+    FakeFileTree tree;
+    tree.PlaceDirectory(u8"cpu");
+
+    EXPECT_TRUE(LinuxSysNodeTreeReader::TryReadNodes(tree.GetRootPath()).empty());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysNodeTreeReaderTest, CanReadNodesOfDualSocketServer) {
+    FakeFileTree tree;
+    placeDualSocketServer(tree);
+
+    std::vector<LinuxSysNodeTreeReader::NodeInfo> nodes = (
+      LinuxSysNodeTreeReader::TryReadNodes(tree.GetRootPath())
+    );
+    ASSERT_EQ(nodes.size(), 2U);
+
+    EXPECT_EQ(nodes[0].Index, 0U);
+    EXPECT_EQ(nodes[0].CoreCount, 4U);
+    EXPECT_EQ(nodes[0].ProcessorIndices, (std::vector<std::size_t> { 0, 1, 2, 3, 8, 9, 10, 11 }));
+    EXPECT_EQ(nodes[0].MemoryInBytes, std::uint64_t(32795876) * 1024);
+    EXPECT_EQ(nodes[0].FreeMemoryInBytes, std::uint64_t(30000000) * 1024);
+
+    EXPECT_EQ(nodes[1].Index, 1U);
+    EXPECT_EQ(nodes[1].CoreCount, 4U);
+    EXPECT_EQ(nodes[1].ProcessorIndices, (std::vector<std::size_t> { 4, 5, 6, 7, 12, 13, 14, 15 }));
+    EXPECT_EQ(nodes[1].MemoryInBytes, std::uint64_t(16777216) * 1024);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxSysNodeTreeReaderTest, ProcessorsWithoutTopologyCountAsCores) {
+    FakeFileTree tree;
+    tree.PlaceFile(u8"node/node0/cpulist", u8"0-5\n");
+    tree.PlaceDirectory(u8"cpu");
+
+    std::vector<LinuxSysNodeTreeReader::NodeInfo> nodes = (
+      LinuxSysNodeTreeReader::TryReadNodes(tree.GetRootPath())
+    );
+    ASSERT_EQ(nodes.size(), 1U);
+    EXPECT_EQ(nodes[0].CoreCount, 6U);
+    EXPECT_EQ(nodes[0].MemoryInBytes, 0U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
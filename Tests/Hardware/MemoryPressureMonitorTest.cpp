@@ -0,0 +1,62 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "Nuclex/Platform/Hardware/MemoryPressureMonitor.h"
+
+#include <gtest/gtest.h>
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(MemoryPressureMonitorTest, HasDefaultConstructor) {
+    EXPECT_NO_THROW(
+      MemoryPressureMonitor monitor;
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(MemoryPressureMonitorTest, FirstSampleIsAvailableImmediately) {
+    MemoryPressureMonitor monitor(std::chrono::milliseconds(10));
+
+    MemoryPressure pressure = monitor.GetCurrentPressure();
+    EXPECT_GT(pressure.TotalMegabytes, 0U);
+    EXPECT_GT(pressure.AvailableMegabytes, 0U);
+    EXPECT_LE(pressure.AvailableMegabytes, pressure.TotalMegabytes);
+    EXPECT_LE(pressure.UsableMegabytes, pressure.AvailableMegabytes);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(MemoryPressureMonitorTest, CanSampleOnDemand) {
+    MemoryPressureMonitor monitor(std::chrono::hours(1));
+
+    MemoryPressure sampled = monitor.SampleNow();
+    MemoryPressure published = monitor.GetCurrentPressure();
+    EXPECT_EQ(sampled.TotalMegabytes, published.TotalMegabytes);
+    EXPECT_EQ(sampled.GroupLimitMegabytes, published.GroupLimitMegabytes);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
@@ -20,10 +20,17 @@ limitations under the License.
 // If the library is compiled as a DLL, this ensures symbols are exported
 #define NUCLEX_PLATFORM_SOURCE 1
 
-//#include "Nuclex/Platform/Hardware/PlatformAppraiser.h"
+#include "Nuclex/Platform/Hardware/PlatformAppraiser.h"
+#include "Nuclex/Platform/Hardware/CpuInfo.h"
+#include "Nuclex/Platform/Tasks/NaiveTaskCoordinator.h"
+
+#include <Nuclex/Support/Threading/ThreadPool.h>
 
 #include <gtest/gtest.h>
 
+#include <filesystem> // for std::filesystem::temp_directory_path()
+#include <thread> // for std::thread::hardware_concurrency()
+
 namespace Nuclex { namespace Platform { namespace Hardware {
 
   // ------------------------------------------------------------------------------------------- //
@@ -32,6 +39,122 @@ namespace Nuclex { namespace Platform { namespace Hardware {
     //PlatformAppraiser appraiser;
   }
 
+  // ------------------------------------------------------------------------------------------- //
+#if defined(NUCLEX_PLATFORM_LINUX)
+  TEST(PlatformAppraiserTest, CpuTopologyCoversAllProcessors) {
+    std::vector<CpuInfo> cpus = PlatformAppraiser::AnalyzeCpuTopology().get();
+    ASSERT_FALSE(cpus.empty());
+
+    std::size_t threadCount = 0;
+    for(const CpuInfo &cpu : cpus) {
+      EXPECT_FALSE(cpu.ModelName.empty());
+      EXPECT_GE(cpu.CoreCount, 1U);
+      EXPECT_EQ(cpu.Cores.size(), cpu.CoreCount);
+      EXPECT_GE(cpu.ThreadCount, cpu.CoreCount);
+      threadCount += cpu.ThreadCount;
+    }
+
+    // Processors can be offline or excluded from the process, but never more than exist
+    EXPECT_GE(threadCount, std::thread::hardware_concurrency());
+  }
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(PlatformAppraiserTest, CpuBudgetStaysWithinHardware) {
+    CpuBudget budget = PlatformAppraiser::QueryCpuBudget();
+
+    EXPECT_GE(budget.UsableThreadCount, 1U);
+    EXPECT_LE(budget.UsableThreadCount, std::thread::hardware_concurrency());
+    EXPECT_LE(budget.UsableThreadCount, budget.AvailableProcessors.size());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(PlatformAppraiserTest, InstructionSetsIncludeCompilerBaseline) {
+    InstructionSetSupport instructionSets = PlatformAppraiser::QueryInstructionSets();
+
+    // Whatever the compiler was allowed to assume when building this test
+    // must be supported by the CPU, otherwise the test wouldn't run at all
+#if defined(__SSE2__) || defined(_M_X64)
+    EXPECT_TRUE(instructionSets.Has(InstructionSet::Sse2));
+#endif
+#if defined(__AVX2__)
+    EXPECT_TRUE(instructionSets.Has(InstructionSet::Avx2));
+#endif
+#if defined(__ARM_NEON)
+    EXPECT_TRUE(instructionSets.Has(InstructionSet::Neon));
+#endif
+#if defined(NUCLEX_PLATFORM_X86)
+    EXPECT_FALSE(instructionSets.Has(InstructionSet::Neon));
+#endif
+    (void)instructionSets;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(PlatformAppraiserTest, AnalysisCanRunInThreadPool) {
+    Nuclex::Support::Threading::ThreadPool threadPool;
+
+    std::future<std::vector<CpuInfo>> cpus = PlatformAppraiser::AnalyzeCpuTopology(threadPool);
+    std::future<MemoryInfo> memory = PlatformAppraiser::AnalyzeMemory(threadPool);
+
+    EXPECT_FALSE(cpus.get().empty());
+    EXPECT_GT(memory.get().InstalledMegabytes, 0U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(PlatformAppraiserTest, AnalysisCanRunAsCoordinatedTask) {
+    Tasks::NaiveTaskCoordinator coordinator;
+    coordinator.AddResource(Tasks::ResourceType::CpuCores, 2);
+    coordinator.Start();
+
+    std::future<std::vector<CpuInfo>> cpus = PlatformAppraiser::AnalyzeCpuTopology(coordinator);
+    std::future<MemoryInfo> memory = PlatformAppraiser::AnalyzeMemory(coordinator);
+
+    ASSERT_EQ(cpus.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_FALSE(cpus.get().empty());
+    ASSERT_EQ(memory.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_GT(memory.get().InstalledMegabytes, 0U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(PlatformAppraiserTest, CanAnalyzeWholePlatform) {
+    PlatformInfo platform = PlatformAppraiser::AnalyzeAll().get();
+
+    EXPECT_FALSE(platform.CpuTopology.empty());
+    EXPECT_GT(platform.Memory.InstalledMegabytes, 0U);
+    for(const StoreInfo &store : platform.StorageVolumes) {
+      EXPECT_FALSE(store.Identifier.empty());
+    }
+    for(const GpuInfo &gpu : platform.Gpus) {
+      EXPECT_FALSE(gpu.ManufacturerName.empty());
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(PlatformAppraiserTest, CanMeasureStoreThroughput) {
+    std::string directory = std::filesystem::temp_directory_path().string();
+    StoreThroughput throughput = PlatformAppraiser::MeasureStoreThroughput(directory, 4).get();
+
+    EXPECT_EQ(throughput.TestFileSize, 4U * 1024U * 1024U);
+    EXPECT_GT(throughput.SequentialReadMegabytesPerSecond, 0.0);
+    EXPECT_GT(throughput.RandomReadsPerSecond, 0.0);
+    EXPECT_GT(throughput.RandomReadMegabytesPerSecond, 0.0);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(PlatformAppraiserTest, CanMeasureClocks) {
+    ClockInfo clocks = PlatformAppraiser::MeasureClocks().get();
+
+    EXPECT_FALSE(clocks.ClockSource.empty());
+    EXPECT_GT(clocks.ClockReadNanoseconds, 0.0);
+    EXPECT_GE(clocks.SleepGranularityMicroseconds, 1.0);
+  }
+
   // ------------------------------------------------------------------------------------------- //
 
 }}} // namespace Nuclex::Platform::Hardware
@@ -0,0 +1,164 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "Nuclex/Platform/Hardware/StoreLocator.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Adds a partition with the specified mount paths to a store</summary>
+  /// <param name="store">Store to which the partition will be added</param>
+  /// <param name="mountPaths">Paths at which the partition is mounted</param>
+  void addPartition(
+    Nuclex::Platform::Hardware::StoreInfo &store, const std::vector<std::string> &mountPaths
+  ) {
+    Nuclex::Platform::Hardware::PartitionInfo &partition = store.Partitions.emplace_back();
+    partition.MountPaths = mountPaths;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Creates a list of stores as they'd be found on a typical workstation</summary>
+  /// <returns>The list of stores</returns>
+  /// <remarks>
+  ///   Store 0 holds the root file system and the EFI partition, store 1 holds the home
+  ///   directories and store 2 is a network server with a share in '/mnt/media'.
+  /// </remarks>
+  std::shared_ptr<const std::vector<Nuclex::Platform::Hardware::StoreInfo>> makeStores() {
+    std::shared_ptr<std::vector<Nuclex::Platform::Hardware::StoreInfo>> stores = (
+      std::make_shared<std::vector<Nuclex::Platform::Hardware::StoreInfo>>(3)
+    );
+#if defined(NUCLEX_PLATFORM_WINDOWS)
+    addPartition(stores->at(0), { u8"C:\\" });
+    addPartition(stores->at(0), { u8"C:\\Boot" });
+    addPartition(stores->at(1), { u8"D:\\", u8"C:\\Users" });
+    addPartition(stores->at(2), { u8"\\\\nas\\media" });
+#else
+    addPartition(stores->at(0), { u8"/" });
+    addPartition(stores->at(0), { u8"/boot/efi" });
+    addPartition(stores->at(1), { u8"/home", u8"/srv/home/" });
+    addPartition(stores->at(2), { u8"/mnt/media" });
+#endif
+    return stores;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Hardware {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(StoreLocatorTest, CanBeCreatedWithoutStores) {
+    StoreLocator locator(std::make_shared<std::vector<StoreInfo>>());
+    EXPECT_TRUE(locator.GetStores().empty());
+    EXPECT_FALSE(locator.Locate(u8"/home").has_value());
+    EXPECT_EQ(locator.GetDriveMask(u8"/home"), 0U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+#if !defined(NUCLEX_PLATFORM_WINDOWS)
+  TEST(StoreLocatorTest, FindsInnermostMount) {
+    StoreLocator locator(makeStores());
+
+    std::optional<StoreLocation> location = locator.Locate(u8"/home/user/.cache/app");
+    ASSERT_TRUE(location.has_value());
+    EXPECT_EQ(location->StoreIndex, 1U);
+    EXPECT_EQ(location->PartitionIndex, 0U);
+    EXPECT_EQ(location->MountPath, u8"/home");
+
+    location = locator.Locate(u8"/boot/efi/EFI");
+    ASSERT_TRUE(location.has_value());
+    EXPECT_EQ(location->StoreIndex, 0U);
+    EXPECT_EQ(location->PartitionIndex, 1U);
+
+    location = locator.Locate(u8"/srv/home/user");
+    ASSERT_TRUE(location.has_value());
+    EXPECT_EQ(location->StoreIndex, 1U);
+    EXPECT_EQ(location->MountPath, u8"/srv/home/");
+  }
+#endif // !defined(NUCLEX_PLATFORM_WINDOWS)
+  // ------------------------------------------------------------------------------------------- //
+#if !defined(NUCLEX_PLATFORM_WINDOWS)
+  TEST(StoreLocatorTest, MatchesOnlyWholePathSegments) {
+    StoreLocator locator(makeStores());
+
+    std::optional<StoreLocation> location = locator.Locate(u8"/homework");
+    ASSERT_TRUE(location.has_value());
+    EXPECT_EQ(location->StoreIndex, 0U);
+    EXPECT_EQ(location->MountPath, u8"/");
+
+    location = locator.Locate(u8"/mnt/media/../other");
+    ASSERT_TRUE(location.has_value());
+    EXPECT_EQ(location->StoreIndex, 0U);
+
+    location = locator.Locate(u8"/mnt//./media");
+    ASSERT_TRUE(location.has_value());
+    EXPECT_EQ(location->StoreIndex, 2U);
+  }
+#endif // !defined(NUCLEX_PLATFORM_WINDOWS)
+  // ------------------------------------------------------------------------------------------- //
+#if defined(NUCLEX_PLATFORM_WINDOWS)
+  TEST(StoreLocatorTest, IgnoresCaseAndSlashDirection) {
+    StoreLocator locator(makeStores());
+
+    std::optional<StoreLocation> location = locator.Locate(u8"c:/users/Someone/AppData");
+    ASSERT_TRUE(location.has_value());
+    EXPECT_EQ(location->StoreIndex, 1U);
+    EXPECT_EQ(location->MountPath, u8"C:\\Users");
+
+    location = locator.Locate(u8"\\\\NAS\\Media\\Movies");
+    ASSERT_TRUE(location.has_value());
+    EXPECT_EQ(location->StoreIndex, 2U);
+  }
+#endif // defined(NUCLEX_PLATFORM_WINDOWS)
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(StoreLocatorTest, RelativePathsAreNotFound) {
+    StoreLocator locator(makeStores());
+    EXPECT_FALSE(locator.Locate(u8"relative/path").has_value());
+    EXPECT_EQ(locator.GetDriveMask(u8"relative/path"), 0U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(StoreLocatorTest, DriveMaskHasStoreBitSet) {
+    StoreLocator locator(makeStores());
+
+#if defined(NUCLEX_PLATFORM_WINDOWS)
+    EXPECT_EQ(locator.GetDriveMask(u8"C:\\Windows"), 1U);
+    EXPECT_EQ(locator.GetDriveMask(u8"D:\\Games"), 2U);
+    EXPECT_EQ(locator.GetDriveMask(u8"\\\\nas\\media"), 4U);
+#else
+    EXPECT_EQ(locator.GetDriveMask(u8"/usr/lib"), 1U);
+    EXPECT_EQ(locator.GetDriveMask(u8"/home/user"), 2U);
+    EXPECT_EQ(locator.GetDriveMask(u8"/mnt/media/movie.mkv"), 4U);
+#endif
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Hardware
@@ -0,0 +1,199 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Platform/LinuxFileApi.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../FakeFileTree.h"
+
+#include <gtest/gtest.h>
+
+namespace Nuclex { namespace Platform { namespace Platform {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxFileApiTest, ReadingManyFilesOfEmptyListReturnsNothing) {
+    std::vector<std::optional<std::string>> contents = LinuxFileApi::ReadManyFiles(
+      std::vector<std::string>()
+    );
+    EXPECT_TRUE(contents.empty());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxFileApiTest, CanReadFewFiles) {
+    FakeFileTree tree;
+    tree.PlaceFile(u8"cpu0/online", u8"1\n");
+    tree.PlaceFile(u8"cpu1/online", u8"0\n");
+
+    std::vector<std::string> paths = {
+      tree.GetPath(u8"cpu0/online"),
+      tree.GetPath(u8"cpu1/online"),
+      tree.GetPath(u8"cpu2/online")
+    };
+    std::vector<std::optional<std::string>> contents = LinuxFileApi::ReadManyFiles(paths);
+    ASSERT_EQ(contents.size(), 3U);
+    ASSERT_TRUE(contents[0].has_value());
+    EXPECT_EQ(contents[0].value(), u8"1\n");
+    ASSERT_TRUE(contents[1].has_value());
+    EXPECT_EQ(contents[1].value(), u8"0\n");
+    EXPECT_FALSE(contents[2].has_value());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxFileApiTest, CanReadManyFilesInSeveralBatches) {
+    FakeFileTree tree;
+
+    // Enough files to need several batches, with every tenth file missing
+    std::vector<std::string> paths;
+    for(std::size_t index = 0; index < 300; ++index) {
+      std::string name = u8"cpu" + std::to_string(index) + u8"/cache_size";
+      if((index % 10) != 9) {
+        tree.PlaceFile(name, std::to_string(index * 1024) + u8"K\n");
+      }
+      paths.push_back(tree.GetPath(name));
+    }
+
+    std::vector<std::optional<std::string>> contents = LinuxFileApi::ReadManyFiles(paths);
+    ASSERT_EQ(contents.size(), paths.size());
+    for(std::size_t index = 0; index < 300; ++index) {
+      if((index % 10) == 9) {
+        EXPECT_FALSE(contents[index].has_value());
+      } else {
+        ASSERT_TRUE(contents[index].has_value());
+        EXPECT_EQ(contents[index].value(), std::to_string(index * 1024) + u8"K\n");
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxFileApiTest, CanReadManyFilesRelativeToDirectory) {
+    FakeFileTree tree;
+
+    std::vector<std::string> relativePaths;
+    for(std::size_t index = 0; index < 20; ++index) {
+      std::string name = u8"cpu" + std::to_string(index) + u8"/online";
+      if(index != 7) {
+        tree.PlaceFile(name, std::to_string(index % 2) + u8"\n");
+      }
+      relativePaths.push_back(name);
+    }
+
+    int directoryDescriptor;
+    ASSERT_TRUE(LinuxFileApi::TryOpenDirectory(tree.GetRootPath(), directoryDescriptor));
+    std::vector<std::optional<std::string>> contents = LinuxFileApi::ReadManyFilesAt(
+      directoryDescriptor, relativePaths
+    );
+    LinuxFileApi::Close(directoryDescriptor);
+
+    ASSERT_EQ(contents.size(), relativePaths.size());
+    for(std::size_t index = 0; index < 20; ++index) {
+      if(index == 7) {
+        EXPECT_FALSE(contents[index].has_value());
+      } else {
+        ASSERT_TRUE(contents[index].has_value());
+        EXPECT_EQ(contents[index].value(), std::to_string(index % 2) + u8"\n");
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxFileApiTest, BatchedFileReaderCanBeReused) {
+    FakeFileTree tree;
+
+    std::vector<std::string> paths;
+    for(std::size_t index = 0; index < 10; ++index) {
+      std::string name = u8"file" + std::to_string(index);
+      tree.PlaceFile(name, std::to_string(index));
+      paths.push_back(name);
+    }
+
+    int directoryDescriptor;
+    ASSERT_TRUE(LinuxFileApi::TryOpenDirectory(tree.GetRootPath(), directoryDescriptor));
+    FileDescriptorClosingScope closeDirectory(directoryDescriptor);
+
+    // The second batch goes through the same ring (or the fallback) as the first
+    BatchedFileReader reader;
+    for(std::size_t batch = 0; batch < 2; ++batch) {
+      std::vector<std::optional<std::string>> contents = reader.ReadFilesAt(
+        directoryDescriptor, paths
+      );
+      ASSERT_EQ(contents.size(), paths.size());
+      for(std::size_t index = 0; index < 10; ++index) {
+        ASSERT_TRUE(contents[index].has_value());
+        EXPECT_EQ(contents[index].value(), std::to_string(index));
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxFileApiTest, ReadingManyFilesTruncatesLargeFiles) {
+    FakeFileTree tree;
+    tree.PlaceFile(u8"large", std::string(100, 'x'));
+
+    std::vector<std::string> paths(10, tree.GetPath(u8"large"));
+    std::vector<std::optional<std::string>> contents = LinuxFileApi::ReadManyFiles(paths, 16);
+    ASSERT_EQ(contents.size(), 10U);
+    for(const std::optional<std::string> &fileContents : contents) {
+      ASSERT_TRUE(fileContents.has_value());
+      EXPECT_EQ(fileContents.value(), std::string(16, 'x'));
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxFileApiTest, CanReadFileLargerThanInitialBuffer) {
+    FakeFileTree tree;
+    std::string expected;
+    for(std::size_t index = 0; index < 1000; ++index) {
+      expected.append(std::to_string(index));
+      expected.push_back('\n');
+    }
+    tree.PlaceFile(u8"large", expected);
+
+    std::string contents;
+    ASSERT_TRUE(LinuxFileApi::TryReadFileInOneReadCall(tree.GetPath(u8"large"), contents));
+    EXPECT_EQ(contents, expected);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxFileApiTest, ReadsProcFilesUntilTheirEnd) {
+
+    // procfs reports a size of 0 for this file, yet its contents span several kilobytes
+    // because each shared library mapped into the process has its own lines
+    std::string contents;
+    ASSERT_TRUE(LinuxFileApi::TryReadFileInOneReadCall(u8"/proc/self/maps", contents));
+    EXPECT_GT(contents.length(), 1280U);
+    ASSERT_FALSE(contents.empty());
+    EXPECT_EQ(contents.back(), '\n');
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Platform
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,130 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Platform/LinuxProcFileReader.h"
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+
+#include "../FakeFileTree.h"
+
+#include <gtest/gtest.h>
+
+namespace Nuclex { namespace Platform { namespace Platform {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcFileReaderTest, ReaderCanBeDefaultConstructed) {
+    LinuxProcFileReader reader;
+    EXPECT_FALSE(reader.IsOpen());
+
+    std::string_view contents;
+    EXPECT_FALSE(reader.TryRead(contents));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcFileReaderTest, OpeningMissingFileFails) {
+    FakeFileTree tree;
+
+    LinuxProcFileReader reader;
+    EXPECT_FALSE(reader.TryOpen(tree.GetPath(u8"does-not-exist")));
+    EXPECT_FALSE(reader.IsOpen());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcFileReaderTest, RereadingSeesChangedContents) {
+    FakeFileTree tree;
+    tree.PlaceFile(u8"meminfo", u8"MemTotal: 1024 kB\n");
+
+    LinuxProcFileReader reader;
+    ASSERT_TRUE(reader.TryOpen(tree.GetPath(u8"meminfo")));
+
+    std::string_view contents;
+    ASSERT_TRUE(reader.TryRead(contents));
+    EXPECT_EQ(contents, u8"MemTotal: 1024 kB\n");
+
+    // The file is rewritten in place, so the opened descriptor sees the new contents
+    tree.PlaceFile(u8"meminfo", u8"MemTotal: 2048 kB\n");
+    ASSERT_TRUE(reader.TryRead(contents));
+    EXPECT_EQ(contents, u8"MemTotal: 2048 kB\n");
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcFileReaderTest, BufferGrowsForLargeFiles) {
+    std::string largeContents;
+    for(std::size_t index = 0; index < 1000; ++index) {
+      largeContents.append(u8"cpu0 1 2 3 4 5 6 7\n");
+    }
+
+    FakeFileTree tree;
+    tree.PlaceFile(u8"stat", largeContents);
+
+    LinuxProcFileReader reader;
+    ASSERT_TRUE(reader.TryOpen(tree.GetPath(u8"stat")));
+
+    std::string_view contents;
+    ASSERT_TRUE(reader.TryRead(contents));
+    EXPECT_EQ(contents, largeContents);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcFileReaderTest, FileFillingTheBufferExactlyIsReadCompletely) {
+    std::string pageContents(4096, 'x');
+
+    FakeFileTree tree;
+    tree.PlaceFile(u8"stat", pageContents);
+
+    LinuxProcFileReader reader;
+    ASSERT_TRUE(reader.TryOpen(tree.GetPath(u8"stat")));
+
+    std::string_view contents;
+    ASSERT_TRUE(reader.TryRead(contents));
+    EXPECT_EQ(contents, pageContents);
+    ASSERT_TRUE(reader.TryRead(contents));
+    EXPECT_EQ(contents, pageContents);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(LinuxProcFileReaderTest, ReaderCanBeMoved) {
+    FakeFileTree tree;
+    tree.PlaceFile(u8"pressure", u8"some avg10=1.00\n");
+
+    LinuxProcFileReader original;
+    ASSERT_TRUE(original.TryOpen(tree.GetPath(u8"pressure")));
+
+    LinuxProcFileReader moved(std::move(original));
+    EXPECT_FALSE(original.IsOpen());
+    EXPECT_TRUE(moved.IsOpen());
+
+    std::string_view contents;
+    ASSERT_TRUE(moved.TryRead(contents));
+    EXPECT_EQ(contents, u8"some avg10=1.00\n");
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Platform
+
+#endif // defined(NUCLEX_PLATFORM_LINUX)
@@ -0,0 +1,305 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Tasks/ManifestLearner.h"
+#include "Nuclex/Platform/Tasks/ResourceManifest.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Type used to tell the learner's statistics apart</summary>
+  class LearnedTask {};
+
+  /// <summary>Another type used to tell the learner's statistics apart</summary>
+  class OtherLearnedTask {};
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Looks up the amount of a resource listed in a resource manifest</summary>
+  /// <param name="manifest">Manifest in which the resource will be looked up</param>
+  /// <param name="resourceType">Resource whose amount will be returned</param>
+  /// <returns>The amount of the resource, zero if it isn't listed</returns>
+  std::size_t getAmount(
+    const std::shared_ptr<Nuclex::Platform::Tasks::ResourceManifest> &manifest,
+    Nuclex::Platform::Tasks::ResourceType resourceType
+  ) {
+    for(std::size_t index = 0; index < manifest->Count; ++index) {
+      if(manifest->Resources[index].Type == resourceType) {
+        return manifest->Resources[index].Amount;
+      }
+    }
+
+    return 0;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(ManifestLearnerTest, DeclaredManifestIsKeptUntilEnoughRunsWereObserved) {
+    ManifestLearner learner;
+    std::shared_ptr<ResourceManifest> declared = ResourceManifest::Create(
+      ResourceType::CpuCores, 8
+    );
+    declared->CpuCoresMayBeLowered = true;
+
+    for(std::size_t index = 1; index < ManifestLearner::MinimumObservationCount; ++index) {
+      learner.Observe(typeid(LearnedTask), 1.0, -1.0);
+    }
+    EXPECT_EQ(learner.GetEffectiveManifest(typeid(LearnedTask), declared), declared);
+
+    learner.Observe(typeid(LearnedTask), 1.0, -1.0);
+    std::shared_ptr<ResourceManifest> effective = learner.GetEffectiveManifest(
+      typeid(LearnedTask), declared
+    );
+    EXPECT_NE(effective, declared);
+    EXPECT_EQ(getAmount(effective, ResourceType::CpuCores), 2U); // a quarter of 8 cores
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(ManifestLearnerTest, BusySingleCoreTasksKeepOneCore) {
+    ManifestLearner learner;
+    std::shared_ptr<ResourceManifest> declared = ResourceManifest::Create(
+      ResourceType::CpuCores, 1
+    );
+
+    // A thread that is busy all the time is still only one core, the safety margin
+    // must not turn it into two
+    for(std::size_t index = 0; index < 10; ++index) {
+      learner.Observe(typeid(LearnedTask), 0.98, -1.0);
+    }
+
+    EXPECT_EQ(learner.GetEffectiveManifest(typeid(LearnedTask), declared), declared);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(ManifestLearnerTest, MovingAverageFollowsChangedUsage) {
+    ManifestLearner learner(0.5, 0.0);
+    std::shared_ptr<ResourceManifest> declared = ResourceManifest::Create(
+      ResourceType::SystemMemory, 300
+    );
+
+    for(std::size_t index = 0; index < 50; ++index) {
+      learner.Observe(typeid(LearnedTask), 0.0, 400.0);
+    }
+    std::shared_ptr<ResourceManifest> effective = learner.GetEffectiveManifest(
+      typeid(LearnedTask), declared
+    );
+    EXPECT_NEAR(getAmount(effective, ResourceType::SystemMemory), 400U, 1U);
+
+    // The variance of the jump fades out as well, so it ends up right on the new value
+    for(std::size_t index = 0; index < 50; ++index) {
+      learner.Observe(typeid(LearnedTask), 0.0, 600.0);
+    }
+    effective = learner.GetEffectiveManifest(typeid(LearnedTask), declared);
+    EXPECT_NEAR(getAmount(effective, ResourceType::SystemMemory), 600U, 1U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(ManifestLearnerTest, AdjustedAmountsStayWithinLimits) {
+    ManifestLearner learner;
+    learner.SetResourceMaximum(ResourceType::SystemMemory, 1500);
+    std::shared_ptr<ResourceManifest> declared = ResourceManifest::Create(
+      ResourceType::CpuCores, 8, ResourceType::SystemMemory, 1000
+    );
+    declared->CpuCoresMayBeLowered = true;
+
+    for(std::size_t index = 0; index < 10; ++index) {
+      learner.Observe(typeid(LearnedTask), 64.0, 64000.0);
+    }
+
+    std::shared_ptr<ResourceManifest> effective = learner.GetEffectiveManifest(
+      typeid(LearnedTask), declared
+    );
+    EXPECT_EQ(getAmount(effective, ResourceType::CpuCores), 8U); // never above declared
+    EXPECT_EQ(getAmount(effective, ResourceType::SystemMemory), 1500U); // resource maximum
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(ManifestLearnerTest, MultiThreadedTasksKeepDeclaredCores) {
+    ManifestLearner learner;
+    std::shared_ptr<ResourceManifest> declared = ResourceManifest::Create(
+      ResourceType::CpuCores, 4
+    );
+
+    // Only the thread calling Run() is measured, so a task that spreads its work over
+    // four threads is observed as keeping a single core busy
+    for(std::size_t index = 0; index < 10; ++index) {
+      learner.Observe(typeid(LearnedTask), 1.0, -1.0);
+    }
+
+    EXPECT_EQ(learner.GetEffectiveManifest(typeid(LearnedTask), declared), declared);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(ManifestLearnerTest, TasksReusingAllocatorMemoryKeepDeclaredMemory) {
+    ManifestLearner learner;
+    std::shared_ptr<ResourceManifest> declared = ResourceManifest::Create(
+      ResourceType::CpuCores, 1, ResourceType::SystemMemory, 64 * 1024 * 1024
+    );
+
+    // Memory the allocator already holds causes no page faults when it is reused,
+    // so the task seems to touch only a few pages even though it needs all 64 MiB
+    for(std::size_t index = 0; index < 10; ++index) {
+      learner.Observe(typeid(LearnedTask), 1.0, 16384.0);
+    }
+
+    std::shared_ptr<ResourceManifest> effective = learner.GetEffectiveManifest(
+      typeid(LearnedTask), declared
+    );
+    EXPECT_EQ(getAmount(effective, ResourceType::SystemMemory), 64U * 1024U * 1024U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(ManifestLearnerTest, PeakResidentMemoryLowersOverDeclaredMemory) {
+    ManifestLearner learner;
+    std::shared_ptr<ResourceManifest> declared = ResourceManifest::Create(
+      ResourceType::SystemMemory, 1000
+    );
+
+    // The whole process never held more than 400 bytes, so no task can have used more
+    for(std::size_t index = 0; index < 10; ++index) {
+      learner.Observe(typeid(LearnedTask), 0.0, 16.0, 400.0);
+    }
+
+    std::shared_ptr<ResourceManifest> effective = learner.GetEffectiveManifest(
+      typeid(LearnedTask), declared
+    );
+    EXPECT_EQ(getAmount(effective, ResourceType::SystemMemory), 500U); // 400 + 25%
+
+    // Once the process held more than the declared amount, nothing can be reclaimed
+    learner.Observe(typeid(LearnedTask), 0.0, 16.0, 2000.0);
+    EXPECT_EQ(learner.GetEffectiveManifest(typeid(LearnedTask), declared), declared);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(ManifestLearnerTest, MemoryIsNotLoweredBelowAQuarter) {
+    ManifestLearner learner;
+    std::shared_ptr<ResourceManifest> declared = ResourceManifest::Create(
+      ResourceType::SystemMemory, 1000
+    );
+
+    for(std::size_t index = 0; index < 10; ++index) {
+      learner.Observe(typeid(LearnedTask), 0.0, 16.0, 20.0);
+    }
+
+    std::shared_ptr<ResourceManifest> effective = learner.GetEffectiveManifest(
+      typeid(LearnedTask), declared
+    );
+    EXPECT_EQ(getAmount(effective, ResourceType::SystemMemory), 250U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(ManifestLearnerTest, UndeclaredResourcesAreNotAdded) {
+    ManifestLearner learner;
+    std::shared_ptr<ResourceManifest> declared = ResourceManifest::Create(
+      ResourceType::VideoMemory, 1000
+    );
+
+    for(std::size_t index = 0; index < 10; ++index) {
+      learner.Observe(typeid(LearnedTask), 4.0, 1000000.0);
+    }
+
+    EXPECT_EQ(learner.GetEffectiveManifest(typeid(LearnedTask), declared), declared);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(ManifestLearnerTest, HardDriveMaskIsCarriedOver) {
+    ManifestLearner learner;
+    std::shared_ptr<ResourceManifest> declared = ResourceManifest::Create(
+      ResourceType::CpuCores, 4
+    );
+    declared->AccessedHardDriveMask = 5;
+    declared->CpuCoresMayBeLowered = true;
+
+    for(std::size_t index = 0; index < 10; ++index) {
+      learner.Observe(typeid(LearnedTask), 1.0, -1.0);
+    }
+
+    std::shared_ptr<ResourceManifest> effective = learner.GetEffectiveManifest(
+      typeid(LearnedTask), declared
+    );
+    EXPECT_NE(effective, declared);
+    EXPECT_EQ(effective->AccessedHardDriveMask, 5U);
+    EXPECT_EQ(learner.GetEffectiveManifest(typeid(LearnedTask), declared), effective);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(ManifestLearnerTest, LearnedValuesSurviveSerialization) {
+    std::string profile;
+    {
+      ManifestLearner learner;
+      for(std::size_t index = 0; index < 10; ++index) {
+        learner.Observe(typeid(LearnedTask), 2.0, 500.0, 1000.0);
+      }
+      profile = learner.Serialize();
+    }
+
+    ManifestLearner learner;
+    learner.Deserialize(
+      u8"garbage line\n"
+      u8"Other\tx\ty\tz\t1\t2\t3\t4\n"
+      u8"Another\t5\t1.5x\t0\t0\t0\t0\t0\n" +
+      profile
+    );
+
+    std::shared_ptr<ResourceManifest> declared = ResourceManifest::Create(
+      ResourceType::CpuCores, 2, ResourceType::SystemMemory, 500
+    );
+    std::shared_ptr<ResourceManifest> effective = learner.GetEffectiveManifest(
+      typeid(LearnedTask), declared
+    );
+    EXPECT_EQ(getAmount(effective, ResourceType::CpuCores), 2U); // never above declared
+    EXPECT_EQ(getAmount(effective, ResourceType::SystemMemory), 625U); // 500 + 25%
+
+    // The peak resident memory of the process was saved as well
+    std::shared_ptr<ResourceManifest> generous = ResourceManifest::Create(
+      ResourceType::SystemMemory, 4000
+    );
+    effective = learner.GetEffectiveManifest(typeid(LearnedTask), generous);
+    EXPECT_EQ(getAmount(effective, ResourceType::SystemMemory), 1250U); // 1000 + 25%
+
+    // Types that never ran are unaffected and the loaded values are saved again
+    EXPECT_EQ(learner.GetEffectiveManifest(typeid(OtherLearnedTask), declared), declared);
+    EXPECT_EQ(learner.Serialize(), profile);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
@@ -0,0 +1,250 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "Nuclex/Platform/Tasks/NaiveTaskCoordinatorFactory.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Creates a CPU description with the specified number of cores</summary>
+  /// <param name="coreCount">Number of cores the CPU should have</param>
+  /// <returns>The description of a CPU with the specified number of cores</returns>
+  Nuclex::Platform::Hardware::CpuInfo makeCpu(std::size_t coreCount) {
+    Nuclex::Platform::Hardware::CpuInfo cpu;
+    cpu.ModelName = u8"Test CPU";
+    cpu.CoreCount = coreCount;
+    cpu.ThreadCount = coreCount * 2;
+    return cpu;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Creates a CPU description whose cores each run two processors</summary>
+  /// <param name="firstProcessorIndex">Index of the CPU's first logical processor</param>
+  /// <param name="coreCount">Number of cores the CPU should have</param>
+  /// <param name="ecoCoreCount">Number of cores at the end that are eco cores</param>
+  /// <returns>The description of a CPU with per-core processor assignments</returns>
+  Nuclex::Platform::Hardware::CpuInfo makeSmtCpu(
+    std::size_t firstProcessorIndex, std::size_t coreCount, std::size_t ecoCoreCount = 0
+  ) {
+    Nuclex::Platform::Hardware::CpuInfo cpu = makeCpu(coreCount);
+    if(ecoCoreCount > 0) {
+      cpu.EcoCoreCount = ecoCoreCount;
+    }
+
+    cpu.Cores.resize(coreCount);
+    for(std::size_t index = 0; index < coreCount; ++index) {
+      cpu.Cores[index].FrequencyInMHz = 3000.0;
+      cpu.Cores[index].ThreadCount = 2;
+      cpu.Cores[index].ProcessorIndices.push_back(firstProcessorIndex + index * 2);
+      cpu.Cores[index].ProcessorIndices.push_back(firstProcessorIndex + index * 2 + 1);
+      if(ecoCoreCount > 0) {
+        cpu.Cores[index].IsEcoCore = (index >= coreCount - ecoCoreCount);
+      }
+    }
+
+    return cpu;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Creates a memory description with the specified amount of memory</summary>
+  /// <param name="megabytes">Amount of memory installed in the system</param>
+  /// <returns>The description of the system's memory</returns>
+  Nuclex::Platform::Hardware::MemoryInfo makeMemory(std::size_t megabytes) {
+    Nuclex::Platform::Hardware::MemoryInfo memory;
+    memory.InstalledMegabytes = megabytes;
+    memory.MaximumProgramMegabytes = megabytes;
+    memory.HugePageKilobytes = 2048;
+    memory.HugePageTotalCount = 0;
+    memory.HugePageFreeCount = 0;
+    memory.TransparentHugePages = Nuclex::Platform::Hardware::TransparentHugePageMode::Never;
+    return memory;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorFactoryTest, EachCpuBecomesOneUnit) {
+    std::vector<Hardware::CpuInfo> cpus { makeCpu(8), makeCpu(4) };
+
+    std::unique_ptr<NaiveTaskCoordinator> coordinator = (
+      NaiveTaskCoordinatorFactory::CreateFor(cpus, makeMemory(16384))
+    );
+
+    // Tasks cannot span CPUs, so the maximum is the larger CPU, not the sum
+    EXPECT_EQ(coordinator->QueryResourceMaximum(ResourceType::CpuCores), 8U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorFactoryTest, UnknownCpuTopologyStillProvidesCores) {
+    std::unique_ptr<NaiveTaskCoordinator> coordinator = (
+      NaiveTaskCoordinatorFactory::CreateFor(std::vector<Hardware::CpuInfo>(), makeMemory(4096))
+    );
+
+    EXPECT_GE(coordinator->QueryResourceMaximum(ResourceType::CpuCores), 1U);
+    EXPECT_NO_THROW(coordinator->Start());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorFactoryTest, MemoryReserveIsLeftToOperatingSystem) {
+    std::size_t usableMegabytes = (
+      NaiveTaskCoordinatorFactory::GetUsableMemory(makeMemory(16384)) / (1024 * 1024)
+    );
+    EXPECT_EQ(usableMegabytes, 16384U - 2048U);
+
+    // Reserve is capped on systems with lots of memory
+    usableMegabytes = (
+      NaiveTaskCoordinatorFactory::GetUsableMemory(makeMemory(262144)) / (1024 * 1024)
+    );
+    EXPECT_EQ(usableMegabytes, 262144U - 4096U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorFactoryTest, BudgetRemovesUnavailableProcessors) {
+    std::vector<Hardware::CpuInfo> cpus { makeSmtCpu(0, 4), makeSmtCpu(8, 4) };
+
+    Hardware::CpuBudget budget;
+    budget.AvailableProcessors = std::vector<std::size_t> { 0, 1, 2, 9, 11 };
+    budget.UsableThreadCount = 5;
+
+    std::vector<Hardware::CpuInfo> restrictedCpus = (
+      NaiveTaskCoordinatorFactory::RestrictToBudget(cpus, budget)
+    );
+
+    // Both CPUs are kept separate, each with only the cores it can still run on
+    ASSERT_EQ(restrictedCpus.size(), 2U);
+    EXPECT_EQ(restrictedCpus[0].CoreCount, 2U);
+    EXPECT_EQ(restrictedCpus[0].ThreadCount, 3U);
+    ASSERT_EQ(restrictedCpus[0].Cores.size(), 2U);
+    EXPECT_EQ(restrictedCpus[0].Cores[1].ThreadCount, 1U);
+    EXPECT_EQ(restrictedCpus[0].Cores[1].ProcessorIndices, std::vector<std::size_t> { 2 });
+    EXPECT_EQ(restrictedCpus[1].CoreCount, 2U);
+    EXPECT_EQ(restrictedCpus[1].ThreadCount, 2U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorFactoryTest, BudgetWithQuotaDropsSurplusCores) {
+    std::vector<Hardware::CpuInfo> cpus { makeSmtCpu(0, 4), makeSmtCpu(8, 4) };
+
+    Hardware::CpuBudget budget;
+    for(std::size_t index = 0; index < 16; ++index) {
+      budget.AvailableProcessors.push_back(index);
+    }
+    budget.CpuQuota = 2.5;
+    budget.UsableThreadCount = 2;
+
+    std::vector<Hardware::CpuInfo> restrictedCpus = (
+      NaiveTaskCoordinatorFactory::RestrictToBudget(cpus, budget)
+    );
+
+    ASSERT_EQ(restrictedCpus.size(), 1U);
+    EXPECT_EQ(restrictedCpus[0].CoreCount, 1U);
+    EXPECT_EQ(restrictedCpus[0].ThreadCount, 2U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorFactoryTest, BudgetKeepsCoreTypesOfHybridCpus) {
+    std::vector<Hardware::CpuInfo> cpus { makeSmtCpu(0, 6, 4) };
+
+    // Leave one p-core and two e-cores to the process
+    Hardware::CpuBudget budget;
+    budget.AvailableProcessors = std::vector<std::size_t> { 2, 3, 8, 10, 11 };
+    budget.UsableThreadCount = 5;
+
+    std::vector<Hardware::CpuInfo> restrictedCpus = (
+      NaiveTaskCoordinatorFactory::RestrictToBudget(cpus, budget)
+    );
+
+    ASSERT_EQ(restrictedCpus.size(), 1U);
+    EXPECT_EQ(restrictedCpus[0].CoreCount, 3U);
+    ASSERT_TRUE(restrictedCpus[0].EcoCoreCount.has_value());
+    EXPECT_EQ(restrictedCpus[0].EcoCoreCount.value(), 2U);
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+    // The coordinator splits the remaining cores into a p-core and an e-core unit
+    std::unique_ptr<NaiveTaskCoordinator> coordinator = (
+      NaiveTaskCoordinatorFactory::CreateFor(restrictedCpus, makeMemory(8192))
+    );
+    EXPECT_EQ(coordinator->QueryResourceMaximum(ResourceType::CpuCores), 2U);
+#endif
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorFactoryTest, EachGpuBecomesVideoMemoryUnit) {
+    std::vector<Hardware::GpuInfo> gpus(2);
+    gpus[0].VideoMemoryInMegabytes = 8192;
+    gpus[1].VideoMemoryInMegabytes = 24576;
+
+    std::unique_ptr<NaiveTaskCoordinator> coordinator = NaiveTaskCoordinatorFactory::CreateFor(
+      std::vector<Hardware::CpuInfo> { makeCpu(4) }, makeMemory(8192), gpus
+    );
+
+    EXPECT_EQ(
+      coordinator->QueryResourceMaximum(ResourceType::VideoMemory),
+      std::size_t(24576) * 1024 * 1024
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorFactoryTest, CanCreateCoordinatorForThisSystem) {
+    std::future<std::unique_ptr<NaiveTaskCoordinator>> coordinatorFuture = (
+      NaiveTaskCoordinatorFactory::CreateForThisSystem()
+    );
+
+    std::unique_ptr<NaiveTaskCoordinator> coordinator = coordinatorFuture.get();
+    ASSERT_TRUE(static_cast<bool>(coordinator));
+    EXPECT_GE(coordinator->QueryResourceMaximum(ResourceType::CpuCores), 1U);
+    EXPECT_NO_THROW(coordinator->Start());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorFactoryTest, CanCreateCoordinatorInThreadPool) {
+    Nuclex::Support::Threading::ThreadPool threadPool;
+    std::future<std::unique_ptr<NaiveTaskCoordinator>> coordinatorFuture = (
+      NaiveTaskCoordinatorFactory::CreateForThisSystem(threadPool)
+    );
+
+    std::unique_ptr<NaiveTaskCoordinator> coordinator = coordinatorFuture.get();
+    ASSERT_TRUE(static_cast<bool>(coordinator));
+    EXPECT_GE(coordinator->QueryResourceMaximum(ResourceType::CpuCores), 1U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks
@@ -21,12 +21,165 @@ limitations under the License.
 #define NUCLEX_PLATFORM_SOURCE 1
 
 #include "Nuclex/Platform/Tasks/NaiveTaskCoordinator.h"
+#include "Nuclex/Platform/Tasks/ResourceManifest.h"
+#include "Nuclex/Platform/Tasks/Task.h"
+#include "Nuclex/Platform/Tasks/TaskEnvironment.h"
+#include "Nuclex/Platform/Tasks/BlockingRegion.h"
+#include "Nuclex/Platform/Hardware/ClockInfo.h"
+#include "../../Source/Platform/LinuxThreadApi.h"
+#include "../FakeFileTree.h"
+
+#include <Nuclex/Support/Threading/Gate.h> // for Gate
 
 #include <gtest/gtest.h>
 
+#include <atomic> // for std::atomic
+#include <chrono> // for std::chrono::seconds
+#include <fstream> // for std::ifstream
+#include <iterator> // for std::istreambuf_iterator
+#include <optional> // for std::optional
+#include <thread> // for std::this_thread::sleep_for()
+#include <vector> // for std::vector
+
 namespace {
 
   // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Builds clock informations with the specified clock read cost</summary>
+  /// <param name="clockReadNanoseconds">Time a read of the steady clock takes</param>
+  /// <param name="hasInvariantTsc">Whether the time stamp counter is invariant</param>
+  /// <returns>Clock informations as they could be measured on a system</returns>
+  Nuclex::Platform::Hardware::ClockInfo makeClocks(
+    double clockReadNanoseconds, std::optional<bool> hasInvariantTsc = true
+  ) {
+    Nuclex::Platform::Hardware::ClockInfo clocks;
+    clocks.ClockSource = u8"tsc";
+    clocks.HasInvariantTsc = hasInvariantTsc;
+    clocks.ClockReadNanoseconds = clockReadNanoseconds;
+    clocks.SleepGranularityMicroseconds = 60.0;
+    return clocks;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Mock task that records the circumstances under which it was run</summary>
+  class RecordingTask : public Nuclex::Platform::Tasks::Task {
+
+    /// <summary>Initializes a new recording task</summary>
+    /// <param name="cpuCoreCount">Number of CPU cores the task will occupy</param>
+    public: RecordingTask(std::size_t cpuCoreCount = 1) :
+      WaitsInBlockingRegion(false),
+      MayFinish(true),
+      Started(false),
+      Finished(false),
+      AssignedUnits(),
+      ProcessorIndices() {
+      this->Resources = Nuclex::Platform::Tasks::ResourceManifest::Create(
+        Nuclex::Platform::Tasks::ResourceType::CpuCores, cpuCoreCount
+      );
+    }
+
+    /// <summary>Executes the task, using the specified resource units</summary>
+    /// <param name="resourceUnitIndices">
+    ///   Indices of the resource units the task coordinator has assigned this task
+    /// </param>
+    /// <param name="stopToken">
+    ///   Lets the task detect when it is requested to cancel its processing
+    /// </param>
+    public: void Run(
+      const Nuclex::Platform::Tasks::ResourceUnitArray &resourceUnitIndices,
+      const Nuclex::Support::Threading::StopToken &stopToken
+    ) noexcept override {
+      (void)stopToken;
+      this->Started.Open();
+      this->AssignedUnits = resourceUnitIndices;
+#if defined(NUCLEX_PLATFORM_LINUX)
+      this->ProcessorIndices = Nuclex::Platform::Platform::LinuxThreadApi::GetCpuAffinity();
+#endif
+      if(this->WaitsInBlockingRegion) {
+        Nuclex::Platform::Tasks::BlockingRegion waitingForPermission;
+        this->MayFinish.Wait();
+      } else {
+        this->MayFinish.Wait();
+      }
+      this->Finished.Open();
+    }
+
+    /// <summary>Whether the task waits for <see cref="MayFinish" /> in a blocking region</summary>
+    public: bool WaitsInBlockingRegion;
+    /// <summary>Can be closed to keep the task running until it is opened again</summary>
+    public: Nuclex::Support::Threading::Gate MayFinish;
+    /// <summary>Opened when the task has started running</summary>
+    public: Nuclex::Support::Threading::Gate Started;
+    /// <summary>Opened when the task has finished running</summary>
+    public: Nuclex::Support::Threading::Gate Finished;
+    /// <summary>Resource units the task coordinator assigned to the task</summary>
+    public: Nuclex::Platform::Tasks::ResourceUnitArray AssignedUnits;
+    /// <summary>Logical processors the task's thread was allowed to run on</summary>
+    public: std::vector<std::size_t> ProcessorIndices;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Mock environment that counts how often it was activated and shut down</summary>
+  class CountingEnvironment : public Nuclex::Platform::Tasks::TaskEnvironment {
+
+    /// <summary>Initializes a new counting environment</summary>
+    public: CountingEnvironment() :
+      ActivationCount(0),
+      ShutdownCount(0) {}
+
+    /// <summary>Activates the task environment</summary>
+    public: void Activate() override {
+      this->ActivationCount.fetch_add(1);
+    }
+
+    /// <summary>Shuts the task environment down</summary>
+    public: void Shutdown() override {
+      this->ShutdownCount.fetch_add(1);
+    }
+
+    /// <summary>Number of times the environment has been activated</summary>
+    public: std::atomic<std::size_t> ActivationCount;
+    /// <summary>Number of times the environment has been shut down</summary>
+    public: std::atomic<std::size_t> ShutdownCount;
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Task coordinator that reads NUMA nodes from a fake sysfs tree</summary>
+  class FakeNumaTaskCoordinator : public Nuclex::Platform::Tasks::NaiveTaskCoordinator {
+
+    /// <summary>Adds the NUMA nodes in the specified fake file tree as resource units</summary>
+    /// <param name="tree">
+    ///   Fake file tree that takes the place of /sys/devices and contains the 'proc'
+    ///   and 'cgroup' directories in place of procfs and the cgroup filesystem
+    /// </param>
+    /// <returns>The number of NUMA nodes that were added</returns>
+    public: std::size_t AddFakeNumaNodes(const Nuclex::Platform::FakeFileTree &tree) {
+      return AddNumaNodeResources(
+        tree.GetRootPath(), tree.GetPath(u8"proc"), tree.GetPath(u8"cgroup")
+      );
+    }
+
+  };
+
+  // ------------------------------------------------------------------------------------------- //
+#if defined(NUCLEX_PLATFORM_LINUX)
+  /// <summary>Builds a fake sysfs tree with two NUMA nodes of different memory size</summary>
+  /// <param name="tree">Fake file tree in which the sysfs files will be placed</param>
+  void placeTwoNumaNodes(Nuclex::Platform::FakeFileTree &tree) {
+    tree.PlaceFile(u8"system/node/node0/cpulist", u8"0-1\n");
+    tree.PlaceFile(u8"system/node/node0/meminfo", u8"Node 0 MemTotal:  4194304 kB\n");
+    tree.PlaceFile(u8"system/node/node1/cpulist", u8"2-3\n");
+    tree.PlaceFile(u8"system/node/node1/meminfo", u8"Node 1 MemTotal:  1048576 kB\n");
+    tree.PlaceFile(u8"system/node/node2/cpulist", u8"\n"); // memory expander without CPUs
+    tree.PlaceFile(u8"system/node/node2/meminfo", u8"Node 2 MemTotal:  8388608 kB\n");
+    tree.PlaceDirectory(u8"system/cpu");
+  }
+#endif // defined(NUCLEX_PLATFORM_LINUX)
   // ------------------------------------------------------------------------------------------- //
 
 } // anonymous namespace
@@ -78,4 +231,540 @@ namespace Nuclex { namespace Platform { namespace Tasks {
 
   // ------------------------------------------------------------------------------------------- //
 
+  TEST(NaiveTaskCoordinatorTest, ScheduledTasksAreExecuted) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddResource(ResourceType::CpuCores, 2);
+
+    std::shared_ptr<RecordingTask> task = std::make_shared<RecordingTask>();
+    coordinator.Schedule(task);
+    coordinator.Start();
+
+    ASSERT_TRUE(task->Finished.WaitFor(std::chrono::seconds(5)));
+    EXPECT_EQ(task->AssignedUnits[static_cast<std::size_t>(ResourceType::CpuCores)], 0U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, EnvironmentsAreActivatedWhileTheirTasksRun) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddResource(ResourceType::CpuCores, 2);
+
+    std::shared_ptr<CountingEnvironment> environment = std::make_shared<CountingEnvironment>();
+    std::shared_ptr<RecordingTask> firstTask = std::make_shared<RecordingTask>();
+    firstTask->MayFinish.Close();
+    std::shared_ptr<RecordingTask> secondTask = std::make_shared<RecordingTask>();
+    secondTask->MayFinish.Close();
+
+    coordinator.Schedule(environment, firstTask);
+    coordinator.Schedule(environment, secondTask);
+    coordinator.Start();
+
+    // Both tasks share one activation of the environment
+    ASSERT_TRUE(firstTask->Started.WaitFor(std::chrono::seconds(5)));
+    ASSERT_TRUE(secondTask->Started.WaitFor(std::chrono::seconds(5)));
+    EXPECT_EQ(environment->ActivationCount.load(), 1U);
+
+    // The environment stays active until the last task using it has ended
+    firstTask->MayFinish.Open();
+    ASSERT_TRUE(firstTask->Finished.WaitFor(std::chrono::seconds(5)));
+    EXPECT_EQ(environment->ShutdownCount.load(), 0U);
+
+    secondTask->MayFinish.Open();
+    ASSERT_TRUE(secondTask->Finished.WaitFor(std::chrono::seconds(5)));
+    for(std::size_t attempt = 0; attempt < 500; ++attempt) {
+      if(environment->ShutdownCount.load() > 0) {
+        break;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(environment->ShutdownCount.load(), 1U);
+    EXPECT_EQ(environment->ActivationCount.load(), 1U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, CpuCoreUnitsRequireProcessors) {
+    NaiveTaskCoordinator coordinator;
+    EXPECT_THROW(
+      coordinator.AddCpuCores(2, std::vector<std::size_t>()),
+      std::logic_error
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, CorePinningCannotBeChangedAfterStart) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddResource(ResourceType::CpuCores, 2);
+    coordinator.Start();
+
+    EXPECT_THROW(
+      coordinator.EnableCorePinning(),
+      std::logic_error
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+#if defined(NUCLEX_PLATFORM_LINUX)
+  TEST(NaiveTaskCoordinatorTest, PinnedTasksRunOnProcessorsOfTheirUnit) {
+    std::vector<std::size_t> allowedProcessors = Platform::LinuxThreadApi::GetCpuAffinity();
+    ASSERT_GE(allowedProcessors.size(), 1U);
+
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddCpuCores(1, std::vector<std::size_t> { allowedProcessors.back() });
+    coordinator.EnableCorePinning();
+
+    std::shared_ptr<RecordingTask> task = std::make_shared<RecordingTask>();
+    coordinator.Schedule(task);
+    coordinator.Start();
+
+    ASSERT_TRUE(task->Finished.WaitFor(std::chrono::seconds(5)));
+    ASSERT_EQ(task->ProcessorIndices.size(), 1U);
+    EXPECT_EQ(task->ProcessorIndices[0], allowedProcessors.back());
+  }
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, UnpinnedTasksKeepProcessAffinity) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddResource(ResourceType::CpuCores, 1);
+
+    std::shared_ptr<RecordingTask> task = std::make_shared<RecordingTask>();
+    coordinator.Schedule(task);
+    coordinator.Start();
+
+    ASSERT_TRUE(task->Finished.WaitFor(std::chrono::seconds(5)));
+#if defined(NUCLEX_PLATFORM_LINUX)
+    EXPECT_EQ(task->ProcessorIndices, Platform::LinuxThreadApi::GetCpuAffinity());
+#endif
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+  TEST(NaiveTaskCoordinatorTest, NumaNodesBecomeResourceUnits) {
+    FakeFileTree tree;
+    placeTwoNumaNodes(tree);
+
+    FakeNumaTaskCoordinator coordinator;
+    EXPECT_EQ(coordinator.AddFakeNumaNodes(tree), 2U);
+
+    // Of the 5 GiB on nodes with CPUs, an eighth is reserved for the operating system.
+    // Node 0 holds four fifths of the memory, so it gets four fifths of the remainder.
+    EXPECT_EQ(coordinator.QueryResourceMaximum(ResourceType::CpuCores), 2U);
+    EXPECT_EQ(
+      coordinator.QueryResourceMaximum(ResourceType::SystemMemory),
+      std::size_t(3584) * 1024 * 1024
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, CgroupMemoryLimitIsSplitAmongNumaNodes) {
+    FakeFileTree tree;
+    placeTwoNumaNodes(tree);
+    tree.PlaceFile(u8"proc/self/cgroup", u8"0::/worker\n");
+    tree.PlaceFile(u8"cgroup/memory.max", u8"max\n");
+    tree.PlaceFile(u8"cgroup/worker/memory.max", u8"1073741824\n");
+
+    FakeNumaTaskCoordinator coordinator;
+    EXPECT_EQ(coordinator.AddFakeNumaNodes(tree), 2U);
+
+    // The 1 GiB limit is far below the memory left after the reserve, so it is
+    // the limit that gets divided. Node 0 has four fifths of the memory.
+    EXPECT_EQ(
+      coordinator.QueryResourceMaximum(ResourceType::SystemMemory),
+      std::size_t(1024) * 1024 * 1024 * 4 / 5
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, TasksStayWithinOneNumaNode) {
+    FakeFileTree tree;
+    placeTwoNumaNodes(tree);
+
+    FakeNumaTaskCoordinator coordinator;
+    coordinator.AddFakeNumaNodes(tree);
+
+    // The first task is too big for node 1's memory, so both tasks together only
+    // fit if the second one goes to node 1 with *both* its CPU cores and memory.
+    std::shared_ptr<RecordingTask> bigTask = std::make_shared<RecordingTask>(2);
+    bigTask->Resources = ResourceManifest::Create(
+      ResourceType::CpuCores, 2,
+      ResourceType::SystemMemory, std::size_t(3) * 1024 * 1024 * 1024
+    );
+    std::shared_ptr<RecordingTask> smallTask = std::make_shared<RecordingTask>(1);
+    smallTask->Resources = ResourceManifest::Create(
+      ResourceType::CpuCores, 1,
+      ResourceType::SystemMemory, std::size_t(512) * 1024 * 1024
+    );
+
+    coordinator.Schedule(bigTask);
+    coordinator.Schedule(smallTask);
+    coordinator.Start();
+
+    ASSERT_TRUE(bigTask->Finished.WaitFor(std::chrono::seconds(5)));
+    ASSERT_TRUE(smallTask->Finished.WaitFor(std::chrono::seconds(5)));
+
+    const std::size_t cpuCores = static_cast<std::size_t>(ResourceType::CpuCores);
+    const std::size_t systemMemory = static_cast<std::size_t>(ResourceType::SystemMemory);
+    EXPECT_EQ(bigTask->AssignedUnits[cpuCores], 0U);
+    EXPECT_EQ(bigTask->AssignedUnits[systemMemory], 0U);
+    EXPECT_EQ(smallTask->AssignedUnits[cpuCores], smallTask->AssignedUnits[systemMemory]);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, CorePreferencesKeepTasksWithinOneNumaNode) {
+    FakeFileTree tree;
+    placeTwoNumaNodes(tree);
+
+    // Each node has one p-core and one e-core, so each gets two CPU core units
+    tree.PlaceFile(u8"cpu_core/cpus", u8"0,2\n");
+    tree.PlaceFile(u8"cpu_atom/cpus", u8"1,3\n");
+
+    FakeNumaTaskCoordinator coordinator;
+    EXPECT_EQ(coordinator.AddFakeNumaNodes(tree), 2U);
+
+    // The first task fills node 0's p-core but leaves memory on node 0, so the second
+    // task only ends up on node 1 if its memory is taken from there, too.
+    std::shared_ptr<RecordingTask> bigTask = std::make_shared<RecordingTask>(1);
+    bigTask->Resources = ResourceManifest::Create(
+      ResourceType::CpuCores, 1,
+      ResourceType::SystemMemory, std::size_t(3) * 1024 * 1024 * 1024
+    );
+    bigTask->PreferredCores = CorePreference::RequirePerformance;
+    bigTask->MayFinish.Close();
+    std::shared_ptr<RecordingTask> smallTask = std::make_shared<RecordingTask>(1);
+    smallTask->Resources = ResourceManifest::Create(
+      ResourceType::CpuCores, 1,
+      ResourceType::SystemMemory, std::size_t(256) * 1024 * 1024
+    );
+    smallTask->PreferredCores = CorePreference::RequirePerformance;
+
+    coordinator.Schedule(bigTask);
+    coordinator.Schedule(smallTask);
+    coordinator.Start();
+
+    ASSERT_TRUE(smallTask->Finished.WaitFor(std::chrono::seconds(5)));
+    bigTask->MayFinish.Open();
+    ASSERT_TRUE(bigTask->Finished.WaitFor(std::chrono::seconds(5)));
+
+    const std::size_t cpuCores = static_cast<std::size_t>(ResourceType::CpuCores);
+    const std::size_t systemMemory = static_cast<std::size_t>(ResourceType::SystemMemory);
+    EXPECT_EQ(bigTask->AssignedUnits[cpuCores], 0U);
+    EXPECT_EQ(bigTask->AssignedUnits[systemMemory], 0U);
+    EXPECT_EQ(smallTask->AssignedUnits[cpuCores], 2U); // Node 1's p-core unit
+    EXPECT_EQ(smallTask->AssignedUnits[systemMemory], 1U);
+  }
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, NumaNodesMustBeAddedFirst) {
+    FakeNumaTaskCoordinator coordinator;
+    coordinator.AddResource(ResourceType::CpuCores, 2);
+
+    EXPECT_THROW(
+      coordinator.AddNumaNodeResources(),
+      std::logic_error
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, CoreRequirementsSelectMatchingUnit) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddCpuCores(2, std::vector<std::size_t> { 0 });
+    coordinator.AddCpuCores(2, std::vector<std::size_t> { 0 }, true);
+
+    std::shared_ptr<RecordingTask> backgroundTask = std::make_shared<RecordingTask>();
+    backgroundTask->PreferredCores = CorePreference::RequireEfficiency;
+    std::shared_ptr<RecordingTask> latencyTask = std::make_shared<RecordingTask>();
+    latencyTask->PreferredCores = CorePreference::RequirePerformance;
+
+    coordinator.Schedule(backgroundTask);
+    coordinator.Schedule(latencyTask);
+    coordinator.Start();
+
+    ASSERT_TRUE(backgroundTask->Finished.WaitFor(std::chrono::seconds(5)));
+    ASSERT_TRUE(latencyTask->Finished.WaitFor(std::chrono::seconds(5)));
+
+    const std::size_t cpuCores = static_cast<std::size_t>(ResourceType::CpuCores);
+    EXPECT_EQ(backgroundTask->AssignedUnits[cpuCores], 1U);
+    EXPECT_EQ(latencyTask->AssignedUnits[cpuCores], 0U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, CorePreferenceFallsBackToOtherClass) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddCpuCores(1, std::vector<std::size_t> { 0 });
+    coordinator.AddCpuCores(1, std::vector<std::size_t> { 0 }, true);
+
+    // The first task occupies the only performance core until we let it finish
+    std::shared_ptr<RecordingTask> firstTask = std::make_shared<RecordingTask>();
+    firstTask->PreferredCores = CorePreference::PreferPerformance;
+    firstTask->MayFinish.Close();
+    std::shared_ptr<RecordingTask> secondTask = std::make_shared<RecordingTask>();
+    secondTask->PreferredCores = CorePreference::PreferPerformance;
+
+    coordinator.Schedule(firstTask);
+    coordinator.Schedule(secondTask);
+    coordinator.Start();
+
+    ASSERT_TRUE(secondTask->Finished.WaitFor(std::chrono::seconds(5)));
+    firstTask->MayFinish.Open();
+    ASSERT_TRUE(firstTask->Finished.WaitFor(std::chrono::seconds(5)));
+
+    const std::size_t cpuCores = static_cast<std::size_t>(ResourceType::CpuCores);
+    EXPECT_EQ(firstTask->AssignedUnits[cpuCores], 0U);
+    EXPECT_EQ(secondTask->AssignedUnits[cpuCores], 1U);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, CoreRequirementsAreIgnoredWithoutHybridCpu) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddResource(ResourceType::CpuCores, 2);
+
+    std::shared_ptr<RecordingTask> task = std::make_shared<RecordingTask>();
+    task->PreferredCores = CorePreference::RequireEfficiency;
+    coordinator.Schedule(task);
+    coordinator.Start();
+
+    EXPECT_TRUE(task->Finished.WaitFor(std::chrono::seconds(5)));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, RunningTasksAreLimitedByThreadCount) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddResource(ResourceType::CpuCores, 1);
+
+    // The first task needs no CPU cores, but still occupies the only task thread
+    std::shared_ptr<RecordingTask> waitingTask = std::make_shared<RecordingTask>(0);
+    waitingTask->MayFinish.Close();
+    std::shared_ptr<RecordingTask> computingTask = std::make_shared<RecordingTask>();
+
+    coordinator.Schedule(waitingTask);
+    coordinator.Schedule(computingTask);
+    coordinator.Start();
+
+    EXPECT_FALSE(computingTask->Finished.WaitFor(std::chrono::milliseconds(100)));
+    waitingTask->MayFinish.Open();
+    EXPECT_TRUE(computingTask->Finished.WaitFor(std::chrono::seconds(5)));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, BlockedTasksLetOtherTasksRun) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddResource(ResourceType::CpuCores, 2);
+
+    // Both tasks need every CPU core, so the second one can only run while
+    // the first one has handed its CPU cores back in the blocking region
+    std::shared_ptr<RecordingTask> waitingTask = std::make_shared<RecordingTask>(2);
+    waitingTask->WaitsInBlockingRegion = true;
+    waitingTask->MayFinish.Close();
+    std::shared_ptr<RecordingTask> computingTask = std::make_shared<RecordingTask>(2);
+
+    coordinator.Schedule(waitingTask);
+    coordinator.Schedule(computingTask);
+    coordinator.Start();
+
+    EXPECT_TRUE(computingTask->Finished.WaitFor(std::chrono::seconds(5)));
+    waitingTask->MayFinish.Open();
+    EXPECT_TRUE(waitingTask->Finished.WaitFor(std::chrono::seconds(5)));
+
+    // All CPU cores must be back in the budget, neither lost nor counted twice
+    std::shared_ptr<RecordingTask> laterTask = std::make_shared<RecordingTask>(2);
+    coordinator.Schedule(laterTask);
+    EXPECT_TRUE(laterTask->Finished.WaitFor(std::chrono::seconds(5)));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, TasksLeavingBlockingRegionsMayOvercommit) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddResource(ResourceType::CpuCores, 2);
+
+    std::shared_ptr<RecordingTask> waitingTask = std::make_shared<RecordingTask>(2);
+    waitingTask->WaitsInBlockingRegion = true;
+    waitingTask->MayFinish.Close();
+    std::shared_ptr<RecordingTask> computingTask = std::make_shared<RecordingTask>(2);
+    computingTask->MayFinish.Close();
+
+    coordinator.Schedule(waitingTask);
+    coordinator.Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    coordinator.Schedule(computingTask);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // The waiting task leaves its blocking region while the computing task holds
+    // the CPU cores. It must not wait for them, but finish without returning them.
+    waitingTask->MayFinish.Open();
+    EXPECT_TRUE(waitingTask->Finished.WaitFor(std::chrono::seconds(5)));
+    computingTask->MayFinish.Open();
+    EXPECT_TRUE(computingTask->Finished.WaitFor(std::chrono::seconds(5)));
+
+    std::shared_ptr<RecordingTask> laterTask = std::make_shared<RecordingTask>(2);
+    coordinator.Schedule(laterTask);
+    EXPECT_TRUE(laterTask->Finished.WaitFor(std::chrono::seconds(5)));
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, UsageAccountingSummarizesTasksByType) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddResource(ResourceType::CpuCores, 2);
+    coordinator.EnableUsageAccounting();
+    coordinator.Start();
+
+    for(std::size_t index = 0; index < 3; ++index) {
+      std::shared_ptr<RecordingTask> task = std::make_shared<RecordingTask>();
+      coordinator.Schedule(task);
+      ASSERT_TRUE(task->Finished.WaitFor(std::chrono::seconds(5)));
+    }
+
+    // The measurement is recorded after the task's Run() method returns, so give
+    // the coordinator's thread a moment to catch up with the last task
+    std::vector<TaskUsageSummary> summaries;
+    for(std::size_t attempt = 0; attempt < 500; ++attempt) {
+      summaries = coordinator.SummarizeTaskUsage();
+      if((summaries.size() == 1) && (summaries[0].RunCount == 3)) {
+        break;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ASSERT_EQ(summaries.size(), 1U);
+    EXPECT_EQ(summaries[0].RunCount, 3U);
+    EXPECT_NE(summaries[0].TaskTypeName.find(u8"RecordingTask"), std::string::npos);
+    EXPECT_EQ(summaries[0].DeclaredCpuCores, 1U);
+    EXPECT_GE(summaries[0].AverageWallSeconds, summaries[0].AverageCpuSeconds * 0.9);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+#if defined(NUCLEX_PLATFORM_LINUX)
+  TEST(NaiveTaskCoordinatorTest, LearnedManifestsCanBeSavedAndLoaded) {
+    FakeFileTree tree;
+    std::string profilePath = tree.GetPath(u8"learned-manifests.txt");
+    {
+      NaiveTaskCoordinator coordinator;
+      coordinator.AddResource(ResourceType::CpuCores, 2);
+      coordinator.EnableManifestLearning();
+      coordinator.Start();
+
+      for(std::size_t index = 0; index < 3; ++index) {
+        std::shared_ptr<RecordingTask> task = std::make_shared<RecordingTask>();
+        coordinator.Schedule(task);
+        ASSERT_TRUE(task->Finished.WaitFor(std::chrono::seconds(5)));
+      }
+
+      // The observation is made after the task's Run() method returns, so keep saving
+      // until the coordinator's thread has caught up with the last task
+      bool wasSaved = false;
+      for(std::size_t attempt = 0; attempt < 500; ++attempt) {
+        coordinator.SaveLearnedManifests(profilePath);
+
+        std::ifstream profileFile(profilePath);
+        std::string profile(
+          (std::istreambuf_iterator<char>(profileFile)), std::istreambuf_iterator<char>()
+        );
+        wasSaved = (profile.find(u8"RecordingTask\t3\t") != std::string::npos);
+        if(wasSaved) {
+          break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+      EXPECT_TRUE(wasSaved);
+    }
+
+    NaiveTaskCoordinator coordinator;
+    EXPECT_TRUE(coordinator.LoadLearnedManifests(profilePath));
+    EXPECT_FALSE(coordinator.LoadLearnedManifests(tree.GetPath(u8"does-not-exist.txt")));
+  }
+#endif // defined(NUCLEX_PLATFORM_LINUX)
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, WakeStrategyDefaultsToBlocking) {
+    NaiveTaskCoordinator coordinator;
+    EXPECT_EQ(coordinator.GetWakeStrategy(), WakeStrategy::Block);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, WakeStrategyDependsOnClockCost) {
+    EXPECT_EQ(NaiveTaskCoordinator::ChooseWakeStrategy(makeClocks(20.0), 8), WakeStrategy::Spin);
+    EXPECT_EQ(NaiveTaskCoordinator::ChooseWakeStrategy(makeClocks(20.0), 2), WakeStrategy::Yield);
+    EXPECT_EQ(NaiveTaskCoordinator::ChooseWakeStrategy(makeClocks(20.0), 1), WakeStrategy::Block);
+    EXPECT_EQ(NaiveTaskCoordinator::ChooseWakeStrategy(makeClocks(500.0), 8), WakeStrategy::Yield);
+    EXPECT_EQ(NaiveTaskCoordinator::ChooseWakeStrategy(makeClocks(2000.0), 8), WakeStrategy::Block);
+    EXPECT_EQ(
+      NaiveTaskCoordinator::ChooseWakeStrategy(makeClocks(20.0, false), 8), WakeStrategy::Yield
+    );
+    EXPECT_EQ(
+      NaiveTaskCoordinator::ChooseWakeStrategy(makeClocks(20.0, std::optional<bool>()), 8),
+      WakeStrategy::Spin
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, WakeStrategyIsAdaptedToCpuCores) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddResource(ResourceType::CpuCores, 1);
+    coordinator.AdaptWakeStrategy(makeClocks(20.0));
+    EXPECT_EQ(coordinator.GetWakeStrategy(), WakeStrategy::Block);
+
+    coordinator.AddResource(ResourceType::CpuCores, 4);
+    coordinator.AdaptWakeStrategy(makeClocks(20.0));
+    EXPECT_EQ(coordinator.GetWakeStrategy(), WakeStrategy::Spin);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, WakeStrategyCannotBeChangedAfterStart) {
+    NaiveTaskCoordinator coordinator;
+    coordinator.AddResource(ResourceType::CpuCores, 2);
+    coordinator.Start();
+
+    EXPECT_THROW(
+      coordinator.SetWakeStrategy(WakeStrategy::Spin),
+      std::logic_error
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, PollingCoordinatorsExecuteTasks) {
+    const WakeStrategy strategies[] = { WakeStrategy::Yield, WakeStrategy::Spin };
+    for(WakeStrategy strategy : strategies) {
+      NaiveTaskCoordinator coordinator;
+      coordinator.AddResource(ResourceType::CpuCores, 2);
+      coordinator.SetWakeStrategy(strategy, std::chrono::microseconds(100));
+      coordinator.Start();
+
+      // Schedule the tasks one after another so the coordinator is polling each time
+      for(std::size_t index = 0; index < 3; ++index) {
+        std::shared_ptr<RecordingTask> task = std::make_shared<RecordingTask>();
+        coordinator.Schedule(task);
+        ASSERT_TRUE(task->Finished.WaitFor(std::chrono::seconds(5)));
+      }
+    }
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(NaiveTaskCoordinatorTest, BlockingRegionsOutsideOfTasksAreIgnored) {
+    EXPECT_NO_THROW(
+      BlockingRegion notInATask;
+      BlockingRegion nested;
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
 }}} // namespace Nuclex::Platform::Tasks
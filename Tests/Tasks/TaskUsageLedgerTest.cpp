@@ -0,0 +1,181 @@
+#pragma region Apache License 2.0
+/*
+Nuclex Native Framework
+Copyright (C) 2002-2024 Markus Ewald / Nuclex Development Labs
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#pragma endregion // Apache License 2.0
+
+// If the library is compiled as a DLL, this ensures symbols are exported
+#define NUCLEX_PLATFORM_SOURCE 1
+
+#include "../../Source/Tasks/TaskUsageLedger.h"
+#include "Nuclex/Platform/Tasks/ResourceManifest.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Type used to tell the ledger's entries apart</summary>
+  class FirstKindOfTask {};
+
+  /// <summary>Another type used to tell the ledger's entries apart</summary>
+  class SecondKindOfTask {};
+
+  // ------------------------------------------------------------------------------------------- //
+
+  /// <summary>Builds counters as if a thread had used the specified resources</summary>
+  /// <param name="milliseconds">Milliseconds that passed since an arbitrary start</param>
+  /// <param name="cpuMilliseconds">Processor time used since the start</param>
+  /// <param name="pageFaults">Page faults caused since the start</param>
+  /// <returns>Counters with the specified values</returns>
+  Nuclex::Platform::Tasks::ThreadUsageCounters makeCounters(
+    std::size_t milliseconds, std::size_t cpuMilliseconds, std::size_t pageFaults
+  ) {
+    Nuclex::Platform::Tasks::ThreadUsageCounters counters;
+    counters.Time = (
+      std::chrono::steady_clock::time_point() + std::chrono::milliseconds(milliseconds)
+    );
+    counters.CpuNanoseconds = cpuMilliseconds * 1000000ULL;
+    counters.PageFaultCount = pageFaults;
+    counters.BytesRead = milliseconds * 10;
+    counters.BytesWritten = milliseconds * 20;
+    return counters;
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+} // anonymous namespace
+
+namespace Nuclex { namespace Platform { namespace Tasks {
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(TaskUsageLedgerTest, EmptyLedgerHasNoSummaries) {
+    TaskUsageLedger ledger;
+    EXPECT_TRUE(ledger.Summarize().empty());
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(TaskUsageLedgerTest, RunsAreGroupedByTaskType) {
+    TaskUsageLedger ledger;
+    std::shared_ptr<ResourceManifest> manifest = ResourceManifest::Create(
+      ResourceType::CpuCores, 2, ResourceType::SystemMemory, 1024 * 1024
+    );
+
+    ledger.Record(
+      typeid(FirstKindOfTask), manifest.get(), makeCounters(0, 0, 0), makeCounters(100, 50, 0)
+    );
+    ledger.Record(
+      typeid(FirstKindOfTask), manifest.get(), makeCounters(0, 0, 0), makeCounters(300, 250, 0)
+    );
+    ledger.Record(
+      typeid(SecondKindOfTask), nullptr, makeCounters(0, 0, 0), makeCounters(100, 100, 0)
+    );
+
+    std::vector<TaskUsageSummary> summaries = ledger.Summarize();
+    ASSERT_EQ(summaries.size(), 2U);
+
+    const TaskUsageSummary &first = summaries[0];
+    EXPECT_NE(first.TaskTypeName.find(u8"FirstKindOfTask"), std::string::npos);
+    EXPECT_EQ(first.RunCount, 2U);
+    EXPECT_DOUBLE_EQ(first.AverageWallSeconds, 0.2);
+    EXPECT_DOUBLE_EQ(first.AverageCpuSeconds, 0.15);
+    EXPECT_DOUBLE_EQ(first.AverageCoresUsed, 0.75);
+    EXPECT_EQ(first.DeclaredCpuCores, 2U);
+    EXPECT_EQ(first.DeclaredSystemMemory, 1024U * 1024U);
+    EXPECT_EQ(first.CpuFit, ManifestFit::Unknown); // two cores, may use helper threads
+    EXPECT_EQ(first.AverageBytesRead, 2000U);
+    EXPECT_EQ(first.AverageBytesWritten, 4000U);
+
+    const TaskUsageSummary &second = summaries[1];
+    EXPECT_NE(second.TaskTypeName.find(u8"SecondKindOfTask"), std::string::npos);
+    EXPECT_EQ(second.RunCount, 1U);
+    EXPECT_EQ(second.DeclaredCpuCores, 0U);
+    EXPECT_EQ(second.CpuFit, ManifestFit::UnderDeclared);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(TaskUsageLedgerTest, CpuFitComparesCoresUsedToDeclaration) {
+    EXPECT_EQ(TaskUsageLedger::JudgeCpuFit(0.9, 1), ManifestFit::Accurate);
+    EXPECT_EQ(TaskUsageLedger::JudgeCpuFit(0.2, 1), ManifestFit::OverDeclared);
+    EXPECT_EQ(TaskUsageLedger::JudgeCpuFit(1.9, 1), ManifestFit::UnderDeclared);
+    EXPECT_EQ(TaskUsageLedger::JudgeCpuFit(0.1, 0), ManifestFit::Accurate);
+    EXPECT_EQ(TaskUsageLedger::JudgeCpuFit(1.0, 0), ManifestFit::UnderDeclared);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(TaskUsageLedgerTest, MultiCoreTasksAreOnlyJudgedIfTheyRunInOneThread) {
+    EXPECT_EQ(TaskUsageLedger::JudgeCpuFit(1.0, 4), ManifestFit::Unknown);
+    EXPECT_EQ(TaskUsageLedger::JudgeCpuFit(1.0, 4, true), ManifestFit::OverDeclared);
+    EXPECT_EQ(TaskUsageLedger::JudgeCpuFit(1.8, 2, true), ManifestFit::Accurate);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(TaskUsageLedgerTest, MemoryFitComparesTouchedMemoryToDeclaration) {
+    const std::size_t MiB = 1024 * 1024;
+    EXPECT_EQ(
+      TaskUsageLedger::JudgeMemoryFit(90 * MiB, 300 * MiB, 100 * MiB), ManifestFit::Accurate
+    );
+    EXPECT_EQ(
+      TaskUsageLedger::JudgeMemoryFit(20 * MiB, 40 * MiB, 100 * MiB), ManifestFit::OverDeclared
+    );
+    EXPECT_EQ(
+      TaskUsageLedger::JudgeMemoryFit(120 * MiB, 300 * MiB, 100 * MiB), ManifestFit::UnderDeclared
+    );
+    EXPECT_EQ(TaskUsageLedger::JudgeMemoryFit(2 * MiB, 0, 0), ManifestFit::Accurate);
+    EXPECT_EQ(TaskUsageLedger::JudgeMemoryFit(60 * MiB, 0, 0), ManifestFit::UnderDeclared);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(TaskUsageLedgerTest, FewPageFaultsDoNotMakeMemoryOverDeclared) {
+    const std::size_t MiB = 1024 * 1024;
+
+    // A task reusing allocator memory or faulting in huge pages causes few page faults,
+    // which says nothing about how much memory it really used
+    EXPECT_EQ(
+      TaskUsageLedger::JudgeMemoryFit(1 * MiB, 0, 100 * MiB), ManifestFit::Unknown
+    );
+    EXPECT_EQ(
+      TaskUsageLedger::JudgeMemoryFit(1 * MiB, 500 * MiB, 100 * MiB), ManifestFit::Accurate
+    );
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+  TEST(TaskUsageLedgerTest, CountersOfCallingThreadCanBeSampled) {
+    ThreadUsageCounters before, after;
+    ThreadUsageCounters::Sample(before);
+
+    volatile std::size_t counter = 0;
+    for(std::size_t index = 0; index < 1000000; ++index) {
+      counter = counter + index;
+    }
+
+    ThreadUsageCounters::Sample(after);
+    EXPECT_GE(after.Time, before.Time);
+    EXPECT_GE(after.CpuNanoseconds, before.CpuNanoseconds);
+    EXPECT_GE(after.PageFaultCount, before.PageFaultCount);
+  }
+
+  // ------------------------------------------------------------------------------------------- //
+
+}}} // namespace Nuclex::Platform::Tasks